@@ -0,0 +1,125 @@
+#include <Ocean/Primitives/AllocatorPolicy.hpp>
+#include <Ocean/Primitives/DynamicArray.hpp>
+#include <Ocean/Primitives/Memory.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+static constexpr u32 k_Rounds = 2000000;
+static constexpr u32 k_Elements = 4;
+static constexpr u32 k_Nodes = 64;
+
+/**
+ * @brief A 32 byte node, the size of a small list or tree node.
+ */
+struct BenchmarkNode {
+    BenchmarkNode* next;
+    u64 payload[3];
+
+};  // BenchmarkNode
+
+/**
+ * @brief Hides the allocator behind a pointer the compiler cannot see through, so every call stays a virtual call.
+ */
+static Allocator* Opaque(Allocator* allocator) {
+    BenchmarkKeep(allocator);
+
+    return allocator;
+}
+
+/**
+ * @brief Builds and destroys a small DynamicArray per round, the pattern of a temporary array in a tight loop.
+ * Measured per array, so the allocation and free dominate.
+ *
+ * @param reset Called once per round to give the memory back, i.e. clearing a linear allocator.
+ */
+template <class A, class R>
+static double ArrayWorkload(const A& allocator, R&& reset) {
+    return BenchmarkTime([&]() {
+        for (u32 round = 0; round < k_Rounds; round++) {
+            {
+                DynamicArray<u32, A> array(k_Elements, allocator);
+
+                for (u32 i = 0; i < k_Elements; i++)
+                    array.PushBack(i + round);
+
+                BenchmarkKeep(array.Back());
+            }
+
+            reset();
+        }
+    });
+}
+
+/**
+ * @brief Allocates a chain of nodes and frees it again, the pattern of a node based container.
+ */
+template <class A>
+static double NodeWorkload(A allocator) {
+    return BenchmarkTime([&]() {
+        for (u32 round = 0; round < k_Rounds / 32; round++) {
+            BenchmarkNode* head = nullptr;
+
+            for (u32 i = 0; i < k_Nodes; i++) {
+                BenchmarkNode* node = oallocat(BenchmarkNode, 1, &allocator);
+                node->next = head;
+                node->payload[0] = i;
+
+                head = node;
+            }
+
+            BenchmarkKeep(head->payload[0]);
+
+            while (head) {
+                BenchmarkNode* next = head->next;
+                ofree(head, &allocator);
+
+                head = next;
+            }
+        }
+    });
+}
+
+BENCHMARK_CASE(AllocatorPolicy_Linear_DynamicArray) {
+    LinearAllocator linear;
+    linear.Init(omega(1));
+
+    const double operations = static_cast<double>(k_Rounds);
+
+    const double virtualSeconds = ArrayWorkload(AllocatorRef<Allocator>(Opaque(&linear)), [&]() { linear.Clear(); });
+    const double inlinedSeconds = ArrayWorkload(AllocatorRef<LinearAllocator>(&linear), [&]() { linear.Clear(); });
+
+    BENCHMARK_REPORT("linear arrays, virtual dispatch", operations, virtualSeconds);
+    BENCHMARK_REPORT("linear arrays, inlined policy", operations, inlinedSeconds);
+
+    linear.Shutdown();
+}
+
+BENCHMARK_CASE(AllocatorPolicy_Malloc_DynamicArray) {
+    MallocAllocator system;
+
+    const double operations = static_cast<double>(k_Rounds);
+
+    // Warm up malloc's caches, so the first measurement is not charged for them.
+    ArrayWorkload(MallocPolicy(), []() { });
+
+    const double virtualSeconds = ArrayWorkload(AllocatorRef<Allocator>(Opaque(&system)), []() { });
+    const double inlinedSeconds = ArrayWorkload(MallocPolicy(), []() { });
+
+    BENCHMARK_REPORT("malloc arrays, virtual dispatch", operations, virtualSeconds);
+    BENCHMARK_REPORT("malloc arrays, inlined policy", operations, inlinedSeconds);
+}
+
+BENCHMARK_CASE(AllocatorPolicy_Pool_Nodes) {
+    PoolAllocator pool;
+    pool.Init(sizeof(BenchmarkNode), k_Nodes, alignof(BenchmarkNode));
+
+    const double operations = static_cast<double>(k_Rounds / 32) * k_Nodes;
+
+    const double virtualSeconds = NodeWorkload(AllocatorRef<Allocator>(Opaque(&pool)));
+    const double inlinedSeconds = NodeWorkload(AllocatorRef<PoolAllocator>(&pool));
+
+    BENCHMARK_REPORT("pool nodes, virtual dispatch", operations, virtualSeconds);
+    BENCHMARK_REPORT("pool nodes, inlined policy", operations, inlinedSeconds);
+
+    pool.Shutdown();
+}
@@ -0,0 +1,42 @@
+#include "Benchmarks.hpp"
+
+// std
+#include <cstdio>
+#include <iostream>
+
+bool BenchmarkFactory::Register(std::string name, std::function<void()> func) {
+    auto it = Benchmarks().find(name);
+
+    if (it == Benchmarks().end()) {
+        Benchmarks()[name] = std::move(func);
+        return true;
+    }
+
+    return false;
+}
+
+void BenchmarkFactory::Run() {
+    std::cerr << "\n========================================\n";
+    std::cerr << "Ocean Benchmark Output:\n";
+
+    for (const auto& func : Benchmarks()) {
+        std::cerr << "\tRunning Benchmark: " << func.first << std::endl;
+
+        func.second();
+    }
+
+    std::cerr << "========================================\n";
+    std::cerr << std::endl;
+}
+
+void BenchmarkFactory::Report(const std::string& label, double operations, double seconds) {
+    fprintf(stderr, "\t\t%-48s %10.2f ms %10.2f ns/op %10.2f Mop/s\n", label.c_str(), seconds * 1000.0, seconds * 1e9 / operations, operations / seconds / 1e6);
+}
+
+std::map<std::string, std::function<void()>>& BenchmarkFactory::Benchmarks() {
+    static std::map<std::string, std::function<void()>> benchmarks;
+
+    return benchmarks;
+}
+
+MAIN { RUN_BENCHMARKS(); }
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <map>
+#include <iostream>
+
+class BenchmarkFactory {
+public:
+    static bool Register(std::string name, std::function<void()> func);
+
+    static void Run();
+
+    /**
+     * @brief Prints a single measurement of a benchmark.
+     * 
+     * @param label The name of the measurement.
+     * @param operations The number of operations that were timed.
+     * @param seconds The time taken in seconds.
+     */
+    static void Report(const std::string& label, double operations, double seconds);
+
+private:
+    /**
+     * @brief Gets the registered benchmarks. A function local static so registration does not depend on the static initialization order.
+     * 
+     * @return std::map<std::string, std::function<void()>>& 
+     */
+    static std::map<std::string, std::function<void()>>& Benchmarks();
+
+};
+
+/**
+ * @brief Times the given function with a monotonic wall clock.
+ * 
+ * @param func The function to time.
+ * @return double - The elapsed time in seconds.
+ */
+template <class F>
+double BenchmarkTime(F&& func) {
+    const auto start = std::chrono::steady_clock::now();
+
+    func();
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Keeps the compiler from optimizing away a value that is only computed for a benchmark.
+ */
+template <class T>
+inline void BenchmarkKeep(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#define BENCHMARK_CASE(name) \
+    void benchmark_##name (void); \
+    static bool benchmark_##name##_registered = BenchmarkFactory::Register(#name, &benchmark_##name); \
+    void benchmark_##name (void)
+
+#define BENCHMARK_REPORT(label, operations, seconds) \
+    BenchmarkFactory::Report((label), (operations), (seconds))
+
+#define RUN_BENCHMARKS() \
+    BenchmarkFactory::Run()
+
+#define MAIN \
+    int main(int argc, char** argv)
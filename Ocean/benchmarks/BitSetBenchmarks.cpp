@@ -0,0 +1,224 @@
+#include <Ocean/Primitives/BitSet.hpp>
+#include <Ocean/Primitives/BitVector.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <algorithm>
+#include <bitset>
+#include <memory>
+#include <random>
+#include <vector>
+
+static constexpr sizet k_Bits = 1 << 20;
+static constexpr u32 k_Passes = 64;
+
+BENCHMARK_CASE(BitSet_Bulk_And_Count) {
+    // Intersecting two masks and counting the result, the inner step of set based culling and matching.
+    std::mt19937_64 random(1);
+
+    {
+        auto a = std::make_unique<std::bitset<k_Bits>>();
+        auto b = std::make_unique<std::bitset<k_Bits>>();
+
+        for (sizet i = 0; i < k_Bits; i++) {
+            (*a)[i] = random() & 1;
+            (*b)[i] = random() & 1;
+        }
+
+        const double seconds = BenchmarkTime([&]() {
+            sizet count = 0;
+
+            for (u32 pass = 0; pass < k_Passes; pass++) {
+                *a &= *b;
+                count += a->count();
+                a->flip();
+            }
+
+            BenchmarkKeep(count);
+        });
+
+        BENCHMARK_REPORT("std::bitset and, count and flip (bits)", k_Bits * k_Passes, seconds);
+    }
+
+    {
+        auto a = std::make_unique<BitSet<k_Bits>>();
+        auto b = std::make_unique<BitSet<k_Bits>>();
+
+        for (sizet i = 0; i < k_Bits; i++) {
+            a->Set(i, random() & 1);
+            b->Set(i, random() & 1);
+        }
+
+        const double seconds = BenchmarkTime([&]() {
+            sizet count = 0;
+
+            for (u32 pass = 0; pass < k_Passes; pass++) {
+                *a &= *b;
+                count += a->Count();
+                a->Flip();
+            }
+
+            BenchmarkKeep(count);
+        });
+
+        BENCHMARK_REPORT("BitSet and, count and flip (bits)", k_Bits * k_Passes, seconds);
+    }
+
+    {
+        std::vector<bool> a(k_Bits);
+        std::vector<bool> b(k_Bits);
+
+        for (sizet i = 0; i < k_Bits; i++) {
+            a[i] = random() & 1;
+            b[i] = random() & 1;
+        }
+
+        // std::vector<bool> has no bulk operations, so it goes a bit at a time.
+        //
+        const double seconds = BenchmarkTime([&]() {
+            sizet count = 0;
+
+            for (u32 pass = 0; pass < k_Passes / 16; pass++) {
+                for (sizet i = 0; i < k_Bits; i++)
+                    a[i] = a[i] && b[i];
+
+                count += std::count(a.begin(), a.end(), true);
+                a.flip();
+            }
+
+            BenchmarkKeep(count);
+        });
+
+        BENCHMARK_REPORT("std::vector<bool> and, count and flip (bits)", k_Bits * (k_Passes / 16), seconds);
+    }
+
+    {
+        BitVector<> a(k_Bits);
+        BitVector<> b(k_Bits);
+
+        for (sizet i = 0; i < k_Bits; i++) {
+            a.Set(i, random() & 1);
+            b.Set(i, random() & 1);
+        }
+
+        const double seconds = BenchmarkTime([&]() {
+            sizet count = 0;
+
+            for (u32 pass = 0; pass < k_Passes; pass++) {
+                a &= b;
+                count += a.Count();
+                a.Flip();
+            }
+
+            BenchmarkKeep(count);
+        });
+
+        BENCHMARK_REPORT("BitVector and, count and flip (bits)", k_Bits * k_Passes, seconds);
+    }
+}
+
+BENCHMARK_CASE(BitSet_Iterate_Set_Bits) {
+    // Visiting the few live entries of a large occupancy mask, one bit in a hundred is set.
+    std::mt19937_64 random(2);
+
+    std::vector<bool> flags(k_Bits);
+    BitVector<> bits(k_Bits);
+    auto fixed = std::make_unique<std::bitset<k_Bits>>();
+
+    for (sizet i = 0; i < k_Bits; i++) {
+        if (random() % 100 == 0) {
+            flags[i] = true;
+            bits.Set(i);
+            fixed->set(i);
+        }
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet sum = 0;
+
+            for (u32 pass = 0; pass < k_Passes; pass++)
+                for (sizet i = 0; i < k_Bits; i++)
+                    if (flags[i])
+                        sum += i;
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("std::vector<bool> scan for set bits (bits)", k_Bits * k_Passes, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet sum = 0;
+
+            for (u32 pass = 0; pass < k_Passes; pass++)
+                for (sizet i = 0; i < k_Bits; i++)
+                    if (fixed->test(i))
+                        sum += i;
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("std::bitset scan for set bits (bits)", k_Bits * k_Passes, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet sum = 0;
+
+            for (u32 pass = 0; pass < k_Passes; pass++)
+                bits.ForEachSet([&](sizet i) { sum += i; });
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("BitVector ForEachSet (bits)", k_Bits * k_Passes, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet sum = 0;
+
+            for (u32 pass = 0; pass < k_Passes; pass++)
+                for (sizet i = bits.FindFirst(); i < bits.Size(); i = bits.FindNext(i + 1))
+                    sum += i;
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("BitVector FindNext (bits)", k_Bits * k_Passes, seconds);
+    }
+}
+
+BENCHMARK_CASE(BitSet_Rank_Select) {
+    // Mapping between positions in a sparse mask and indexes into a packed array of its entries.
+    constexpr u32 k_Queries = 1 << 16;
+    constexpr sizet k_SelectBits = 1 << 12;
+
+    std::mt19937_64 random(3);
+
+    BitSet<k_SelectBits> bits;
+    for (sizet i = 0; i < k_SelectBits; i++)
+        bits.Set(i, random() % 4 == 0);
+
+    const sizet count = bits.Count();
+
+    std::vector<sizet> queries(k_Queries);
+    for (sizet& query : queries)
+        query = random() % count;
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet sum = 0;
+
+            for (sizet query : queries)
+                sum += bits.Rank(bits.Select(query));
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("BitSet<4096> select then rank", k_Queries, seconds);
+    }
+}
@@ -0,0 +1,230 @@
+#include <Ocean/Types/Bitrix3D.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <cmath>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+static constexpr i32 k_Side = 512;
+static constexpr u32 k_Queries = 1 << 20;
+static constexpr u32 k_Rays = 1 << 14;
+static constexpr f32 k_RayLength = 800.0f;
+
+/**
+ * @return i32 - The height of the terrain at a column, between 16 and 112.
+ */
+static i32 TerrainHeight(i32 x, i32 z) {
+    return 64 + static_cast<i32>(32.0 * std::sin(x / 40.0) * std::cos(z / 55.0) + 16.0 * std::sin((x + z) / 17.0));
+}
+
+/**
+ * @return u64 - A position packed into the key of the hashed voxel set.
+ */
+static u64 VoxelKey(i32 x, i32 y, i32 z) {
+    return static_cast<u64>(static_cast<u32>(x) & 0xfffff) | static_cast<u64>(static_cast<u32>(y) & 0xfffff) << 20 |
+           static_cast<u64>(static_cast<u32>(z) & 0xfffff) << 40;
+}
+
+/**
+ * @brief Random positions in the terrain's box, with a fixed seed so both volumes see the same queries.
+ */
+static std::vector<i32> RandomPositions(u32 count, u64 seed) {
+    std::mt19937_64 random(seed);
+    std::vector<i32> positions(count * 3);
+
+    for (u32 i = 0; i < count; i++) {
+        positions[i * 3 + 0] = static_cast<i32>(random() % k_Side);
+        positions[i * 3 + 1] = static_cast<i32>(random() % 128);
+        positions[i * 3 + 2] = static_cast<i32>(random() % k_Side);
+    }
+
+    return positions;
+}
+
+BENCHMARK_CASE(Bitrix3D_Terrain) {
+    // A solid terrain of 512x512 columns, the occupied space of a large world is mostly its ground.
+    sizet voxels = 0;
+    for (i32 z = 0; z < k_Side; z++)
+        for (i32 x = 0; x < k_Side; x++)
+            voxels += TerrainHeight(x, z);
+
+    std::unordered_set<u64> hashed;
+    Bitrix3D volume;
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            hashed.reserve(voxels);
+
+            for (i32 z = 0; z < k_Side; z++)
+                for (i32 x = 0; x < k_Side; x++)
+                    for (i32 y = 0; y < TerrainHeight(x, z); y++)
+                        hashed.insert(VoxelKey(x, y, z));
+
+            BenchmarkKeep(hashed.size());
+        });
+
+        BENCHMARK_REPORT("std::unordered_set<u64> set voxels (voxels)", voxels, seconds);
+    }
+
+    {
+        Bitrix3D voxelByVoxel;
+
+        const double seconds = BenchmarkTime([&]() {
+            for (i32 z = 0; z < k_Side; z++)
+                for (i32 x = 0; x < k_Side; x++)
+                    for (i32 y = 0; y < TerrainHeight(x, z); y++)
+                        voxelByVoxel.Set(x, y, z);
+
+            BenchmarkKeep(voxelByVoxel.Count());
+        });
+
+        BENCHMARK_REPORT("Bitrix3D set voxels (voxels)", voxels, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            for (i32 z = 0; z < k_Side; z++)
+                for (i32 x = 0; x < k_Side; x++)
+                    volume.SetRegion(x, 0, z, 1, static_cast<u32>(TerrainHeight(x, z)), 1);
+
+            BenchmarkKeep(volume.Count());
+        });
+
+        BENCHMARK_REPORT("Bitrix3D set columns (voxels)", voxels, seconds);
+    }
+
+    const std::vector<i32> queries = RandomPositions(k_Queries, 1);
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet found = 0;
+
+            for (u32 i = 0; i < k_Queries; i++)
+                found += hashed.count(VoxelKey(queries[i * 3], queries[i * 3 + 1], queries[i * 3 + 2]));
+
+            BenchmarkKeep(found);
+        });
+
+        BENCHMARK_REPORT("std::unordered_set<u64> test voxels (queries)", k_Queries, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet found = 0;
+
+            for (u32 i = 0; i < k_Queries; i++)
+                found += volume.Get(queries[i * 3], queries[i * 3 + 1], queries[i * 3 + 2]);
+
+            BenchmarkKeep(found);
+        });
+
+        BENCHMARK_REPORT("Bitrix3D test voxels (queries)", k_Queries, seconds);
+    }
+
+    {
+        // 64x64x64 boxes, counted voxel by voxel through the hashed set and a brick at a time.
+        const double seconds = BenchmarkTime([&]() {
+            sizet count = 0;
+
+            for (i32 box = 0; box < 8; box++)
+                for (i32 z = box * 64; z < box * 64 + 64; z++)
+                    for (i32 y = 32; y < 96; y++)
+                        for (i32 x = box * 64; x < box * 64 + 64; x++)
+                            count += hashed.count(VoxelKey(x, y, z));
+
+            BenchmarkKeep(count);
+        });
+
+        BENCHMARK_REPORT("std::unordered_set<u64> count regions (voxels)", 8 * 64 * 64 * 64, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet count = 0;
+
+            for (i32 box = 0; box < 8; box++)
+                count += volume.CountRegion(box * 64, 32, box * 64, 64, 64, 64);
+
+            BenchmarkKeep(count);
+        });
+
+        BENCHMARK_REPORT("Bitrix3D count regions (voxels)", 8 * 64 * 64 * 64, seconds);
+    }
+
+    // Rays from above the terrain looking across and down into it, most travel over empty space first.
+    std::mt19937 random(7);
+    std::uniform_real_distribution<f32> across(0.0f, static_cast<f32>(k_Side));
+    std::uniform_real_distribution<f32> component(-1.0f, 1.0f);
+
+    std::vector<f32> rays(k_Rays * 6);
+    for (u32 i = 0; i < k_Rays; i++) {
+        rays[i * 6 + 0] = across(random);
+        rays[i * 6 + 1] = 300.0f;
+        rays[i * 6 + 2] = across(random);
+        rays[i * 6 + 3] = component(random);
+        rays[i * 6 + 4] = -0.2f - std::abs(component(random));
+        rays[i * 6 + 5] = component(random);
+    }
+
+    {
+        // A voxel by voxel walk testing every voxel it crosses.
+        const double seconds = BenchmarkTime([&]() {
+            sizet hits = 0;
+
+            for (u32 i = 0; i < k_Rays; i++) {
+                const f32* ray = &rays[i * 6];
+                const f32 length = std::sqrt(ray[3] * ray[3] + ray[4] * ray[4] + ray[5] * ray[5]);
+
+                i32 voxel[3];
+                i32 step[3];
+                f32 next[3];
+                f32 delta[3];
+
+                for (u32 a = 0; a < 3; a++) {
+                    const f32 direction = ray[a + 3] / length;
+
+                    voxel[a] = static_cast<i32>(std::floor(ray[a]));
+                    step[a] = direction > 0 ? 1 : -1;
+                    delta[a] = 1.0f / std::abs(direction);
+                    next[a] = (voxel[a] + (step[a] > 0) - ray[a]) / direction;
+                }
+
+                for (f32 distance = 0.0f; distance <= k_RayLength;) {
+                    if (hashed.count(VoxelKey(voxel[0], voxel[1], voxel[2]))) {
+                        hits++;
+                        break;
+                    }
+
+                    const u32 a = next[0] < next[1] ? (next[0] < next[2] ? 0 : 2) : (next[1] < next[2] ? 1 : 2);
+                    distance = next[a];
+                    voxel[a] += step[a];
+                    next[a] += delta[a];
+                }
+            }
+
+            BenchmarkKeep(hits);
+        });
+
+        BENCHMARK_REPORT("std::unordered_set<u64> voxel walk raycast (rays)", k_Rays, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet hits = 0;
+            Bitrix3DHit hit;
+
+            for (u32 i = 0; i < k_Rays; i++) {
+                const f32* ray = &rays[i * 6];
+
+                hits += volume.Raycast(ray[0], ray[1], ray[2], ray[3], ray[4], ray[5], k_RayLength, hit);
+            }
+
+            BenchmarkKeep(hits);
+        });
+
+        BENCHMARK_REPORT("Bitrix3D raycast (rays)", k_Rays, seconds);
+    }
+}
@@ -0,0 +1,331 @@
+#include <Ocean/Types/Bitrix.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+static constexpr u16 k_Size = 4096;
+static constexpr u32 k_Passes = 16;
+static constexpr sizet k_Cells = static_cast<sizet>(k_Size) * k_Size;
+
+/**
+ * @brief A grid with about a third of its cells set.
+ */
+static Bitrix2D RandomGrid(u64 seed) {
+    std::mt19937_64 random(seed);
+    Bitrix2D grid(k_Size, k_Size);
+
+    for (sizet i = 0; i < grid.WordsPerRow() * k_Size; i++)
+        grid.Data()[i] = random() & random();
+
+    return grid;
+}
+
+BENCHMARK_CASE(Bitrix2D_Bulk_Operations) {
+    // Combining a collision grid with an occupancy grid, the cell by cell loop a column per allocation needs first.
+    const Bitrix2D obstacles = RandomGrid(1);
+    const Bitrix2D occupied = RandomGrid(2);
+
+    {
+        std::vector<std::vector<bool>> a(k_Size, std::vector<bool>(k_Size));
+        std::vector<std::vector<bool>> b(k_Size, std::vector<bool>(k_Size));
+
+        for (u16 x = 0; x < k_Size; x++) {
+            for (u16 y = 0; y < k_Size; y++) {
+                a[x][y] = obstacles.Get(x, y);
+                b[x][y] = occupied.Get(x, y);
+            }
+        }
+
+        const double seconds = BenchmarkTime([&]() {
+            sizet count = 0;
+
+            for (u16 x = 0; x < k_Size; x++)
+                for (u16 y = 0; y < k_Size; y++)
+                    count += a[x][y] && b[x][y];
+
+            BenchmarkKeep(count);
+        });
+
+        BENCHMARK_REPORT("std::vector<std::vector<bool>> and and count (cells)", k_Cells, seconds);
+    }
+
+    Bitrix2D grid = obstacles;
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet count = 0;
+
+            for (u32 pass = 0; pass < k_Passes; pass++) {
+                grid &= occupied;
+                count += grid.Count();
+                grid |= obstacles;
+            }
+
+            BenchmarkKeep(count);
+        });
+
+        BENCHMARK_REPORT("Bitrix2D and, count and or (cells)", k_Cells * k_Passes, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 pass = 0; pass < k_Passes; pass++) {
+                grid ^= occupied;
+                grid.Flip();
+            }
+
+            BenchmarkKeep(grid.Data()[0]);
+        });
+
+        BENCHMARK_REPORT("Bitrix2D xor and not (cells)", k_Cells * k_Passes, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 pass = 0; pass < k_Passes; pass++)
+                grid.Shift(pass % 2 == 0 ? 3 : -3, pass % 2 == 0 ? 1 : -1);
+
+            BenchmarkKeep(grid.Data()[0]);
+        });
+
+        BENCHMARK_REPORT("Bitrix2D shift (cells)", k_Cells * k_Passes, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet count = 0;
+
+            for (u16 y = 0; y < k_Size; y++)
+                count += grid.CountRow(y);
+
+            for (u16 y = 0; y + 64 <= k_Size; y += 64)
+                for (u16 x = 0; x + 64 <= k_Size; x += 64)
+                    count += grid.CountRegion(x + 5, y, 50, 64);
+
+            BenchmarkKeep(count);
+        });
+
+        BENCHMARK_REPORT("Bitrix2D count rows and 64x64 regions (cells)", k_Cells * 2, seconds);
+    }
+}
+
+BENCHMARK_CASE(Bitrix2D_Copy_And_Resize) {
+    const Bitrix2D source = RandomGrid(3);
+
+    {
+        std::vector<std::vector<bool>> columns(k_Size, std::vector<bool>(k_Size));
+        std::vector<std::vector<bool>> copy;
+
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 pass = 0; pass < k_Passes; pass++) {
+                copy = columns;
+                BenchmarkKeep(copy.back().size());
+            }
+        });
+
+        BENCHMARK_REPORT("std::vector<std::vector<bool>> copy (cells)", k_Cells * k_Passes, seconds);
+    }
+
+    {
+        Bitrix2D copy;
+
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 pass = 0; pass < k_Passes; pass++) {
+                copy = source;
+                BenchmarkKeep(copy.Data()[pass]);
+            }
+        });
+
+        BENCHMARK_REPORT("Bitrix2D copy (cells)", k_Cells * k_Passes, seconds);
+    }
+
+    {
+        Bitrix2D grid = source;
+
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 pass = 0; pass < k_Passes; pass++)
+                grid.Resize(pass % 2 == 0 ? k_Size - 100 : k_Size, k_Size, true);
+
+            BenchmarkKeep(grid.Count());
+        });
+
+        BENCHMARK_REPORT("Bitrix2D resize (cells)", k_Cells * k_Passes, seconds);
+    }
+}
+
+/**
+ * @brief A grid of overlapping 9x9 blocks covering about a third of its cells, shaped like an occupancy map.
+ */
+static Bitrix2D BlockGrid(u64 seed) {
+    std::mt19937_64 random(seed);
+    Bitrix2D grid(k_Size, k_Size);
+
+    for (u16 y = 0; y < k_Size; y++)
+        for (u16 x = 0; x < k_Size; x++)
+            grid.Set(x, y, random() % 200 == 0);
+
+    grid.Dilate(4);
+
+    return grid;
+}
+
+BENCHMARK_CASE(Bitrix2D_Region_Algorithms) {
+    // Against the same algorithms cell by cell on a byte grid, then the word versions over one and every thread.
+    const Bitrix2D source = BlockGrid(4);
+
+    std::vector<u8> cells(k_Cells);
+    for (u16 y = 0; y < k_Size; y++)
+        for (u16 x = 0; x < k_Size; x++)
+            cells[y * k_Size + x] = source.Get(x, y);
+
+    {
+        std::vector<u32> labels(k_Cells);
+
+        const double seconds = BenchmarkTime([&]() {
+            std::fill(labels.begin(), labels.end(), 0);
+
+            std::vector<u32> stack;
+            u32 count = 0;
+
+            for (u32 start = 0; start < k_Cells; start++) {
+                if (labels[start] != 0 || !cells[start])
+                    continue;
+
+                labels[start] = ++count;
+                stack.push_back(start);
+
+                while (!stack.empty()) {
+                    const u32 cell = stack.back();
+                    stack.pop_back();
+
+                    const u32 x = cell % k_Size;
+                    const u32 neighbors[4] = { cell - 1, cell + 1, cell - k_Size, cell + k_Size };
+                    const b8 inside[4] = { x > 0, x + 1 < k_Size, cell >= k_Size, cell + k_Size < k_Cells };
+
+                    for (u32 i = 0; i < 4; i++) {
+                        if (inside[i] && cells[neighbors[i]] && labels[neighbors[i]] == 0) {
+                            labels[neighbors[i]] = count;
+                            stack.push_back(neighbors[i]);
+                        }
+                    }
+                }
+            }
+
+            BenchmarkKeep(count);
+        });
+
+        BENCHMARK_REPORT("Cell by cell label components (cells)", k_Cells, seconds);
+    }
+
+    {
+        std::vector<u8> next(k_Cells);
+
+        const double seconds = BenchmarkTime([&]() {
+            for (i32 y = 0; y < k_Size; y++) {
+                for (i32 x = 0; x < k_Size; x++) {
+                    u32 neighbors = 0;
+
+                    for (i32 ny = y - 1; ny <= y + 1; ny++)
+                        for (i32 nx = x - 1; nx <= x + 1; nx++)
+                            if ((nx != x || ny != y) && nx >= 0 && ny >= 0 && nx < k_Size && ny < k_Size)
+                                neighbors += cells[ny * k_Size + nx];
+
+                    next[y * k_Size + x] = neighbors == 3 || (neighbors == 2 && cells[y * k_Size + x]);
+                }
+            }
+
+            BenchmarkKeep(next[k_Cells / 2]);
+        });
+
+        BENCHMARK_REPORT("Cell by cell life step (cells)", k_Cells, seconds);
+    }
+
+    {
+        std::vector<u8> dilated(k_Cells);
+        constexpr i32 radius = 2;
+
+        const double seconds = BenchmarkTime([&]() {
+            for (i32 y = 0; y < k_Size; y++) {
+                for (i32 x = 0; x < k_Size; x++) {
+                    u8 any = 0;
+
+                    for (i32 ny = std::max(y - radius, 0); ny <= std::min(y + radius, k_Size - 1); ny++)
+                        for (i32 nx = std::max(x - radius, 0); nx <= std::min(x + radius, k_Size - 1); nx++)
+                            any |= cells[ny * k_Size + nx];
+
+                    dilated[y * k_Size + x] = any;
+                }
+            }
+
+            BenchmarkKeep(dilated[k_Cells / 2]);
+        });
+
+        BENCHMARK_REPORT("Cell by cell dilate by 2 (cells)", k_Cells, seconds);
+    }
+
+    {
+        // Two thirds of the cells are open, so the fill spreads over most of the grid.
+        const Bitrix2D open = ~source;
+
+        u16 start = 0;
+        while (!open.Get(start, 0))
+            start++;
+
+        const double seconds = BenchmarkTime([&]() {
+            BenchmarkKeep(open.FloodFill(start, 0).Count());
+        });
+
+        BENCHMARK_REPORT("Bitrix2D flood fill (cells)", k_Cells, seconds);
+    }
+
+    const u32 hardwareThreads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 4;
+
+    for (u32 threads : { 1u, hardwareThreads }) {
+        const std::string suffix = " x" + std::to_string(threads) + " threads (cells)";
+
+        {
+            DynamicArray<u32> labels;
+            source.LabelComponents(labels);
+
+            const double seconds = BenchmarkTime([&]() {
+                BenchmarkKeep(source.LabelComponents(labels, threads));
+            });
+
+            BENCHMARK_REPORT(("Bitrix2D label components" + suffix).c_str(), k_Cells, seconds);
+        }
+
+        {
+            Bitrix2D grid = source;
+
+            const double seconds = BenchmarkTime([&]() {
+                for (u32 pass = 0; pass < k_Passes; pass++)
+                    grid.Step(Bitrix2D::k_LifeBirth, Bitrix2D::k_LifeSurvive, threads);
+
+                BenchmarkKeep(grid.Data()[0]);
+            });
+
+            BENCHMARK_REPORT(("Bitrix2D life step" + suffix).c_str(), k_Cells * k_Passes, seconds);
+        }
+
+        {
+            Bitrix2D grid = source;
+
+            const double seconds = BenchmarkTime([&]() {
+                for (u32 pass = 0; pass < k_Passes; pass++) {
+                    grid.Dilate(2, threads);
+                    grid.Erode(2, threads);
+                }
+
+                BenchmarkKeep(grid.Data()[0]);
+            });
+
+            BENCHMARK_REPORT(("Bitrix2D dilate and erode by 2" + suffix).c_str(), k_Cells * k_Passes * 2, seconds);
+        }
+    }
+}
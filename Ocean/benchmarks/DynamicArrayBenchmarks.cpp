@@ -0,0 +1,228 @@
+#include <Ocean/Primitives/DynamicArray.hpp>
+#include <Ocean/Types/SmartPtrs.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <string>
+#include <vector>
+
+static constexpr u32 k_Rounds = 50;
+static constexpr u32 k_Elements = 500000;
+static constexpr u32 k_SmallRounds = 200000;
+static constexpr u32 k_SmallElements = 16;
+
+/**
+ * @brief Calls the container's push function with the same spelling for DynamicArray and std::vector.
+ */
+template <class T, class V>
+static void Push(DynamicArray<T>& array, V&& value) { array.PushBack(std::forward<V>(value)); }
+template <class T, class V>
+static void Push(std::vector<T>& array, V&& value) { array.push_back(std::forward<V>(value)); }
+
+template <class T>
+static void Reserve(DynamicArray<T>& array, sizet count) { array.Reserve(count); }
+template <class T>
+static void Reserve(std::vector<T>& array, sizet count) { array.reserve(count); }
+
+template <class T>
+static sizet Count(const DynamicArray<T>& array) { return array.Size(); }
+template <class T>
+static sizet Count(const std::vector<T>& array) { return array.size(); }
+
+template <class T>
+static void EraseFront(DynamicArray<T>& array, sizet count) { array.Erase(static_cast<sizet>(0), count); }
+template <class T>
+static void EraseFront(std::vector<T>& array, sizet count) { array.erase(array.begin(), array.begin() + count); }
+
+/**
+ * @brief Times k_Rounds of growing a container from empty to k_Elements, the growth path with every reallocation.
+ *
+ * @param make Creates the value pushed for an index.
+ */
+template <class C, class F>
+static double GrowWorkload(F&& make, b8 reserve) {
+    return BenchmarkTime([&]() {
+        for (u32 round = 0; round < k_Rounds; round++) {
+            C array;
+
+            if (reserve)
+                Reserve(array, k_Elements);
+
+            for (u32 i = 0; i < k_Elements; i++)
+                Push(array, make(i));
+
+            BenchmarkKeep(array[k_Elements - 1]);
+        }
+    });
+}
+
+/**
+ * @brief Runs the same workload over DynamicArray and std::vector and reports both.
+ */
+template <class T, class F>
+static void Compare(const std::string& label, F&& make, b8 reserve = false) {
+    const double operations = static_cast<double>(k_Rounds) * k_Elements;
+
+    const double vectorSeconds = GrowWorkload<std::vector<T>>(make, reserve);
+    const double arraySeconds = GrowWorkload<DynamicArray<T>>(make, reserve);
+
+    BENCHMARK_REPORT("std::vector" + label, operations, vectorSeconds);
+    BENCHMARK_REPORT("DynamicArray" + label, operations, arraySeconds);
+}
+
+BENCHMARK_CASE(DynamicArray_PushBack_Trivial) {
+    Compare<u32>("<u32> PushBack", [](u32 i) { return i; });
+    Compare<u32>("<u32> PushBack reserved", [](u32 i) { return i; }, true);
+}
+
+BENCHMARK_CASE(DynamicArray_PushBack_Relocatable) {
+    // shared_ptr has a non-trivial move, but is relocated with memcpy by the DynamicArray.
+    const Ref<u32> shared = MakeRef<u32>(0);
+
+    Compare<Ref<u32>>("<Ref<u32>> PushBack", [&](u32) { return shared; });
+}
+
+BENCHMARK_CASE(DynamicArray_PushBack_String) {
+    // std::string points into itself for short strings, so both containers move element by element.
+    Compare<std::string>("<std::string> PushBack", [](u32 i) { return std::string(i & 7, 'o'); });
+}
+
+BENCHMARK_CASE(DynamicArray_Small_Temporaries) {
+    const double operations = static_cast<double>(k_SmallRounds);
+
+    const double vectorSeconds = BenchmarkTime([]() {
+        for (u32 round = 0; round < k_SmallRounds; round++) {
+            std::vector<u32> array;
+
+            for (u32 i = 0; i < k_SmallElements; i++)
+                array.push_back(i + round);
+
+            BenchmarkKeep(array.back());
+        }
+    });
+
+    const double arraySeconds = BenchmarkTime([]() {
+        for (u32 round = 0; round < k_SmallRounds; round++) {
+            DynamicArray<u32> array;
+
+            for (u32 i = 0; i < k_SmallElements; i++)
+                array.PushBack(i + round);
+
+            BenchmarkKeep(array.Back());
+        }
+    });
+
+    BENCHMARK_REPORT("std::vector<u32> 16 element temporaries", operations, vectorSeconds);
+    BENCHMARK_REPORT("DynamicArray<u32> 16 element temporaries", operations, arraySeconds);
+}
+
+/**
+ * @brief Times erasing the front k_SmallElements of an array until it is empty, which shifts the remaining elements.
+ */
+template <class C>
+static double EraseWorkload(const Ref<u32>& shared) {
+    C array;
+    Reserve(array, k_Elements / 10);
+
+    for (u32 i = 0; i < k_Elements / 10; i++)
+        Push(array, shared);
+
+    return BenchmarkTime([&]() {
+        while (Count(array) >= k_SmallElements)
+            EraseFront(array, k_SmallElements);
+    });
+}
+
+BENCHMARK_CASE(DynamicArray_Erase_Relocatable) {
+    const Ref<u32> shared = MakeRef<u32>(0);
+    const double operations = static_cast<double>(k_Elements / 10 / k_SmallElements);
+
+    const double vectorSeconds = EraseWorkload<std::vector<Ref<u32>>>(shared);
+    const double arraySeconds = EraseWorkload<DynamicArray<Ref<u32>>>(shared);
+
+    BENCHMARK_REPORT("std::vector<Ref<u32>> erase front", operations, vectorSeconds);
+    BENCHMARK_REPORT("DynamicArray<Ref<u32>> erase front", operations, arraySeconds);
+}
+
+BENCHMARK_CASE(DynamicArray_Iterate) {
+    std::vector<u32> vector;
+    DynamicArray<u32> array;
+
+    for (u32 i = 0; i < k_Elements; i++) {
+        vector.push_back(i);
+        array.PushBack(i);
+    }
+
+    const double operations = static_cast<double>(k_Rounds) * k_Elements;
+
+    const double vectorSeconds = BenchmarkTime([&]() {
+        for (u32 round = 0; round < k_Rounds; round++) {
+            u64 sum = 0;
+            for (u32 value : vector)
+                sum += value;
+
+            BenchmarkKeep(sum);
+        }
+    });
+
+    const double arraySeconds = BenchmarkTime([&]() {
+        for (u32 round = 0; round < k_Rounds; round++) {
+            u64 sum = 0;
+            for (sizet i = 0; i < array.Size(); i++)
+                sum += array[i];
+
+            BenchmarkKeep(sum);
+        }
+    });
+
+    BENCHMARK_REPORT("std::vector<u32> iterate", operations, vectorSeconds);
+    BENCHMARK_REPORT("DynamicArray<u32> iterate", operations, arraySeconds);
+}
+
+/**
+ * @brief Walks a table of short arrays, like per-entity lists, summing their sizes and comparing neighbours.
+ * @note The walk reads every array header once, so it costs what the headers weigh.
+ */
+template <class C>
+static void NestedWorkload(const std::string& label, const C& table) {
+    const double operations = static_cast<double>(k_Rounds) * table.size();
+
+    const double walkSeconds = BenchmarkTime([&]() {
+        for (u32 round = 0; round < k_Rounds; round++) {
+            u64 sum = 0;
+            for (sizet i = 0; i < table.size(); i++)
+                sum += Count(table[i]);
+
+            BenchmarkKeep(sum);
+        }
+    });
+
+    const double compareSeconds = BenchmarkTime([&]() {
+        for (u32 round = 0; round < k_Rounds; round++) {
+            sizet equal = 0;
+            for (sizet i = 1; i < table.size(); i++)
+                equal += table[i] == table[i - 1];
+
+            BenchmarkKeep(equal);
+        }
+    });
+
+    BENCHMARK_REPORT(label + " walk sizes", operations, walkSeconds);
+    BENCHMARK_REPORT(label + " compare neighbours", operations, compareSeconds);
+}
+
+BENCHMARK_CASE(DynamicArray_Nested_Arrays) {
+    std::vector<std::vector<u32>> vectors(k_Elements);
+    std::vector<DynamicArray<u32>> arrays(k_Elements);
+
+    for (u32 i = 0; i < k_Elements; i++) {
+        for (u32 j = 0; j < i % 4; j++) {
+            vectors[i].push_back(j);
+            arrays[i].PushBack(j);
+        }
+    }
+
+    NestedWorkload("std::vector<u32> (" + std::to_string(sizeof(std::vector<u32>)) + " bytes)", vectors);
+    NestedWorkload("DynamicArray<u32> (" + std::to_string(sizeof(DynamicArray<u32>)) + " bytes)", arrays);
+}
@@ -0,0 +1,59 @@
+#include <Ocean/Types/FloatingPoints.hpp>
+#include <Ocean/Primitives/FixedArray.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <array>
+#include <type_traits>
+
+// Codegen checks, a FixedArray has to be a plain array to the compiler: same layout, and copied with a memcpy.
+static_assert(sizeof(FixedArray<f32, 16>) == sizeof(f32[16]));
+static_assert(alignof(FixedArray<f32, 16>) == alignof(f32));
+static_assert(std::is_trivially_copyable_v<FixedArray<f32, 16>>);
+static_assert(std::is_standard_layout_v<FixedArray<f32, 16>>);
+
+static constexpr u32 k_Rounds = 10000000;
+static constexpr sizet k_Elements = 16;
+
+/**
+ * @brief Fills, copies and sums a small array per round, like a matrix or a list of texture slots.
+ */
+template <class C>
+static double SmallArrayWorkload() {
+    return BenchmarkTime([]() {
+        C arr { };
+
+        for (u32 round = 0; round < k_Rounds; round++) {
+            for (sizet i = 0; i < k_Elements; i++)
+                arr[i] = static_cast<f32>(round + i);
+
+            C copy = arr;
+            BenchmarkKeep(copy);
+
+            f32 sum = 0.0f;
+            for (sizet i = 0; i < k_Elements; i++)
+                sum += copy[i];
+
+            BenchmarkKeep(sum);
+        }
+    });
+}
+
+/** @brief A raw array wrapped only so it can be copied, the baseline. */
+struct RawArray {
+    f32 data[k_Elements];
+
+    f32& operator [] (sizet i) { return data[i]; }
+
+};
+
+BENCHMARK_CASE(FixedArray_Against_Plain_Arrays) {
+    const double rawSeconds = SmallArrayWorkload<RawArray>();
+    const double stdSeconds = SmallArrayWorkload<std::array<f32, k_Elements>>();
+    const double fixedSeconds = SmallArrayWorkload<FixedArray<f32, k_Elements>>();
+
+    BENCHMARK_REPORT("f32[16]", k_Rounds, rawSeconds);
+    BENCHMARK_REPORT("std::array<f32, 16>", k_Rounds, stdSeconds);
+    BENCHMARK_REPORT("FixedArray<f32, 16>", k_Rounds, fixedSeconds);
+}
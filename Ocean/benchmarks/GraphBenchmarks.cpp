@@ -0,0 +1,179 @@
+#include <Ocean/Primitives/BitrixGraph.hpp>
+#include <Ocean/Primitives/CsrGraph.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Random edges between the given number of vertices.
+ */
+static std::vector<GraphEdge> RandomEdges(u32 vertices, sizet count, u64 seed) {
+    std::mt19937_64 random(seed);
+    std::vector<GraphEdge> edges(count);
+
+    for (GraphEdge& edge : edges)
+        edge = { static_cast<u32>(random() % vertices), static_cast<u32>(random() % vertices) };
+
+    return edges;
+}
+
+/**
+ * @brief The adjacency lists a graph is usually kept in without a dedicated container.
+ */
+static std::vector<std::vector<u32>> AdjacencyLists(u32 vertices, const std::vector<GraphEdge>& edges) {
+    std::vector<std::vector<u32>> adjacency(vertices);
+
+    for (const GraphEdge& edge : edges)
+        adjacency[edge.from].push_back(edge.to);
+
+    return adjacency;
+}
+
+/**
+ * @brief A queue based breadth first search over adjacency lists.
+ */
+static std::vector<u32> ListBreadthFirst(const std::vector<std::vector<u32>>& adjacency, u32 source) {
+    std::vector<u32> distances(adjacency.size(), CsrGraph<>::k_Unreached);
+    std::queue<u32> queue;
+
+    distances[source] = 0;
+    queue.push(source);
+
+    while (!queue.empty()) {
+        const u32 vertex = queue.front();
+        queue.pop();
+
+        for (u32 target : adjacency[vertex]) {
+            if (distances[target] == CsrGraph<>::k_Unreached) {
+                distances[target] = distances[vertex] + 1;
+                queue.push(target);
+            }
+        }
+    }
+
+    return distances;
+}
+
+BENCHMARK_CASE(Graph_Sparse_Navigation) {
+    // A navigation sized graph, a million vertices and eight million edges.
+    constexpr u32 k_Vertices = 1 << 20;
+    constexpr sizet k_Edges = 8 << 20;
+    constexpr u32 k_Searches = 4;
+
+    const std::vector<GraphEdge> edges = RandomEdges(k_Vertices, k_Edges, 1);
+
+    {
+        std::vector<std::vector<u32>> adjacency;
+
+        const double build = BenchmarkTime([&]() { adjacency = AdjacencyLists(k_Vertices, edges); });
+
+        const double search = BenchmarkTime([&]() {
+            for (u32 i = 0; i < k_Searches; i++)
+                BenchmarkKeep(ListBreadthFirst(adjacency, i)[k_Vertices - 1]);
+        });
+
+        BENCHMARK_REPORT("std::vector<std::vector<u32>> build", k_Edges, build);
+        BENCHMARK_REPORT("std::vector<std::vector<u32>> breadth first (edges)", k_Edges * k_Searches, search);
+    }
+
+    {
+        CsrGraph<> graph;
+
+        const double build = BenchmarkTime([&]() { graph.Build(k_Vertices, edges.data(), edges.size()); });
+        BENCHMARK_REPORT("CsrGraph build", k_Edges, build);
+
+        for (u32 threads : { 1u, 4u }) {
+            const double search = BenchmarkTime([&]() {
+                for (u32 i = 0; i < k_Searches; i++)
+                    BenchmarkKeep(graph.BreadthFirst(i, threads)[k_Vertices - 1]);
+            });
+
+            BENCHMARK_REPORT("CsrGraph breadth first (edges), " + std::to_string(threads) + " threads", k_Edges * k_Searches, search);
+        }
+    }
+
+    {
+        // The same edges pointed from the lower to the higher vertex, a dependency graph with no cycles.
+        //
+        std::vector<GraphEdge> acyclic = edges;
+        for (GraphEdge& edge : acyclic)
+            if (edge.from > edge.to)
+                std::swap(edge.from, edge.to);
+
+        CsrGraph<> graph(k_Vertices, acyclic.data(), acyclic.size());
+        DynamicArray<u32> order;
+
+        const double sort = BenchmarkTime([&]() { BenchmarkKeep(graph.TopologicalSort(order)); });
+        BENCHMARK_REPORT("CsrGraph topological sort (edges)", graph.EdgeCount(), sort);
+    }
+}
+
+BENCHMARK_CASE(Graph_Dense_Reachability) {
+    // A dense graph, eight thousand vertices and four million edges.
+    constexpr u32 k_Vertices = 1 << 13;
+    constexpr sizet k_Edges = 4 << 20;
+    constexpr u32 k_Searches = 16;
+
+    const std::vector<GraphEdge> edges = RandomEdges(k_Vertices, k_Edges, 2);
+
+    CsrGraph<> csr(k_Vertices, edges.data(), edges.size());
+    BitrixGraph<> bitrix(k_Vertices);
+
+    for (const GraphEdge& edge : edges)
+        bitrix.AddEdge(edge.from, edge.to);
+
+    {
+        const double search = BenchmarkTime([&]() {
+            for (u32 i = 0; i < k_Searches; i++)
+                BenchmarkKeep(csr.BreadthFirst(i)[k_Vertices - 1]);
+        });
+
+        BENCHMARK_REPORT("CsrGraph dense breadth first (edges)", csr.EdgeCount() * k_Searches, search);
+    }
+
+    for (u32 threads : { 1u, 4u }) {
+        const double search = BenchmarkTime([&]() {
+            for (u32 i = 0; i < k_Searches; i++)
+                BenchmarkKeep(bitrix.BreadthFirst(i, threads)[k_Vertices - 1]);
+        });
+
+        BENCHMARK_REPORT("BitrixGraph dense breadth first (edges), " + std::to_string(threads) + " threads", bitrix.EdgeCount() * k_Searches, search);
+    }
+
+    // Reachability between every pair, from a search per vertex or from the closure.
+    constexpr u32 k_ClosureVertices = 1 << 11;
+
+    const std::vector<GraphEdge> sparse = RandomEdges(k_ClosureVertices, k_ClosureVertices, 3);
+
+    CsrGraph<> small(k_ClosureVertices, sparse.data(), sparse.size());
+    BitrixGraph<> smallBitrix(k_ClosureVertices);
+
+    for (const GraphEdge& edge : sparse)
+        smallBitrix.AddEdge(edge.from, edge.to);
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet reachable = 0;
+
+            for (u32 v = 0; v < k_ClosureVertices; v++)
+                for (u32 distance : small.BreadthFirst(v))
+                    reachable += distance != CsrGraph<>::k_Unreached;
+
+            BenchmarkKeep(reachable);
+        });
+
+        BENCHMARK_REPORT("CsrGraph breadth first from every vertex (vertices)", k_ClosureVertices, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() { BenchmarkKeep(smallBitrix.TransitiveClosure().EdgeCount()); });
+
+        BENCHMARK_REPORT("BitrixGraph transitive closure (vertices)", k_ClosureVertices, seconds);
+    }
+}
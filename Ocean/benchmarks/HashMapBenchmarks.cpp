@@ -0,0 +1,135 @@
+#include <Ocean/Primitives/HashMap.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static constexpr u32 k_Entries = 1 << 20;
+static constexpr u32 k_StringEntries = 1 << 16;
+
+/**
+ * @brief Random u64 keys, with a fixed seed so both maps see the same keys.
+ */
+static std::vector<u64> RandomKeys(u32 count, u64 seed) {
+    std::mt19937_64 random(seed);
+    std::vector<u64> keys(count);
+
+    for (u64& key : keys)
+        key = random();
+
+    return keys;
+}
+
+/** @brief Lookup and erase for both maps, so one workload drives both. */
+static const u64* Lookup(const std::unordered_map<u64, u64>& map, u64 key) {
+    const auto it = map.find(key);
+
+    return it == map.end() ? nullptr : &it->second;
+}
+static const u64* Lookup(const HashMap<u64, u64>& map, u64 key) {
+    const auto it = map.Find(key);
+
+    return it == map.End() ? nullptr : &it->value;
+}
+static void Remove(std::unordered_map<u64, u64>& map, u64 key) { map.erase(key); }
+static void Remove(HashMap<u64, u64>& map, u64 key) { map.Erase(key); }
+
+template <class Map>
+static void IntegerWorkload(const std::string& name, const std::vector<u64>& keys, const std::vector<u64>& misses) {
+    Map map;
+
+    const double insertSeconds = BenchmarkTime([&]() {
+        for (u64 key : keys)
+            map[key] = key;
+    });
+
+    const double hitSeconds = BenchmarkTime([&]() {
+        u64 sum = 0;
+
+        for (u64 key : keys)
+            sum += *Lookup(map, key);
+
+        BenchmarkKeep(sum);
+    });
+
+    const double missSeconds = BenchmarkTime([&]() {
+        u64 found = 0;
+
+        for (u64 key : misses)
+            found += Lookup(map, key) != nullptr;
+
+        BenchmarkKeep(found);
+    });
+
+    const double eraseSeconds = BenchmarkTime([&]() {
+        for (u64 key : keys)
+            Remove(map, key);
+    });
+
+    BENCHMARK_REPORT(name + " insert", keys.size(), insertSeconds);
+    BENCHMARK_REPORT(name + " lookup hit", keys.size(), hitSeconds);
+    BENCHMARK_REPORT(name + " lookup miss", misses.size(), missSeconds);
+    BENCHMARK_REPORT(name + " erase", keys.size(), eraseSeconds);
+}
+
+BENCHMARK_CASE(HashMap_Integer_Keys) {
+    const std::vector<u64> keys = RandomKeys(k_Entries, 1);
+    const std::vector<u64> misses = RandomKeys(k_Entries, 2);
+
+    IntegerWorkload<std::unordered_map<u64, u64>>("std::unordered_map<u64, u64>", keys, misses);
+    IntegerWorkload<HashMap<u64, u64>>("HashMap<u64, u64>", keys, misses);
+}
+
+BENCHMARK_CASE(HashMap_String_Keys) {
+    std::vector<std::string> names(k_StringEntries);
+    for (u32 i = 0; i < k_StringEntries; i++)
+        names[i] = "resource/texture_" + std::to_string(i * 2654435761u);
+
+    {
+        std::unordered_map<std::string, u32> map;
+
+        const double insertSeconds = BenchmarkTime([&]() {
+            for (u32 i = 0; i < k_StringEntries; i++)
+                map[names[i]] = i;
+        });
+
+        // Looking up by a cstring builds a std::string per lookup.
+        const double lookupSeconds = BenchmarkTime([&]() {
+            u64 sum = 0;
+
+            for (const std::string& name : names)
+                sum += map.find(name.c_str())->second;
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("std::unordered_map<std::string, u32> insert", k_StringEntries, insertSeconds);
+        BENCHMARK_REPORT("std::unordered_map<std::string, u32> cstring lookup", k_StringEntries, lookupSeconds);
+    }
+
+    {
+        HashMap<std::string, u32> map;
+
+        const double insertSeconds = BenchmarkTime([&]() {
+            for (u32 i = 0; i < k_StringEntries; i++)
+                map[names[i]] = i;
+        });
+
+        // The transparent hash looks the cstring up directly.
+        const double lookupSeconds = BenchmarkTime([&]() {
+            u64 sum = 0;
+
+            for (const std::string& name : names)
+                sum += map.Find(name.c_str())->value;
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("HashMap<std::string, u32> insert", k_StringEntries, insertSeconds);
+        BENCHMARK_REPORT("HashMap<std::string, u32> cstring lookup", k_StringEntries, lookupSeconds);
+    }
+}
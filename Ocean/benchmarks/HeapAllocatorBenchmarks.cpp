@@ -0,0 +1,76 @@
+#include <Ocean/Primitives/Memory.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <string>
+#include <thread>
+#include <vector>
+
+static constexpr u32 k_OperationsPerThread = 2000000;
+static constexpr u32 k_LiveSlots = 256;
+
+/**
+ * @brief Randomly allocates and frees small blocks from the allocator, keeping up to k_LiveSlots blocks alive.
+ */
+static void AllocationWorkload(Allocator* allocator, u32 seed) {
+    void* slots[k_LiveSlots] = { };
+    u32 state = seed;
+
+    for (u32 i = 0; i < k_OperationsPerThread; i++) {
+        // xorshift32
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        void*& slot = slots[state % k_LiveSlots];
+
+        if (slot) {
+            allocator->Deallocate(slot);
+            slot = nullptr;
+        }
+        else {
+            slot = allocator->Allocate(16 + (state >> 8) % 496, alignof(max_align_t));
+            BenchmarkKeep(slot);
+        }
+    }
+
+    for (void* slot : slots)
+        if (slot)
+            allocator->Deallocate(slot);
+}
+
+static void RunThreaded(const std::string& label, Allocator* allocator, u32 threadCount) {
+    const double seconds = BenchmarkTime([&]() {
+        std::vector<std::thread> threads;
+
+        for (u32 i = 0; i < threadCount; i++)
+            threads.emplace_back(AllocationWorkload, allocator, 0x9E3779B9u * (i + 1));
+
+        for (std::thread& thread : threads)
+            thread.join();
+    });
+
+    BENCHMARK_REPORT(label + " (" + std::to_string(threadCount) + " threads)", static_cast<double>(k_OperationsPerThread) * threadCount, seconds);
+}
+
+BENCHMARK_CASE(HeapAllocator_Threaded_Throughput) {
+    HeapAllocator cached;
+    cached.Init(omega(256));
+
+    HeapAllocator locked;
+    locked.Init(omega(256), false);
+
+    MallocAllocator system;
+
+    const u32 hardwareThreads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 4;
+
+    for (u32 threads = 1; threads <= hardwareThreads * 2; threads *= 2) {
+        RunThreaded("TLSF + thread caches", &cached, threads);
+        RunThreaded("TLSF + lock", &locked, threads);
+        RunThreaded("malloc", &system, threads);
+    }
+
+    cached.Shutdown();
+    locked.Shutdown();
+}
@@ -0,0 +1,203 @@
+#include <Ocean/Primitives/IntrusiveList.hpp>
+#include <Ocean/Primitives/SinglyLinkedList.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <forward_list>
+#include <list>
+#include <random>
+#include <vector>
+
+static constexpr u64 k_Operations = 1 << 22;
+static constexpr u32 k_QueueDepth = 1024;
+static constexpr u32 k_Objects = 1 << 14;
+
+BENCHMARK_CASE(List_Queue_Churn) {
+    // A work queue at a steady depth, every operation appends a job and retires the oldest.
+    {
+        std::forward_list<u64> list;
+        std::forward_list<u64>::iterator tail = list.before_begin();
+
+        for (u32 i = 0; i < k_QueueDepth; i++)
+            tail = list.insert_after(tail, i);
+
+        const double seconds = BenchmarkTime([&]() {
+            u64 sum = 0;
+
+            for (u64 i = 0; i < k_Operations; i++) {
+                tail = list.insert_after(tail, i);
+
+                sum += list.front();
+                list.pop_front();
+            }
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("std::forward_list<u64> push back and pop front", k_Operations, seconds);
+    }
+
+    {
+        std::list<u64> list;
+
+        for (u32 i = 0; i < k_QueueDepth; i++)
+            list.push_back(i);
+
+        const double seconds = BenchmarkTime([&]() {
+            u64 sum = 0;
+
+            for (u64 i = 0; i < k_Operations; i++) {
+                list.push_back(i);
+
+                sum += list.front();
+                list.pop_front();
+            }
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("std::list<u64> push back and pop front", k_Operations, seconds);
+    }
+
+    {
+        SinglyLinkedList<u64> list;
+
+        for (u32 i = 0; i < k_QueueDepth; i++)
+            list.PushBack(i);
+
+        const double seconds = BenchmarkTime([&]() {
+            u64 sum = 0;
+
+            for (u64 i = 0; i < k_Operations; i++) {
+                list.PushBack(i);
+
+                sum += list.Front();
+                list.PopFront();
+            }
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("SinglyLinkedList<u64> push back and pop front", k_Operations, seconds);
+    }
+}
+
+BENCHMARK_CASE(List_Splice) {
+    // Per-thread lists of finished work handed to one list every frame.
+    constexpr u32 k_Frames = 1 << 14;
+    constexpr u32 k_PerFrame = 64;
+
+    {
+        std::list<u64> done;
+        std::list<u64> frame;
+
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 f = 0; f < k_Frames; f++) {
+                for (u32 i = 0; i < k_PerFrame; i++)
+                    frame.push_back(i);
+
+                done.splice(done.end(), frame);
+
+                if (done.size() > 4096)
+                    done.clear();
+            }
+
+            BenchmarkKeep(done.size());
+        });
+
+        BENCHMARK_REPORT("std::list<u64> fill and splice", k_Frames * k_PerFrame, seconds);
+    }
+
+    {
+        SinglyLinkedList<u64> done;
+        SinglyLinkedList<u64> frame;
+
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 f = 0; f < k_Frames; f++) {
+                for (u32 i = 0; i < k_PerFrame; i++)
+                    frame.PushBack(i);
+
+                done.Splice(frame);
+
+                // The cleared nodes go back to the frame list, as its pool was taken by the splice.
+                //
+                if (done.Size() > 4096) {
+                    done.Clear();
+                    std::swap(done, frame);
+                }
+            }
+
+            BenchmarkKeep(done.Size());
+        });
+
+        BENCHMARK_REPORT("SinglyLinkedList<u64> fill and splice", k_Frames * k_PerFrame, seconds);
+    }
+}
+
+/** @brief An engine object that owns the link fields of the list it is updated through. */
+struct Actor : public IntrusiveListHook<> {
+    u64 id;
+    u64 state[3];
+
+};  // Actor
+
+BENCHMARK_CASE(List_Erase_By_Object) {
+    // Objects leave the update list knowing only themselves and rejoin it at the back.
+    std::mt19937 random(5);
+    std::vector<u32> picks(k_Operations / 4);
+
+    for (u32& pick : picks)
+        pick = random() % k_Objects;
+
+    std::vector<Actor> actors(k_Objects);
+    for (u32 i = 0; i < k_Objects; i++)
+        actors[i].id = i;
+
+    {
+        std::list<Actor*> list;
+        std::vector<std::list<Actor*>::iterator> positions;
+
+        for (Actor& actor : actors)
+            positions.push_back(list.insert(list.end(), &actor));
+
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 pick : picks) {
+                list.erase(positions[pick]);
+                positions[pick] = list.insert(list.end(), &actors[pick]);
+            }
+
+            u64 sum = 0;
+            for (const Actor* actor : list)
+                sum += actor->id;
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("std::list<Actor*> erase by stored iterator and append", picks.size(), seconds);
+    }
+
+    {
+        IntrusiveList<Actor> list;
+
+        for (Actor& actor : actors)
+            list.PushBack(actor);
+
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 pick : picks) {
+                list.Erase(actors[pick]);
+                list.PushBack(actors[pick]);
+            }
+
+            u64 sum = 0;
+            for (const Actor& actor : list)
+                sum += actor.id;
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("IntrusiveList<Actor> erase by object and append", picks.size(), seconds);
+
+        list.Clear();
+    }
+}
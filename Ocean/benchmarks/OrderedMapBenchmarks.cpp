@@ -0,0 +1,151 @@
+#include <Ocean/Primitives/OrderedMap.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+static constexpr u32 k_Entries = 1 << 20;
+static constexpr u32 k_Queries = 1 << 20;
+static constexpr u32 k_Events = 1 << 16;
+
+/** @brief Lower bound, insert and pop front for both maps, so one workload drives both. */
+static u64 Value(const std::pair<const u64, u64>& entry) { return entry.second; }
+static u64 Value(const OrderedMap<u64, u64>::ConstReference& entry) { return entry.value; }
+static const u64* LowerBound(const std::map<u64, u64>& map, u64 key) {
+    const auto it = map.lower_bound(key);
+
+    return it == map.end() ? nullptr : &it->second;
+}
+static const u64* LowerBound(const OrderedMap<u64, u64>& map, u64 key) {
+    const auto it = map.LowerBound(key);
+
+    return it == map.End() ? nullptr : &it->value;
+}
+static b8 Schedule(std::map<u64, u64>& map, u64 time, u64 event) { return map.emplace(time, event).second; }
+static b8 Schedule(OrderedMap<u64, u64>& map, u64 time, u64 event) { return map.Emplace(time, event).second; }
+static std::pair<u64, u64> PopEarliest(std::map<u64, u64>& map) {
+    const auto it = map.begin();
+    const std::pair<u64, u64> earliest(it->first, it->second);
+
+    map.erase(it);
+
+    return earliest;
+}
+static std::pair<u64, u64> PopEarliest(OrderedMap<u64, u64>& map) {
+    const auto it = map.Begin();
+    const std::pair<u64, u64> earliest(it->key, it->value);
+
+    map.Erase(it);
+
+    return earliest;
+}
+
+/**
+ * @brief A timeline of keyframes at increasing times, sampled at random times with a lower bound per sample.
+ */
+template <class Map>
+static void TimelineWorkload(const std::string& name, const std::vector<std::pair<u64, u64>>& keyframes, const std::vector<u64>& samples) {
+    Map map;
+
+    const double insertSeconds = BenchmarkTime([&]() {
+        for (const std::pair<u64, u64>& keyframe : keyframes)
+            map[keyframe.first] = keyframe.second;
+    });
+
+    const Map& view = map;
+
+    const double iterateSeconds = BenchmarkTime([&]() {
+        u64 sum = 0;
+
+        for (u32 pass = 0; pass < 8; pass++)
+            for (const auto& entry : view)
+                sum += Value(entry);
+
+        BenchmarkKeep(sum);
+    });
+
+    const double sampleSeconds = BenchmarkTime([&]() {
+        u64 sum = 0;
+
+        for (u64 time : samples) {
+            const u64* value = LowerBound(map, time);
+
+            if (value)
+                sum += *value;
+        }
+
+        BenchmarkKeep(sum);
+    });
+
+    BENCHMARK_REPORT(name + " insert keyframes", keyframes.size(), insertSeconds);
+    BENCHMARK_REPORT(name + " ordered iteration", keyframes.size() * 8, iterateSeconds);
+    BENCHMARK_REPORT(name + " lower bound samples", samples.size(), sampleSeconds);
+}
+
+BENCHMARK_CASE(OrderedMap_Timeline) {
+    std::mt19937_64 random(1);
+
+    std::vector<std::pair<u64, u64>> keyframes(k_Entries);
+    u64 time = 0;
+
+    for (u32 i = 0; i < k_Entries; i++) {
+        time += 1 + random() % 64;
+        keyframes[i] = { time, i };
+    }
+
+    std::vector<u64> samples(k_Queries);
+    for (u64& sample : samples)
+        sample = random() % time;
+
+    TimelineWorkload<std::map<u64, u64>>("std::map<u64, u64>", keyframes, samples);
+    TimelineWorkload<OrderedMap<u64, u64>>("OrderedMap<u64, u64>", keyframes, samples);
+
+    // Sorted keyframes can skip the inserts entirely.
+    OrderedMap<u64, u64> loaded;
+
+    const double loadSeconds = BenchmarkTime([&]() {
+        loaded.BulkLoad(keyframes.begin(), keyframes.end());
+    });
+
+    BENCHMARK_REPORT("OrderedMap<u64, u64> bulk load keyframes", keyframes.size(), loadSeconds);
+}
+
+/**
+ * @brief An event queue that keeps a window of pending events, each step runs the earliest one and schedules a new
+ * one a random delay after it.
+ */
+template <class Map>
+static void SchedulerWorkload(const std::string& name, u32 steps) {
+    std::mt19937_64 random(2);
+    Map map;
+
+    for (u32 i = 0; i < k_Events; i++)
+        while (!Schedule(map, random() % (k_Events * 16ull), i)) { }
+
+    const double seconds = BenchmarkTime([&]() {
+        u64 sum = 0;
+
+        for (u32 i = 0; i < steps; i++) {
+            const std::pair<u64, u64> event = PopEarliest(map);
+            sum += event.second;
+
+            u64 delay = 1 + random() % (k_Events * 16ull);
+            while (!Schedule(map, event.first + delay, i))
+                delay++;
+        }
+
+        BenchmarkKeep(sum);
+    });
+
+    BENCHMARK_REPORT(name + " pop and schedule", steps, seconds);
+}
+
+BENCHMARK_CASE(OrderedMap_Event_Scheduling) {
+    SchedulerWorkload<std::map<u64, u64>>("std::map<u64, u64>", k_Queries);
+    SchedulerWorkload<OrderedMap<u64, u64>>("OrderedMap<u64, u64>", k_Queries);
+}
@@ -0,0 +1,107 @@
+#include <Ocean/Primitives/DynamicArray.hpp>
+#include <Ocean/Primitives/Memory.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <cstring>
+#include <string>
+
+static constexpr u32 k_Rounds = 200;
+static constexpr u32 k_Arrays = 8;
+static constexpr u32 k_ElementsPerArray = 60000;
+
+/**
+ * @brief A growable u32 buffer that doubles its capacity when it is full, like a container's PushBack.
+ */
+struct GrowthBuffer {
+    u32* data = nullptr;
+    u32 size = 0;
+    u32 capacity = 0;
+
+};  // GrowthBuffer
+
+/**
+ * @brief Pushes k_ElementsPerArray values into k_Arrays interleaved buffers, so that growing buffers compete for their neighbours.
+ *
+ * @tparam Reallocate Grows with Allocator::Reallocate if true, with Allocate, memcpy and Deallocate otherwise.
+ */
+template <b8 Reallocate>
+static void GrowthWorkload(Allocator* allocator) {
+    GrowthBuffer buffers[k_Arrays];
+
+    for (u32 i = 0; i < k_ElementsPerArray; i++) {
+        for (GrowthBuffer& buffer : buffers) {
+            if (buffer.size == buffer.capacity) {
+                const u32 capacity = buffer.capacity ? buffer.capacity * 2 : 4;
+
+                if constexpr (Reallocate) {
+                    buffer.data = static_cast<u32*>(allocator->Reallocate(buffer.data, buffer.capacity * sizeof(u32), capacity * sizeof(u32), alignof(u32)));
+                }
+                else {
+                    u32* data = static_cast<u32*>(allocator->Allocate(capacity * sizeof(u32), alignof(u32)));
+
+                    if (buffer.data) {
+                        memcpy(data, buffer.data, buffer.size * sizeof(u32));
+                        allocator->Deallocate(buffer.data);
+                    }
+
+                    buffer.data = data;
+                }
+
+                buffer.capacity = capacity;
+            }
+
+            buffer.data[buffer.size++] = i;
+        }
+    }
+
+    for (GrowthBuffer& buffer : buffers) {
+        BenchmarkKeep(buffer.data[buffer.size - 1]);
+        allocator->Deallocate(buffer.data);
+    }
+}
+
+static void RunGrowth(const std::string& label, Allocator* allocator) {
+    const double copySeconds = BenchmarkTime([&]() {
+        for (u32 round = 0; round < k_Rounds; round++)
+            GrowthWorkload<false>(allocator);
+    });
+
+    const double reallocSeconds = BenchmarkTime([&]() {
+        for (u32 round = 0; round < k_Rounds; round++)
+            GrowthWorkload<true>(allocator);
+    });
+
+    const double pushes = static_cast<double>(k_Rounds) * k_Arrays * k_ElementsPerArray;
+
+    BENCHMARK_REPORT(label + " allocate + copy", pushes, copySeconds);
+    BENCHMARK_REPORT(label + " reallocate", pushes, reallocSeconds);
+}
+
+BENCHMARK_CASE(Allocator_PushBack_Growth) {
+    HeapAllocator heap;
+    heap.Init(omega(64));
+
+    MallocAllocator system;
+
+    RunGrowth("TLSF heap", &heap);
+    RunGrowth("malloc", &system);
+
+    heap.Shutdown();
+}
+
+BENCHMARK_CASE(DynamicArray_PushBack_Growth) {
+    const double seconds = BenchmarkTime([]() {
+        for (u32 round = 0; round < k_Rounds; round++) {
+            DynamicArray<u32> array;
+
+            for (u32 i = 0; i < k_ElementsPerArray; i++)
+                array.PushBack(i);
+
+            BenchmarkKeep(array.Back());
+        }
+    });
+
+    BENCHMARK_REPORT("DynamicArray<u32> PushBack", static_cast<double>(k_Rounds) * k_ElementsPerArray, seconds);
+}
@@ -0,0 +1,233 @@
+#include <Ocean/Primitives/RingBuffer.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+static constexpr u64 k_Items = 1 << 22;
+static constexpr u64 k_RoundTrips = 1 << 16;
+static constexpr sizet k_Capacity = 1024;
+static constexpr sizet k_Batch = 32;
+
+// The waits yield instead of spinning, so the numbers stay meaningful when there are more threads than cores.
+
+/** @brief The queue the engine would reach for without a ring, a deque behind a mutex. */
+class LockedQueue {
+public:
+    explicit LockedQueue(sizet capacity) :
+        m_Capacity(capacity)
+    { }
+
+    b8 TryPush(u64 value) {
+        std::lock_guard<std::mutex> lock(this->m_Lock);
+
+        if (this->m_Items.size() == this->m_Capacity)
+            return false;
+
+        this->m_Items.push_back(value);
+
+        return true;
+    }
+    b8 TryPop(u64& value) {
+        std::lock_guard<std::mutex> lock(this->m_Lock);
+
+        if (this->m_Items.empty())
+            return false;
+
+        value = this->m_Items.front();
+        this->m_Items.pop_front();
+
+        return true;
+    }
+
+private:
+    std::mutex m_Lock;
+    std::deque<u64> m_Items;
+    sizet m_Capacity;
+
+};  // LockedQueue
+
+/**
+ * @brief Moves k_Items values from the producers to the consumers one at a time, and times it.
+ */
+template <class Q>
+static double Throughput(Q& queue, u32 producers, u32 consumers) {
+    std::atomic<u64> consumed{ 0 };
+    std::vector<std::thread> threads;
+
+    return BenchmarkTime([&]() {
+        for (u32 p = 0; p < producers; p++) {
+            threads.emplace_back([&, p]() {
+                const u64 count = k_Items / producers;
+
+                for (u64 i = 0; i < count; ) {
+                    if (queue.TryPush(p * count + i))
+                        i++;
+                    else
+                        std::this_thread::yield();
+                }
+            });
+        }
+
+        for (u32 c = 0; c < consumers; c++) {
+            threads.emplace_back([&]() {
+                u64 sum = 0;
+                u64 value = 0;
+
+                while (consumed.load(std::memory_order_relaxed) < k_Items) {
+                    if (queue.TryPop(value)) {
+                        sum += value;
+                        consumed.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else {
+                        std::this_thread::yield();
+                    }
+                }
+
+                BenchmarkKeep(sum);
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+    });
+}
+
+/**
+ * @brief Moves k_Items values from the producers to the consumers in batches of k_Batch, and times it.
+ */
+template <class Q>
+static double BatchThroughput(Q& queue, u32 producers, u32 consumers) {
+    std::atomic<u64> consumed{ 0 };
+    std::vector<std::thread> threads;
+
+    return BenchmarkTime([&]() {
+        for (u32 p = 0; p < producers; p++) {
+            threads.emplace_back([&, p]() {
+                const u64 count = k_Items / producers;
+                u64 batch[k_Batch];
+
+                for (u64 i = 0; i < count; ) {
+                    const u64 size = count - i < k_Batch ? count - i : k_Batch;
+                    for (u64 j = 0; j < size; j++)
+                        batch[j] = p * count + i + j;
+
+                    const sizet pushed = queue.TryPushBatch(batch, size);
+                    if (pushed == 0)
+                        std::this_thread::yield();
+
+                    i += pushed;
+                }
+            });
+        }
+
+        for (u32 c = 0; c < consumers; c++) {
+            threads.emplace_back([&]() {
+                u64 sum = 0;
+                u64 out[k_Batch];
+
+                while (consumed.load(std::memory_order_relaxed) < k_Items) {
+                    const sizet popped = queue.TryPopBatch(out, k_Batch);
+
+                    if (popped == 0)
+                        std::this_thread::yield();
+
+                    for (sizet i = 0; i < popped; i++)
+                        sum += out[i];
+
+                    consumed.fetch_add(popped, std::memory_order_relaxed);
+                }
+
+                BenchmarkKeep(sum);
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+    });
+}
+
+BENCHMARK_CASE(Ring_Throughput) {
+    {
+        SpscRing<u64> ring(k_Capacity);
+        BENCHMARK_REPORT("SpscRing<u64> 1:1", k_Items, Throughput(ring, 1, 1));
+    }
+    {
+        SpscRing<u64> ring(k_Capacity);
+        BENCHMARK_REPORT("SpscRing<u64> 1:1 batch", k_Items, BatchThroughput(ring, 1, 1));
+    }
+
+    for (u32 threads = 1; threads <= 4; threads *= 2) {
+        const std::string label = std::to_string(threads) + ":" + std::to_string(threads);
+
+        {
+            LockedQueue queue(k_Capacity);
+            BENCHMARK_REPORT("Locked std::deque<u64> " + label, k_Items, Throughput(queue, threads, threads));
+        }
+        {
+            MpmcRing<u64> ring(k_Capacity);
+            BENCHMARK_REPORT("MpmcRing<u64> " + label, k_Items, Throughput(ring, threads, threads));
+        }
+        {
+            MpmcRing<u64> ring(k_Capacity);
+            BENCHMARK_REPORT("MpmcRing<u64> " + label + " batch", k_Items, BatchThroughput(ring, threads, threads));
+        }
+    }
+}
+
+/**
+ * @brief Bounces a value between two threads through a pair of queues, the time per round trip is twice the
+ * latency of a handoff.
+ */
+template <class Q>
+static double RoundTrips(Q& ping, Q& pong) {
+    return BenchmarkTime([&]() {
+        std::thread echo([&]() {
+            u64 value = 0;
+
+            for (u64 i = 0; i < k_RoundTrips; i++) {
+                while (!ping.TryPop(value))
+                    std::this_thread::yield();
+                while (!pong.TryPush(value + 1))
+                    std::this_thread::yield();
+            }
+        });
+
+        u64 value = 0;
+
+        for (u64 i = 0; i < k_RoundTrips; i++) {
+            while (!ping.TryPush(value))
+                std::this_thread::yield();
+            while (!pong.TryPop(value))
+                std::this_thread::yield();
+        }
+
+        echo.join();
+
+        BenchmarkKeep(value);
+    });
+}
+
+BENCHMARK_CASE(Ring_Latency) {
+    {
+        LockedQueue ping(k_Capacity);
+        LockedQueue pong(k_Capacity);
+        BENCHMARK_REPORT("Locked std::deque<u64> round trip", k_RoundTrips, RoundTrips(ping, pong));
+    }
+    {
+        SpscRing<u64> ping(k_Capacity);
+        SpscRing<u64> pong(k_Capacity);
+        BENCHMARK_REPORT("SpscRing<u64> round trip", k_RoundTrips, RoundTrips(ping, pong));
+    }
+    {
+        MpmcRing<u64> ping(k_Capacity);
+        MpmcRing<u64> pong(k_Capacity);
+        BENCHMARK_REPORT("MpmcRing<u64> round trip", k_RoundTrips, RoundTrips(ping, pong));
+    }
+}
@@ -0,0 +1,168 @@
+#include <Ocean/Primitives/HashMap.hpp>
+#include <Ocean/Primitives/SlotMap.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+static constexpr u32 k_Objects = 1 << 16;
+static constexpr u32 k_Lookups = 1 << 22;
+
+/** @brief Stands in for a texture or an audio buffer, a few words of state that a frame reads. */
+struct Resource {
+    u64 id;
+    u32 width;
+    u32 height;
+    u64 bytes;
+
+};  // Resource
+
+/**
+ * @brief Random indexes of the objects to look up, shared by every way of naming them.
+ */
+static std::vector<u32> RandomPicks(u64 seed) {
+    std::mt19937 random(static_cast<u32>(seed));
+    std::vector<u32> picks(k_Lookups);
+
+    for (u32& pick : picks)
+        pick = random() % k_Objects;
+
+    return picks;
+}
+
+BENCHMARK_CASE(SlotMap_Resolve) {
+    const std::vector<u32> picks = RandomPicks(1);
+
+    // Holding a Ref<> per user means every copy handed out touches the atomic count.
+    {
+        std::vector<std::shared_ptr<Resource>> objects;
+        for (u32 i = 0; i < k_Objects; i++)
+            objects.push_back(std::make_shared<Resource>(Resource{ i, 64, 64, 4096 }));
+
+        const double seconds = BenchmarkTime([&]() {
+            u64 sum = 0;
+
+            for (u32 pick : picks) {
+                const std::shared_ptr<Resource> ref = objects[pick];
+
+                sum += ref->bytes;
+            }
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("Ref<Resource> copy and read", k_Lookups, seconds);
+    }
+
+    // Looking a resource up by name, as the ResourceManager does.
+    {
+        HashMap<std::string, std::shared_ptr<Resource>> objects;
+        std::vector<std::string> names;
+
+        for (u32 i = 0; i < k_Objects; i++) {
+            names.push_back("resource/texture_" + std::to_string(i));
+            objects[names.back()] = std::make_shared<Resource>(Resource{ i, 64, 64, 4096 });
+        }
+
+        const double seconds = BenchmarkTime([&]() {
+            u64 sum = 0;
+
+            for (u32 pick : picks)
+                sum += objects.Find(names[pick].c_str())->value->bytes;
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("HashMap<std::string, Ref<Resource>> name lookup", k_Lookups, seconds);
+    }
+
+    {
+        SlotMap<Resource> objects;
+        std::vector<SlotHandle32> handles;
+
+        for (u32 i = 0; i < k_Objects; i++)
+            handles.push_back(objects.Insert(Resource{ i, 64, 64, 4096 }));
+
+        const double seconds = BenchmarkTime([&]() {
+            u64 sum = 0;
+
+            for (u32 pick : picks) {
+                const Resource* resource = objects.Get(handles[pick]);
+
+                if (resource)
+                    sum += resource->bytes;
+            }
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("SlotMap<Resource> checked handle lookup", k_Lookups, seconds);
+    }
+}
+
+BENCHMARK_CASE(SlotMap_Churn_And_Iterate) {
+    std::mt19937 random(2);
+
+    // Entities that spawn and despawn every frame, and a system that walks all of them.
+    {
+        std::vector<std::shared_ptr<Resource>> objects;
+        for (u32 i = 0; i < k_Objects; i++)
+            objects.push_back(std::make_shared<Resource>(Resource{ i, 1, 1, i }));
+
+        const double churnSeconds = BenchmarkTime([&]() {
+            for (u32 i = 0; i < k_Lookups / 4; i++) {
+                const u32 pick = random() % k_Objects;
+
+                objects[pick] = objects.back();
+                objects.back() = std::make_shared<Resource>(Resource{ i, 1, 1, i });
+            }
+        });
+
+        const double iterateSeconds = BenchmarkTime([&]() {
+            u64 sum = 0;
+
+            for (u32 pass = 0; pass < 64; pass++)
+                for (const std::shared_ptr<Resource>& object : objects)
+                    sum += object->bytes;
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("std::vector<Ref<Resource>> despawn and spawn", k_Lookups / 4, churnSeconds);
+        BENCHMARK_REPORT("std::vector<Ref<Resource>> iterate", k_Objects * 64, iterateSeconds);
+    }
+
+    {
+        SlotMap<Resource> objects;
+        std::vector<SlotHandle32> handles;
+
+        for (u32 i = 0; i < k_Objects; i++)
+            handles.push_back(objects.Insert(Resource{ i, 1, 1, i }));
+
+        const double churnSeconds = BenchmarkTime([&]() {
+            for (u32 i = 0; i < k_Lookups / 4; i++) {
+                const u32 pick = random() % k_Objects;
+
+                objects.Erase(handles[pick]);
+                handles[pick] = objects.Insert(Resource{ i, 1, 1, i });
+            }
+        });
+
+        const double iterateSeconds = BenchmarkTime([&]() {
+            u64 sum = 0;
+
+            for (u32 pass = 0; pass < 64; pass++)
+                for (const Resource& object : objects)
+                    sum += object.bytes;
+
+            BenchmarkKeep(sum);
+        });
+
+        BENCHMARK_REPORT("SlotMap<Resource> despawn and spawn", k_Lookups / 4, churnSeconds);
+        BENCHMARK_REPORT("SlotMap<Resource> iterate", k_Objects * 64, iterateSeconds);
+    }
+}
@@ -0,0 +1,48 @@
+#include <Ocean/Primitives/DynamicArray.hpp>
+#include <Ocean/Primitives/SmallArray.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <string>
+
+static constexpr u32 k_Rounds = 1000000;
+
+/**
+ * @brief Builds, walks and destroys a short list per round, like a vertex layout or a frame's list of images.
+ */
+template <class C>
+static double ShortListWorkload(u32 elements) {
+    return BenchmarkTime([&]() {
+        for (u32 round = 0; round < k_Rounds; round++) {
+            C list;
+
+            for (u32 i = 0; i < elements; i++)
+                list.PushBack(i + round);
+
+            u32 sum = 0;
+            for (u32 value : list)
+                sum += value;
+
+            BenchmarkKeep(sum);
+        }
+    });
+}
+
+static void Compare(u32 elements) {
+    const std::string label = std::to_string(elements) + " element list";
+
+    const double dynamicSeconds = ShortListWorkload<DynamicArray<u32>>(elements);
+    const double smallSeconds = ShortListWorkload<SmallArray<u32, 8>>(elements);
+
+    BENCHMARK_REPORT("DynamicArray<u32> " + label, k_Rounds, dynamicSeconds);
+    BENCHMARK_REPORT("SmallArray<u32, 8> " + label, k_Rounds, smallSeconds);
+}
+
+BENCHMARK_CASE(SmallArray_Short_Lists) {
+    Compare(4);
+    Compare(8);
+
+    // Past the inline capacity the SmallArray spills and behaves like a DynamicArray.
+    Compare(32);
+}
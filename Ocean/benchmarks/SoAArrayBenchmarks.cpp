@@ -0,0 +1,120 @@
+#include <Ocean/Primitives/SoAArray.hpp>
+#include <Ocean/Types/FloatingPoints.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <random>
+#include <vector>
+
+static constexpr u32 k_Particles = 1 << 20;
+static constexpr u32 k_Frames = 50;
+static constexpr f32 k_DeltaTime = 1.0f / 60.0f;
+
+/**
+ * @brief A particle as one struct, the fields an update loop reads sit between the ones only the renderer reads.
+ */
+struct Particle {
+    f32 x, y, z;
+    f32 velocityX, velocityY, velocityZ;
+    f32 lifetime;
+    f32 size;
+    f32 rotation;
+    u32 color;
+    u32 texture;
+    u32 flags;
+
+};  // Particle
+
+using ParticleStreams = SoAArray<f32, f32, f32, f32, f32, f32, f32, f32, f32, u32, u32, u32>;
+
+BENCHMARK_CASE(SoAArray_Particles) {
+    std::mt19937 random(3);
+    std::uniform_real_distribution<f32> value(-1.0f, 1.0f);
+
+    std::vector<Particle> particles;
+    particles.reserve(k_Particles);
+    ParticleStreams streams(k_Particles);
+
+    for (u32 i = 0; i < k_Particles; i++) {
+        const Particle particle { value(random), value(random), value(random), value(random), value(random),
+                                  value(random), value(random) + 1.0f, 1.0f, 0.0f, i, 0, 0 };
+
+        particles.push_back(particle);
+        streams.PushBack(particle.x, particle.y, particle.z, particle.velocityX, particle.velocityY,
+                         particle.velocityZ, particle.lifetime, particle.size, particle.rotation, particle.color,
+                         particle.texture, particle.flags);
+    }
+
+    {
+        // Integrates the positions and ages the particles, 7 of the 12 fields.
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 frame = 0; frame < k_Frames; frame++) {
+                for (Particle& particle : particles) {
+                    particle.x += particle.velocityX * k_DeltaTime;
+                    particle.y += particle.velocityY * k_DeltaTime;
+                    particle.z += particle.velocityZ * k_DeltaTime;
+                    particle.lifetime -= k_DeltaTime;
+                }
+            }
+
+            BenchmarkKeep(particles[k_Particles / 2].x);
+        });
+
+        BENCHMARK_REPORT("std::vector<Particle> update (particle frames)", k_Particles * k_Frames, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            f32* x = streams.Data<0>();
+            f32* y = streams.Data<1>();
+            f32* z = streams.Data<2>();
+            const f32* velocityX = streams.Data<3>();
+            const f32* velocityY = streams.Data<4>();
+            const f32* velocityZ = streams.Data<5>();
+            f32* lifetime = streams.Data<6>();
+
+            for (u32 frame = 0; frame < k_Frames; frame++) {
+                for (u32 i = 0; i < k_Particles; i++) {
+                    x[i] += velocityX[i] * k_DeltaTime;
+                    y[i] += velocityY[i] * k_DeltaTime;
+                    z[i] += velocityZ[i] * k_DeltaTime;
+                    lifetime[i] -= k_DeltaTime;
+                }
+            }
+
+            BenchmarkKeep(x[k_Particles / 2]);
+        });
+
+        BENCHMARK_REPORT("SoAArray particle streams update (particle frames)", k_Particles * k_Frames, seconds);
+    }
+
+    {
+        // Counts the live particles, a single field.
+        const double seconds = BenchmarkTime([&]() {
+            sizet alive = 0;
+
+            for (u32 frame = 0; frame < k_Frames; frame++)
+                for (const Particle& particle : particles)
+                    alive += particle.lifetime > 0.0f;
+
+            BenchmarkKeep(alive);
+        });
+
+        BENCHMARK_REPORT("std::vector<Particle> count alive (particle frames)", k_Particles * k_Frames, seconds);
+    }
+
+    {
+        const double seconds = BenchmarkTime([&]() {
+            sizet alive = 0;
+
+            for (u32 frame = 0; frame < k_Frames; frame++)
+                for (f32 lifetime : streams.Field<6>())
+                    alive += lifetime > 0.0f;
+
+            BenchmarkKeep(alive);
+        });
+
+        BENCHMARK_REPORT("SoAArray particle streams count alive (particle frames)", k_Particles * k_Frames, seconds);
+    }
+}
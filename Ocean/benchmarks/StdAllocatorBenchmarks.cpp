@@ -0,0 +1,93 @@
+#include <Ocean/Primitives/Memory.hpp>
+#include <Ocean/Primitives/StdAllocator.hpp>
+
+#include "./Base/Benchmarks.hpp"
+
+// std
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/** @brief The number of calls made to the global operator new. */
+static std::atomic<u64> s_GlobalNewCalls{ 0 };
+
+void* operator new(sizet size) {
+    s_GlobalNewCalls.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = malloc(size))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, OC_UNUSED sizet size) noexcept {
+    free(ptr);
+}
+
+static constexpr u32 k_Frames = 1000;
+static constexpr u32 k_EntriesPerFrame = 512;
+
+/**
+ * @brief Simulates the per-frame container traffic of a system that rebuilds a lookup table and an event list each frame.
+ */
+template <class Map, class Vector>
+static u64 SimulateFrame(Map& map, Vector& events) {
+    u64 sum = 0;
+
+    for (u32 i = 0; i < k_EntriesPerFrame; i++) {
+        map[i * 2654435761u] = i;
+        events.push_back(i);
+    }
+
+    for (u32 i = 0; i < k_EntriesPerFrame; i++)
+        sum += map[i * 2654435761u];
+
+    map.clear();
+    events.clear();
+    events.shrink_to_fit();
+
+    return sum;
+}
+
+static void Report(const std::string& label, u64 newCalls, double seconds) {
+    BENCHMARK_REPORT(label + " (" + std::to_string(newCalls / k_Frames) + " global new/frame)", static_cast<double>(k_Frames) * k_EntriesPerFrame, seconds);
+}
+
+BENCHMARK_CASE(StdAllocator_Frame_Container_Traffic) {
+    MemoryService::Instance().Init(nullptr);
+
+    {
+        std::unordered_map<u32, u32> map;
+        std::vector<u32> events;
+
+        const u64 before = s_GlobalNewCalls.load();
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 frame = 0; frame < k_Frames; frame++)
+                BenchmarkKeep(SimulateFrame(map, events));
+        });
+
+        Report("std::allocator", s_GlobalNewCalls.load() - before, seconds);
+    }
+
+    {
+        std::unordered_map<u32, u32, std::hash<u32>, std::equal_to<u32>, OceanStdAllocator<std::pair<const u32, u32>>> map;
+        std::vector<u32, OceanStdAllocator<u32>> events;
+
+        const u64 before = s_GlobalNewCalls.load();
+        const double seconds = BenchmarkTime([&]() {
+            for (u32 frame = 0; frame < k_Frames; frame++)
+                BenchmarkKeep(SimulateFrame(map, events));
+        });
+
+        Report("OceanStdAllocator (system heap)", s_GlobalNewCalls.load() - before, seconds);
+    }
+
+    MemoryService::Shutdown();
+}
@@ -1,10 +1,11 @@
 #pragma once
 #include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/HashMap.hpp"
 #include "Ocean/Primitives/Macros.hpp"
 #include "Ocean/Types/SmartPtrs.hpp"
+#include "Ocean/Types/Strings.hpp"
 #include "audio.hpp"
 #include <phonon.h>
-#include <unordered_map>
 
 namespace sonar{
     //classes with no definitions.
@@ -15,22 +16,27 @@ namespace sonar{
 
     class Ambisonic;
 
+    //maps named audio objects, the names are copied so the caller's strings can go away.
+    //the maps are static and live until exit, after the memory service shuts down, so they allocate with malloc.
+    template <class T>
+    using named_map = HashMap<String, Ref<T>, Hash<String>, EqualTo<String>, MallocPolicy>;
+
     struct global_audio_context{
         static sonar::steamaudio* audio;
         //in case i need to keep track of this stuff.
-        OC_STATIC_INLINE std::unordered_map<const char*, Ref<IPLAudioBuffer>> buffers;
-        OC_STATIC_INLINE std::unordered_map<const char*, Ref<IPLAudioBuffer>> inbuffers;
-        OC_STATIC_INLINE std::unordered_map<const char*, Ref<IPLAudioBuffer>> outbuffer;
+        OC_STATIC_INLINE named_map<IPLAudioBuffer> buffers;
+        OC_STATIC_INLINE named_map<IPLAudioBuffer> inbuffers;
+        OC_STATIC_INLINE named_map<IPLAudioBuffer> outbuffer;
         
-        OC_STATIC_INLINE std::unordered_map<const char*, Ref<IPLAudioBuffer>> tmpbuffer;
+        OC_STATIC_INLINE named_map<IPLAudioBuffer> tmpbuffer;
 
 
-        static std::unordered_map<const char*, Ref<sonar::HRTF>> hrtfs;
+        static named_map<sonar::HRTF> hrtfs;
         
-        static std::unordered_map<const char*, Ref<sonar::Binaural>> binaural;
+        static named_map<sonar::Binaural> binaural;
+
+        static named_map<sonar::Ambisonic> ambisonics;
 
-        static std::unordered_map<const char*, Ref<sonar::Ambisonic>> ambisonics;
-        
 
 
 
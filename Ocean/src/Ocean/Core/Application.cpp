@@ -4,6 +4,8 @@
 #include "Ocean/Primitives/Log.hpp"
 #include "Ocean/Primitives/Time.hpp"
 
+#include "Ocean/Core/ResourceManager.hpp"
+
 #include "Ocean/Renderer/Renderer.hpp"
 
 namespace Ocean {
@@ -30,6 +32,9 @@ namespace Ocean {
 
 	Application::~Application() {
 		Renderer::Shutdown();
+
+		// Resources are stored in maps allocated from the MemoryService, so they are released while it is alive.
+		ResourceManager::Clear();
 	}
 
 	void Application::Close() {
@@ -72,6 +77,7 @@ namespace Ocean {
 				time -= 5.0f;
 				oprint("Frames per 5 seconds: %i (%f fps)\n", frameCount, frameCount / 5.0f);
 				oprint("Fixed Updates per 5 seconds: %i (%f ups)\n", accumulatorCounter, accumulatorCounter / 5.0f);
+				oprint("Peak frame allocator usage: %llu bytes\n", MemoryService::Instance().PeakFrameHighWaterMark());
 				frameCount = accumulatorCounter = 0;
 			}
 
@@ -128,7 +134,8 @@ namespace Ocean {
 		
 	}
 	void Application::FrameEnd() {
-		
+		// Releases the frame allocator memory of the oldest frame.
+		MemoryService::Instance().EndFrame();
 	}
 
 	void Application::OnResize(u16 width, u16 height) {
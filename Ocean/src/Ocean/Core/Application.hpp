@@ -153,7 +153,7 @@ namespace Ocean {
 		 */
 		void Render(f32 interpolation);
 		/**
-		 * @brief Runs at the end of each frame.
+		 * @brief Runs at the end of each frame. Advances the MemoryService's frame allocator.
 		 */
 		void FrameEnd();
 
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Ocean/Primitives/DynamicArray.hpp"
+#include "Ocean/Primitives/SmallArray.hpp"
 
 #include "Ocean/Core/Layers/Layer.hpp"
 
@@ -10,6 +10,12 @@ namespace Ocean {
      * @brief A LayerStack manages pushing and popping Layers in a simple manner.
      */
     class LayerStack {
+    private:
+        /** @brief The number of Layers stored inline, applications rarely push more. */
+        OC_STATIC_EXPR sizet k_InlineLayers = 8;
+
+        using LayerArray = SmallArray<Layer*, k_InlineLayers>;
+
     public:
         LayerStack() : m_Layers(), m_InsertIndex(0) { }
         ~LayerStack();
@@ -43,32 +49,32 @@ namespace Ocean {
         /**
          * @brief Get's the first layer as an iterator.
          * 
-         * @return DynamicArray<Layer*>::Iterator 
+         * @return LayerArray::Iterator 
          */
-        OC_INLINE DynamicArray<Layer*>::Iterator begin() { return m_Layers.Begin(); }
+        OC_INLINE LayerArray::Iterator begin() { return m_Layers.Begin(); }
         /**
          * @brief Get's the first layer as a const-iterator.
          * 
-         * @return DynamicArray<Layer*>::ConstIterator 
+         * @return LayerArray::ConstIterator 
          */
-         OC_INLINE DynamicArray<Layer*>::ConstIterator begin() const { return m_Layers.Begin(); }
+         OC_INLINE LayerArray::ConstIterator begin() const { return m_Layers.Begin(); }
 
         /**
          * @brief Get's the last layer as an iterator.
          * 
-         * @return DynamicArray<Layer*>::Iterator 
+         * @return LayerArray::Iterator 
          */
-         OC_INLINE DynamicArray<Layer*>::Iterator end() { return m_Layers.End(); }
+         OC_INLINE LayerArray::Iterator end() { return m_Layers.End(); }
         /**
          * @brief Get's the last layer as a const-iterator.
          * 
-         * @return DynamicArray<Layer*>::ConstIterator 
+         * @return LayerArray::ConstIterator 
          */
-         OC_INLINE DynamicArray<Layer*>::ConstIterator end() const { return m_Layers.End(); }
+         OC_INLINE LayerArray::ConstIterator end() const { return m_Layers.End(); }
 
     private:
         /** @brief An array of Layer pointers representing a layerstack. */
-        DynamicArray<Layer*> m_Layers;
+        LayerArray m_Layers;
 
         /** @brief Records the index of the last non-overlay Layer in the layerstack. */
         u32 m_InsertIndex;
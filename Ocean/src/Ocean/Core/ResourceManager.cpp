@@ -44,14 +44,24 @@ namespace Ocean {
     }
 
     void ResourceManager::Clear() {
-        Instance()->m_Shaders.clear();
-        Instance()->m_Textures.clear();
-        Instance()->m_Fonts.clear();
+        Instance()->m_Shaders.Clear();
+        Instance()->m_Textures.Clear();
+        Instance()->m_Fonts.Clear();
+
+        // Clearing keeps the memory, which comes from the MemoryService, so it is released too.
+        //
+        Instance()->m_Shaders.ShrinkToFit();
+        Instance()->m_Textures.ShrinkToFit();
+        Instance()->m_Fonts.ShrinkToFit();
     }
 
 
 
-    ResourceManager::ResourceManager() : m_Shaders(), m_Textures(), m_Fonts() {
+    ResourceManager::ResourceManager() :
+        m_Shaders(oTagAllocator(MEMORY_TAG_RESOURCES)),
+        m_Textures(oTagAllocator(MEMORY_TAG_RESOURCES)),
+        m_Fonts(oTagAllocator(MEMORY_TAG_RESOURCES))
+    {
 
     }
 
@@ -3,11 +3,9 @@
 #include "Ocean/Types/SmartPtrs.hpp"
 #include "Ocean/Types/Strings.hpp"
 
+#include "Ocean/Primitives/HashMap.hpp"
 #include "Ocean/Primitives/Macros.hpp"
 
-// std
-#include <map>
-
 namespace Ocean {
 
     namespace Splash {
@@ -82,6 +80,8 @@ namespace Ocean {
 
         /**
          * @brief Clears all of the loaded items.
+         * 
+         * @note Must be called before the MemoryService is shut down, as the item maps are allocated from it.
          */
         OC_STATIC void Clear();
 
@@ -117,13 +117,18 @@ namespace Ocean {
          */
         Ref<Splash::Font> LoadFontFile(cstring path);
 
+    private:
+        /** @brief The resources of one type by name, allocated from the resources tag. */
+        template <class T>
+        using ResourceMap = HashMap<String, Ref<T>, Hash<String>, EqualTo<String>, AllocatorRef<TaggedAllocator>>;
+
     private:
 
         OC_STATIC_INLINE Scope<ResourceManager> s_Instance = MakeScope<ResourceManager>(); /** @brief The ResourceManager's singleton instance. */
 
-        std::map<cstring, Ref<Splash::Shader>> m_Shaders; /** @brief The Splash::Shader objects stored. */
-        std::map<cstring, Ref<Splash::Texture2D>> m_Textures; /** @brief The Splash::Texture2D objects stored. */
-        std::map<cstring, Ref<Splash::Font>> m_Fonts; /** @brief The Splash::Font objects stored. */
+        ResourceMap<Splash::Shader> m_Shaders; /** @brief The Splash::Shader objects stored. */
+        ResourceMap<Splash::Texture2D> m_Textures; /** @brief The Splash::Texture2D objects stored. */
+        ResourceMap<Splash::Font> m_Fonts; /** @brief The Splash::Font objects stored. */
 
     };
 
@@ -8,6 +8,7 @@
 #include "Ocean/Types/Timestep.hpp"
 #include "Ocean/Types/Bix.hpp"
 #include "Ocean/Types/Bitrix.hpp"
+#include "Ocean/Types/Bitrix3D.hpp"
 
 #include "Ocean/Primitives/Assert.hpp"
 #include "Ocean/Primitives/Exceptions.hpp"
@@ -17,6 +18,18 @@
 #include "Ocean/Primitives/Time.hpp"
 #include "Ocean/Primitives/FixedArray.hpp"
 #include "Ocean/Primitives/DynamicArray.hpp"
+#include "Ocean/Primitives/SmallArray.hpp"
+#include "Ocean/Primitives/SoAArray.hpp"
+#include "Ocean/Primitives/HashMap.hpp"
+#include "Ocean/Primitives/OrderedMap.hpp"
+#include "Ocean/Primitives/SlotMap.hpp"
+#include "Ocean/Primitives/RingBuffer.hpp"
+#include "Ocean/Primitives/IntrusiveList.hpp"
+#include "Ocean/Primitives/SinglyLinkedList.hpp"
+#include "Ocean/Primitives/CsrGraph.hpp"
+#include "Ocean/Primitives/BitrixGraph.hpp"
+#include "Ocean/Primitives/BitSet.hpp"
+#include "Ocean/Primitives/BitVector.hpp"
 
 // #include "Ocean/Core/Input/Input.hpp"
 
@@ -0,0 +1,361 @@
+#include "AllocationProfiler.hpp"
+
+#ifdef OC_DETAILED_ALLOCATIONS
+
+// std
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+/**
+ * @brief The counters of a single MemoryTag on one thread.
+ */
+struct ProfilerTagCounters {
+	std::atomic<u64> allocationCount; /** @brief The number of allocations made. */
+	std::atomic<u64> deallocationCount; /** @brief The number of deallocations made. */
+
+	std::atomic<u64> allocatedBytes; /** @brief The total number of bytes allocated. */
+	std::atomic<u64> freedBytes; /** @brief The total number of bytes freed. */
+
+	std::atomic<u64> histogram[k_AllocationHistogramBuckets]; /** @brief Allocation counts per size bucket. */
+
+};	// ProfilerTagCounters
+
+/**
+ * @brief The counters of a single call site on one thread.
+ */
+struct ProfilerCallSite {
+	std::atomic<cstring> file; /** @brief The file of the call site, nullptr if the slot is unused. */
+	u32 line; /** @brief The line of the call site, written before file is published. */
+
+	std::atomic<u64> allocationCount; /** @brief The number of allocations requested. */
+	std::atomic<u64> requestedBytes; /** @brief The total number of bytes requested. */
+
+};	// ProfilerCallSite
+
+/**
+ * @brief The counters of one thread. Only the owning thread writes, any thread may read while merging.
+ */
+struct ProfilerThreadData {
+	ProfilerTagCounters tags[MEMORY_TAG_COUNT]; /** @brief The counters per MemoryTag. */
+	ProfilerCallSite callSites[AllocationProfiler::k_MaxThreadCallSites]; /** @brief An open addressed call site table. */
+
+	ProfilerThreadData* next; /** @brief The next registered thread. */
+
+};	// ProfilerThreadData
+
+/** @brief Guards the thread list and the peaks. */
+static std::mutex s_ProfilerLock;
+/** @brief Every thread that has recorded anything. Thread data is never freed so counters of exited threads stay counted. */
+static ProfilerThreadData* s_ProfilerThreads = nullptr;
+/** @brief The peak live bytes per MemoryTag seen at a merge. */
+static u64 s_PeakLiveBytes[MEMORY_TAG_COUNT] = { };
+
+static thread_local ProfilerThreadData* t_ProfilerData = nullptr;
+
+static cstring s_TagNames[MEMORY_TAG_COUNT] = {
+	"General",
+	"Frame",
+	"Renderer",
+	"Audio",
+	"Resources",
+	"ECS",
+	"Scratch",
+};
+
+/**
+ * @brief Adds to a counter that only the calling thread writes, avoiding a locked read-modify-write.
+ *
+ * @param counter The counter.
+ * @param value The value to add.
+ */
+OC_STATIC_INLINE void oBumpCounter(std::atomic<u64>& counter, u64 value) {
+	counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Gets the calling thread's counters, registering the thread on first use.
+ *
+ * @return ProfilerThreadData&
+ */
+static ProfilerThreadData& oProfilerThreadData() {
+	if (t_ProfilerData)
+		return *t_ProfilerData;
+
+	// Allocated from malloc so the profiler never recurses into the allocators it watches.
+	//
+	ProfilerThreadData* data = new (malloc(sizeof(ProfilerThreadData))) ProfilerThreadData();
+
+	std::lock_guard<std::mutex> lock(s_ProfilerLock);
+
+	data->next = s_ProfilerThreads;
+	s_ProfilerThreads = data;
+
+	t_ProfilerData = data;
+	return *data;
+}
+
+/**
+ * @brief Merges the live bytes of every thread per tag and updates the peaks. Expects the lock to be held.
+ *
+ * @param live The live bytes per tag to write to.
+ */
+static void oMergeLiveBytes(u64 (&live)[MEMORY_TAG_COUNT]) {
+	for (u8 tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+		u64 allocated = 0;
+		u64 freed = 0;
+
+		for (ProfilerThreadData* data = s_ProfilerThreads; data; data = data->next) {
+			allocated += data->tags[tag].allocatedBytes.load(std::memory_order_relaxed);
+			freed += data->tags[tag].freedBytes.load(std::memory_order_relaxed);
+		}
+
+		// The threads are not read at a single point in time, so a free may be seen before its allocation.
+		//
+		live[tag] = allocated > freed ? allocated - freed : 0;
+
+		if (live[tag] > s_PeakLiveBytes[tag])
+			s_PeakLiveBytes[tag] = live[tag];
+	}
+}
+
+/**
+ * @brief Writes a string as a JSON string literal.
+ *
+ * @param file The file to write to.
+ * @param string The string to write.
+ */
+static void oWriteJsonString(FILE* file, cstring string) {
+	fputc('"', file);
+
+	for (; *string; string++) {
+		if (*string == '"' || *string == '\\')
+			fputc('\\', file);
+
+		fputc(*string, file);
+	}
+
+	fputc('"', file);
+}
+
+// Allocation Profiler
+
+void AllocationProfiler::RecordAllocate(MemoryTag tag, sizet size) {
+	ProfilerTagCounters& counters = oProfilerThreadData().tags[tag];
+
+	oBumpCounter(counters.allocationCount, 1);
+	oBumpCounter(counters.allocatedBytes, size);
+	oBumpCounter(counters.histogram[HistogramBucket(size)], 1);
+}
+
+void AllocationProfiler::RecordDeallocate(MemoryTag tag, sizet size, u64 count) {
+	ProfilerTagCounters& counters = oProfilerThreadData().tags[tag];
+
+	oBumpCounter(counters.deallocationCount, count);
+	oBumpCounter(counters.freedBytes, size);
+}
+
+void AllocationProfiler::RecordCallSite(cstring file, u32 line, sizet size) {
+	ProfilerThreadData& data = oProfilerThreadData();
+
+	const u32 mask = k_MaxThreadCallSites - 1;
+	u32 index = static_cast<u32>((reinterpret_cast<uintptr_t>(file) >> 3) ^ (line * 0x9E3779B1u)) & mask;
+
+	for (u32 probe = 0; probe < k_MaxThreadCallSites; probe++, index = (index + 1) & mask) {
+		ProfilerCallSite& site = data.callSites[index];
+		cstring siteFile = site.file.load(std::memory_order_relaxed);
+
+		if (!siteFile) {
+			site.line = line;
+			site.file.store(file, std::memory_order_release);
+		}
+		else if (siteFile != file || site.line != line)
+			continue;
+
+		oBumpCounter(site.allocationCount, 1);
+		oBumpCounter(site.requestedBytes, size);
+
+		return;
+	}
+}
+
+void AllocationProfiler::Sample() {
+	u64 live[MEMORY_TAG_COUNT];
+
+	std::lock_guard<std::mutex> lock(s_ProfilerLock);
+
+	oMergeLiveBytes(live);
+}
+
+void AllocationProfiler::Snapshot(AllocationSnapshot& snapshot) {
+	memset(&snapshot, 0, sizeof(AllocationSnapshot));
+
+	std::lock_guard<std::mutex> lock(s_ProfilerLock);
+
+	u64 live[MEMORY_TAG_COUNT];
+	oMergeLiveBytes(live);
+
+	for (u8 tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+		AllocationTagStats& stats = snapshot.tags[tag];
+
+		for (ProfilerThreadData* data = s_ProfilerThreads; data; data = data->next) {
+			const ProfilerTagCounters& counters = data->tags[tag];
+
+			stats.allocationCount += counters.allocationCount.load(std::memory_order_relaxed);
+			stats.deallocationCount += counters.deallocationCount.load(std::memory_order_relaxed);
+			stats.allocatedBytes += counters.allocatedBytes.load(std::memory_order_relaxed);
+			stats.freedBytes += counters.freedBytes.load(std::memory_order_relaxed);
+
+			for (u32 i = 0; i < k_AllocationHistogramBuckets; i++)
+				stats.histogram[i] += counters.histogram[i].load(std::memory_order_relaxed);
+		}
+
+		stats.liveBytes = live[tag];
+		stats.peakLiveBytes = s_PeakLiveBytes[tag];
+	}
+
+	// The same call site can be seen through different string literals from different translation units.
+	//
+	for (ProfilerThreadData* data = s_ProfilerThreads; data; data = data->next) {
+		for (const ProfilerCallSite& site : data->callSites) {
+			cstring file = site.file.load(std::memory_order_acquire);
+			if (!file)
+				continue;
+
+			u32 i = 0;
+			while (i < snapshot.callSiteCount && (snapshot.callSites[i].line != site.line || strcmp(snapshot.callSites[i].file, file) != 0))
+				i++;
+
+			if (i == snapshot.callSiteCount) {
+				if (i == AllocationSnapshot::k_MaxCallSites)
+					continue;
+
+				snapshot.callSites[i].file = file;
+				snapshot.callSites[i].line = site.line;
+				snapshot.callSiteCount++;
+			}
+
+			snapshot.callSites[i].allocationCount += site.allocationCount.load(std::memory_order_relaxed);
+			snapshot.callSites[i].requestedBytes += site.requestedBytes.load(std::memory_order_relaxed);
+		}
+	}
+
+	std::sort(snapshot.callSites, snapshot.callSites + snapshot.callSiteCount, [](const AllocationCallSiteStats& a, const AllocationCallSiteStats& b) {
+		return a.requestedBytes > b.requestedBytes;
+	});
+}
+
+b8 AllocationProfiler::ExportJson(cstring path) {
+	FILE* file = fopen(path, "w");
+	if (!file)
+		return false;
+
+	AllocationSnapshot* snapshot = static_cast<AllocationSnapshot*>(malloc(sizeof(AllocationSnapshot)));
+	Snapshot(*snapshot);
+
+	fprintf(file, "{\n\t\"tags\": [\n");
+
+	for (u8 tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+		const AllocationTagStats& stats = snapshot->tags[tag];
+
+		fprintf(file, "\t\t{ \"name\": \"%s\", \"allocations\": %llu, \"deallocations\": %llu, \"allocatedBytes\": %llu, \"freedBytes\": %llu, \"liveBytes\": %llu, \"peakLiveBytes\": %llu, \"histogram\": [",
+			s_TagNames[tag],
+			static_cast<unsigned long long>(stats.allocationCount),
+			static_cast<unsigned long long>(stats.deallocationCount),
+			static_cast<unsigned long long>(stats.allocatedBytes),
+			static_cast<unsigned long long>(stats.freedBytes),
+			static_cast<unsigned long long>(stats.liveBytes),
+			static_cast<unsigned long long>(stats.peakLiveBytes)
+		);
+
+		for (u32 i = 0; i < k_AllocationHistogramBuckets; i++)
+			fprintf(file, i == 0 ? "%llu" : ", %llu", static_cast<unsigned long long>(stats.histogram[i]));
+
+		fprintf(file, tag + 1 < MEMORY_TAG_COUNT ? "] },\n" : "] }\n");
+	}
+
+	fprintf(file, "\t],\n\t\"callSites\": [\n");
+
+	for (u32 i = 0; i < snapshot->callSiteCount; i++) {
+		const AllocationCallSiteStats& site = snapshot->callSites[i];
+
+		fprintf(file, "\t\t{ \"file\": ");
+		oWriteJsonString(file, site.file);
+		fprintf(file, ", \"line\": %u, \"allocations\": %llu, \"requestedBytes\": %llu }%s\n",
+			site.line,
+			static_cast<unsigned long long>(site.allocationCount),
+			static_cast<unsigned long long>(site.requestedBytes),
+			i + 1 < snapshot->callSiteCount ? "," : ""
+		);
+	}
+
+	fprintf(file, "\t]\n}\n");
+
+	free(snapshot);
+	return fclose(file) == 0;
+}
+
+b8 AllocationProfiler::ExportCsv(cstring path) {
+	FILE* file = fopen(path, "w");
+	if (!file)
+		return false;
+
+	AllocationSnapshot* snapshot = static_cast<AllocationSnapshot*>(malloc(sizeof(AllocationSnapshot)));
+	Snapshot(*snapshot);
+
+	fprintf(file, "kind,name,line,allocations,deallocations,allocated_bytes,freed_bytes,live_bytes,peak_live_bytes");
+	for (u32 i = 0; i < k_AllocationHistogramBuckets; i++)
+		fprintf(file, ",le_2^%u", i);
+
+	fprintf(file, "\n");
+
+	for (u8 tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+		const AllocationTagStats& stats = snapshot->tags[tag];
+
+		fprintf(file, "tag,%s,,%llu,%llu,%llu,%llu,%llu,%llu",
+			s_TagNames[tag],
+			static_cast<unsigned long long>(stats.allocationCount),
+			static_cast<unsigned long long>(stats.deallocationCount),
+			static_cast<unsigned long long>(stats.allocatedBytes),
+			static_cast<unsigned long long>(stats.freedBytes),
+			static_cast<unsigned long long>(stats.liveBytes),
+			static_cast<unsigned long long>(stats.peakLiveBytes)
+		);
+
+		for (u32 i = 0; i < k_AllocationHistogramBuckets; i++)
+			fprintf(file, ",%llu", static_cast<unsigned long long>(stats.histogram[i]));
+
+		fprintf(file, "\n");
+	}
+
+	// Call sites only know what was requested, the remaining columns stay empty.
+	//
+	for (u32 i = 0; i < snapshot->callSiteCount; i++) {
+		const AllocationCallSiteStats& site = snapshot->callSites[i];
+
+		fprintf(file, "site,\"%s\",%u,%llu,,%llu,,,",
+			site.file,
+			site.line,
+			static_cast<unsigned long long>(site.allocationCount),
+			static_cast<unsigned long long>(site.requestedBytes)
+		);
+
+		for (u32 j = 0; j < k_AllocationHistogramBuckets; j++)
+			fputc(',', file);
+
+		fprintf(file, "\n");
+	}
+
+	free(snapshot);
+	return fclose(file) == 0;
+}
+
+cstring AllocationProfiler::TagName(MemoryTag tag) {
+	return tag < MEMORY_TAG_COUNT ? s_TagNames[tag] : "Unknown";
+}
+
+#endif
@@ -0,0 +1,182 @@
+#pragma once
+
+/**
+ * @file AllocationProfiler.hpp
+ * @brief Records allocation counts, bytes and size histograms per memory tag and per call site.
+ *
+ * @details The profiler only exists when OC_DETAILED_ALLOCATIONS is defined (see the Ocean_ALLOCATION_PROFILING
+ * CMake option). Without it every OC_PROFILE_* macro expands to a no-op, so the allocators pay no cost at all.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+#include "Ocean/Types/Strings.hpp"
+
+#include "Ocean/Primitives/BitKernels.hpp"
+#include "Ocean/Primitives/Macros.hpp"
+
+/**
+ * @brief The tag of an allocator, used to group allocations in the profiler.
+ */
+enum MemoryTag : u8 {
+	MEMORY_TAG_GENERAL = 0,
+	MEMORY_TAG_FRAME,
+	MEMORY_TAG_RENDERER,
+	MEMORY_TAG_AUDIO,
+	MEMORY_TAG_RESOURCES,
+	MEMORY_TAG_ECS,
+	MEMORY_TAG_SCRATCH,
+	MEMORY_TAG_COUNT,
+
+};	// MemoryTag
+
+#ifdef OC_DETAILED_ALLOCATIONS
+
+/** @brief The number of buckets in a size histogram, the last bucket also holds every larger size. */
+OC_STATIC_EXPR u32 k_AllocationHistogramBuckets = 40;
+
+/** @brief Records an allocation of the given size for the tag. */
+#define OC_PROFILE_ALLOCATE(tag, size)          AllocationProfiler::RecordAllocate(tag, size)
+/** @brief Records a deallocation of the given size for the tag. */
+#define OC_PROFILE_DEALLOCATE(tag, size)        AllocationProfiler::RecordDeallocate(tag, size, 1)
+/** @brief Records that count allocations totalling size bytes were released at once, i.e. an arena reset. */
+#define OC_PROFILE_RELEASE(tag, size, count)    AllocationProfiler::RecordDeallocate(tag, size, count)
+/** @brief Records an allocation request at the current file and line. */
+#define OC_PROFILE_CALL_SITE(size)              AllocationProfiler::RecordCallSite(__FILE__, __LINE__, size)
+
+/**
+ * @brief The merged statistics of a single MemoryTag.
+ */
+struct AllocationTagStats {
+	u64 allocationCount; /** @brief The number of allocations made. */
+	u64 deallocationCount; /** @brief The number of deallocations made. */
+
+	u64 allocatedBytes; /** @brief The total number of bytes allocated. */
+	u64 freedBytes; /** @brief The total number of bytes freed. */
+
+	u64 liveBytes; /** @brief The number of bytes currently allocated. */
+	u64 peakLiveBytes; /** @brief The highest number of live bytes seen at a sample point. */
+
+	u64 histogram[k_AllocationHistogramBuckets]; /** @brief Allocation counts per size bucket, bucket i holds sizes in (2^(i - 1), 2^i]. */
+
+};	// AllocationTagStats
+
+/**
+ * @brief The merged statistics of a single allocation call site.
+ */
+struct AllocationCallSiteStats {
+	cstring file; /** @brief The file of the call site. */
+	u32 line; /** @brief The line of the call site. */
+
+	u64 allocationCount; /** @brief The number of allocations requested. */
+	u64 requestedBytes; /** @brief The total number of bytes requested. */
+
+};	// AllocationCallSiteStats
+
+/**
+ * @brief A merged view of every thread's counters at one point in time.
+ */
+struct AllocationSnapshot {
+	/** @brief The maximum number of distinct call sites in a snapshot. */
+	OC_STATIC_EXPR u32 k_MaxCallSites = 1024;
+
+	AllocationTagStats tags[MEMORY_TAG_COUNT]; /** @brief The statistics per MemoryTag. */
+
+	u32 callSiteCount; /** @brief The number of call sites in the snapshot. */
+	AllocationCallSiteStats callSites[k_MaxCallSites]; /** @brief The call sites sorted by requested bytes, largest first. */
+
+};	// AllocationSnapshot
+
+/**
+ * @brief A low overhead allocation profiler.
+ *
+ * @details Every thread records into its own counters without any locks or shared atomics. The counters are merged
+ * on demand when a snapshot is taken. Live bytes are exact at merge time, the peak is updated at every merge, so
+ * calling Sample() once a frame tracks the peak at frame granularity.
+ */
+class AllocationProfiler {
+public:
+	/** @brief The number of call sites a single thread can track, further call sites are dropped. */
+	OC_STATIC_EXPR u32 k_MaxThreadCallSites = 256;
+
+public:
+	/**
+	 * @brief Records an allocation on the calling thread.
+	 *
+	 * @param tag The MemoryTag of the allocator.
+	 * @param size The size in bytes of the allocation.
+	 */
+	static void RecordAllocate(MemoryTag tag, sizet size);
+	/**
+	 * @brief Records one or more deallocations on the calling thread.
+	 *
+	 * @param tag The MemoryTag of the allocator.
+	 * @param size The total size in bytes that was freed.
+	 * @param count The number of allocations that were freed.
+	 */
+	static void RecordDeallocate(MemoryTag tag, sizet size, u64 count);
+	/**
+	 * @brief Records an allocation request at the given call site on the calling thread.
+	 *
+	 * @param file The file of the call site, must be a string literal.
+	 * @param line The line of the call site.
+	 * @param size The requested size in bytes.
+	 */
+	static void RecordCallSite(cstring file, u32 line, sizet size);
+
+	/**
+	 * @brief Merges the live bytes of every thread and updates the peaks, without building a full snapshot.
+	 */
+	static void Sample();
+	/**
+	 * @brief Merges the counters of every thread into the snapshot.
+	 *
+	 * @param snapshot The snapshot to write to.
+	 */
+	static void Snapshot(AllocationSnapshot& snapshot);
+
+	/**
+	 * @brief Writes a snapshot as JSON to the given path.
+	 *
+	 * @param path The file to write to.
+	 * @return b8 - True if the file was written.
+	 */
+	static b8 ExportJson(cstring path);
+	/**
+	 * @brief Writes a snapshot as CSV to the given path, one row per tag followed by one row per call site.
+	 *
+	 * @param path The file to write to.
+	 * @return b8 - True if the file was written.
+	 */
+	static b8 ExportCsv(cstring path);
+
+	/**
+	 * @brief Gets the name of a MemoryTag.
+	 *
+	 * @param tag The MemoryTag.
+	 * @return cstring
+	 */
+	static cstring TagName(MemoryTag tag);
+
+	/**
+	 * @brief Gets the histogram bucket of the given size.
+	 *
+	 * @param size The size in bytes.
+	 * @return u32
+	 */
+	static u32 HistogramBucket(sizet size) {
+		const u32 bucket = size <= 1 ? 0 : 1 + oLastBit(static_cast<u64>(size) - 1);
+
+		return bucket < k_AllocationHistogramBuckets ? bucket : k_AllocationHistogramBuckets - 1;
+	}
+
+};	// AllocationProfiler
+
+#else
+
+#define OC_PROFILE_ALLOCATE(tag, size)          static_cast<void>(0)
+#define OC_PROFILE_DEALLOCATE(tag, size)        static_cast<void>(0)
+#define OC_PROFILE_RELEASE(tag, size, count)    static_cast<void>(0)
+#define OC_PROFILE_CALL_SITE(size)              static_cast<void>(0)
+
+#endif
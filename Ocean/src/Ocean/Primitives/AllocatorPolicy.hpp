@@ -0,0 +1,209 @@
+#pragma once
+
+/**
+ * @file AllocatorPolicy.hpp
+ * @brief Allocator policies that containers take as a template parameter, so their allocator is chosen at compile time.
+ *
+ * @details A policy has the same Allocate, Deallocate and Reallocate signatures as an Allocator, so the oalloc* macros
+ * work on a pointer to one. None of the calls go through the Allocator vtable, the common path of a final allocator
+ * inlines into the container. Stateless policies are empty, stateful ones hold a pointer to the allocator to use.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+#include "Ocean/Primitives/Macros.hpp"
+#include "Ocean/Primitives/Memory.hpp"
+
+// std
+#include <cstddef>
+#include <cstdlib>
+#include <type_traits>
+
+/**
+ * @brief A stateless policy that allocates with malloc, realloc and free. The default of Ocean's containers.
+ *
+ * @details Alignments beyond alignof(max_align_t), which malloc doesn't guarantee, go through oAlignedAlloc() and
+ * oAlignedRealloc() instead.
+ */
+class MallocPolicy {
+public:
+    /**
+     * @copydoc Allocator::Allocate()
+     */
+    void* Allocate(sizet size, sizet alignment = alignof(max_align_t)) {
+        // Like the MallocAllocator only allocations are counted, not bytes.
+        OC_PROFILE_ALLOCATE(MEMORY_TAG_GENERAL, 0);
+
+        return oAlignedAlloc(size, alignment);
+    }
+
+    /**
+     * @copydoc Allocator::Deallocate()
+     */
+    void Deallocate(void* ptr) {
+        OC_PROFILE_DEALLOCATE(MEMORY_TAG_GENERAL, 0);
+
+        oAlignedFree(ptr);
+    }
+
+    /**
+     * @copydoc Allocator::Reallocate()
+     */
+    void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment = alignof(max_align_t)) {
+        if (newSize == 0) {
+            Deallocate(ptr);
+
+            return nullptr;
+        }
+
+        if (!ptr)
+            OC_PROFILE_ALLOCATE(MEMORY_TAG_GENERAL, 0);
+
+        return oAlignedRealloc(ptr, oldSize, newSize, alignment);
+    }
+
+    b8 operator == (const MallocPolicy&) const { return true; }
+    b8 operator != (const MallocPolicy&) const { return false; }
+
+};  // MallocPolicy
+
+/**
+ * @brief A stateless policy that allocates from the MemoryService's system heap.
+ */
+class SystemPolicy {
+public:
+    /**
+     * @copydoc Allocator::Allocate()
+     */
+    void* Allocate(sizet size, sizet alignment = alignof(max_align_t)) {
+        return oSystemAllocator->Allocate(size, alignment);
+    }
+
+    /**
+     * @copydoc Allocator::Deallocate()
+     */
+    void Deallocate(void* ptr) {
+        oSystemAllocator->Deallocate(ptr);
+    }
+
+    /**
+     * @copydoc Allocator::Reallocate()
+     */
+    void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment = alignof(max_align_t)) {
+        return oSystemAllocator->Reallocate(ptr, oldSize, newSize, alignment);
+    }
+
+    b8 operator == (const SystemPolicy&) const { return true; }
+    b8 operator != (const SystemPolicy&) const { return false; }
+
+};  // SystemPolicy
+
+/**
+ * @brief A stateful policy that forwards to an allocator instance.
+ *
+ * @details With a final allocator type, i.e. AllocatorRef<LinearAllocator>, every call is resolved at compile time
+ * and the bump or free list path inlines. AllocatorRef<Allocator> accepts any allocator at the cost of a virtual call.
+ *
+ * @tparam A The allocator type.
+ */
+template <class A = Allocator>
+class AllocatorRef {
+public:
+    /**
+     * @brief Construct a new AllocatorRef.
+     *
+     * @param allocator The allocator to forward to, it must outlive every container using it.
+     */
+    AllocatorRef(A* allocator) :
+        p_Allocator(allocator)
+    { }
+
+    /**
+     * @copydoc Allocator::Allocate()
+     */
+    void* Allocate(sizet size, sizet alignment = alignof(max_align_t)) {
+        return this->p_Allocator->Allocate(size, alignment);
+    }
+
+    /**
+     * @copydoc Allocator::Deallocate()
+     */
+    void Deallocate(void* ptr) {
+        this->p_Allocator->Deallocate(ptr);
+    }
+
+    /**
+     * @copydoc Allocator::Reallocate()
+     */
+    void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment = alignof(max_align_t)) {
+        return this->p_Allocator->Reallocate(ptr, oldSize, newSize, alignment);
+    }
+
+    /**
+     * @return A* - The allocator the policy forwards to.
+     */
+    A* Get() const { return this->p_Allocator; }
+
+    b8 operator == (const AllocatorRef& other) const { return this->p_Allocator == other.p_Allocator; }
+    b8 operator != (const AllocatorRef& other) const { return this->p_Allocator != other.p_Allocator; }
+
+private:
+    /** @brief The allocator to forward to. */
+    A* p_Allocator;
+
+};  // AllocatorRef
+
+/**
+ * @brief Holds a container's allocator policy, taking no space when the policy is stateless.
+ *
+ * @details Containers inherit the storage instead of holding the policy as a member, so an empty policy like
+ * MallocPolicy shares the container's address through the empty base optimization. A container with more than one
+ * empty base is declared OC_EMPTY_BASES.
+ *
+ * @tparam A The allocator policy.
+ */
+template <class A, b8 = std::is_empty_v<A> && !std::is_final_v<A>>
+class PolicyStorage : private A {
+public:
+    inline PolicyStorage(const A& policy) :
+        A(policy)
+    { }
+
+    /**
+     * @return A& - The allocator policy.
+     */
+    inline A& Policy() { return *this; }
+    /**
+     * @return const A& - The allocator policy.
+     */
+    inline const A& Policy() const { return *this; }
+
+};  // PolicyStorage
+
+/**
+ * @brief Holds a stateful allocator policy as a member.
+ *
+ * @tparam A The allocator policy.
+ */
+template <class A>
+class PolicyStorage<A, false> {
+public:
+    inline PolicyStorage(const A& policy) :
+        m_Policy(policy)
+    { }
+
+    /**
+     * @return A& - The allocator policy.
+     */
+    inline A& Policy() { return this->m_Policy; }
+    /**
+     * @return const A& - The allocator policy.
+     */
+    inline const A& Policy() const { return this->m_Policy; }
+
+private:
+    /** @brief The allocator policy. */
+    A m_Policy;
+
+};  // PolicyStorage
@@ -0,0 +1,515 @@
+#pragma once
+
+/**
+ * @file BitKernels.hpp
+ * @brief Word level bit operations, and bulk kernels over arrays of 64-bit words.
+ *
+ * @details The bulk kernels are the shared core of the bit containers, BitSet, BitVector and the bit grids. They
+ * work on whole words and use AVX2 when Ocean is built with Ocean_AVX2, or SSE2 on any x64 target, with a scalar
+ * loop for the remaining words. The output of a kernel may be one of its inputs.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+#include "Ocean/Primitives/Macros.hpp"
+
+#if defined(__AVX2__)
+    #define OC_BITS_AVX2
+
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define OC_BITS_SSE2
+
+    #include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+/**
+ * @param word A word.
+ * @return u32 - The number of set bits in the word.
+ */
+inline u32 oPopcount(u64 word) {
+#if defined(_MSC_VER)
+    return static_cast<u32>(__popcnt64(word));
+#else
+    return static_cast<u32>(__builtin_popcountll(word));
+#endif
+}
+
+/**
+ * @param word A non-zero word.
+ * @return u32 - The index of the lowest set bit.
+ */
+inline u32 oFirstBit(u64 word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+
+    return static_cast<u32>(index);
+#else
+    return static_cast<u32>(__builtin_ctzll(word));
+#endif
+}
+
+/**
+ * @param word A non-zero word.
+ * @return u32 - The index of the highest set bit.
+ */
+inline u32 oLastBit(u64 word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, word);
+
+    return static_cast<u32>(index);
+#else
+    return 63 - static_cast<u32>(__builtin_clzll(word));
+#endif
+}
+
+/**
+ * @param word A word.
+ * @param rank The rank of the set bit to find, less than the number of set bits in the word.
+ * @return u32 - The index of the set bit with rank lower set bits below it.
+ */
+inline u32 oSelectBit(u64 word, u32 rank) {
+#if defined(__BMI2__)
+    return oFirstBit(_pdep_u64(u64(1) << rank, word));
+#else
+    // Skip whole bytes by their counts, then the bits of the byte that holds it.
+    //
+    u32 base = 0;
+
+    for (u32 count = oPopcount(word & 0xff); rank >= count; count = oPopcount(word & 0xff)) {
+        rank -= count;
+        word >>= 8;
+        base += 8;
+    }
+
+    for (u32 i = 0; i < rank; i++)
+        word &= word - 1;
+
+    return base + oFirstBit(word);
+#endif
+}
+
+/** @brief The kernel operation of oBitsAnd. */
+struct BitOpAnd {
+    OC_STATIC_INLINE u64 Word(u64 a, u64 b) { return a & b; }
+#if defined(OC_BITS_AVX2)
+    OC_STATIC_INLINE __m256i Vector(__m256i a, __m256i b) { return _mm256_and_si256(a, b); }
+#elif defined(OC_BITS_SSE2)
+    OC_STATIC_INLINE __m128i Vector(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+#endif
+
+};  // BitOpAnd
+
+/** @brief The kernel operation of oBitsOr. */
+struct BitOpOr {
+    OC_STATIC_INLINE u64 Word(u64 a, u64 b) { return a | b; }
+#if defined(OC_BITS_AVX2)
+    OC_STATIC_INLINE __m256i Vector(__m256i a, __m256i b) { return _mm256_or_si256(a, b); }
+#elif defined(OC_BITS_SSE2)
+    OC_STATIC_INLINE __m128i Vector(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+#endif
+
+};  // BitOpOr
+
+/** @brief The kernel operation of oBitsXor. */
+struct BitOpXor {
+    OC_STATIC_INLINE u64 Word(u64 a, u64 b) { return a ^ b; }
+#if defined(OC_BITS_AVX2)
+    OC_STATIC_INLINE __m256i Vector(__m256i a, __m256i b) { return _mm256_xor_si256(a, b); }
+#elif defined(OC_BITS_SSE2)
+    OC_STATIC_INLINE __m128i Vector(__m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+#endif
+
+};  // BitOpXor
+
+/** @brief The kernel operation of oBitsAndNot, a and not b. */
+struct BitOpAndNot {
+    OC_STATIC_INLINE u64 Word(u64 a, u64 b) { return a & ~b; }
+#if defined(OC_BITS_AVX2)
+    OC_STATIC_INLINE __m256i Vector(__m256i a, __m256i b) { return _mm256_andnot_si256(b, a); }
+#elif defined(OC_BITS_SSE2)
+    OC_STATIC_INLINE __m128i Vector(__m128i a, __m128i b) { return _mm_andnot_si128(b, a); }
+#endif
+
+};  // BitOpAndNot
+
+/**
+ * @brief Applies a kernel operation to two word arrays.
+ *
+ * @tparam Op The operation, see BitOpAnd.
+ * @param out The output words.
+ * @param a The first input words.
+ * @param b The second input words.
+ * @param count The number of words.
+ */
+template <class Op>
+inline void oBitsApply(u64* out, const u64* a, const u64* b, sizet count) {
+    sizet i = 0;
+
+#if defined(OC_BITS_AVX2)
+    for (; i + 4 <= count; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), Op::Vector(x, y));
+    }
+#elif defined(OC_BITS_SSE2)
+    for (; i + 2 <= count; i += 2) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), Op::Vector(x, y));
+    }
+#endif
+
+    for (; i < count; i++)
+        out[i] = Op::Word(a[i], b[i]);
+}
+
+/** @brief out = a & b over count words. */
+inline void oBitsAnd(u64* out, const u64* a, const u64* b, sizet count) { oBitsApply<BitOpAnd>(out, a, b, count); }
+/** @brief out = a | b over count words. */
+inline void oBitsOr(u64* out, const u64* a, const u64* b, sizet count) { oBitsApply<BitOpOr>(out, a, b, count); }
+/** @brief out = a ^ b over count words. */
+inline void oBitsXor(u64* out, const u64* a, const u64* b, sizet count) { oBitsApply<BitOpXor>(out, a, b, count); }
+/** @brief out = a & ~b over count words. */
+inline void oBitsAndNot(u64* out, const u64* a, const u64* b, sizet count) { oBitsApply<BitOpAndNot>(out, a, b, count); }
+
+/**
+ * @brief out = ~a over count words.
+ */
+inline void oBitsNot(u64* out, const u64* a, sizet count) {
+    sizet i = 0;
+
+#if defined(OC_BITS_AVX2)
+    const __m256i ones = _mm256_set1_epi64x(-1);
+
+    for (; i + 4 <= count; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_xor_si256(x, ones));
+    }
+#elif defined(OC_BITS_SSE2)
+    const __m128i ones = _mm_set1_epi32(-1);
+
+    for (; i + 2 <= count; i += 2) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(x, ones));
+    }
+#endif
+
+    for (; i < count; i++)
+        out[i] = ~a[i];
+}
+
+/**
+ * @param words The words.
+ * @param count The number of words.
+ * @return sizet - The number of set bits.
+ */
+inline sizet oBitsCount(const u64* words, sizet count) {
+    sizet i = 0;
+    sizet total = 0;
+
+#if defined(OC_BITS_AVX2)
+    // Counts the bits of each nibble with a table lookup, and sums the byte counts into 64-bit lanes.
+    //
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    __m256i sums = _mm256_setzero_si256();
+
+    for (; i + 4 <= count; i += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+
+        const __m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(x, nibble));
+        const __m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble));
+
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+    }
+
+    alignas(32) u64 lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), sums);
+
+    total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+
+    for (; i < count; i++)
+        total += oPopcount(words[i]);
+
+    return total;
+}
+
+/**
+ * @param words The words.
+ * @param begin The first bit to count.
+ * @param end One past the last bit to count.
+ * @return sizet - The number of set bits in [begin, end).
+ */
+inline sizet oBitsCountRange(const u64* words, sizet begin, sizet end) {
+    if (begin >= end)
+        return 0;
+
+    const sizet first = begin / 64;
+    const sizet last = (end - 1) / 64;
+
+    const u64 head = ~u64(0) << (begin % 64);
+    const u64 tail = ~u64(0) >> (63 - (end - 1) % 64);
+
+    if (first == last)
+        return oPopcount(words[first] & head & tail);
+
+    return oPopcount(words[first] & head) + oBitsCount(words + first + 1, last - first - 1) + oPopcount(words[last] & tail);
+}
+
+/**
+ * @param words The words.
+ * @param count The number of words.
+ * @return b8 - True if any bit is set, False otherwise.
+ */
+inline b8 oBitsAny(const u64* words, sizet count) {
+    u64 any = 0;
+
+    for (sizet i = 0; i < count; i++)
+        any |= words[i];
+
+    return any != 0;
+}
+
+/**
+ * @brief Finds the first set bit at or after a position.
+ *
+ * @param words The words.
+ * @param count The number of words.
+ * @param from The bit to start from.
+ * @return sizet - The index of the bit, or count * 64 if there is none.
+ */
+inline sizet oBitsFindFirst(const u64* words, sizet count, sizet from) {
+    sizet w = from / 64;
+
+    if (w >= count)
+        return count * 64;
+
+    const u64 first = words[w] & (~u64(0) << (from % 64));
+    if (first != 0)
+        return w * 64 + oFirstBit(first);
+
+    w++;
+
+#if defined(OC_BITS_AVX2)
+    // Empty stretches are skipped four words at a time.
+    //
+    for (; w + 4 <= count; w += 4) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + w));
+
+        if (!_mm256_testz_si256(x, x))
+            break;
+    }
+#endif
+
+    for (; w < count; w++)
+        if (words[w] != 0)
+            return w * 64 + oFirstBit(words[w]);
+
+    return count * 64;
+}
+
+/**
+ * @param words The words.
+ * @param count The number of words.
+ * @param rank The rank of the set bit to find.
+ * @return sizet - The index of the set bit with rank lower set bits below it, or count * 64 if there are not enough
+ * set bits.
+ */
+inline sizet oBitsSelect(const u64* words, sizet count, sizet rank) {
+    for (sizet w = 0; w < count; w++) {
+        const u32 bits = oPopcount(words[w]);
+
+        if (rank < bits)
+            return w * 64 + oSelectBit(words[w], static_cast<u32>(rank));
+
+        rank -= bits;
+    }
+
+    return count * 64;
+}
+
+/**
+ * @brief Shifts the bits of a word array towards the higher indexes, bit i moves to bit i + shift and the lowest
+ * shift bits become zero. The output may be the input.
+ *
+ * @param out The output words.
+ * @param in The input words.
+ * @param count The number of words.
+ * @param shift The number of bits to shift by.
+ */
+inline void oBitsShiftUp(u64* out, const u64* in, sizet count, sizet shift) {
+    const sizet q = shift / 64;
+    const u32 r = shift % 64;
+
+    if (q >= count) {
+        for (sizet i = 0; i < count; i++)
+            out[i] = 0;
+
+        return;
+    }
+
+    // Every output word joins two input words, so the words are written from the top down to work in place.
+    //
+    sizet w = count;
+
+#if defined(OC_BITS_AVX2)
+    const __m128i left = _mm_cvtsi32_si128(static_cast<i32>(r));
+    const __m128i right = _mm_cvtsi32_si128(static_cast<i32>(64 - r));
+
+    for (; w >= q + 5; w -= 4) {
+        const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + w - 4 - q));
+        const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + w - 5 - q));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + w - 4), _mm256_or_si256(_mm256_sll_epi64(high, left), _mm256_srl_epi64(low, right)));
+    }
+#elif defined(OC_BITS_SSE2)
+    const __m128i left = _mm_cvtsi32_si128(static_cast<i32>(r));
+    const __m128i right = _mm_cvtsi32_si128(static_cast<i32>(64 - r));
+
+    for (; w >= q + 3; w -= 2) {
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + w - 2 - q));
+        const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + w - 3 - q));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + w - 2), _mm_or_si128(_mm_sll_epi64(high, left), _mm_srl_epi64(low, right)));
+    }
+#endif
+
+    for (; w > q + 1; w--)
+        out[w - 1] = r == 0 ? in[w - 1 - q] : (in[w - 1 - q] << r) | (in[w - 2 - q] >> (64 - r));
+
+    out[q] = in[0] << r;
+
+    for (sizet i = 0; i < q; i++)
+        out[i] = 0;
+}
+
+/**
+ * @brief Shifts the bits of a word array towards the lower indexes, bit i moves to bit i - shift and the highest
+ * shift bits become zero. The output may be the input.
+ *
+ * @param out The output words.
+ * @param in The input words.
+ * @param count The number of words.
+ * @param shift The number of bits to shift by.
+ */
+inline void oBitsShiftDown(u64* out, const u64* in, sizet count, sizet shift) {
+    const sizet q = shift / 64;
+    const u32 r = shift % 64;
+
+    if (q >= count) {
+        for (sizet i = 0; i < count; i++)
+            out[i] = 0;
+
+        return;
+    }
+
+    // The last output word with input bits, the words are written from the bottom up to work in place.
+    //
+    const sizet last = count - 1 - q;
+    sizet w = 0;
+
+#if defined(OC_BITS_AVX2)
+    const __m128i right = _mm_cvtsi32_si128(static_cast<i32>(r));
+    const __m128i left = _mm_cvtsi32_si128(static_cast<i32>(64 - r));
+
+    for (; w + 4 <= last; w += 4) {
+        const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + w + q));
+        const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + w + q + 1));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + w), _mm256_or_si256(_mm256_srl_epi64(low, right), _mm256_sll_epi64(high, left)));
+    }
+#elif defined(OC_BITS_SSE2)
+    const __m128i right = _mm_cvtsi32_si128(static_cast<i32>(r));
+    const __m128i left = _mm_cvtsi32_si128(static_cast<i32>(64 - r));
+
+    for (; w + 2 <= last; w += 2) {
+        const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + w + q));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + w + q + 1));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + w), _mm_or_si128(_mm_srl_epi64(low, right), _mm_sll_epi64(high, left)));
+    }
+#endif
+
+    for (; w < last; w++)
+        out[w] = r == 0 ? in[w + q] : (in[w + q] >> r) | (in[w + q + 1] << (64 - r));
+
+    out[last] = in[count - 1] >> r;
+
+    for (w = last + 1; w < count; w++)
+        out[w] = 0;
+}
+
+/**
+ * @brief Calls a function with the index of every set bit, in increasing order.
+ *
+ * @tparam F A callable taking a sizet.
+ * @param words The words.
+ * @param count The number of words.
+ * @param function The function.
+ */
+template <class F>
+inline void oBitsForEach(const u64* words, sizet count, F&& function) {
+    for (sizet w = 0; w < count; w++)
+        for (u64 set = words[w]; set != 0; set &= set - 1)
+            function(w * 64 + oFirstBit(set));
+}
+
+/**
+ * @brief Accesses one bit of a word, enabling bool setting through the bit containers' [] operator.
+ */
+class BitReference {
+public:
+    /**
+     * @param word The word that holds the bit.
+     * @param bit The index of the bit in the word.
+     */
+    inline BitReference(u64& word, u32 bit) : m_Word(word), m_Mask(u64(1) << bit) { }
+    BitReference(const BitReference&) = default;
+
+    /**
+     * @brief Sets the bit to the given value.
+     *
+     * @param value The value to set the bit.
+     * @return BitReference&
+     */
+    inline BitReference& operator = (b8 value) {
+        if (value)
+            this->m_Word |= this->m_Mask;
+        else
+            this->m_Word &= ~this->m_Mask;
+
+        return *this;
+    }
+    /**
+     * @brief Sets the bit to the value of another bit.
+     */
+    inline BitReference& operator = (const BitReference& other) { return *this = static_cast<b8>(other); }
+
+    inline operator b8() const { return (this->m_Word & this->m_Mask) != 0; }
+
+    /**
+     * @brief Flips the bit.
+     */
+    inline void Flip() { this->m_Word ^= this->m_Mask; }
+
+private:
+    /** @brief The word that holds the bit. */
+    u64& m_Word;
+    /** @brief The bit in the word. */
+    u64 m_Mask;
+
+};  // BitReference
@@ -0,0 +1,262 @@
+#pragma once
+
+/**
+ * @file BitSet.hpp
+ * @brief A fixed size set of bits, packed in 64-bit words.
+ *
+ * @details Bit i is bit i % 64 of word i / 64, so the words can be handed to the kernels in BitKernels.hpp and to
+ * code that expects the usual bit order. The bits past the size in the last word are always zero, which lets the
+ * counts and searches work on whole words.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+#include "Ocean/Primitives/BitKernels.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Macros.hpp"
+
+// std
+#include <cstring>
+#include <utility>
+
+/**
+ * @brief A set of N bits, stored inline.
+ *
+ * @tparam N The number of bits.
+ */
+template <sizet N>
+class BitSet {
+    static_assert(N > 0, "A BitSet must hold at least one bit.");
+
+public:
+    /** @brief The number of words that hold the bits. */
+    OC_STATIC_EXPR sizet k_Words = (N + 63) / 64;
+
+public:
+    /**
+     * @brief Construct a new BitSet with every bit clear.
+     */
+    inline BitSet() : m_Words() { }
+    /**
+     * @brief Construct a new BitSet from the bits of a value, bit i of the value is bit i of the set.
+     *
+     * @param value The value.
+     */
+    inline explicit BitSet(u64 value) : m_Words() {
+        this->m_Words[0] = value;
+        Trim();
+    }
+
+    /**
+     * @return b8 - True if this is equal to other, False otherwise.
+     */
+    inline b8 operator == (const BitSet& other) const { return memcmp(this->m_Words, other.m_Words, sizeof(this->m_Words)) == 0; }
+    /**
+     * @return b8 - True if this is not equal to other, False otherwise.
+     */
+    inline b8 operator != (const BitSet& other) const { return !(*this == other); }
+
+    /**
+     * @param index The index of the bit, must be less than N.
+     * @return BitReference
+     */
+    inline BitReference operator [] (sizet index) { return { this->m_Words[index / 64], static_cast<u32>(index % 64) }; }
+    /**
+     * @param index The index of the bit, must be less than N.
+     * @return b8 - True if the bit is set, False otherwise.
+     */
+    inline b8 operator [] (sizet index) const { return Test(index); }
+
+    /**
+     * @brief Operates the same as index [] access with range access safety.
+     *
+     * @param index The index of the bit.
+     * @return b8 - True if the bit is set, False otherwise.
+     */
+    inline b8 At(sizet index) const {
+        if (index >= N)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to access a BitSet bit out of range!");
+
+        return Test(index);
+    }
+
+    /**
+     * @param index The index of the bit, must be less than N.
+     * @return b8 - True if the bit is set, False otherwise.
+     */
+    inline b8 Test(sizet index) const { return (this->m_Words[index / 64] >> (index % 64)) & 1; }
+
+    /**
+     * @brief Sets the bit at the given index.
+     *
+     * @param index The index of the bit, must be less than N.
+     */
+    inline void Set(sizet index) { this->m_Words[index / 64] |= u64(1) << (index % 64); }
+    /**
+     * @brief Sets the bit at the given index to a value.
+     *
+     * @param index The index of the bit, must be less than N.
+     * @param value The value to set the bit.
+     */
+    inline void Set(sizet index, b8 value) { (*this)[index] = value; }
+    /**
+     * @brief Clears the bit at the given index.
+     *
+     * @param index The index of the bit, must be less than N.
+     */
+    inline void Reset(sizet index) { this->m_Words[index / 64] &= ~(u64(1) << (index % 64)); }
+    /**
+     * @brief Flips the bit at the given index.
+     *
+     * @param index The index of the bit, must be less than N.
+     */
+    inline void Flip(sizet index) { this->m_Words[index / 64] ^= u64(1) << (index % 64); }
+    /**
+     * @brief Flips every bit.
+     */
+    inline void Flip() {
+        oBitsNot(this->m_Words, this->m_Words, k_Words);
+        Trim();
+    }
+
+    /**
+     * @brief Sets every bit to the given value.
+     *
+     * @param value The value to set the bits. (OPTIONAL)
+     */
+    inline void Clear(b8 value = false) {
+        memset(this->m_Words, value ? 0xff : 0, sizeof(this->m_Words));
+        Trim();
+    }
+
+    /**
+     * @return sizet - The number of set bits.
+     */
+    inline sizet Count() const { return oBitsCount(this->m_Words, k_Words); }
+    /**
+     * @return b8 - True if any bit is set, False otherwise.
+     */
+    inline b8 Any() const { return oBitsAny(this->m_Words, k_Words); }
+    /**
+     * @return b8 - True if no bit is set, False otherwise.
+     */
+    inline b8 None() const { return !Any(); }
+    /**
+     * @return b8 - True if every bit is set, False otherwise.
+     */
+    inline b8 All() const { return Count() == N; }
+
+    /**
+     * @return sizet - The index of the first set bit, or N if there is none.
+     */
+    inline sizet FindFirst() const { return FindNext(0); }
+    /**
+     * @param index The index to search from.
+     * @return sizet - The index of the first set bit at or after index, or N if there is none.
+     */
+    inline sizet FindNext(sizet index) const {
+        const sizet found = oBitsFindFirst(this->m_Words, k_Words, index);
+
+        return found < N ? found : N;
+    }
+
+    /**
+     * @param index An index up to N.
+     * @return sizet - The number of set bits before index.
+     */
+    inline sizet Rank(sizet index) const {
+        sizet rank = oBitsCount(this->m_Words, index / 64);
+
+        if (index % 64 != 0)
+            rank += oPopcount(this->m_Words[index / 64] & ((u64(1) << (index % 64)) - 1));
+
+        return rank;
+    }
+    /**
+     * @param rank The rank of the set bit to find.
+     * @return sizet - The index of the set bit with rank set bits before it, or N if there are not enough set bits.
+     */
+    inline sizet Select(sizet rank) const {
+        const sizet found = oBitsSelect(this->m_Words, k_Words, rank);
+
+        return found < N ? found : N;
+    }
+
+    /**
+     * @brief Calls a function with the index of every set bit, in increasing order.
+     *
+     * @tparam F A callable taking a sizet.
+     * @param function The function.
+     */
+    template <class F>
+    inline void ForEachSet(F&& function) const { oBitsForEach(this->m_Words, k_Words, std::forward<F>(function)); }
+
+    inline BitSet& operator &= (const BitSet& other) {
+        oBitsAnd(this->m_Words, this->m_Words, other.m_Words, k_Words);
+
+        return *this;
+    }
+    inline BitSet& operator |= (const BitSet& other) {
+        oBitsOr(this->m_Words, this->m_Words, other.m_Words, k_Words);
+
+        return *this;
+    }
+    inline BitSet& operator ^= (const BitSet& other) {
+        oBitsXor(this->m_Words, this->m_Words, other.m_Words, k_Words);
+
+        return *this;
+    }
+    /**
+     * @brief Clears every bit that is set in other.
+     *
+     * @param other The bits to clear.
+     * @return BitSet&
+     */
+    inline BitSet& AndNot(const BitSet& other) {
+        oBitsAndNot(this->m_Words, this->m_Words, other.m_Words, k_Words);
+
+        return *this;
+    }
+
+    inline BitSet operator & (const BitSet& other) const { return BitSet(*this) &= other; }
+    inline BitSet operator | (const BitSet& other) const { return BitSet(*this) |= other; }
+    inline BitSet operator ^ (const BitSet& other) const { return BitSet(*this) ^= other; }
+    inline BitSet operator ~ () const {
+        BitSet flipped(*this);
+        flipped.Flip();
+
+        return flipped;
+    }
+
+    /**
+     * @return u64* - The words of the set, WordCount() of them.
+     */
+    inline u64* Data() { return this->m_Words; }
+    /**
+     * @return const u64* - The words of the set, WordCount() of them.
+     */
+    inline const u64* Data() const { return this->m_Words; }
+    /**
+     * @return sizet - The number of words of the set.
+     */
+    OC_STATIC_EXPR sizet WordCount() { return k_Words; }
+    /**
+     * @return sizet - The number of bits in the set.
+     */
+    OC_STATIC_EXPR sizet Size() { return N; }
+
+private:
+    /**
+     * @brief Clears the bits past N in the last word.
+     */
+    inline void Trim() {
+        if (N % 64 != 0)
+            this->m_Words[k_Words - 1] &= (u64(1) << (N % 64)) - 1;
+    }
+
+private:
+    /** @brief The bits. */
+    u64 m_Words[k_Words];
+
+};  // BitSet
@@ -0,0 +1,495 @@
+#pragma once
+
+/**
+ * @file BitVector.hpp
+ * @brief A growable array of bits, packed in 64-bit words.
+ *
+ * @details The runtime sized counterpart of BitSet, with the same bit order and the same guarantee that the bits
+ * past the size in the last word are zero. Unlike std::vector<bool> the words are public through Data(), and every
+ * bulk operation runs on the word kernels in BitKernels.hpp.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
+#include "Ocean/Primitives/BitKernels.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Macros.hpp"
+#include "Ocean/Primitives/Memory.hpp"
+
+// std
+#include <cstring>
+#include <utility>
+
+/**
+ * @brief A growable array of bits.
+ *
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
+ */
+template <class A = MallocPolicy>
+class BitVector {
+public:
+    inline BitVector() :
+        m_Allocator(),
+        p_Words(nullptr),
+        m_Size(0),
+        m_Capacity(0)
+    { }
+    /**
+     * @brief Construct a new BitVector with the given number of bits.
+     *
+     * @param size The number of bits.
+     * @param value The value of every bit. (OPTIONAL)
+     * @param allocator The allocator policy to use. (OPTIONAL)
+     */
+    inline explicit BitVector(sizet size, b8 value = false, const A& allocator = A()) :
+        m_Allocator(allocator),
+        p_Words(nullptr),
+        m_Size(0),
+        m_Capacity(0)
+    {
+        Resize(size, value);
+    }
+    /**
+     * @brief Construct a new BitVector from another BitVector, using the same allocator.
+     *
+     * @param other The BitVector to copy from.
+     */
+    inline BitVector(const BitVector& other) :
+        m_Allocator(other.m_Allocator),
+        p_Words(nullptr),
+        m_Size(0),
+        m_Capacity(0)
+    {
+        CopyFrom(other);
+    }
+    /**
+     * @brief Move a BitVector to a new BitVector, the other BitVector is left empty.
+     *
+     * @param other The BitVector to move from.
+     */
+    inline BitVector(BitVector&& other) :
+        m_Allocator(other.m_Allocator),
+        p_Words(other.p_Words),
+        m_Size(other.m_Size),
+        m_Capacity(other.m_Capacity)
+    {
+        other.Forget();
+    }
+    ~BitVector() {
+        Release();
+    }
+
+    inline BitVector& operator = (const BitVector& other) {
+        if (this != &other) {
+            if (this->m_Allocator != other.m_Allocator || this->m_Capacity < WordsFor(other.m_Size)) {
+                Release();
+
+                this->m_Allocator = other.m_Allocator;
+                CopyFrom(other);
+            }
+            else {
+                if (other.m_Size > 0)
+                    memcpy(this->p_Words, other.p_Words, WordsFor(other.m_Size) * sizeof(u64));
+
+                this->m_Size = other.m_Size;
+            }
+        }
+
+        return *this;
+    }
+    inline BitVector& operator = (BitVector&& other) {
+        if (this != &other) {
+            Release();
+
+            this->m_Allocator = other.m_Allocator;
+            this->p_Words = other.p_Words;
+            this->m_Size = other.m_Size;
+            this->m_Capacity = other.m_Capacity;
+
+            other.Forget();
+        }
+
+        return *this;
+    }
+
+    /**
+     * @return b8 - True if both hold the same bits, False otherwise.
+     */
+    inline b8 operator == (const BitVector& other) const {
+        return this->m_Size == other.m_Size && (this->m_Size == 0 || memcmp(this->p_Words, other.p_Words, WordCount() * sizeof(u64)) == 0);
+    }
+    /**
+     * @return b8 - True if the bits differ, False otherwise.
+     */
+    inline b8 operator != (const BitVector& other) const { return !(*this == other); }
+
+    /**
+     * @param index The index of the bit, must be less than Size().
+     * @return BitReference
+     */
+    inline BitReference operator [] (sizet index) { return { this->p_Words[index / 64], static_cast<u32>(index % 64) }; }
+    /**
+     * @param index The index of the bit, must be less than Size().
+     * @return b8 - True if the bit is set, False otherwise.
+     */
+    inline b8 operator [] (sizet index) const { return Test(index); }
+
+    /**
+     * @brief Operates the same as index [] access with range access safety.
+     *
+     * @param index The index of the bit.
+     * @return b8 - True if the bit is set, False otherwise.
+     */
+    inline b8 At(sizet index) const {
+        if (index >= this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to access a BitVector bit out of range!");
+
+        return Test(index);
+    }
+
+    /**
+     * @param index The index of the bit, must be less than Size().
+     * @return b8 - True if the bit is set, False otherwise.
+     */
+    inline b8 Test(sizet index) const { return (this->p_Words[index / 64] >> (index % 64)) & 1; }
+
+    /**
+     * @brief Sets the bit at the given index.
+     *
+     * @param index The index of the bit, must be less than Size().
+     */
+    inline void Set(sizet index) { this->p_Words[index / 64] |= u64(1) << (index % 64); }
+    /**
+     * @brief Sets the bit at the given index to a value.
+     *
+     * @param index The index of the bit, must be less than Size().
+     * @param value The value to set the bit.
+     */
+    inline void Set(sizet index, b8 value) { (*this)[index] = value; }
+    /**
+     * @brief Clears the bit at the given index.
+     *
+     * @param index The index of the bit, must be less than Size().
+     */
+    inline void Reset(sizet index) { this->p_Words[index / 64] &= ~(u64(1) << (index % 64)); }
+    /**
+     * @brief Flips the bit at the given index.
+     *
+     * @param index The index of the bit, must be less than Size().
+     */
+    inline void Flip(sizet index) { this->p_Words[index / 64] ^= u64(1) << (index % 64); }
+    /**
+     * @brief Flips every bit.
+     */
+    inline void Flip() {
+        oBitsNot(this->p_Words, this->p_Words, WordCount());
+        Trim();
+    }
+
+    /**
+     * @brief Appends a bit. Amortized O(1).
+     *
+     * @param value The value of the bit.
+     */
+    inline void PushBack(b8 value) {
+        if (this->m_Size == this->m_Capacity * 64)
+            Grow(WordsFor(this->m_Size + 1));
+
+        if (this->m_Size % 64 == 0)
+            this->p_Words[this->m_Size / 64] = 0;
+
+        this->p_Words[this->m_Size / 64] |= static_cast<u64>(value) << (this->m_Size % 64);
+        this->m_Size++;
+    }
+    /**
+     * @brief Removes the last bit.
+     */
+    inline void PopBack() {
+        if (this->m_Size == 0)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to pop from an empty BitVector!");
+
+        this->m_Size--;
+        Reset(this->m_Size);
+    }
+
+    /**
+     * @brief Changes the number of bits, new bits take the given value.
+     *
+     * @param size The new number of bits.
+     * @param value The value of any new bits. (OPTIONAL)
+     */
+    void Resize(sizet size, b8 value = false) {
+        const sizet words = WordsFor(size);
+
+        if (words > this->m_Capacity)
+            Grow(words);
+
+        if (size > this->m_Size) {
+            const sizet oldWords = WordCount();
+
+            // The tail of the old last word is zero, so only setting needs to touch it.
+            //
+            if (value && this->m_Size % 64 != 0)
+                this->p_Words[oldWords - 1] |= ~u64(0) << (this->m_Size % 64);
+
+            memset(this->p_Words + oldWords, value ? 0xff : 0, (words - oldWords) * sizeof(u64));
+        }
+
+        this->m_Size = size;
+        Trim();
+    }
+    /**
+     * @brief Makes room for at least the given number of bits.
+     *
+     * @param bits The number of bits.
+     */
+    inline void Reserve(sizet bits) {
+        if (WordsFor(bits) > this->m_Capacity)
+            Grow(WordsFor(bits));
+    }
+
+    /**
+     * @brief Removes every bit, keeping the memory.
+     */
+    inline void Clear() { this->m_Size = 0; }
+    /**
+     * @brief Sets every bit to the given value.
+     *
+     * @param value The value to set the bits.
+     */
+    inline void Fill(b8 value) {
+        if (this->m_Size > 0)
+            memset(this->p_Words, value ? 0xff : 0, WordCount() * sizeof(u64));
+
+        Trim();
+    }
+
+    /**
+     * @return sizet - The number of set bits.
+     */
+    inline sizet Count() const { return oBitsCount(this->p_Words, WordCount()); }
+    /**
+     * @return b8 - True if any bit is set, False otherwise.
+     */
+    inline b8 Any() const { return oBitsAny(this->p_Words, WordCount()); }
+    /**
+     * @return b8 - True if no bit is set, False otherwise.
+     */
+    inline b8 None() const { return !Any(); }
+    /**
+     * @return b8 - True if every bit is set, False otherwise.
+     */
+    inline b8 All() const { return Count() == this->m_Size; }
+
+    /**
+     * @return sizet - The index of the first set bit, or Size() if there is none.
+     */
+    inline sizet FindFirst() const { return FindNext(0); }
+    /**
+     * @param index The index to search from.
+     * @return sizet - The index of the first set bit at or after index, or Size() if there is none.
+     */
+    inline sizet FindNext(sizet index) const {
+        const sizet found = oBitsFindFirst(this->p_Words, WordCount(), index);
+
+        return found < this->m_Size ? found : this->m_Size;
+    }
+
+    /**
+     * @param index An index up to Size().
+     * @return sizet - The number of set bits before index.
+     */
+    inline sizet Rank(sizet index) const {
+        if (index > this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to rank a BitVector past its size!");
+
+        sizet rank = oBitsCount(this->p_Words, index / 64);
+
+        if (index % 64 != 0)
+            rank += oPopcount(this->p_Words[index / 64] & ((u64(1) << (index % 64)) - 1));
+
+        return rank;
+    }
+    /**
+     * @param rank The rank of the set bit to find.
+     * @return sizet - The index of the set bit with rank set bits before it, or Size() if there are not enough set
+     * bits.
+     */
+    inline sizet Select(sizet rank) const {
+        const sizet found = oBitsSelect(this->p_Words, WordCount(), rank);
+
+        return found < this->m_Size ? found : this->m_Size;
+    }
+
+    /**
+     * @brief Calls a function with the index of every set bit, in increasing order.
+     *
+     * @tparam F A callable taking a sizet.
+     * @param function The function.
+     */
+    template <class F>
+    inline void ForEachSet(F&& function) const { oBitsForEach(this->p_Words, WordCount(), std::forward<F>(function)); }
+
+    inline BitVector& operator &= (const BitVector& other) {
+        CheckSizes(other);
+        oBitsAnd(this->p_Words, this->p_Words, other.p_Words, WordCount());
+
+        return *this;
+    }
+    inline BitVector& operator |= (const BitVector& other) {
+        CheckSizes(other);
+        oBitsOr(this->p_Words, this->p_Words, other.p_Words, WordCount());
+
+        return *this;
+    }
+    inline BitVector& operator ^= (const BitVector& other) {
+        CheckSizes(other);
+        oBitsXor(this->p_Words, this->p_Words, other.p_Words, WordCount());
+
+        return *this;
+    }
+    /**
+     * @brief Clears every bit that is set in other.
+     *
+     * @param other The bits to clear, the same size as this.
+     * @return BitVector&
+     */
+    inline BitVector& AndNot(const BitVector& other) {
+        CheckSizes(other);
+        oBitsAndNot(this->p_Words, this->p_Words, other.p_Words, WordCount());
+
+        return *this;
+    }
+
+    /**
+     * @return u64* - The words of the vector, WordCount() of them.
+     */
+    inline u64* Data() { return this->p_Words; }
+    /**
+     * @return const u64* - The words of the vector, WordCount() of them.
+     */
+    inline const u64* Data() const { return this->p_Words; }
+    /**
+     * @return sizet - The number of words that hold the bits.
+     */
+    inline sizet WordCount() const { return WordsFor(this->m_Size); }
+
+    /**
+     * @return sizet - The number of bits.
+     */
+    inline sizet Size() const { return this->m_Size; }
+    /**
+     * @return sizet - The number of bits the vector holds before it grows.
+     */
+    inline sizet Capacity() const { return this->m_Capacity * 64; }
+    /**
+     * @return b8 - True if the vector holds no bits, False otherwise.
+     */
+    inline b8 Empty() const { return this->m_Size == 0; }
+
+    /**
+     * @return const A& - The allocator policy of the vector.
+     */
+    inline const A& GetAllocator() const { return this->m_Allocator; }
+
+private:
+    /**
+     * @return sizet - The number of words that hold the given number of bits.
+     */
+    OC_STATIC_EXPR sizet WordsFor(sizet bits) { return (bits + 63) / 64; }
+
+    /**
+     * @brief Clears the bits past the size in the last word.
+     */
+    inline void Trim() {
+        if (this->m_Size % 64 != 0)
+            this->p_Words[this->m_Size / 64] &= (u64(1) << (this->m_Size % 64)) - 1;
+    }
+
+    /**
+     * @brief Throws if the other vector is a different size.
+     */
+    inline void CheckSizes(const BitVector& other) const {
+        if (this->m_Size != other.m_Size)
+            throw Ocean::Exception(Ocean::Error::INVALID_ARGUMENT, "Attempt to combine BitVectors of different sizes!");
+    }
+
+    /**
+     * @brief Grows the words to at least the given count, doubling the capacity.
+     *
+     * @param words The least number of words.
+     */
+    void Grow(sizet words) {
+        sizet capacity = this->m_Capacity * 2;
+        if (capacity < words)
+            capacity = words;
+
+        const sizet used = WordCount();
+
+        // A failed reallocation leaves the old words in place, so the vector is unchanged when this throws.
+        //
+        u64* grown = nullptr;
+
+        if (this->p_Words)
+            grown = oreallocat(this->p_Words, u64, used, capacity, &this->m_Allocator);
+        else
+            grown = oallocat(u64, capacity, &this->m_Allocator);
+
+        if (!grown)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to grow the BitVector!");
+
+        this->p_Words = grown;
+        this->m_Capacity = capacity;
+    }
+
+    /**
+     * @brief Copies the bits of another vector into this vector, which holds no words.
+     */
+    void CopyFrom(const BitVector& other) {
+        const sizet words = WordsFor(other.m_Size);
+
+        if (words > 0) {
+            this->p_Words = oallocat(u64, words, &this->m_Allocator);
+            if (!this->p_Words)
+                throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to copy the BitVector!");
+
+            memcpy(this->p_Words, other.p_Words, words * sizeof(u64));
+        }
+
+        this->m_Size = other.m_Size;
+        this->m_Capacity = words;
+    }
+
+    /**
+     * @brief Frees the words.
+     */
+    inline void Release() {
+        if (this->p_Words)
+            ofree(this->p_Words, &this->m_Allocator);
+
+        Forget();
+    }
+    /**
+     * @brief Leaves the vector empty, without freeing the words.
+     */
+    inline void Forget() {
+        this->p_Words = nullptr;
+        this->m_Size = 0;
+        this->m_Capacity = 0;
+    }
+
+private:
+    /** @brief The allocator policy of the words. */
+    A m_Allocator;
+
+    /** @brief The bits, bit i is bit i % 64 of word i / 64. */
+    u64* p_Words;
+
+    /** @brief The number of bits. */
+    sizet m_Size;
+    /** @brief The number of allocated words. */
+    sizet m_Capacity;
+
+};  // BitVector
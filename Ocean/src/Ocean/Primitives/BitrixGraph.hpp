@@ -0,0 +1,367 @@
+#pragma once
+
+/**
+ * @file BitrixGraph.hpp
+ * @brief A directed graph stored as a dense adjacency bit matrix, for small graphs with many edges.
+ *
+ * @details The matrix is a BasicBitrix2D, each vertex has a row of 64-bit words with a bit per vertex it has an edge to,
+ * so a graph holds at most u16_max vertices. Edge edits and queries
+ * are a single bit operation, and the traversals work a word, 64 vertices, at a time. A breadth first search ORs the
+ * rows of a whole frontier into the next frontier, and the transitive closure ORs whole rows together, so both do
+ * about V * V / 64 word operations however many edges the graph has.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+#include "Ocean/Types/Bitrix.hpp"
+
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
+#include "Ocean/Primitives/BitKernels.hpp"
+#include "Ocean/Primitives/DynamicArray.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Macros.hpp"
+
+#include "Ocean/Primitives/Structures/Graph.hpp"
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+/**
+ * @brief A directed graph stored as a row-major adjacency bit matrix.
+ *
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
+ */
+template <class A = MallocPolicy>
+class BitrixGraph final : public Graph<BitrixGraph<A>> {
+private:
+    /** @brief The fewest words a search level touches before it is spread over threads. */
+    OC_STATIC_EXPR sizet k_ParallelWords = 1 << 16;
+
+public:
+    using Graph<BitrixGraph<A>>::k_Unreached;
+
+    inline BitrixGraph() :
+        m_Matrix(),
+        m_EdgeCount(0)
+    { }
+    /**
+     * @brief Construct a new BitrixGraph with the given number of vertices and no edges.
+     *
+     * @param vertexCount The number of vertices.
+     * @param allocator The allocator policy of the matrix and the search and sort results. (OPTIONAL)
+     */
+    inline explicit BitrixGraph(u32 vertexCount, const A& allocator = A()) :
+        m_Matrix(allocator),
+        m_EdgeCount(0)
+    {
+        Resize(vertexCount);
+    }
+    BitrixGraph(const BitrixGraph&) = default;
+    /**
+     * @brief Move a BitrixGraph to a new BitrixGraph, the other BitrixGraph is left with no vertices.
+     *
+     * @param other The BitrixGraph to move from.
+     */
+    inline BitrixGraph(BitrixGraph&& other) :
+        m_Matrix(std::move(other.m_Matrix)),
+        m_EdgeCount(other.m_EdgeCount)
+    {
+        other.m_EdgeCount = 0;
+    }
+    ~BitrixGraph() = default;
+
+    BitrixGraph& operator = (const BitrixGraph&) = default;
+    inline BitrixGraph& operator = (BitrixGraph&& other) {
+        if (this != &other) {
+            this->m_Matrix = std::move(other.m_Matrix);
+            this->m_EdgeCount = other.m_EdgeCount;
+
+            other.m_EdgeCount = 0;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Equality comparison. Container provides operator != from it.
+     *
+     * @param other The BitrixGraph to compare with.
+     * @return b8 - True if both graphs have the same vertices and edges, False otherwise.
+     */
+    inline b8 operator == (const BitrixGraph& other) const { return this->m_Matrix == other.m_Matrix; }
+
+    /**
+     * @brief Changes the number of vertices, keeping the edges between the vertices that remain.
+     *
+     * @param vertexCount The new number of vertices.
+     */
+    void Resize(u32 vertexCount) {
+        if (vertexCount > u16_max)
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "A BitrixGraph holds at most u16_max vertices!");
+
+        const u16 count = static_cast<u16>(vertexCount);
+
+        this->m_Matrix.Resize(count, count);
+        this->m_EdgeCount = this->m_Matrix.Count();
+    }
+
+    /**
+     * @brief Adds an edge from vertex to vertex. O(1).
+     *
+     * @param from A unique index of the starting vertex.
+     * @param to A unique index of the ending vertex.
+     */
+    void AddEdge(u32 from, u32 to) {
+        CheckVertices(from, to);
+
+        this->m_EdgeCount += !IsSet(from, to);
+        this->m_Matrix.Set(static_cast<u16>(to), static_cast<u16>(from), true);
+    }
+    /**
+     * @brief Removes an edge from vertex to vertex. O(1).
+     *
+     * @param from A unique index of the starting vertex.
+     * @param to A unique index of the ending vertex.
+     */
+    void RemoveEdge(u32 from, u32 to) {
+        CheckVertices(from, to);
+
+        this->m_EdgeCount -= IsSet(from, to);
+        this->m_Matrix.Set(static_cast<u16>(to), static_cast<u16>(from), false);
+    }
+
+    /**
+     * @brief Determines if the given vertex's share an edge. O(1).
+     *
+     * @param from A unique index of the starting vertex.
+     * @param to A unique index of the ending vertex.
+     * @return b8
+     */
+    b8 IsAdjacent(u32 from, u32 to) const {
+        CheckVertices(from, to);
+
+        return IsSet(from, to);
+    }
+
+    /**
+     * @param vertex The vertex.
+     * @return u32 - The number of edges starting at the vertex.
+     */
+    inline u32 Degree(u32 vertex) const {
+        return static_cast<u32>(this->m_Matrix.CountRow(static_cast<u16>(vertex)));
+    }
+
+    /**
+     * @brief Gets the adjacency bits of a vertex, bit to % 64 of word to / 64 is set for each edge.
+     *
+     * @param vertex The vertex.
+     * @return u64* - WordsPerRow() words.
+     */
+    inline u64* Row(u32 vertex) { return this->m_Matrix.Row(static_cast<u16>(vertex)); }
+    /**
+     * @brief Gets the adjacency bits of a vertex, bit to % 64 of word to / 64 is set for each edge.
+     *
+     * @param vertex The vertex.
+     * @return const u64* - WordsPerRow() words.
+     */
+    inline const u64* Row(u32 vertex) const { return this->m_Matrix.Row(static_cast<u16>(vertex)); }
+    /**
+     * @return sizet - The number of words in a row.
+     */
+    inline sizet WordsPerRow() const { return this->m_Matrix.WordsPerRow(); }
+    /**
+     * @return const BasicBitrix2D<A>& - The adjacency matrix, row from holds the edges starting at from.
+     */
+    inline const BasicBitrix2D<A>& Matrix() const { return this->m_Matrix; }
+
+    /**
+     * @brief Finds the distance in edges from a vertex to every vertex, a whole level at a time. Each level ORs the
+     * rows of its vertices into the next frontier, and large levels split the words over the given number of threads.
+     *
+     * @param source The vertex to start from.
+     * @param threads The number of threads to use. (OPTIONAL)
+     * @return DynamicArray<u32, A> - The distance of every vertex, k_Unreached for vertices that cannot be reached.
+     */
+    DynamicArray<u32, A> BreadthFirst(u32 source, u32 threads = 1) const {
+        CheckVertices(source, source);
+
+        const sizet words = WordsPerRow();
+
+        DynamicArray<u32, A> distances(VertexCount(), GetAllocator());
+        for (u32 v = 0; v < VertexCount(); v++)
+            distances.PushBack(k_Unreached);
+
+        // The visited set, the frontier and the next frontier, one bit per vertex each.
+        //
+        DynamicArray<u64, A> bits(3 * words, GetAllocator());
+        for (sizet i = 0; i < 3 * words; i++)
+            bits.PushBack(0);
+
+        u64* visited = bits.Data();
+        u64* frontier = visited + words;
+        u64* next = frontier + words;
+
+        distances[source] = 0;
+        visited[source / 64] = frontier[source / 64] = u64(1) << (source % 64);
+
+        sizet frontierSize = 1;
+        u32 level = 0;
+
+        while (frontierSize > 0) {
+            level++;
+
+            std::atomic<sizet> found{ 0 };
+
+            // Every thread reads the whole frontier but only writes its own words of the next frontier.
+            //
+            const u32 parts = frontierSize * words >= k_ParallelWords ? threads : 1;
+
+            oParallelFor(parts, words, [&](sizet begin, sizet end) {
+                std::fill(next + begin, next + end, 0);
+
+                for (sizet f = 0; f < words; f++) {
+                    for (u64 set = frontier[f]; set != 0; set &= set - 1) {
+                        const u64* row = Row(static_cast<u32>(f * 64 + oFirstBit(set)));
+
+                        oBitsOr(next + begin, next + begin, row + begin, end - begin);
+                    }
+                }
+
+                sizet count = 0;
+
+                for (sizet w = begin; w < end; w++) {
+                    const u64 reached = next[w] & ~visited[w];
+
+                    next[w] = reached;
+                    visited[w] |= reached;
+                    count += oPopcount(reached);
+
+                    for (u64 set = reached; set != 0; set &= set - 1)
+                        distances[w * 64 + oFirstBit(set)] = level;
+                }
+
+                found.fetch_add(count, std::memory_order_relaxed);
+            });
+
+            std::swap(frontier, next);
+            frontierSize = found.load(std::memory_order_relaxed);
+        }
+
+        return distances;
+    }
+
+    /**
+     * @brief Builds the graph with an edge from every vertex to every vertex it can reach by one or more edges.
+     * Warshall's algorithm over whole rows, O(V * V * V / 64).
+     *
+     * @return BitrixGraph - The transitive closure.
+     */
+    BitrixGraph TransitiveClosure() const {
+        BitrixGraph closure(*this);
+
+        const sizet words = WordsPerRow();
+
+        for (u32 k = 0; k < VertexCount(); k++) {
+            const u64* through = closure.Row(k);
+            const sizet word = k / 64;
+            const u64 bit = u64(1) << (k % 64);
+
+            // Every vertex that reaches k also reaches everything k reaches.
+            //
+            for (u32 v = 0; v < VertexCount(); v++) {
+                u64* row = closure.Row(v);
+
+                if (row[word] & bit)
+                    oBitsOr(row, row, through, words);
+            }
+        }
+
+        closure.m_EdgeCount = closure.m_Matrix.Count();
+
+        return closure;
+    }
+
+    /**
+     * @brief Orders the vertices so that every edge goes from an earlier vertex to a later one. O(V * V / 64 + E).
+     *
+     * @param order The order, cleared first. If the graph has a cycle it holds the vertices that are not on or after
+     * a cycle.
+     * @return b8 - True if the graph is acyclic and every vertex was ordered, False otherwise.
+     */
+    b8 TopologicalSort(DynamicArray<u32, A>& order) const {
+        DynamicArray<u32, A> inDegree(VertexCount(), GetAllocator());
+        for (u32 v = 0; v < VertexCount(); v++)
+            inDegree.PushBack(0);
+
+        for (u32 v = 0; v < VertexCount(); v++)
+            ForEachNeighbor(v, [&](u32 target) { inDegree[target]++; });
+
+        order.Clear();
+        order.Reserve(VertexCount());
+
+        for (u32 v = 0; v < VertexCount(); v++)
+            if (inDegree[v] == 0)
+                order.PushBack(v);
+
+        for (sizet head = 0; head < order.Size(); head++) {
+            ForEachNeighbor(order[head], [&](u32 target) {
+                if (--inDegree[target] == 0)
+                    order.PushBack(target);
+            });
+        }
+
+        return order.Size() == VertexCount();
+    }
+
+    /**
+     * @brief Calls a function with every ending vertex of a vertex's edges, in increasing order.
+     *
+     * @tparam F A callable taking a u32.
+     * @param vertex The vertex.
+     * @param function The function.
+     */
+    template <class F>
+    inline void ForEachNeighbor(u32 vertex, F&& function) const {
+        oBitsForEach(Row(vertex), WordsPerRow(), [&](sizet target) { function(static_cast<u32>(target)); });
+    }
+
+    /**
+     * @return u32 - The number of vertices in the Graph.
+     */
+    u32 VertexCount() const { return this->m_Matrix.Height(); }
+    /**
+     * @return sizet - The number of edges in the Graph.
+     */
+    sizet EdgeCount() const { return this->m_EdgeCount; }
+
+    /**
+     * @return const A& - The allocator policy of the graph.
+     */
+    inline const A& GetAllocator() const { return this->m_Matrix.GetAllocator(); }
+
+private:
+    /**
+     * @brief Throws if either vertex does not exist.
+     */
+    inline void CheckVertices(u32 from, u32 to) const {
+        if (from >= VertexCount() || to >= VertexCount())
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to access a BitrixGraph vertex that does not exist!");
+    }
+
+    /**
+     * @return b8 - True if the edge is set, without checking the vertices.
+     */
+    inline b8 IsSet(u32 from, u32 to) const {
+        return this->m_Matrix.Get(static_cast<u16>(to), static_cast<u16>(from));
+    }
+
+private:
+    /** @brief The adjacency matrix, bit to of row from is set for each edge. It holds the allocator policy. */
+    BasicBitrix2D<A> m_Matrix;
+
+    /** @brief The number of set bits. */
+    sizet m_EdgeCount;
+
+};  // BitrixGraph
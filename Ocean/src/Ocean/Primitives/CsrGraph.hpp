@@ -0,0 +1,440 @@
+#pragma once
+
+/**
+ * @file CsrGraph.hpp
+ * @brief A directed graph in compressed sparse row form, for large sparse graphs.
+ *
+ * @details The targets of every edge are stored in one array grouped by their starting vertex, and an offset array
+ * gives where each vertex's group starts. So walking the neighbors of a vertex reads one contiguous run, and the
+ * whole graph is two allocations no matter how many vertices and edges it has. The neighbors of each vertex are kept
+ * sorted, which makes IsAdjacent a binary search.
+ *
+ * Building from an edge list is the fast path, AddEdge and RemoveEdge shift the arrays and are meant for occasional
+ * edits of a built graph.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+#include "Ocean/Types/Iterator.hpp"
+
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
+#include "Ocean/Primitives/DynamicArray.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Macros.hpp"
+
+#include "Ocean/Primitives/Structures/Graph.hpp"
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A directed graph stored in compressed sparse row form.
+ *
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
+ */
+template <class A = MallocPolicy>
+class CsrGraph final : public Graph<CsrGraph<A>> {
+private:
+    /** @brief The smallest frontier that a breadth first search spreads over threads. */
+    OC_STATIC_EXPR sizet k_ParallelFrontier = 2048;
+    /** @brief The number of vertices a search thread collects before adding them to the next frontier. */
+    OC_STATIC_EXPR sizet k_FlushSize = 256;
+
+public:
+    using Neighbors = IteratorRange<const u32*>;
+
+    using Graph<CsrGraph<A>>::k_Unreached;
+
+public:
+    inline CsrGraph() :
+        m_VertexCount(0),
+        m_Offsets(),
+        m_Targets()
+    {
+        this->m_Offsets.PushBack(0);
+    }
+    /**
+     * @brief Construct a new empty CsrGraph that allocates from the given allocator.
+     *
+     * @param allocator The allocator policy to use.
+     */
+    inline explicit CsrGraph(const A& allocator) :
+        m_VertexCount(0),
+        m_Offsets(allocator),
+        m_Targets(allocator)
+    {
+        this->m_Offsets.PushBack(0);
+    }
+    /**
+     * @brief Construct a new CsrGraph from a list of edges, see Build().
+     *
+     * @param vertexCount The number of vertices.
+     * @param edges The edges.
+     * @param edgeCount The number of edges.
+     * @param allocator The allocator policy to use. (OPTIONAL)
+     */
+    inline CsrGraph(u32 vertexCount, const GraphEdge* edges, sizet edgeCount, const A& allocator = A()) :
+        CsrGraph(allocator)
+    {
+        Build(vertexCount, edges, edgeCount);
+    }
+    inline CsrGraph(const CsrGraph& other) = default;
+    /**
+     * @brief Move a CsrGraph to a new CsrGraph, the other CsrGraph is left with no vertices.
+     *
+     * @param other The CsrGraph to move from.
+     */
+    inline CsrGraph(CsrGraph&& other) :
+        m_VertexCount(other.m_VertexCount),
+        m_Offsets(std::move(other.m_Offsets)),
+        m_Targets(std::move(other.m_Targets))
+    {
+        other.Forget();
+    }
+    ~CsrGraph() = default;
+
+    inline CsrGraph& operator = (const CsrGraph& other) = default;
+    inline CsrGraph& operator = (CsrGraph&& other) {
+        if (this != &other) {
+            this->m_VertexCount = other.m_VertexCount;
+            this->m_Offsets = std::move(other.m_Offsets);
+            this->m_Targets = std::move(other.m_Targets);
+
+            other.Forget();
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Equality comparison, the neighbors of each vertex are sorted and unique so equal graphs store the same
+     * arrays. Container provides operator != from it.
+     *
+     * @param other The CsrGraph to compare with.
+     * @return b8 - True if both graphs have the same vertices and edges, False otherwise.
+     */
+    inline b8 operator == (const CsrGraph& other) const {
+        return this->m_VertexCount == other.m_VertexCount && this->m_Offsets == other.m_Offsets && this->m_Targets == other.m_Targets;
+    }
+
+    /**
+     * @brief Replaces the graph with the given vertices and edges. O(V + E) plus sorting each vertex's neighbors,
+     * repeated edges are kept once.
+     *
+     * @param vertexCount The number of vertices.
+     * @param edges The edges, each vertex must be less than vertexCount.
+     * @param edgeCount The number of edges.
+     */
+    void Build(u32 vertexCount, const GraphEdge* edges, sizet edgeCount) {
+        if (edgeCount > std::numeric_limits<u32>::max())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "CsrGraph edge count does not fit its offsets!");
+
+        for (sizet i = 0; i < edgeCount; i++)
+            if (edges[i].from >= vertexCount || edges[i].to >= vertexCount)
+                throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to build a CsrGraph with an edge to a vertex that does not exist!");
+
+        // Count the edges of each vertex, then turn the counts into the offsets of the groups.
+        //
+        this->m_Offsets.Clear();
+        Fill(this->m_Offsets, static_cast<sizet>(vertexCount) + 1, 0);
+
+        for (sizet i = 0; i < edgeCount; i++)
+            this->m_Offsets[edges[i].from + 1]++;
+
+        for (u32 v = 0; v < vertexCount; v++)
+            this->m_Offsets[v + 1] += this->m_Offsets[v];
+
+        this->m_Targets.Clear();
+        Fill(this->m_Targets, edgeCount, 0);
+
+        DynamicArray<u32, A> cursor(this->m_Offsets);
+
+        for (sizet i = 0; i < edgeCount; i++)
+            this->m_Targets[cursor[edges[i].from]++] = edges[i].to;
+
+        // Sort each group and drop repeated edges, packing the groups down as they shrink.
+        //
+        u32* targets = this->m_Targets.Data();
+        u32 write = 0;
+        u32 begin = 0;
+
+        for (u32 v = 0; v < vertexCount; v++) {
+            const u32 end = this->m_Offsets[v + 1];
+
+            std::sort(targets + begin, targets + end);
+
+            this->m_Offsets[v] = write;
+
+            for (u32 i = begin; i < end; i++)
+                if (i == begin || targets[i] != targets[i - 1])
+                    targets[write++] = targets[i];
+
+            begin = end;
+        }
+
+        this->m_Offsets[vertexCount] = write;
+        this->m_Targets.Resize(write);
+        this->m_VertexCount = vertexCount;
+    }
+
+    /**
+     * @brief Adds vertices with no edges.
+     *
+     * @param count The number of vertices to add.
+     * @return u32 - The first new vertex.
+     */
+    u32 AddVertices(u32 count) {
+        if (count > std::numeric_limits<u32>::max() - this->m_VertexCount)
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "CsrGraph has no vertex ids left!");
+
+        const u32 first = this->m_VertexCount;
+        const u32 end = this->m_Offsets.Back();
+
+        this->m_Offsets.Reserve(count);
+
+        for (u32 i = 0; i < count; i++)
+            this->m_Offsets.PushBack(end);
+
+        this->m_VertexCount += count;
+
+        return first;
+    }
+
+    /**
+     * @brief Adds an edge from vertex to vertex. O(V + E), as the edges after it shift.
+     *
+     * @param from A unique index of the starting vertex.
+     * @param to A unique index of the ending vertex.
+     */
+    void AddEdge(u32 from, u32 to) {
+        CheckVertices(from, to);
+
+        const u32* position = Find(from, to);
+        if (position != this->m_Targets.Data() + this->m_Offsets[from + 1] && *position == to)
+            return;
+
+        this->m_Targets.Emplace(position - this->m_Targets.Data(), to);
+
+        for (u32 v = from + 1; v <= this->m_VertexCount; v++)
+            this->m_Offsets[v]++;
+    }
+    /**
+     * @brief Removes an edge from vertex to vertex. O(V + E), as the edges after it shift.
+     *
+     * @param from A unique index of the starting vertex.
+     * @param to A unique index of the ending vertex.
+     */
+    void RemoveEdge(u32 from, u32 to) {
+        CheckVertices(from, to);
+
+        const u32* position = Find(from, to);
+        if (position == this->m_Targets.Data() + this->m_Offsets[from + 1] || *position != to)
+            return;
+
+        this->m_Targets.Erase(position - this->m_Targets.Data());
+
+        for (u32 v = from + 1; v <= this->m_VertexCount; v++)
+            this->m_Offsets[v]--;
+    }
+
+    /**
+     * @brief Determines if the given vertex's share an edge. O(log degree).
+     *
+     * @param from A unique index of the starting vertex.
+     * @param to A unique index of the ending vertex.
+     * @return b8
+     */
+    b8 IsAdjacent(u32 from, u32 to) const {
+        CheckVertices(from, to);
+
+        const u32* position = Find(from, to);
+
+        return position != this->m_Targets.Data() + this->m_Offsets[from + 1] && *position == to;
+    }
+
+    /**
+     * @param vertex The vertex.
+     * @return Neighbors - The ending vertices of the vertex's edges, in increasing order.
+     */
+    inline Neighbors NeighborsOf(u32 vertex) const {
+        const u32* targets = this->m_Targets.Data();
+
+        return Neighbors(targets + this->m_Offsets[vertex], targets + this->m_Offsets[vertex + 1]);
+    }
+    /**
+     * @param vertex The vertex.
+     * @return u32 - The number of edges starting at the vertex.
+     */
+    inline u32 Degree(u32 vertex) const { return this->m_Offsets[vertex + 1] - this->m_Offsets[vertex]; }
+
+    /**
+     * @brief Finds the distance in edges from a vertex to every vertex, level by level. Large levels are split over
+     * the given number of threads.
+     *
+     * @param source The vertex to start from.
+     * @param threads The number of threads to use. (OPTIONAL)
+     * @return DynamicArray<u32, A> - The distance of every vertex, k_Unreached for vertices that cannot be reached.
+     */
+    DynamicArray<u32, A> BreadthFirst(u32 source, u32 threads = 1) const {
+        CheckVertices(source, source);
+
+        const A& allocator = this->m_Targets.GetAllocator();
+
+        DynamicArray<u32, A> distances(allocator);
+        Fill(distances, this->m_VertexCount, k_Unreached);
+
+        // Every vertex joins a frontier at most once, so a frontier never outgrows the vertex count.
+        //
+        DynamicArray<u32, A> frontier(allocator);
+        DynamicArray<u32, A> next(allocator);
+        Fill(frontier, this->m_VertexCount, 0);
+        Fill(next, this->m_VertexCount, 0);
+
+        // A vertex is claimed by setting its bit, so that only one thread writes its distance.
+        //
+        std::vector<std::atomic<u64>> visited((this->m_VertexCount + 63) / 64);
+
+        distances[source] = 0;
+        visited[source / 64].store(u64(1) << (source % 64), std::memory_order_relaxed);
+        frontier[0] = source;
+
+        sizet frontierSize = 1;
+        u32 level = 0;
+
+        while (frontierSize > 0) {
+            level++;
+
+            std::atomic<sizet> nextSize{ 0 };
+
+            const u32 parts = frontierSize >= k_ParallelFrontier ? threads : 1;
+
+            oParallelFor(parts, frontierSize, [&](sizet begin, sizet end) {
+                u32 found[k_FlushSize];
+                sizet count = 0;
+
+                for (sizet i = begin; i < end; i++) {
+                    for (u32 target : NeighborsOf(frontier[i])) {
+                        std::atomic<u64>& word = visited[target / 64];
+                        const u64 bit = u64(1) << (target % 64);
+
+                        if ((word.load(std::memory_order_relaxed) & bit) || (word.fetch_or(bit, std::memory_order_relaxed) & bit))
+                            continue;
+
+                        distances[target] = level;
+                        found[count++] = target;
+
+                        if (count == k_FlushSize) {
+                            std::copy(found, found + count, next.Data() + nextSize.fetch_add(count, std::memory_order_relaxed));
+                            count = 0;
+                        }
+                    }
+                }
+
+                std::copy(found, found + count, next.Data() + nextSize.fetch_add(count, std::memory_order_relaxed));
+            });
+
+            std::swap(frontier, next);
+            frontierSize = nextSize.load(std::memory_order_relaxed);
+        }
+
+        return distances;
+    }
+
+    /**
+     * @brief Orders the vertices so that every edge goes from an earlier vertex to a later one. O(V + E).
+     *
+     * @param order The order, cleared first. If the graph has a cycle it holds the vertices that are not on or after
+     * a cycle.
+     * @return b8 - True if the graph is acyclic and every vertex was ordered, False otherwise.
+     */
+    b8 TopologicalSort(DynamicArray<u32, A>& order) const {
+        DynamicArray<u32, A> inDegree(this->m_Targets.GetAllocator());
+        Fill(inDegree, this->m_VertexCount, 0);
+
+        for (u32 target : this->m_Targets)
+            inDegree[target]++;
+
+        order.Clear();
+        order.Reserve(this->m_VertexCount);
+
+        for (u32 v = 0; v < this->m_VertexCount; v++)
+            if (inDegree[v] == 0)
+                order.PushBack(v);
+
+        // The order doubles as the queue of vertices whose edges are still to be removed.
+        //
+        for (sizet head = 0; head < order.Size(); head++) {
+            for (u32 target : NeighborsOf(order[head]))
+                if (--inDegree[target] == 0)
+                    order.PushBack(target);
+        }
+
+        return order.Size() == this->m_VertexCount;
+    }
+
+    /**
+     * @return u32 - The number of vertices in the Graph.
+     */
+    u32 VertexCount() const { return this->m_VertexCount; }
+    /**
+     * @return sizet - The number of edges in the Graph.
+     */
+    sizet EdgeCount() const { return this->m_Targets.Size(); }
+
+    /**
+     * @return const A& - The allocator policy of the graph.
+     */
+    inline const A& GetAllocator() const { return this->m_Targets.GetAllocator(); }
+
+private:
+    /**
+     * @brief Throws if either vertex does not exist.
+     */
+    inline void CheckVertices(u32 from, u32 to) const {
+        if (from >= this->m_VertexCount || to >= this->m_VertexCount)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to access a CsrGraph vertex that does not exist!");
+    }
+
+    /**
+     * @return const u32* - The first neighbor of from that is not less than to.
+     */
+    inline const u32* Find(u32 from, u32 to) const {
+        const u32* targets = this->m_Targets.Data();
+
+        return std::lower_bound(targets + this->m_Offsets[from], targets + this->m_Offsets[from + 1], to);
+    }
+
+    /**
+     * @brief Appends count copies of value to an array.
+     */
+    OC_STATIC void Fill(DynamicArray<u32, A>& array, sizet count, u32 value) {
+        array.Reserve(count);
+
+        for (sizet i = 0; i < count; i++)
+            array.PushBack(value);
+    }
+
+    /**
+     * @brief Leaves a moved from graph with no vertices and no edges.
+     */
+    inline void Forget() {
+        this->m_VertexCount = 0;
+        this->m_Offsets.Clear();
+        this->m_Offsets.PushBack(0);
+        this->m_Targets.Clear();
+    }
+
+private:
+    /** @brief The number of vertices. */
+    u32 m_VertexCount;
+
+    /** @brief Where each vertex's neighbors start in the targets, with the edge count at the end. */
+    DynamicArray<u32, A> m_Offsets;
+    /** @brief The ending vertex of every edge, grouped by starting vertex. */
+    DynamicArray<u32, A> m_Targets;
+
+};  // CsrGraph
@@ -1,10 +1,13 @@
 #pragma once
 
+#include "Ocean/Types/FloatingPoints.hpp"
 #include "Ocean/Types/Integers.hpp"
 #include "Ocean/Types/Iterator.hpp"
 
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
 #include "Ocean/Primitives/Memory.hpp"
 #include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Relocatable.hpp"
 
 #include "Ocean/Primitives/Structures/Container.hpp"
 
@@ -12,67 +15,108 @@
 #include <initializer_list>
 #include <algorithm>
 #include <cstring>
+#include <limits>
+#include <new>
+#include <ostream>
+#include <ratio>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 /**
  * @brief A dynamically sized array.
- * 
+ *
+ * @details Elements are constructed in place and destroyed when they leave the array. When T is trivially relocatable,
+ * see Relocatable.hpp, growing and erasing move the elements with memcpy and growth goes through the allocator's
+ * Reallocate so the block can grow in place.
+ *
  * @tparam T The data type.
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
+ * @tparam G The factor the capacity grows by when the array is full, a std::ratio greater than 1. Smaller factors
+ * waste less memory, larger ones copy less often. Being a type it takes no space in the array.
  */
-template <class T>
-class DynamicArray : public Container {
+template <class T, class A = MallocPolicy, class G = std::ratio<2>>
+class OC_EMPTY_BASES DynamicArray : public Container<DynamicArray<T, A, G>>, private PolicyStorage<A> {
+    static_assert(std::ratio_greater_v<G, std::ratio<1>>, "The Array growth factor must be greater than 1!");
+
 public:
     using Iterator = RandomAccessIterator<T>;
     using ConstIterator = RandomAccessIterator<const T>;
 
+    /** @brief The factor the capacity is multiplied with when the array is full. */
+    using GrowthFactor = typename G::type;
+    /** @brief The capacity of the first allocation made by a growing array. */
+    OC_STATIC_EXPR sizet k_MinimumCapacity = 4;
+
 public:
     inline DynamicArray() :
+        PolicyStorage<A>(A()),
+        m_Size(0),
+        m_Capacity(0),
+        p_Data(nullptr)
+    { }
+    /**
+     * @brief Construct a new empty Dynamic Array that allocates from the given allocator.
+     *
+     * @param allocator The allocator policy to use.
+     */
+    inline explicit DynamicArray(const A& allocator) :
+        PolicyStorage<A>(allocator),
         m_Size(0),
         m_Capacity(0),
         p_Data(nullptr)
     { }
     /**
      * @brief Construct a new Dynamic Array with a initial capacity of the given size.
-     * 
+     *
      * @param size The initial size of the Dynamic Array.
+     * @param allocator The allocator policy to use. (OPTIONAL)
      */
-    inline DynamicArray(u16 size) :
+    inline DynamicArray(sizet size, const A& allocator = A()) :
+        PolicyStorage<A>(allocator),
         m_Size(0),
-        m_Capacity(size),
-        p_Data(oallocat(T, this->m_Capacity, oUnmanagedAllocator))
-    { }
+        m_Capacity(0),
+        p_Data(nullptr)
+    {
+        SetCapacity(size);
+    }
     /**
-     * @brief Construct a new Dynamic Array from another Dynamic Array.
-     * 
+     * @brief Construct a new Dynamic Array from another Dynamic Array, using the same allocator.
+     *
      * @param rhs The Dynamic Array to copy from.
      */
     inline DynamicArray(const DynamicArray& rhs) :
-        m_Size(rhs.m_Size),
-        m_Capacity(rhs.m_Capacity),
-        p_Data(oallocat(T, this->m_Capacity, oUnmanagedAllocator))
+        PolicyStorage<A>(rhs.Policy()),
+        m_Size(0),
+        m_Capacity(0),
+        p_Data(nullptr)
     {
-        for (u16 i = 0; i < this->m_Size; i++)
-            this->p_Data[i] = rhs.p_Data[i];
+        SetCapacity(rhs.m_Capacity);
+
+        CopyConstruct(rhs.p_Data, rhs.m_Size);
     }
     /**
      * @brief Construct a new Dynamic Array from a std::vector.
-     * 
+     *
      * @param rhs The std::vector to copy from.
      */
     inline DynamicArray(const std::vector<T>& rhs) :
-        m_Size(rhs.size()),
-        m_Capacity(rhs.capacity()),
-        p_Data(oallocat(T, this->m_Capacity, oUnmanagedAllocator))
+        PolicyStorage<A>(A()),
+        m_Size(0),
+        m_Capacity(0),
+        p_Data(nullptr)
     {
-        for (u16 i = 0; i < this->m_Size; i++)
-            this->p_Data[i] = rhs[i];
+        SetCapacity(rhs.capacity());
+
+        CopyConstruct(rhs.data(), rhs.size());
     }
     /**
      * @brief Move a Dynamic Array to a new Dynamic Array.
-     * 
+     *
      * @param other The Dynamic Array to move data from.
      */
     inline DynamicArray(DynamicArray&& other) :
+        PolicyStorage<A>(other.Policy()),
         m_Size(other.m_Size),
         m_Capacity(other.m_Capacity),
         p_Data(other.p_Data)
@@ -83,85 +127,78 @@ public:
     }
     /**
      * @brief Construct a new Dynamic Array from an initial list.
-     * 
+     *
      * @param list The initial list of type T to store.
      */
     inline DynamicArray(const std::initializer_list<T> &list) :
-        m_Size(list.size()),
-        m_Capacity(list.size()),
-        p_Data(oallocat(T, this->m_Capacity, oUnmanagedAllocator))
+        PolicyStorage<A>(A()),
+        m_Size(0),
+        m_Capacity(0),
+        p_Data(nullptr)
     {
-        // Because list will be destroyed we can utilize std::move.
-        // 
-        for (u16 i = 0; i < list.size(); i++)
-            this->p_Data[i] = std::move(*(list.begin() + i));
+        SetCapacity(list.size());
+
+        // The elements of an initializer list are const, so they can only be copied.
+        //
+        CopyConstruct(list.begin(), list.size());
     }
     inline ~DynamicArray() {
-        if (this->p_Data)
-            ofree(this->p_Data, oUnmanagedAllocator);
+        Release();
     }
 
     inline DynamicArray& operator = (const DynamicArray& rhs) {
         if (this != &rhs) {
-            this->m_Size = rhs.m_Size;
-            this->m_Capacity = rhs.m_Capacity;
+            Clear();
 
-            if (!this->p_Data)
-                this->p_Data = oallocat(T, this->m_Capacity, oUnmanagedAllocator);
+            if (this->m_Capacity < rhs.m_Size)
+                SetCapacity(rhs.m_Capacity);
 
-            for (u16 i = 0; i < this->m_Size; i++)
-                this->p_Data[i] = rhs.p_Data[i];
+            CopyConstruct(rhs.p_Data, rhs.m_Size);
         }
 
         return *this;
     }
     inline DynamicArray& operator = (DynamicArray&& other) {
-        if (this->p_Data)
-            ofree(this->p_Data, oUnmanagedAllocator);
+        if (this != &other) {
+            Release();
 
-        this->m_Size = other.m_Size;
-        this->p_Data = other.p_Data;
-
-        other.m_Size = 0;
-        other.p_Data = nullptr;
+            // The memory is adopted, so the allocator that owns it comes along.
+            //
+            this->Policy() = other.Policy();
+            this->m_Size = other.m_Size;
+            this->m_Capacity = other.m_Capacity;
+            this->p_Data = other.p_Data;
+
+            other.m_Size = 0;
+            other.m_Capacity = 0;
+            other.p_Data = nullptr;
+        }
 
         return *this;
     }
 
     /**
-     * @brief Equality comparison with a generic Container.
-     * 
-     * @param other A valid Container.
+     * @brief Equality comparison, element by element. Container provides operator != from it.
+     *
+     * @param other The DynamicArray to compare with.
      * @return b8 - True if equal, False otherwise.
      */
-    inline virtual b8 operator == (const Container& other) const override {
-        const DynamicArray<T>* rhs = dynamic_cast<const DynamicArray<T>*>(&other);
-
-        if (rhs == nullptr)
-            return false;
-
-        if (this->m_Size != rhs->m_Size)
+    inline b8 operator == (const DynamicArray& other) const {
+        if (this->m_Size != other.m_Size)
             return false;
 
-        return std::equal(this->Begin(), this->End(), rhs->Begin());
-    }
-    /**
-     * @brief In-equality comparison with a generic Container.
-     * 
-     * @param other A valid Container.
-     * @return b8 - True if unequal, False otherwise.
-     */
-    inline virtual b8 operator != (const Container& other) const override {
-        return !(*this == other);
+        return std::equal(this->Begin(), this->End(), other.Begin());
     }
+    /** @brief The policy base has an operator != of its own, this one compares arrays. */
+    using Container<DynamicArray<T, A, G>>::operator !=;
 
     /**
      * @brief Gets the element at the given index with range checking.
-     * 
+     *
      * @param index The index to get in the Array.
-     * @return T& 
+     * @return T&
      */
-    inline constexpr T& At(u16 index) {
+    inline constexpr T& At(sizet index) {
         if (index >= this->m_Size)
             throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Array range!");
 
@@ -169,11 +206,11 @@ public:
     }
     /**
      * @brief Gets the element at the given index with range checking.
-     * 
+     *
      * @param index The index to get in the Array.
-     * @return const T& 
+     * @return const T&
      */
-    inline constexpr const T& At(u16 index) const {
+    inline constexpr const T& At(sizet index) const {
         if (index >= this->m_Size)
             throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Array range!");
 
@@ -182,185 +219,230 @@ public:
 
     /**
      * @brief Gets the element at the given index.
-     * 
+     *
      * @param i The index to get in the Array.
-     * @return T& 
+     * @return T&
      */
-    inline constexpr T& operator [] (u16 i) { return this->p_Data[i]; }
+    inline constexpr T& operator [] (sizet i) { return this->p_Data[i]; }
     /**
      * @brief Gets the element at the given index.
-     * 
+     *
      * @param i The index to get in the Array.
-     * @return const T& 
+     * @return const T&
      */
-    inline constexpr const T& operator [] (u16 i) const { return this->p_Data[i]; }
+    inline constexpr const T& operator [] (sizet i) const { return this->p_Data[i]; }
 
     /**
      * @brief Gets the first element in the Array.
-     * 
-     * @return T& 
+     *
+     * @return T&
      */
     inline constexpr T& Front() { return this->p_Data[0]; }
     /**
      * @brief Gets the first element in the Array.
-     * 
-     * @return const T& 
+     *
+     * @return const T&
      */
     inline constexpr const T& Front() const { return this->p_Data[0]; }
     /**
      * @brief Gets the last element in the Array.
-     * 
-     * @return T& 
+     *
+     * @return T&
      */
     inline constexpr T& Back() { return this->p_Data[this->m_Size - 1]; }
     /**
      * @brief Gets the last element in the Array.
-     * 
-     * @return const T& 
+     *
+     * @return const T&
      */
     inline constexpr const T& Back() const { return this->p_Data[this->m_Size - 1]; }
 
     /**
      * @brief Gets a Iterator to the beginning of the DynamicArray.
-     * 
-     * @return Iterator 
+     *
+     * @return Iterator
      */
     inline constexpr Iterator Begin() { return Iterator(this->p_Data); }
     inline constexpr Iterator begin() { return Begin(); }
     /**
      * @brief Gets a ConstIterator to the beginning of the DynamicArray.
-     * 
-     * @return ConstIterator 
+     *
+     * @return ConstIterator
      */
     inline constexpr ConstIterator Begin() const { return ConstIterator(this->p_Data); }
     inline constexpr ConstIterator begin() const { return Begin(); }
     /**
      * @brief Gets a Iterator to the end of the DynamicArray.
-     * 
-     * @return Iterator 
+     *
+     * @return Iterator
      */
     inline constexpr Iterator End() { return Iterator(this->p_Data + this->m_Size); }
     inline constexpr Iterator end() { return End(); }
     /**
      * @brief Gets a ConstIterator to the end of the DynamicArray.
-     * 
-     * @return ConstIterator 
+     *
+     * @return ConstIterator
      */
     inline constexpr ConstIterator End() const { return ConstIterator(this->p_Data + this->m_Size); }
     inline constexpr ConstIterator end() const { return End(); }
 
     /**
      * @brief Constructs a new object of type T at the given position.
-     * 
-     * @tparam Args 
+     *
+     * @tparam Args
      * @param pos The position to construct a new object at.
      * @param args The type T constructor arguments.
      */
     template <class ... Args>
-    inline constexpr void Emplace(u16 pos, Args ... args) {
-        if (this->m_Size == this->m_Capacity)
-            Resize(this->m_Capacity * 2);
+    inline void Emplace(sizet pos, Args&& ... args) {
+        if (pos > this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Array range!");
 
-        // Shift elements to the right to make space for the new element.
-        //
-        for (u16 i = this->m_Size; i > pos; i--)
-            this->p_Data[i] = std::move(this->p_Data[i - 1]);
+        if (pos == this->m_Size) {
+            EmplaceBack(std::forward<Args>(args)...);
+
+            return;
+        }
 
-        // Construct the new element in place.
+        // The arguments may refer to an element, so the value is built before anything is moved.
         //
-        new (&this->p_Data[pos]) T(std::forward<Args>(args)...);
+        StagedValue<T> value(std::forward<Args>(args)...);
+
+        if (this->m_Size == this->m_Capacity)
+            SetCapacity(NextCapacity(this->m_Size + 1));
+
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            memmove(static_cast<void*>(this->p_Data + pos + 1), static_cast<const void*>(this->p_Data + pos), (this->m_Size - pos) * sizeof(T));
+
+            value.RelocateTo(&this->p_Data[pos]);
+        }
+        else {
+            // Shift elements to the right to make space for the new element. The last one moves into raw memory.
+            //
+            new (&this->p_Data[this->m_Size]) T(std::move(this->p_Data[this->m_Size - 1]));
+
+            for (sizet i = this->m_Size - 1; i > pos; i--)
+                this->p_Data[i] = std::move(this->p_Data[i - 1]);
+
+            this->p_Data[pos].~T();
+            value.RelocateTo(&this->p_Data[pos]);
+        }
 
         this->m_Size++;
     }
     /**
      * @brief Constructs a new object of type T at the end of the Dynamic Array.
-     * 
-     * @tparam Args 
+     *
+     * @tparam Args
      * @param args The type T constructor arguments.
+     * @return T& - The new element.
      */
     template <class ... Args>
-    inline constexpr void EmplaceBack(Args ... args) {
+    inline T& EmplaceBack(Args&& ... args) {
         if (this->m_Size == this->m_Capacity)
-            Resize(this->m_Capacity * 2);
+            return GrowAndEmplaceBack(std::forward<Args>(args)...);
 
         // Construct the new element in place at the end.
         //
-        new (&this->p_Data[this->m_Size]) T(std::forward<Args>(args)...);
+        T* element = new (&this->p_Data[this->m_Size]) T(std::forward<Args>(args)...);
 
         this->m_Size++;
+
+        return *element;
+    }
+
+    /**
+     * @brief Copies an object to the end of the Dynamic Array.
+     *
+     * @param value The object to copy.
+     */
+    inline void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+    /**
+     * @brief Moves an object to the end of the Dynamic Array.
+     *
+     * @param value The object to move.
+     */
+    inline void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+    /**
+     * @brief Deconstructs and removes the last object of the Dynamic Array.
+     */
+    inline void PopBack() {
+        if (this->m_Size == 0)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to PopBack an empty Array!");
+
+        this->m_Size--;
+
+        this->p_Data[this->m_Size].~T();
     }
 
     /**
      * @brief Deconstructs the elements within the Dynamic Array.
      */
-    inline constexpr void Clear() {
-        for (u16 i = 0; i < this->m_Size; i++)
-            this->p_Data[i].~T();
+    inline void Clear() {
+        Destroy(0, this->m_Size);
 
         this->m_Size = 0;
     }
 
     /**
      * @brief Deconstructs and removes the object at the given position.
-     * 
+     *
      * @param pos The integer position of the object.
      */
-    inline constexpr void Erase(u16 pos) {
+    inline void Erase(sizet pos) {
         if (pos >= this->m_Size)
             throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Array range!");
 
-        // Call the deconstructor at the position.
-        //
-        this->p_Data[pos].~T();
-
-        // Shift elements to the left to fill the space.
-        //
-        for (u16 i = pos; i < this->m_Size - 1; i++)
-            this->p_Data[i] = std::move(this->p_Data[i + 1]);
-
-        this->m_Size--;
+        Erase(pos, pos + 1);
     }
     /**
      * @brief Deconstructs and removes the object at the given position.
-     * 
+     *
      * @param pos The Iterator position of the object.
      */
-    inline constexpr void Erase(Iterator pos) {
+    inline void Erase(Iterator pos) {
         // Convert iterator to index and call the index erase.
         //
-        Erase(static_cast<u16>(pos - Begin()));
+        Erase(static_cast<sizet>(pos - Begin()));
     }
     /**
      * @brief Deconstructs and removes the object at the given position.
-     * 
+     *
      * @param pos The ConstIterator position of the object.
      */
-    inline constexpr void Erase(ConstIterator pos) {
+    inline void Erase(ConstIterator pos) {
         // Convert iterator to index and call the index erase.
         //
-        Erase(static_cast<u16>(pos - Begin()));
+        Erase(static_cast<sizet>(pos - ConstIterator(this->p_Data)));
     }
     /**
      * @brief Deconstructs and removes the objects within a given range.
-     * 
+     *
      * @param first The first integer position in the range.
      * @param last The last integer position in the range.
-     * @return u16 - The number of objects erased.
+     * @return sizet - The number of objects erased.
      */
-    inline constexpr u16 Erase(u16 first, u16 last) {
+    inline sizet Erase(sizet first, sizet last) {
         if (first >= this->m_Size || last > this->m_Size || first >= last)
             throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Invalid range for Erase!");
 
-        u16 count = last - first;
+        const sizet count = last - first;
 
-        // Shift elements to the left to fill the space.
-        //
-        for (u16 i = last; i < this->m_Size; i++) {
-            // Call the deconstructor.
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            Destroy(first, last);
+
+            memmove(static_cast<void*>(this->p_Data + first), static_cast<const void*>(this->p_Data + last), (this->m_Size - last) * sizeof(T));
+        }
+        else {
+            // Shift elements to the left to fill the space, then deconstruct the moved-from tail.
             //
-            this->p_Data[first].~T();
+            std::move(this->p_Data + last, this->p_Data + this->m_Size, this->p_Data + first);
 
-            this->p_Data[first++] = std::move(this->p_Data[i]);
+            Destroy(this->m_Size - count, this->m_Size);
         }
 
         this->m_Size -= count;
@@ -368,121 +450,270 @@ public:
     }
     /**
      * @brief Deconstructs and removes the objects within a given range.
-     * 
+     *
      * @param first The first Iterator position in the range.
      * @param last The last Iterator position in the range.
-     * @return u16 - The number of objects erased.
+     * @return sizet - The number of objects erased.
      */
-    inline constexpr u16 Erase(Iterator first, Iterator last) {
+    inline sizet Erase(Iterator first, Iterator last) {
         // Convert iterators to indices.
         //
-        return Erase(static_cast<u16>(first - Begin()), static_cast<u16>(last - Begin()));
+        return Erase(static_cast<sizet>(first - Begin()), static_cast<sizet>(last - Begin()));
     }
     /**
      * @brief Deconstructs and removes the objects within a given range.
-     * 
+     *
      * @param first The first ConstIterator position in the range.
      * @param last The last ConstIterator position in the range.
-     * @return u16 - The number of objects erased.
+     * @return sizet - The number of objects erased.
      */
-    inline constexpr u16 Erase(ConstIterator first, ConstIterator last) {
+    inline sizet Erase(ConstIterator first, ConstIterator last) {
         // Convert iterators to indices.
         //
-        return Erase(static_cast<u16>(first - Begin()), static_cast<u16>(last - Begin()));
+        const ConstIterator begin(this->p_Data);
+
+        return Erase(static_cast<sizet>(first - begin), static_cast<sizet>(last - begin));
     }
 
     /**
      * @brief Reserves the requested amount of space.
      * @note Reserve accounts for the number of existing items in the Dynamic Array. Making the total requested capacity = space + Size().
-     * 
+     *
      * @param space The number of free elements to make space for.
      */
-    inline constexpr void Reserve(u16 space) {
+    inline void Reserve(sizet space) {
+        if (space > MaxSize() - this->m_Size)
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested Array capacity is too large!");
+
         if (this->m_Capacity < (space + this->m_Size))
-            Resize(space + this->m_Size);
+            SetCapacity(space + this->m_Size);
     }
     /**
-     * @brief Resizes the Dynamic Array to the new size.
+     * @brief Resizes the capacity of the Dynamic Array to the new size.
      * @note If there are active objects beyond the new size, then they will be deconstructed and erased.
-     * 
-     * @param newSize The new size of the Dynamic Array.
+     *
+     * @param newSize The new capacity of the Dynamic Array.
      */
-    inline constexpr void Resize(u16 newSize) {
-        if (newSize == 0)
-            newSize = 2;
+    inline void Resize(sizet newSize) {
         // Deconstruct any objects beyond newSize if necessary.
         //
         if (newSize < this->m_Size) {
-            for (u16 i = newSize; i < this->m_Size; i++)
-                this->p_Data[i].~T();
+            Destroy(newSize, this->m_Size);
 
             this->m_Size = newSize;
         }
 
-        if (newSize == this->m_Capacity)
-            return;
-
-        T* newData = oallocat(T, newSize, oUnmanagedAllocator);
-        
-        for (u16 i = 0; i < this->m_Size; i++)
-            newData[i] = std::move(this->p_Data[i]);
-
-        if (this->p_Data)
-            ofree(this->p_Data, oUnmanagedAllocator);
-
-        this->p_Data = newData;
-        this->m_Capacity = newSize;
+        SetCapacity(newSize);
+    }
+    /**
+     * @brief Releases the capacity that is not used by any element.
+     */
+    inline void ShrinkToFit() {
+        if (this->m_Capacity > this->m_Size)
+            SetCapacity(this->m_Size);
     }
 
     /**
      * @brief Gets the internal data pointer.
-     * 
-     * @return T* 
+     *
+     * @return T*
      */
     inline constexpr T* Data() { return this->p_Data; }
     /**
      * @brief Gets the internal data pointer.
-     * 
-     * @return const T* 
+     *
+     * @return const T*
      */
     inline constexpr const T* Data() const { return this->p_Data; }
 
+    /**
+     * @return const A& - The allocator policy of the DynamicArray.
+     */
+    inline const A& GetAllocator() const { return this->Policy(); }
+
     /**
      * @return b8 - True if the Array is empty, False otherwise.
      */
     inline constexpr b8 Empty() const { return this->m_Size == 0; }
     /**
-     * @return u16 - The size of the Array.
+     * @return sizet - The size of the Array.
      */
-    inline constexpr u16 Size() const { return this->m_Size; }
+    inline constexpr sizet Size() const { return this->m_Size; }
     /**
-     * @return u16 - The capacity of the Array.
+     * @return sizet - The capacity of the Array.
      */
-    inline constexpr u16 Capacity() const { return this->m_Capacity; }
+    inline constexpr sizet Capacity() const { return this->m_Capacity; }
+    /**
+     * @return sizet - The largest number of elements the Array can address.
+     */
+    inline static constexpr sizet MaxSize() { return std::numeric_limits<sizet>::max() / sizeof(T); }
 
     /**
      * @brief Gets a JSON useable format of the DynamicArray.
-     * 
-     * @param os 
-     * @param rhs 
-     * @return std::ostream& 
+     *
+     * @param os
+     * @param rhs
+     * @return std::ostream&
      */
-    inline friend std::ostream& operator << (std::ostream& os, const DynamicArray<T>& rhs) {
+    inline friend std::ostream& operator << (std::ostream& os, const DynamicArray<T, A, G>& rhs) {
         os << "{ ";
 
-        for (u16 i = 0; i < (rhs.m_Size - 1); i++)
-            os << rhs.p_Data[i] << ", ";
+        for (sizet i = 0; i < rhs.m_Size; i++)
+            os << (i == 0 ? "" : ", ") << rhs.p_Data[i];
 
-        os << rhs.p_Data[rhs.m_Size - 1] << " }";
+        os << " }";
 
         return os;
     }
 
+protected:
+    /**
+     * @brief Gets the capacity to grow to, so that at least the required number of elements fit.
+     *
+     * @param required The number of elements that must fit.
+     * @return sizet
+     */
+    inline sizet NextCapacity(sizet required) const {
+        if (required > MaxSize())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested Array capacity is too large!");
+
+        constexpr sizet num = static_cast<sizet>(GrowthFactor::num);
+        constexpr sizet den = static_cast<sizet>(GrowthFactor::den);
+
+        const sizet capacity = this->m_Capacity > MaxSize() / num ? MaxSize() : this->m_Capacity * num / den;
+
+        return std::max({ capacity, required, k_MinimumCapacity });
+    }
+
+    /**
+     * @brief The slow path of EmplaceBack, taken when the array is full.
+     *
+     * @tparam Args
+     * @param args The type T constructor arguments.
+     * @return T& - The new element.
+     */
+    template <class ... Args>
+    T& GrowAndEmplaceBack(Args&& ... args) {
+        // The arguments may refer to an element, which is moved by the growth. So the value is built first.
+        //
+        StagedValue<T> value(std::forward<Args>(args)...);
+
+        SetCapacity(NextCapacity(this->m_Size + 1));
+
+        T* element = value.RelocateTo(&this->p_Data[this->m_Size]);
+
+        this->m_Size++;
+
+        return *element;
+    }
+
+    /**
+     * @brief Reallocates the data to hold exactly the given number of elements, relocating the current ones.
+     * @note The capacity must not be smaller than the current size.
+     *
+     * @param capacity The new capacity.
+     */
+    inline void SetCapacity(sizet capacity) {
+        if (capacity == this->m_Capacity)
+            return;
+
+        if (capacity > MaxSize())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested Array capacity is too large!");
+
+        if (capacity == 0) {
+            if (this->p_Data)
+                ofree(this->p_Data, &this->Policy());
+
+            this->p_Data = nullptr;
+            this->m_Capacity = 0;
+
+            return;
+        }
+
+        T* newData = nullptr;
+
+        // Trivially relocatable elements can be moved bytewise, which lets the allocator grow the block in place.
+        //
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            newData = oreallocat(this->p_Data, T, this->m_Capacity, capacity, &this->Policy());
+            if (!newData)
+                throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to resize the Array!");
+        }
+        else {
+            newData = oallocat(T, capacity, &this->Policy());
+            if (!newData)
+                throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to resize the Array!");
+
+            // The new memory is uninitialized, so the elements are move constructed into it.
+            //
+            for (sizet i = 0; i < this->m_Size; i++) {
+                new (&newData[i]) T(std::move(this->p_Data[i]));
+
+                this->p_Data[i].~T();
+            }
+
+            if (this->p_Data)
+                ofree(this->p_Data, &this->Policy());
+        }
+
+        this->p_Data = newData;
+        this->m_Capacity = capacity;
+    }
+
+    /**
+     * @brief Copy constructs the given elements at the end of the array.
+     * @note The capacity must already fit the elements.
+     *
+     * @param data The elements to copy.
+     * @param count The number of elements.
+     */
+    inline void CopyConstruct(const T* data, sizet count) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count)
+                memcpy(static_cast<void*>(this->p_Data + this->m_Size), static_cast<const void*>(data), count * sizeof(T));
+
+            this->m_Size += count;
+        }
+        else {
+            for (sizet i = 0; i < count; i++) {
+                new (&this->p_Data[this->m_Size]) T(data[i]);
+
+                this->m_Size++;
+            }
+        }
+    }
+
+    /**
+     * @brief Deconstructs the elements in the range [first, last).
+     *
+     * @param first The first position to deconstruct.
+     * @param last One past the last position to deconstruct.
+     */
+    inline void Destroy(sizet first, sizet last) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (sizet i = first; i < last; i++)
+                this->p_Data[i].~T();
+        }
+    }
+
+    /**
+     * @brief Deconstructs every element and frees the data.
+     */
+    inline void Release() {
+        Clear();
+
+        if (this->p_Data)
+            ofree(this->p_Data, &this->Policy());
+
+        this->p_Data = nullptr;
+        this->m_Capacity = 0;
+    }
+
 protected:
     /** @brief The number of elements in the DynamicArray. */
-    u16 m_Size;
+    sizet m_Size;
     /** @brief The number of elements in memory of the DynamicArray. */
-    u16 m_Capacity;
+    sizet m_Capacity;
     /** @brief The data pointer of the DynamicArray. */
     T* p_Data;
 
@@ -5,7 +5,6 @@
 #include "Ocean/Types/Iterator.hpp"
 #include "Ocean/Types/Strings.hpp"
 
-#include "Ocean/Primitives/Memory.hpp"
 #include "Ocean/Primitives/Exceptions.hpp"
 
 #include "Ocean/Primitives/Structures/Container.hpp"
@@ -15,222 +14,204 @@
 #include <ostream>
 
 /**
- * @brief A fixed size array.
- * 
+ * @brief A fixed size array whose elements are stored inline, like a plain T[S].
+ *
+ * @details All S elements always exist, and they are value initialized unless an initializer list provides them. The
+ * array never allocates, so copies and moves are element-wise and a FixedArray of a trivially copyable type is itself
+ * trivially copyable. It is usable in constexpr contexts, the Container base is empty and literal so it adds nothing.
+ *
  * @tparam T The data type.
  * @tparam S The size of the array.
  */
-template <class T, u16 S>
-class FixedArray : public Container {
+template <class T, sizet S>
+class FixedArray : public Container<FixedArray<T, S>> {
+    static_assert(S > 0, "A FixedArray needs at least one element.");
+
 public:
     using Iterator = RandomAccessIterator<T>;
     using ConstIterator = RandomAccessIterator<const T>;
 
-    public:
-    FixedArray() :
-        m_Size(0),
-        p_Data(oallocat(T, S, oUnmanagedAllocator))
+public:
+    constexpr FixedArray() :
+        m_Data()
     { }
-    FixedArray(const FixedArray& rhs) :
-        m_Size(rhs.m_Size),
-        p_Data(oallocat(T, S, oUnmanagedAllocator))
-    {
-        for (u16 i = 0; i < this->m_Size; i++)
-            this->p_Data[i] = rhs.p_Data[i];
-    }
-    FixedArray(FixedArray&& other) :
-        m_Size(other.m_Size),
-        p_Data(other.p_Data)
-    {
-        other.m_Size = 0;
-        other.p_Data = oallocat(T, S, oUnmanagedAllocator);
-    }
-    FixedArray(const std::initializer_list<T> &list) :
-        m_Size(list.size()),
-        p_Data(oallocat(T, S, oUnmanagedAllocator))
+    /**
+     * @brief Construct a new FixedArray from an initializer list, the remaining elements are value initialized.
+     *
+     * @param list The first elements of the array, at most S of them.
+     */
+    constexpr FixedArray(std::initializer_list<T> list) :
+        m_Data()
     {
-      if (list.size() >= S)
-        throw Ocean::Exception(Ocean::Error::OVERFLOW_ERROR, "Initializer list length greater than FixedArray capacity!");
-
-      // Because list will be destroyed we can utilize std::move.
-      // 
-      for (u16 i = 0; i < list.size(); i++)
-        this->p_Data[i] = std::move(*(list.begin() + i));
-    }
-    ~FixedArray() {
-        if (this->p_Data)
-            ofree(this->p_Data, oUnmanagedAllocator);
-    }
-
-    FixedArray& operator = (const FixedArray& rhs) {
-        if (*this != rhs) {
-            this->m_Size = rhs.m_Size;
+        if (list.size() > S)
+            throw Ocean::Exception(Ocean::Error::OVERFLOW_ERROR, "Initializer list length greater than FixedArray capacity!");
 
-            for (u16 i = 0; i < this->m_Size; i++)
-                this->p_Data[i] = rhs.p_Data[i];
-        }
-
-        return *this;
-    }
-    FixedArray& operator = (FixedArray&& other) {
-        if (this->p_Data)
-            ofree(this->p_Data, oUnmanagedAllocator);
-
-        this->m_Size = other.m_Size;
-        this->p_Data = other.p_Data;
-
-        other.m_Size = 0;
-        other.p_Data = nullptr;
-
-        return *this;
+        for (sizet i = 0; i < list.size(); i++)
+            this->m_Data[i] = list.begin()[i];
     }
 
-    inline virtual b8 operator == (const Container& other) const override {
-        const FixedArray<T, S>* rhs = dynamic_cast<const FixedArray<T, S>*>(&other);
+    constexpr FixedArray(const FixedArray&) = default;
+    constexpr FixedArray(FixedArray&&) = default;
+    ~FixedArray() = default;
 
-        if (rhs == nullptr)
-            return false;
+    constexpr FixedArray& operator = (const FixedArray&) = default;
+    constexpr FixedArray& operator = (FixedArray&&) = default;
 
-        if (this->m_Size != rhs->m_Size)
-            return false;
+    /**
+     * @brief Equality comparison with another FixedArray. Container provides operator != from it.
+     *
+     * @param other The FixedArray to compare with.
+     * @return b8 - True if every element is equal, False otherwise.
+     */
+    constexpr b8 operator == (const FixedArray& other) const {
+        for (sizet i = 0; i < S; i++)
+            if (!(this->m_Data[i] == other.m_Data[i]))
+                return false;
 
-        return std::equal(this->Begin(), this->End(), rhs->Begin());
-    }
-    inline virtual b8 operator != (const Container& other) const override {
-        return !(*this == other);
+        return true;
     }
 
     /**
      * @brief Gets the element at the given index with range checking.
-     * 
+     *
      * @param index The index to get in the Array.
-     * @return T& 
+     * @return T&
      */
-    inline constexpr T& At(u16 index) {
-        if (index >= this->m_Size)
+    constexpr T& At(sizet index) {
+        if (index >= S)
             throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Array range!");
 
-        return this->p_Data[index];
+        return this->m_Data[index];
     }
     /**
      * @brief Gets the element at the given index with range checking.
-     * 
+     *
      * @param index The index to get in the Array.
-     * @return const T& 
+     * @return const T&
      */
-    constexpr const T& At(u16 index) const {
-        if (index >= this->m_Size)
+    constexpr const T& At(sizet index) const {
+        if (index >= S)
             throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Array range!");
 
-        return this->p_Data[index];
+        return this->m_Data[index];
     }
 
     /**
      * @brief Gets the element at the given index.
-     * 
+     *
      * @param i The index to get in the Array.
-     * @return T& 
+     * @return T&
      */
-    constexpr T& operator [] (u16 i) { return this->p_Data[i]; }
+    constexpr T& operator [] (sizet i) { return this->m_Data[i]; }
     /**
      * @brief Gets the element at the given index.
-     * 
+     *
      * @param i The index to get in the Array.
-     * @return const T& 
+     * @return const T&
      */
-    constexpr const T& operator [] (u16 i) const { return this->p_Data[i]; }
+    constexpr const T& operator [] (sizet i) const { return this->m_Data[i]; }
 
     /**
      * @brief Gets the first element in the Array.
-     * 
-     * @return T& 
+     *
+     * @return T&
      */
-    constexpr T& Front() { return this->p_Data[0]; }
+    constexpr T& Front() { return this->m_Data[0]; }
     /**
      * @brief Gets the first element in the Array.
-     * 
-     * @return const T& 
+     *
+     * @return const T&
      */
-    constexpr const T& Front() const { return this->p_Data[0]; }
+    constexpr const T& Front() const { return this->m_Data[0]; }
     /**
      * @brief Gets the last element in the Array.
-     * 
-     * @return T& 
+     *
+     * @return T&
      */
-    constexpr T& Back() { return this->p_Data[this->m_Size - 1]; }
+    constexpr T& Back() { return this->m_Data[S - 1]; }
     /**
      * @brief Gets the last element in the Array.
-     * 
-     * @return const T& 
+     *
+     * @return const T&
      */
-    constexpr const T& Back() const { return this->p_Data[this->m_Size - 1]; }
+    constexpr const T& Back() const { return this->m_Data[S - 1]; }
 
     /**
-     * @brief Gets a Iterator to the beginning of the DynamicArray.
-     * 
-     * @return Iterator 
+     * @brief Gets a Iterator to the beginning of the FixedArray.
+     *
+     * @return Iterator
+     */
+    constexpr Iterator Begin() { return Iterator(this->m_Data); }
+    constexpr Iterator begin() { return Begin(); }
+    /**
+     * @brief Gets a ConstIterator to the beginning of the FixedArray.
+     *
+     * @return ConstIterator
      */
-    inline constexpr Iterator Begin() { return Iterator(this->p_Data); }
-    inline constexpr Iterator begin() { return Begin(); }
+    constexpr ConstIterator Begin() const { return ConstIterator(this->m_Data); }
+    constexpr ConstIterator begin() const { return Begin(); }
     /**
-     * @brief Gets a ConstIterator to the beginning of the DynamicArray.
-     * 
-     * @return ConstIterator 
+     * @brief Gets a Iterator to the end of the FixedArray.
+     *
+     * @return Iterator
      */
-    inline constexpr ConstIterator Begin() const { return ConstIterator(this->p_Data); }
-    inline constexpr ConstIterator begin() const { return Begin(); }
+    constexpr Iterator End() { return Iterator(this->m_Data + S); }
+    constexpr Iterator end() { return End(); }
     /**
-     * @brief Gets a Iterator to the end of the DynamicArray.
-     * 
-     * @return Iterator 
+     * @brief Gets a ConstIterator to the end of the FixedArray.
+     *
+     * @return ConstIterator
      */
-    inline constexpr Iterator End() { return Iterator(this->p_Data + this->m_Size); }
-    inline constexpr Iterator end() { return End(); }
+    constexpr ConstIterator End() const { return ConstIterator(this->m_Data + S); }
+    constexpr ConstIterator end() const { return End(); }
+
     /**
-     * @brief Gets a ConstIterator to the end of the DynamicArray.
-     * 
-     * @return ConstIterator 
+     * @brief Assigns the given value to every element.
+     *
+     * @param value The value to assign.
      */
-    inline constexpr ConstIterator End() const { return ConstIterator(this->p_Data + this->m_Size); }
-    inline constexpr ConstIterator end() const { return End(); }
+    constexpr void Fill(const T& value) {
+        for (sizet i = 0; i < S; i++)
+            this->m_Data[i] = value;
+    }
 
     /**
      * @brief Gets the internal data pointer.
-     * 
-     * @return T* 
+     *
+     * @return T*
      */
-    constexpr T* Data() { return this->p_Data; }
+    constexpr T* Data() { return this->m_Data; }
     /**
      * @brief Gets the internal data pointer.
-     * 
-     * @return const T* 
+     *
+     * @return const T*
      */
-    constexpr const T* Data() const { return this->p_Data; }
+    constexpr const T* Data() const { return this->m_Data; }
 
     /**
-     * @return b8 - True if the Array is empty, False otherwise.
+     * @return b8 - Always False, a FixedArray always holds S elements.
      */
-    constexpr b8 Empty() const { return this->m_Size == 0; }
+    constexpr b8 Empty() const { return false; }
     /**
-     * @return u16 - The size of the Array.
+     * @return sizet - The size of the Array, S.
      */
-    constexpr u16 Size() const { return this->m_Size; }
+    constexpr sizet Size() const { return S; }
     /**
-     * @return u16 - The capacity of the Array.
+     * @return sizet - The capacity of the Array, S.
      */
-    constexpr u16 Capacity() const { return S; }
+    constexpr sizet Capacity() const { return S; }
 
     /**
      * @brief Gets a JSON useable format of the FixedArray.
-     * 
-     * @param os 
-     * @param rhs 
-     * @return std::ostream& 
+     *
+     * @param os
+     * @param rhs
+     * @return std::ostream&
      */
     friend std::ostream& operator << (std::ostream& os, const FixedArray<T, S>& rhs) {
         os << "{ ";
 
-        for (u16 i = 0; i < (S - 1); i++)
+        for (sizet i = 0; i < (S - 1); i++)
             os << rhs[i] << ", ";
 
         os << rhs[S - 1] << " }";
@@ -239,9 +220,7 @@ public:
     }
 
 protected:
-    /** @brief The number of elements in the FixedArray. */
-    u16 m_Size;
-    /** @brief The data pointer of the FixedArray. */
-    T* p_Data;
+    /** @brief The elements of the FixedArray. */
+    T m_Data[S];
 
 };  // FixedArray
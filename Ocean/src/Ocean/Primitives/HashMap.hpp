@@ -1,12 +1,1084 @@
 #pragma once
 
-#include <map>
-#include <unordered_map>
+/**
+ * @file HashMap.hpp
+ * @brief Ocean's associative containers.
+ *
+ * @details The HashMap is a flat, open addressing hash table in the style of the Swiss tables. Every slot of the table
+ * has a metadata byte that is either empty, deleted, or the low 7 bits of the hash of the entry in the slot. A lookup
+ * compares a whole group of 16 metadata bytes against the hash at once, with SSE2 where available, and only compares
+ * keys for the slots that match. The slots hold indexes into a dense array of entries, so iterating a HashMap is a
+ * linear walk over its keys and values.
+ */
 
-template <typename K, class T>
-using OrderedMap = std::map<K, T>;
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+#include "Ocean/Types/Iterator.hpp"
 
-template <typename K, class T>
-using UnorderedMap = std::unordered_map<K, T>;
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Memory.hpp"
+#include "Ocean/Primitives/Relocatable.hpp"
 
-// TODO: Replace OrderedMap & UnorderedMap with local implementations.
+// std
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define OC_HASHMAP_SSE2
+
+    #include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+/**
+ * @brief A transparent hash for string keys, a HashMap<std::string, T> can be searched with a cstring or a
+ * std::string_view without building a std::string.
+ */
+struct StringHash {
+    using is_transparent = void;
+
+    sizet operator () (std::string_view str) const { return std::hash<std::string_view>()(str); }
+
+};  // StringHash
+
+/**
+ * @brief The default hash of a HashMap, std::hash except for the string types which hash transparently.
+ *
+ * @tparam K The key type.
+ */
+template <class K>
+struct Hash : std::hash<K> { };
+
+template <>
+struct Hash<std::string> : StringHash { };
+
+template <>
+struct Hash<std::string_view> : StringHash { };
+
+/**
+ * @brief The default key comparison of a HashMap, std::equal_to except for the string types which compare
+ * transparently.
+ *
+ * @tparam K The key type.
+ */
+template <class K>
+struct EqualTo : std::equal_to<K> { };
+
+template <>
+struct EqualTo<std::string> : std::equal_to<> { };
+
+template <>
+struct EqualTo<std::string_view> : std::equal_to<> { };
+
+/**
+ * @brief A group of 16 metadata bytes of a HashMap, compared all at once.
+ *
+ * @details A metadata byte is k_Empty, k_Deleted, or the 7 bit hash of a full slot. Only the first two have their high
+ * bit set. The matches are returned as a bit mask where bit i is slot i of the group.
+ */
+class HashGroup {
+public:
+    /** @brief The number of slots in a group. */
+    OC_STATIC_EXPR sizet k_Width = 16;
+
+    /** @brief The metadata of a slot that was never used. */
+    OC_STATIC_EXPR u8 k_Empty = 0x80;
+    /** @brief The metadata of a slot whose entry was erased, lookups continue past it. */
+    OC_STATIC_EXPR u8 k_Deleted = 0xFE;
+
+public:
+    /**
+     * @brief Loads a group.
+     *
+     * @param control The first metadata byte of the group, it may be unaligned.
+     */
+    explicit HashGroup(const u8* control) :
+        m_Control(Load(control))
+    { }
+
+    /**
+     * @param hash The 7 bit hash to look for.
+     * @return u32 - The slots whose metadata equals the hash.
+     */
+    u32 Match(u8 hash) const {
+    #ifdef OC_HASHMAP_SSE2
+        const __m128i match = _mm_set1_epi8(static_cast<char>(hash));
+
+        return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(match, this->m_Control)));
+    #else
+        u32 mask = 0;
+
+        for (sizet i = 0; i < k_Width; i++)
+            mask |= static_cast<u32>(this->m_Control.bytes[i] == hash) << i;
+
+        return mask;
+    #endif
+    }
+
+    /**
+     * @return u32 - The empty slots.
+     */
+    u32 MatchEmpty() const { return Match(k_Empty); }
+
+    /**
+     * @return u32 - The empty or deleted slots, the ones an entry can be placed in.
+     */
+    u32 MatchFree() const {
+    #ifdef OC_HASHMAP_SSE2
+        return static_cast<u32>(_mm_movemask_epi8(this->m_Control));
+    #else
+        u32 mask = 0;
+
+        for (sizet i = 0; i < k_Width; i++)
+            mask |= static_cast<u32>(this->m_Control.bytes[i] >> 7) << i;
+
+        return mask;
+    #endif
+    }
+
+    /**
+     * @param mask A non-zero match mask.
+     * @return u32 - The first slot in the mask.
+     */
+    static u32 FirstSlot(u32 mask) {
+    #if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+
+        return static_cast<u32>(index);
+    #else
+        return static_cast<u32>(__builtin_ctz(mask));
+    #endif
+    }
+
+    /**
+     * @param mask A match mask.
+     * @return u32 - The number of slots after the last slot in the mask, k_Width if the mask is empty.
+     */
+    static u32 SlotsAfterLast(u32 mask) {
+        if (mask == 0)
+            return k_Width;
+
+    #if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse(&index, mask);
+
+        return static_cast<u32>(k_Width - 1 - index);
+    #else
+        return static_cast<u32>(__builtin_clz(mask)) - (32 - k_Width);
+    #endif
+    }
+
+private:
+#ifdef OC_HASHMAP_SSE2
+    using Control = __m128i;
+#else
+    /** @brief The metadata bytes, wrapped so they can be returned by Load. */
+    struct Control {
+        u8 bytes[k_Width];
+
+    };  // Control
+#endif
+
+    /**
+     * @param control The first metadata byte of the group, it may be unaligned.
+     * @return Control - The metadata of the group.
+     */
+    OC_STATIC_INLINE Control Load(const u8* control) {
+    #ifdef OC_HASHMAP_SSE2
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+    #else
+        Control loaded;
+        memcpy(loaded.bytes, control, k_Width);
+
+        return loaded;
+    #endif
+    }
+
+private:
+    /** @brief The metadata of the group. */
+    Control m_Control;
+
+};  // HashGroup
+
+/**
+ * @brief Picks the type a HashMap lookup takes. Maps with a transparent hash and key comparison take any type the two
+ * accept, others take the key type.
+ */
+template <b8 Transparent>
+struct HashKeyArg {
+    template <class L, class K>
+    using Type = K;
+
+};  // HashKeyArg
+
+template <>
+struct HashKeyArg<true> {
+    template <class L, class K>
+    using Type = L;
+
+};  // HashKeyArg
+
+/**
+ * @brief True if the functor declares is_transparent.
+ *
+ * @tparam F The functor type.
+ */
+template <class F, class = void>
+struct IsTransparent : std::false_type { };
+
+template <class F>
+struct IsTransparent<F, std::void_t<typename F::is_transparent>> : std::true_type { };
+
+/**
+ * @brief An unordered map stored as a flat open addressing hash table.
+ *
+ * @details Entries are kept in a dense array in insertion order, erasing an entry moves the last entry into its place.
+ * Iteration walks that array. Inserting may grow the array, so pointers and iterators to entries are invalidated by
+ * inserts and erases, like a DynamicArray's. When the hash and the key comparison are transparent, as the defaults are
+ * for std::string, lookups accept any type they can hash and compare.
+ *
+ * @tparam K The key type.
+ * @tparam T The value type.
+ * @tparam H The hash functor.
+ * @tparam E The key equality functor.
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
+ */
+template <class K, class T, class H = Hash<K>, class E = EqualTo<K>, class A = MallocPolicy>
+class HashMap {
+public:
+    /**
+     * @brief A key and its value.
+     */
+    struct Entry {
+        /** @brief An entry can move bytewise if both its key and value can. */
+        using TriviallyRelocatable = std::bool_constant<IsTriviallyRelocatable_v<K> && IsTriviallyRelocatable_v<T>>;
+
+        template <class L, class ... Args>
+        Entry(L&& newKey, Args&& ... args) :
+            key(std::forward<L>(newKey)),
+            value(std::forward<Args>(args)...)
+        { }
+
+        /** @brief The key, it must not be changed while in a HashMap. */
+        K key;
+        /** @brief The value. */
+        T value;
+
+    };  // Entry
+
+    using Iterator = RandomAccessIterator<Entry>;
+    using ConstIterator = RandomAccessIterator<const Entry>;
+
+    /** @brief The smallest table, one group. */
+    OC_STATIC_EXPR sizet k_MinimumCapacity = HashGroup::k_Width;
+    /** @brief The capacity of the first entry array. */
+    OC_STATIC_EXPR sizet k_MinimumEntries = 4;
+
+private:
+    template <class L>
+    using KeyArg = typename HashKeyArg<IsTransparent<H>::value && IsTransparent<E>::value>::template Type<L, K>;
+
+    /** @brief Returned by the slot searches when the key is not in the table. */
+    OC_STATIC_EXPR sizet k_NoSlot = std::numeric_limits<sizet>::max();
+
+public:
+    inline HashMap() :
+        m_Allocator(),
+        m_Hash(),
+        m_Equal(),
+        p_Slots(nullptr),
+        p_Control(nullptr),
+        m_Capacity(0),
+        m_GrowthLeft(0),
+        p_Entries(nullptr),
+        m_Size(0),
+        m_EntryCapacity(0)
+    { }
+    /**
+     * @brief Construct a new empty HashMap that allocates from the given allocator.
+     *
+     * @param allocator The allocator policy to use.
+     */
+    inline explicit HashMap(const A& allocator) :
+        m_Allocator(allocator),
+        m_Hash(),
+        m_Equal(),
+        p_Slots(nullptr),
+        p_Control(nullptr),
+        m_Capacity(0),
+        m_GrowthLeft(0),
+        p_Entries(nullptr),
+        m_Size(0),
+        m_EntryCapacity(0)
+    { }
+    /**
+     * @brief Construct a new HashMap from another HashMap, using the same allocator.
+     *
+     * @param other The HashMap to copy from.
+     */
+    inline HashMap(const HashMap& other) :
+        m_Allocator(other.m_Allocator),
+        m_Hash(other.m_Hash),
+        m_Equal(other.m_Equal),
+        p_Slots(nullptr),
+        p_Control(nullptr),
+        m_Capacity(0),
+        m_GrowthLeft(0),
+        p_Entries(nullptr),
+        m_Size(0),
+        m_EntryCapacity(0)
+    {
+        CopyFrom(other);
+    }
+    /**
+     * @brief Move a HashMap to a new HashMap.
+     *
+     * @param other The HashMap to move from.
+     */
+    inline HashMap(HashMap&& other) :
+        m_Allocator(other.m_Allocator),
+        m_Hash(std::move(other.m_Hash)),
+        m_Equal(std::move(other.m_Equal)),
+        p_Slots(other.p_Slots),
+        p_Control(other.p_Control),
+        m_Capacity(other.m_Capacity),
+        m_GrowthLeft(other.m_GrowthLeft),
+        p_Entries(other.p_Entries),
+        m_Size(other.m_Size),
+        m_EntryCapacity(other.m_EntryCapacity)
+    {
+        other.Forget();
+    }
+    /**
+     * @brief Construct a new HashMap from an initial list of entries, later duplicates of a key are ignored.
+     *
+     * @param list The keys and values to insert.
+     */
+    inline HashMap(std::initializer_list<std::pair<K, T>> list) :
+        HashMap()
+    {
+        Reserve(list.size());
+
+        for (const std::pair<K, T>& pair : list)
+            Emplace(pair.first, pair.second);
+    }
+    inline ~HashMap() {
+        Release();
+    }
+
+    inline HashMap& operator = (const HashMap& other) {
+        if (this != &other) {
+            Release();
+
+            this->m_Allocator = other.m_Allocator;
+            this->m_Hash = other.m_Hash;
+            this->m_Equal = other.m_Equal;
+
+            CopyFrom(other);
+        }
+
+        return *this;
+    }
+    inline HashMap& operator = (HashMap&& other) {
+        if (this != &other) {
+            Release();
+
+            this->m_Allocator = other.m_Allocator;
+            this->m_Hash = std::move(other.m_Hash);
+            this->m_Equal = std::move(other.m_Equal);
+
+            this->p_Slots = other.p_Slots;
+            this->p_Control = other.p_Control;
+            this->m_Capacity = other.m_Capacity;
+            this->m_GrowthLeft = other.m_GrowthLeft;
+            this->p_Entries = other.p_Entries;
+            this->m_Size = other.m_Size;
+            this->m_EntryCapacity = other.m_EntryCapacity;
+
+            other.Forget();
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Finds the entry of a key.
+     *
+     * @param key The key to look for.
+     * @return Iterator - The entry, or End() if the key is not in the HashMap.
+     */
+    template <class L = K>
+    inline Iterator Find(const KeyArg<L>& key) {
+        const sizet slot = FindSlot(key, HashOf(key));
+
+        return slot == k_NoSlot ? End() : Iterator(&this->p_Entries[this->p_Slots[slot]]);
+    }
+    /**
+     * @brief Finds the entry of a key.
+     *
+     * @param key The key to look for.
+     * @return ConstIterator - The entry, or End() if the key is not in the HashMap.
+     */
+    template <class L = K>
+    inline ConstIterator Find(const KeyArg<L>& key) const {
+        const sizet slot = FindSlot(key, HashOf(key));
+
+        return slot == k_NoSlot ? End() : ConstIterator(&this->p_Entries[this->p_Slots[slot]]);
+    }
+
+    /**
+     * @param key The key to look for.
+     * @return b8 - True if the key is in the HashMap, False otherwise.
+     */
+    template <class L = K>
+    inline b8 Contains(const KeyArg<L>& key) const {
+        return FindSlot(key, HashOf(key)) != k_NoSlot;
+    }
+
+    /**
+     * @brief Gets the value of a key, throwing if it is not in the HashMap.
+     *
+     * @param key The key to look for.
+     * @return T&
+     */
+    template <class L = K>
+    inline T& At(const KeyArg<L>& key) {
+        const sizet slot = FindSlot(key, HashOf(key));
+        if (slot == k_NoSlot)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Key is not in the HashMap!");
+
+        return this->p_Entries[this->p_Slots[slot]].value;
+    }
+    /**
+     * @brief Gets the value of a key, throwing if it is not in the HashMap.
+     *
+     * @param key The key to look for.
+     * @return const T&
+     */
+    template <class L = K>
+    inline const T& At(const KeyArg<L>& key) const {
+        const sizet slot = FindSlot(key, HashOf(key));
+        if (slot == k_NoSlot)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Key is not in the HashMap!");
+
+        return this->p_Entries[this->p_Slots[slot]].value;
+    }
+
+    /**
+     * @brief Gets the value of a key, inserting a value initialized one if the key is not in the HashMap.
+     *
+     * @param key The key to look for.
+     * @return T&
+     */
+    template <class L = K>
+    inline T& operator [] (KeyArg<L>&& key) {
+        return Emplace(std::forward<KeyArg<L>>(key)).first->value;
+    }
+    /**
+     * @brief Gets the value of a key, inserting a value initialized one if the key is not in the HashMap.
+     *
+     * @param key The key to look for.
+     * @return T&
+     */
+    template <class L = K>
+    inline T& operator [] (const KeyArg<L>& key) {
+        return Emplace(key).first->value;
+    }
+
+    /**
+     * @brief Inserts a key and value if the key is not already in the HashMap.
+     *
+     * @param key The key.
+     * @param value The value.
+     * @return std::pair<Iterator, b8> - The entry of the key, and True if it was inserted.
+     */
+    inline std::pair<Iterator, b8> Insert(const K& key, const T& value) {
+        return Emplace(key, value);
+    }
+
+    /**
+     * @brief Constructs a value for the key in place, if the key is not already in the HashMap. The arguments are left
+     * untouched when the key exists.
+     *
+     * @tparam L The key argument type, a K is only constructed from it when inserting.
+     * @tparam Args
+     * @param key The key.
+     * @param args The type T constructor arguments.
+     * @return std::pair<Iterator, b8> - The entry of the key, and True if it was inserted.
+     */
+    template <class L, class ... Args>
+    std::pair<Iterator, b8> Emplace(L&& key, Args&& ... args) {
+        const u64 hash = HashOf(key);
+
+        const sizet slot = FindSlot(key, hash);
+        if (slot != k_NoSlot)
+            return { Iterator(&this->p_Entries[this->p_Slots[slot]]), false };
+
+        // Growing the table does not move the entries, so it is done before the arguments are used.
+        //
+        if (this->m_GrowthLeft == 0)
+            Rehash(TableCapacityFor(this->m_Size + 1));
+
+        Entry* entry = nullptr;
+
+        if (this->m_Size == this->m_EntryCapacity) {
+            // The arguments may refer to an entry, which is moved by the growth. So the entry is built first.
+            //
+            StagedValue<Entry> staged(std::forward<L>(key), std::forward<Args>(args)...);
+
+            SetEntryCapacity(NextEntryCapacity());
+
+            entry = staged.RelocateTo(&this->p_Entries[this->m_Size]);
+        }
+        else {
+            entry = new (&this->p_Entries[this->m_Size]) Entry(std::forward<L>(key), std::forward<Args>(args)...);
+        }
+
+        Place(this->m_Size, hash);
+
+        this->m_Size++;
+
+        return { Iterator(entry), true };
+    }
+
+    /**
+     * @brief Assigns the value of a key, inserting the key if it is not in the HashMap.
+     *
+     * @param key The key.
+     * @param value The value.
+     * @return std::pair<Iterator, b8> - The entry of the key, and True if it was inserted.
+     */
+    template <class L, class V>
+    std::pair<Iterator, b8> InsertOrAssign(L&& key, V&& value) {
+        std::pair<Iterator, b8> result = Emplace(std::forward<L>(key), std::forward<V>(value));
+
+        if (!result.second)
+            result.first->value = std::forward<V>(value);
+
+        return result;
+    }
+
+    /**
+     * @brief Erases the entry of a key.
+     *
+     * @param key The key to erase.
+     * @return b8 - True if the key was erased, False if it was not in the HashMap.
+     */
+    template <class L = K>
+    inline b8 Erase(const KeyArg<L>& key) {
+        const sizet slot = FindSlot(key, HashOf(key));
+        if (slot == k_NoSlot)
+            return false;
+
+        EraseSlot(slot);
+
+        return true;
+    }
+    /**
+     * @brief Erases the entry at the iterator. The last entry is moved into its place.
+     *
+     * @param position The entry to erase.
+     * @return Iterator - The same position, which now holds the next entry to visit.
+     */
+    inline Iterator Erase(Iterator position) {
+        const sizet index = static_cast<sizet>(&*position - this->p_Entries);
+
+        EraseSlot(FindSlotOfIndex(index, HashOf(this->p_Entries[index].key)));
+
+        return Iterator(&this->p_Entries[index]);
+    }
+
+    /**
+     * @brief Erases every entry, keeping the memory.
+     */
+    inline void Clear() {
+        Destroy();
+
+        if (this->m_Capacity) {
+            memset(this->p_Control, HashGroup::k_Empty, this->m_Capacity + HashGroup::k_Width);
+
+            this->m_GrowthLeft = MaxLoad(this->m_Capacity);
+        }
+    }
+
+    /**
+     * @brief Makes room for the given number of entries, so inserting them does not allocate.
+     *
+     * @param count The number of entries.
+     */
+    inline void Reserve(sizet count) {
+        if (count > MaxSize())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested HashMap capacity is too large!");
+
+        if (count > this->m_EntryCapacity)
+            SetEntryCapacity(count);
+
+        if (count > this->m_Size + this->m_GrowthLeft)
+            Rehash(TableCapacityFor(count));
+    }
+
+    /**
+     * @brief Shrinks the entries and the table to fit the current size, freeing them if the HashMap is empty.
+     */
+    inline void ShrinkToFit() {
+        if (this->m_Size == 0) {
+            Release();
+
+            return;
+        }
+
+        if (this->m_EntryCapacity > this->m_Size)
+            SetEntryCapacity(this->m_Size);
+
+        const sizet capacity = TableCapacityFor(this->m_Size);
+        if (capacity < this->m_Capacity)
+            Rehash(capacity);
+    }
+
+    /**
+     * @brief Gets a Iterator to the first entry.
+     *
+     * @return Iterator
+     */
+    inline Iterator Begin() { return Iterator(this->p_Entries); }
+    inline Iterator begin() { return Begin(); }
+    /**
+     * @brief Gets a ConstIterator to the first entry.
+     *
+     * @return ConstIterator
+     */
+    inline ConstIterator Begin() const { return ConstIterator(this->p_Entries); }
+    inline ConstIterator begin() const { return Begin(); }
+    /**
+     * @brief Gets a Iterator past the last entry.
+     *
+     * @return Iterator
+     */
+    inline Iterator End() { return Iterator(this->p_Entries + this->m_Size); }
+    inline Iterator end() { return End(); }
+    /**
+     * @brief Gets a ConstIterator past the last entry.
+     *
+     * @return ConstIterator
+     */
+    inline ConstIterator End() const { return ConstIterator(this->p_Entries + this->m_Size); }
+    inline ConstIterator end() const { return End(); }
+
+    /**
+     * @return A - The allocator policy of the HashMap.
+     */
+    inline A GetAllocator() const { return this->m_Allocator; }
+
+    /**
+     * @return b8 - True if the HashMap has no entries, False otherwise.
+     */
+    inline b8 Empty() const { return this->m_Size == 0; }
+    /**
+     * @return sizet - The number of entries.
+     */
+    inline sizet Size() const { return this->m_Size; }
+    /**
+     * @return sizet - The number of slots in the table, up to 7/8 of them are used before it grows.
+     */
+    inline sizet Capacity() const { return this->m_Capacity; }
+    /**
+     * @return sizet - The largest number of entries a HashMap can hold, the slots index the entries with a u32.
+     */
+    OC_STATIC_EXPR sizet MaxSize() { return std::numeric_limits<u32>::max() - 1; }
+
+private:
+    /**
+     * @brief Hashes a key, mixing the bits so hashes like std::hash's identity on integers spread over the table.
+     *
+     * @tparam L The key argument type.
+     * @param key The key.
+     * @return u64
+     */
+    template <class L>
+    inline u64 HashOf(const L& key) const {
+        const u64 hash = static_cast<u64>(this->m_Hash(key)) * 0x9E3779B97F4A7C15ull;
+
+        return hash ^ (hash >> 32);
+    }
+
+    /** @return u8 - The 7 bit part of the hash that is stored in the metadata. */
+    OC_STATIC u8 ShortHash(u64 hash) { return static_cast<u8>(hash & 0x7F); }
+    /** @return sizet - The part of the hash that selects the first group to probe. */
+    OC_STATIC sizet ProbeStart(u64 hash) { return static_cast<sizet>(hash >> 7); }
+
+    /**
+     * @param capacity The number of slots.
+     * @return sizet - The number of entries the table holds before it grows.
+     */
+    OC_STATIC sizet MaxLoad(sizet capacity) { return capacity - capacity / 8; }
+
+    /**
+     * @param count The number of entries.
+     * @return sizet - The smallest power of two table that holds them.
+     */
+    OC_STATIC sizet TableCapacityFor(sizet count) {
+        sizet capacity = k_MinimumCapacity;
+
+        while (MaxLoad(capacity) < count)
+            capacity *= 2;
+
+        return capacity;
+    }
+
+    /**
+     * @brief Finds the slot of a key. The groups are probed quadratically, the step grows by a group each time, which
+     * visits every group of a power of two table.
+     *
+     * @tparam L The key argument type.
+     * @param key The key.
+     * @param hash The mixed hash of the key.
+     * @return sizet - The slot, or k_NoSlot.
+     */
+    template <class L>
+    sizet FindSlot(const L& key, u64 hash) const {
+        if (this->m_Size == 0)
+            return k_NoSlot;
+
+        const sizet mask = this->m_Capacity - 1;
+        const u8 shortHash = ShortHash(hash);
+
+        sizet position = ProbeStart(hash) & mask;
+        sizet step = 0;
+
+        while (true) {
+            const HashGroup group(this->p_Control + position);
+
+            for (u32 matches = group.Match(shortHash); matches; matches &= matches - 1) {
+                const sizet slot = (position + HashGroup::FirstSlot(matches)) & mask;
+
+                if (this->m_Equal(this->p_Entries[this->p_Slots[slot]].key, key))
+                    return slot;
+            }
+
+            // A probe sequence ends at its first empty slot, so the key would have been in an earlier group.
+            //
+            if (group.MatchEmpty())
+                return k_NoSlot;
+
+            step += HashGroup::k_Width;
+            position = (position + step) & mask;
+        }
+    }
+
+    /**
+     * @brief Finds the slot that points at the given entry.
+     *
+     * @param index The index of the entry.
+     * @param hash The mixed hash of its key.
+     * @return sizet
+     */
+    sizet FindSlotOfIndex(sizet index, u64 hash) const {
+        const sizet mask = this->m_Capacity - 1;
+        const u8 shortHash = ShortHash(hash);
+
+        sizet position = ProbeStart(hash) & mask;
+        sizet step = 0;
+
+        while (true) {
+            const HashGroup group(this->p_Control + position);
+
+            for (u32 matches = group.Match(shortHash); matches; matches &= matches - 1) {
+                const sizet slot = (position + HashGroup::FirstSlot(matches)) & mask;
+
+                if (this->p_Slots[slot] == index)
+                    return slot;
+            }
+
+            step += HashGroup::k_Width;
+            position = (position + step) & mask;
+        }
+    }
+
+    /**
+     * @brief Finds the first empty or deleted slot along the probe sequence of a hash.
+     *
+     * @param hash The mixed hash.
+     * @return sizet
+     */
+    sizet FindFreeSlot(u64 hash) const {
+        const sizet mask = this->m_Capacity - 1;
+
+        sizet position = ProbeStart(hash) & mask;
+        sizet step = 0;
+
+        while (true) {
+            const u32 free = HashGroup(this->p_Control + position).MatchFree();
+            if (free)
+                return (position + HashGroup::FirstSlot(free)) & mask;
+
+            step += HashGroup::k_Width;
+            position = (position + step) & mask;
+        }
+    }
+
+    /**
+     * @brief Sets the metadata of a slot. The first group is mirrored after the last slot, so a group can be loaded
+     * from any slot without wrapping.
+     *
+     * @param slot The slot.
+     * @param control The metadata.
+     */
+    inline void SetControl(sizet slot, u8 control) {
+        this->p_Control[slot] = control;
+
+        if (slot < HashGroup::k_Width)
+            this->p_Control[this->m_Capacity + slot] = control;
+    }
+
+    /**
+     * @brief Puts an entry in the table.
+     * @note The table must have room for it.
+     *
+     * @param index The index of the entry.
+     * @param hash The mixed hash of its key.
+     */
+    inline void Place(sizet index, u64 hash) {
+        const sizet slot = FindFreeSlot(hash);
+
+        if (this->p_Control[slot] == HashGroup::k_Empty)
+            this->m_GrowthLeft--;
+
+        SetControl(slot, ShortHash(hash));
+        this->p_Slots[slot] = static_cast<u32>(index);
+    }
+
+    /**
+     * @brief Erases the entry of a slot and moves the last entry into its place.
+     *
+     * @param slot The slot to erase.
+     */
+    void EraseSlot(sizet slot) {
+        const sizet index = this->p_Slots[slot];
+        const sizet last = this->m_Size - 1;
+
+        // A slot can go back to empty if no probe sequence ever had to pass it. That is the case when there are fewer
+        // than a group of full slots in a row around it, as every group loaded over it then has an empty slot.
+        //
+        const sizet mask = this->m_Capacity - 1;
+        const u32 emptyAfter = HashGroup(this->p_Control + slot).MatchEmpty();
+        const u32 emptyBefore = HashGroup(this->p_Control + ((slot - HashGroup::k_Width) & mask)).MatchEmpty();
+
+        if (emptyAfter && emptyBefore && HashGroup::FirstSlot(emptyAfter) + HashGroup::SlotsAfterLast(emptyBefore) < HashGroup::k_Width) {
+            SetControl(slot, HashGroup::k_Empty);
+
+            this->m_GrowthLeft++;
+        }
+        else {
+            SetControl(slot, HashGroup::k_Deleted);
+        }
+
+        if (index != last) {
+            this->p_Slots[FindSlotOfIndex(last, HashOf(this->p_Entries[last].key))] = static_cast<u32>(index);
+
+            this->p_Entries[index].~Entry();
+            RelocateEntry(&this->p_Entries[last], &this->p_Entries[index]);
+        }
+        else {
+            this->p_Entries[index].~Entry();
+        }
+
+        this->m_Size--;
+    }
+
+    /**
+     * @brief Rebuilds the table with the given number of slots, which also clears the deleted slots. The entries do not
+     * move.
+     *
+     * @param capacity The number of slots, a power of two.
+     */
+    void Rehash(sizet capacity) {
+        void* memory = oallocaa(capacity * sizeof(u32) + capacity + HashGroup::k_Width, &this->m_Allocator, alignof(u32));
+        if (!memory)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to grow the HashMap!");
+
+        if (this->p_Slots)
+            ofree(this->p_Slots, &this->m_Allocator);
+
+        this->p_Slots = static_cast<u32*>(memory);
+        this->p_Control = static_cast<u8*>(memory) + capacity * sizeof(u32);
+        this->m_Capacity = capacity;
+
+        memset(this->p_Control, HashGroup::k_Empty, capacity + HashGroup::k_Width);
+
+        for (sizet i = 0; i < this->m_Size; i++) {
+            const u64 hash = HashOf(this->p_Entries[i].key);
+            const sizet slot = FindFreeSlot(hash);
+
+            SetControl(slot, ShortHash(hash));
+            this->p_Slots[slot] = static_cast<u32>(i);
+        }
+
+        this->m_GrowthLeft = MaxLoad(capacity) - this->m_Size;
+    }
+
+    /**
+     * @return sizet - The entry capacity to grow to when the entry array is full.
+     */
+    inline sizet NextEntryCapacity() const {
+        if (this->m_Size >= MaxSize())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "HashMap is full!");
+
+        return std::min(std::max(this->m_EntryCapacity * 2, k_MinimumEntries), MaxSize());
+    }
+
+    /**
+     * @brief Reallocates the entry array, relocating the entries.
+     *
+     * @param capacity The new entry capacity, not smaller than the size.
+     */
+    void SetEntryCapacity(sizet capacity) {
+        Entry* entries = nullptr;
+
+        if constexpr (IsTriviallyRelocatable_v<Entry>) {
+            entries = oreallocat(this->p_Entries, Entry, this->m_EntryCapacity, capacity, &this->m_Allocator);
+            if (!entries)
+                throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to grow the HashMap!");
+        }
+        else {
+            entries = oallocat(Entry, capacity, &this->m_Allocator);
+            if (!entries)
+                throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to grow the HashMap!");
+
+            for (sizet i = 0; i < this->m_Size; i++)
+                RelocateEntry(&this->p_Entries[i], &entries[i]);
+
+            if (this->p_Entries)
+                ofree(this->p_Entries, &this->m_Allocator);
+        }
+
+        this->p_Entries = entries;
+        this->m_EntryCapacity = capacity;
+    }
+
+    /**
+     * @brief Moves an entry to uninitialized memory and ends the source's lifetime.
+     *
+     * @param source The entry to move.
+     * @param destination The memory to move it to.
+     */
+    OC_STATIC void RelocateEntry(Entry* source, Entry* destination) {
+        if constexpr (IsTriviallyRelocatable_v<Entry>) {
+            memcpy(static_cast<void*>(destination), static_cast<const void*>(source), sizeof(Entry));
+        }
+        else {
+            new (destination) Entry(std::move(*source));
+
+            source->~Entry();
+        }
+    }
+
+    /**
+     * @brief Copies the table and the entries of another HashMap into this empty one. The layout is copied as is,
+     * since both hash the keys the same way.
+     *
+     * @param other The HashMap to copy.
+     */
+    void CopyFrom(const HashMap& other) {
+        if (other.m_Size == 0)
+            return;
+
+        SetEntryCapacity(other.m_Size);
+
+        for (sizet i = 0; i < other.m_Size; i++) {
+            new (&this->p_Entries[i]) Entry(other.p_Entries[i].key, other.p_Entries[i].value);
+
+            this->m_Size++;
+        }
+
+        const sizet bytes = other.m_Capacity * sizeof(u32) + other.m_Capacity + HashGroup::k_Width;
+
+        void* memory = oallocaa(bytes, &this->m_Allocator, alignof(u32));
+        if (!memory)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to copy the HashMap!");
+
+        memcpy(memory, other.p_Slots, bytes);
+
+        this->p_Slots = static_cast<u32*>(memory);
+        this->p_Control = static_cast<u8*>(memory) + other.m_Capacity * sizeof(u32);
+        this->m_Capacity = other.m_Capacity;
+        this->m_GrowthLeft = other.m_GrowthLeft;
+    }
+
+    /**
+     * @brief Deconstructs every entry.
+     */
+    inline void Destroy() {
+        if constexpr (!std::is_trivially_destructible_v<Entry>) {
+            for (sizet i = 0; i < this->m_Size; i++)
+                this->p_Entries[i].~Entry();
+        }
+
+        this->m_Size = 0;
+    }
+
+    /**
+     * @brief Deconstructs every entry and frees the memory.
+     */
+    inline void Release() {
+        Destroy();
+
+        if (this->p_Entries)
+            ofree(this->p_Entries, &this->m_Allocator);
+
+        if (this->p_Slots)
+            ofree(this->p_Slots, &this->m_Allocator);
+
+        Forget();
+    }
+
+    /**
+     * @brief Empties the HashMap without touching its memory, after the memory was handed to another HashMap.
+     */
+    inline void Forget() {
+        this->p_Slots = nullptr;
+        this->p_Control = nullptr;
+        this->m_Capacity = 0;
+        this->m_GrowthLeft = 0;
+        this->p_Entries = nullptr;
+        this->m_Size = 0;
+        this->m_EntryCapacity = 0;
+    }
+
+private:
+    /** @brief The allocator policy of the HashMap. */
+    A m_Allocator;
+    /** @brief The hash functor. */
+    H m_Hash;
+    /** @brief The key equality functor. */
+    E m_Equal;
+
+    /** @brief The entry index of each slot. The metadata bytes follow in the same allocation. */
+    u32* p_Slots;
+    /** @brief The metadata byte of each slot, followed by a copy of the first group. */
+    u8* p_Control;
+    /** @brief The number of slots, a power of two. */
+    sizet m_Capacity;
+    /** @brief The number of empty slots that can still be filled before the table grows. */
+    sizet m_GrowthLeft;
+
+    /** @brief The dense entry array. */
+    Entry* p_Entries;
+    /** @brief The number of entries. */
+    sizet m_Size;
+    /** @brief The number of entries in memory. */
+    sizet m_EntryCapacity;
+
+};  // HashMap
@@ -0,0 +1,459 @@
+#pragma once
+
+/**
+ * @file IntrusiveList.hpp
+ * @brief An intrusive doubly linked list, linking objects through hooks they already own.
+ *
+ * @details The list never allocates, copies or destroys its objects. An object joins a list by deriving from an
+ * IntrusiveListHook, and the list links the hooks together around a sentinel hook of its own. So inserting, erasing
+ * and splicing are O(1) pointer updates, and an object can be erased knowing only the object. An object may sit in
+ * several lists at once by deriving from a hook per list, each with its own tag type.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+#include "Ocean/Primitives/Assert.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Macros.hpp"
+
+// std
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+template <class T, class Tag>
+class IntrusiveList;
+
+/**
+ * @brief The link fields an object derives from to be held by an IntrusiveList.
+ *
+ * @details Copying an object does not copy its membership, the copy starts unlinked. An object must be erased from
+ * its list before it is destroyed.
+ *
+ * @tparam Tag The tag naming the list the hook belongs to, so that an object can have a hook for several lists.
+ */
+template <class Tag = void>
+class IntrusiveListHook {
+public:
+    inline IntrusiveListHook() :
+        p_Prev(nullptr),
+        p_Next(nullptr)
+    { }
+    inline IntrusiveListHook(const IntrusiveListHook&) :
+        p_Prev(nullptr),
+        p_Next(nullptr)
+    { }
+    inline ~IntrusiveListHook() {
+        OASSERTM(!IsLinked(), "An object was destroyed while still in an IntrusiveList.");
+    }
+
+    inline IntrusiveListHook& operator = (const IntrusiveListHook&) { return *this; }
+
+    /**
+     * @return b8 - True if the object is in a list, False otherwise.
+     */
+    inline b8 IsLinked() const { return this->p_Next != nullptr; }
+
+private:
+    template <class, class>
+    friend class IntrusiveList;
+
+    /** @brief The previous hook, the list's sentinel before the first object. */
+    IntrusiveListHook* p_Prev;
+    /** @brief The next hook, the list's sentinel after the last object. */
+    IntrusiveListHook* p_Next;
+
+};  // IntrusiveListHook
+
+/**
+ * @brief A doubly linked list of objects that derive from an IntrusiveListHook.
+ *
+ * @details The list is circular around a sentinel hook, so no operation checks for the ends. The list only holds
+ * references, erasing an object or clearing the list leaves the objects alive and unlinked.
+ *
+ * @tparam T The object type, deriving from IntrusiveListHook<Tag>.
+ * @tparam Tag The tag of the hook the list links through.
+ */
+template <class T, class Tag = void>
+class IntrusiveList {
+private:
+    using Hook = IntrusiveListHook<Tag>;
+
+public:
+    /**
+     * @brief A bidirectional iterator over the objects of the list.
+     *
+     * @tparam Const True for a ConstIterator.
+     */
+    template <b8 Const>
+    class BasicIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+    public:
+        BasicIterator() :
+            p_Hook(nullptr)
+        { }
+        explicit BasicIterator(Hook* hook) :
+            p_Hook(hook)
+        { }
+        /**
+         * @brief Converts an Iterator to a ConstIterator.
+         *
+         * @param other The Iterator.
+         */
+        template <b8 OtherConst, class = std::enable_if_t<Const && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) :
+            p_Hook(other.p_Hook)
+        { }
+
+        reference operator * () const { return *static_cast<pointer>(this->p_Hook); }
+        pointer operator -> () const { return static_cast<pointer>(this->p_Hook); }
+
+        BasicIterator& operator ++ () {
+            this->p_Hook = this->p_Hook->p_Next;
+
+            return *this;
+        }
+        BasicIterator operator ++ (int) {
+            BasicIterator previous = *this;
+            ++*this;
+
+            return previous;
+        }
+        BasicIterator& operator -- () {
+            this->p_Hook = this->p_Hook->p_Prev;
+
+            return *this;
+        }
+        BasicIterator operator -- (int) {
+            BasicIterator previous = *this;
+            --*this;
+
+            return previous;
+        }
+
+        b8 operator == (const BasicIterator& other) const { return this->p_Hook == other.p_Hook; }
+        b8 operator != (const BasicIterator& other) const { return this->p_Hook != other.p_Hook; }
+
+    private:
+        template <b8>
+        friend class BasicIterator;
+
+        friend class IntrusiveList;
+
+    private:
+        /** @brief The hook of the object, or the list's sentinel at the end. */
+        Hook* p_Hook;
+
+    };  // BasicIterator
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+public:
+    inline IntrusiveList() :
+        m_Root(),
+        m_Size(0)
+    {
+        Reset();
+    }
+    /**
+     * @brief Move the objects of a list to a new list, the other list is left empty.
+     *
+     * @param other The list to move from.
+     */
+    inline IntrusiveList(IntrusiveList&& other) :
+        m_Root(),
+        m_Size(0)
+    {
+        Reset();
+        Splice(End(), other);
+    }
+    inline ~IntrusiveList() {
+        Clear();
+
+        // The sentinel is unlinked so that its hook does not report a linked object.
+        //
+        this->m_Root.p_Prev = nullptr;
+        this->m_Root.p_Next = nullptr;
+    }
+
+    OC_NO_COPY(IntrusiveList);
+
+    inline IntrusiveList& operator = (IntrusiveList&& other) {
+        if (this != &other) {
+            Clear();
+            Splice(End(), other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Links an object in front of the first object.
+     *
+     * @param value The object, which must not be in a list through this hook.
+     */
+    inline void PushFront(T& value) { LinkBefore(this->m_Root.p_Next, &value); }
+    /**
+     * @brief Links an object after the last object.
+     *
+     * @param value The object, which must not be in a list through this hook.
+     */
+    inline void PushBack(T& value) { LinkBefore(&this->m_Root, &value); }
+    /**
+     * @brief Links an object before a position.
+     *
+     * @param pos The position to insert before, End() appends.
+     * @param value The object, which must not be in a list through this hook.
+     * @return Iterator - The position of the object.
+     */
+    inline Iterator Insert(ConstIterator pos, T& value) {
+        LinkBefore(pos.p_Hook, &value);
+
+        return Iterator(static_cast<Hook*>(&value));
+    }
+
+    /**
+     * @brief Unlinks the first object.
+     *
+     * @return T& - The unlinked object.
+     */
+    inline T& PopFront() {
+        if (this->m_Size == 0)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to PopFront an empty IntrusiveList!");
+
+        Hook* hook = this->m_Root.p_Next;
+        Unlink(hook);
+
+        return *static_cast<T*>(hook);
+    }
+    /**
+     * @brief Unlinks the last object.
+     *
+     * @return T& - The unlinked object.
+     */
+    inline T& PopBack() {
+        if (this->m_Size == 0)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to PopBack an empty IntrusiveList!");
+
+        Hook* hook = this->m_Root.p_Prev;
+        Unlink(hook);
+
+        return *static_cast<T*>(hook);
+    }
+
+    /**
+     * @brief Unlinks an object, the object is left alive.
+     *
+     * @param value The object, which must be in this list.
+     */
+    inline void Erase(T& value) {
+        OASSERTM(static_cast<Hook&>(value).IsLinked(), "Attempt to Erase an object that is not in an IntrusiveList.");
+
+        Unlink(static_cast<Hook*>(&value));
+    }
+    /**
+     * @brief Unlinks the object at a position, the object is left alive.
+     *
+     * @param pos The position, which must not be End().
+     * @return Iterator - The position after the unlinked object.
+     */
+    inline Iterator Erase(ConstIterator pos) {
+        Hook* next = pos.p_Hook->p_Next;
+        Unlink(pos.p_Hook);
+
+        return Iterator(next);
+    }
+
+    /**
+     * @brief Unlinks every object, the objects are left alive.
+     */
+    void Clear() {
+        Hook* hook = this->m_Root.p_Next;
+
+        while (hook != &this->m_Root) {
+            Hook* next = hook->p_Next;
+
+            hook->p_Prev = nullptr;
+            hook->p_Next = nullptr;
+            hook = next;
+        }
+
+        Reset();
+    }
+
+    /**
+     * @brief Moves every object of another list before a position in this list. O(1).
+     *
+     * @param pos The position to insert before.
+     * @param other The list to take the objects of, which is left empty.
+     */
+    void Splice(ConstIterator pos, IntrusiveList& other) {
+        if (&other == this || other.m_Size == 0)
+            return;
+
+        Hook* first = other.m_Root.p_Next;
+        Hook* last = other.m_Root.p_Prev;
+        Hook* next = pos.p_Hook;
+
+        first->p_Prev = next->p_Prev;
+        next->p_Prev->p_Next = first;
+        last->p_Next = next;
+        next->p_Prev = last;
+
+        this->m_Size += other.m_Size;
+        other.Reset();
+    }
+    /**
+     * @brief Moves one object of another list, or of this list, before a position in this list. O(1).
+     *
+     * @param pos The position to insert before.
+     * @param other The list holding the object.
+     * @param value The object to move.
+     */
+    void Splice(ConstIterator pos, IntrusiveList& other, T& value) {
+        Hook* hook = static_cast<Hook*>(&value);
+
+        if (hook == pos.p_Hook || hook->p_Next == pos.p_Hook)
+            return;
+
+        other.Unlink(hook);
+        LinkBefore(pos.p_Hook, &value);
+    }
+
+    /**
+     * @brief Gets the position of an object in the list. O(1).
+     *
+     * @param value The object, which must be in this list.
+     * @return Iterator
+     */
+    inline Iterator IteratorTo(T& value) { return Iterator(static_cast<Hook*>(&value)); }
+    /**
+     * @brief Gets the position of an object in the list. O(1).
+     *
+     * @param value The object, which must be in this list.
+     * @return ConstIterator
+     */
+    inline ConstIterator IteratorTo(const T& value) const {
+        return ConstIterator(const_cast<Hook*>(static_cast<const Hook*>(&value)));
+    }
+
+    /**
+     * @brief Gets the first object in the list.
+     *
+     * @return T&
+     */
+    inline T& Front() { return *static_cast<T*>(this->m_Root.p_Next); }
+    /**
+     * @brief Gets the first object in the list.
+     *
+     * @return const T&
+     */
+    inline const T& Front() const { return *static_cast<const T*>(this->m_Root.p_Next); }
+    /**
+     * @brief Gets the last object in the list.
+     *
+     * @return T&
+     */
+    inline T& Back() { return *static_cast<T*>(this->m_Root.p_Prev); }
+    /**
+     * @brief Gets the last object in the list.
+     *
+     * @return const T&
+     */
+    inline const T& Back() const { return *static_cast<const T*>(this->m_Root.p_Prev); }
+
+    /**
+     * @brief Gets a Iterator to the first object of the list.
+     *
+     * @return Iterator
+     */
+    inline Iterator Begin() { return Iterator(this->m_Root.p_Next); }
+    inline Iterator begin() { return Begin(); }
+    /**
+     * @brief Gets a ConstIterator to the first object of the list.
+     *
+     * @return ConstIterator
+     */
+    inline ConstIterator Begin() const { return ConstIterator(this->m_Root.p_Next); }
+    inline ConstIterator begin() const { return Begin(); }
+    /**
+     * @brief Gets a Iterator past the last object of the list.
+     *
+     * @return Iterator
+     */
+    inline Iterator End() { return Iterator(&this->m_Root); }
+    inline Iterator end() { return End(); }
+    /**
+     * @brief Gets a ConstIterator past the last object of the list.
+     *
+     * @return ConstIterator
+     */
+    inline ConstIterator End() const { return ConstIterator(const_cast<Hook*>(&this->m_Root)); }
+    inline ConstIterator end() const { return End(); }
+
+    /**
+     * @return b8 - True if the list is empty, False otherwise.
+     */
+    inline b8 Empty() const { return this->m_Size == 0; }
+    /**
+     * @return sizet - The number of objects in the list.
+     */
+    inline sizet Size() const { return this->m_Size; }
+
+private:
+    /**
+     * @brief Makes the list empty by pointing the sentinel at itself.
+     */
+    inline void Reset() {
+        this->m_Root.p_Prev = &this->m_Root;
+        this->m_Root.p_Next = &this->m_Root;
+        this->m_Size = 0;
+    }
+
+    /**
+     * @brief Links an object before a hook of the list.
+     *
+     * @param next The hook to link before.
+     * @param value The object.
+     */
+    inline void LinkBefore(Hook* next, T* value) {
+        Hook* hook = static_cast<Hook*>(value);
+
+        OASSERTM(!hook->IsLinked(), "Attempt to insert an object that is already in an IntrusiveList.");
+
+        hook->p_Prev = next->p_Prev;
+        hook->p_Next = next;
+        next->p_Prev->p_Next = hook;
+        next->p_Prev = hook;
+
+        this->m_Size++;
+    }
+    /**
+     * @brief Unlinks a hook of the list and marks it unlinked.
+     *
+     * @param hook The hook.
+     */
+    inline void Unlink(Hook* hook) {
+        hook->p_Prev->p_Next = hook->p_Next;
+        hook->p_Next->p_Prev = hook->p_Prev;
+        hook->p_Prev = nullptr;
+        hook->p_Next = nullptr;
+
+        this->m_Size--;
+    }
+
+private:
+    /** @brief The sentinel hook, before the first object and after the last. */
+    Hook m_Root;
+    /** @brief The number of objects in the list. */
+    sizet m_Size;
+
+};  // IntrusiveList
@@ -32,6 +32,18 @@
 
 #endif
 
+#ifdef _MSC_VER
+
+    /** @brief Lets a class lay out every empty base at offset zero. MSVC otherwise only does so for the first one. */
+    #define OC_EMPTY_BASES                           __declspec(empty_bases)
+
+#else
+
+    /** @brief Lets a class lay out every empty base at offset zero, which other compilers already do. */
+    #define OC_EMPTY_BASES
+
+#endif
+
 /** @brief Marks a function as an inline constexpr (const expression). */
 #define OC_INLINE_EXPR                           inline constexpr
 
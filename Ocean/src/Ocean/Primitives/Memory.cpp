@@ -1,15 +1,25 @@
 #include "Memory.hpp"
 
 #include "Ocean/Primitives/Assert.hpp"
+#include "Ocean/Primitives/Numerics.hpp"
 
 // libs
 #include <tlsf.h>
 
 // std
 #include <stdlib.h>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
+#ifdef OC_PLATFORM_WINDOWS
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <unistd.h>
+#endif
+
 // Memory Methods
 
 // The following offset and adjustment implementations are adapted from:
@@ -33,6 +43,75 @@ uintptr_t oAlignmentAdjustment(sizet alignOf, const void* const ptr) {
 	return alignOf - offset;
 }
 
+void* oAlignedAlloc(sizet size, sizet alignment) {
+#ifdef OC_PLATFORM_WINDOWS
+	return _aligned_malloc(size, alignment);
+#else
+	if (alignment <= alignof(max_align_t))
+		return malloc(size);
+
+	// posix_memalign, unlike aligned_alloc, takes any size.
+	//
+	void* memory = nullptr;
+	if (posix_memalign(&memory, alignment, size) != 0)
+		return nullptr;
+
+	return memory;
+#endif
+}
+
+void* oAlignedRealloc(void* ptr, OC_UNUSED sizet oldSize, sizet newSize, sizet alignment) {
+#ifdef OC_PLATFORM_WINDOWS
+	return _aligned_realloc(ptr, newSize, alignment);
+#else
+	if (alignment <= alignof(max_align_t))
+		return realloc(ptr, newSize);
+
+	// realloc only keeps the alignment of malloc, over aligned memory is moved by hand.
+	//
+	void* memory = oAlignedAlloc(newSize, alignment);
+	if (!memory)
+		return nullptr;
+
+	if (ptr) {
+		memcpy(memory, ptr, oldSize < newSize ? oldSize : newSize);
+		free(ptr);
+	}
+
+	return memory;
+#endif
+}
+
+void oAlignedFree(void* ptr) {
+#ifdef OC_PLATFORM_WINDOWS
+	_aligned_free(ptr);
+#else
+	free(ptr);
+#endif
+}
+
+// Allocator
+
+void* Allocator::Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) {
+	if (!ptr)
+		return Allocate(newSize, alignment);
+
+	if (newSize == 0) {
+		Deallocate(ptr);
+
+		return nullptr;
+	}
+
+	void* block = Allocate(newSize, alignment);
+	if (!block)
+		return nullptr;
+
+	memcpy(block, ptr, oldSize < newSize ? oldSize : newSize);
+	Deallocate(ptr);
+
+	return block;
+}
+
 // Walker Methods
 
 #ifdef OC_DETAILED_ALLOCATIONS
@@ -44,74 +123,738 @@ uintptr_t oAlignmentAdjustment(sizet alignOf, const void* const ptr) {
 
 #endif
 
-// Heap Allocator
+// OS Memory
+
+/**
+ * @brief Gets the page size of the OS.
+ * 
+ * @return sizet 
+ */
+static sizet oPageSize() {
+	static const sizet s_PageSize = []() -> sizet {
+	#ifdef OC_PLATFORM_WINDOWS
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+
+		return info.dwPageSize;
+	#else
+		return static_cast<sizet>(sysconf(_SC_PAGESIZE));
+	#endif
+	}();
+
+	return s_PageSize;
+}
 
-#ifdef OC_DETAILED_ALLOCATIONS
+/**
+ * @brief Maps zeroed memory from the OS. Pages are only backed by physical memory once they are touched.
+ * 
+ * @param size The size in bytes to map, a multiple of the page size.
+ * @return void* - The mapping or nullptr on failure.
+ */
+static void* oMapMemory(sizet size) {
+#ifdef OC_PLATFORM_WINDOWS
+	return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+	void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
 
-	static MemoryStats s_Stats{ 0, 0, 0, 0 };
+	return memory == MAP_FAILED ? nullptr : memory;
+#endif
+}
 
+/**
+ * @brief Returns a mapping to the OS.
+ * 
+ * @param memory The mapping returned by oMapMemory().
+ * @param size The size of the mapping.
+ */
+static void oUnmapMemory(void* memory, OC_UNUSED sizet size) {
+#ifdef OC_PLATFORM_WINDOWS
+	VirtualFree(memory, 0, MEM_RELEASE);
+#else
+	munmap(memory, size);
 #endif
+}
+
+// Heap Thread Cache
+
+/** @brief The size classes served by the heap thread caches. */
+OC_STATIC constexpr sizet k_SizeClasses[] = { 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024 };
+/** @brief The number of heap size classes. */
+OC_STATIC constexpr u8 k_SizeClassCount = ArraySize(k_SizeClasses);
+
+static_assert(k_SizeClasses[k_SizeClassCount - 1] == HeapAllocator::k_MaxCachedSize, "The largest size class must match HeapAllocator::k_MaxCachedSize.");
+
+/** @brief The number of blocks a magazine can hold. */
+OC_STATIC constexpr u32 k_MagazineSize = 64;
+/** @brief The number of blocks moved between a magazine and the heap at once. */
+OC_STATIC constexpr u32 k_MagazineBatch = k_MagazineSize / 2;
+/** @brief The maximum number of heaps that can have thread caches at the same time. */
+OC_STATIC constexpr u8 k_MaxCachedHeaps = 4;
+
+/** @brief The generation of each thread cache slot, 0 if the slot is unused. */
+static std::atomic<u32> s_CacheGenerations[k_MaxCachedHeaps] = { };
+/** @brief The next generation to hand out to a heap. */
+static std::atomic<u32> s_NextCacheGeneration{ 1 };
+
+struct HeapThreadCache;
+
+/** @brief Guards the list of thread caches and the slot generations while caches are drained. */
+static std::mutex s_CacheRegistryLock;
+/** @brief The thread caches of every live thread that has used a cached heap. */
+static HeapThreadCache* s_CacheRegistry = nullptr;
+
+/**
+ * @brief A lookup table from a size in 16 byte granules to a size class.
+ */
+struct SizeClassTable {
+	u8 ceil[HeapAllocator::k_MaxCachedSize / 16 + 1]; /** @brief The smallest size class that fits the granule count. */
+
+	constexpr SizeClassTable() : ceil() {
+		u8 sizeClass = 0;
+		for (sizet i = 0; i < ArraySize(this->ceil); i++) {
+			while (k_SizeClasses[sizeClass] < i * 16)
+				sizeClass++;
+
+			this->ceil[i] = sizeClass;
+		}
+	}
+
+};	// SizeClassTable
+
+OC_STATIC constexpr SizeClassTable k_SizeClassTable{ };
+
+/**
+ * @brief Gets the smallest size class that fits the given size.
+ * 
+ * @param size The requested size in bytes, at most HeapAllocator::k_MaxCachedSize.
+ * @return u8 
+ */
+OC_STATIC_INLINE u8 oSizeClassCeil(sizet size) {
+	return k_SizeClassTable.ceil[(size + 15) / 16];
+}
+
+/**
+ * @brief A stack of free blocks of a single size class.
+ */
+struct HeapMagazine {
+	u32 count; /** @brief The number of blocks in the magazine. */
+	void* blocks[k_MagazineSize]; /** @brief The cached blocks. */
+
+};	// HeapMagazine
+
+/**
+ * @brief The per-thread cache of every cached heap. Drains back to the heaps when the thread exits.
+ */
+struct HeapThreadCache {
+	/**
+	 * @brief The magazines of one heap.
+	 */
+	struct Entry {
+		HeapAllocator* heap; /** @brief The heap the blocks belong to. */
+		u32 generation; /** @brief The generation of the heap's slot when the entry was filled. */
+
+		HeapMagazine magazines[k_SizeClassCount]; /** @brief A magazine per size class. */
+
+	};	// Entry
+
+	HeapThreadCache() : entries(), prev(nullptr), next(nullptr) {
+		std::lock_guard<std::mutex> lock(s_CacheRegistryLock);
+
+		this->next = s_CacheRegistry;
+		if (this->next)
+			this->next->prev = this;
+
+		s_CacheRegistry = this;
+	}
+	~HeapThreadCache() {
+		// The registry lock keeps a heap from shutting down between the generation check and the drain.
+		//
+		std::lock_guard<std::mutex> lock(s_CacheRegistryLock);
+
+		if (this->prev)
+			this->prev->next = this->next;
+		else
+			s_CacheRegistry = this->next;
+
+		if (this->next)
+			this->next->prev = this->prev;
+
+		for (u8 i = 0; i < k_MaxCachedHeaps; i++)
+			if (this->entries[i].generation != 0 && s_CacheGenerations[i].load(std::memory_order_acquire) == this->entries[i].generation)
+				Drain(this->entries[i]);
+	}
+
+	OC_NO_COPY(HeapThreadCache);
+
+	/**
+	 * @brief Gets the calling thread's entry for the given heap, resetting it if it is stale.
+	 * 
+	 * @param heap The heap to get the entry of.
+	 * @return Entry& 
+	 */
+	Entry& Get(HeapAllocator* heap) {
+		Entry& entry = this->entries[heap->m_CacheSlot];
+
+		// A stale entry belongs to a heap that has been shut down, its blocks are gone with it.
+		//
+		if (entry.generation != heap->m_CacheGeneration) {
+			entry.heap = heap;
+			entry.generation = heap->m_CacheGeneration;
+
+			for (HeapMagazine& magazine : entry.magazines)
+				magazine.count = 0;
+		}
+
+		return entry;
+	}
+
+	/**
+	 * @brief Returns all of the blocks in the entry to its heap.
+	 * 
+	 * @param entry The entry to drain.
+	 */
+	static void Drain(Entry& entry) {
+		for (HeapMagazine& magazine : entry.magazines) {
+			entry.heap->DeallocateBatch(magazine.blocks, magazine.count);
+			magazine.count = 0;
+		}
+	}
+
+	/**
+	 * @brief Returns the blocks every thread has cached for the heap and retires the heap's slot.
+	 * 
+	 * @param heap The heap being shut down, no thread may use it anymore.
+	 */
+	static void Retire(HeapAllocator* heap) {
+		std::lock_guard<std::mutex> lock(s_CacheRegistryLock);
+
+		for (HeapThreadCache* cache = s_CacheRegistry; cache; cache = cache->next) {
+			Entry& entry = cache->entries[heap->m_CacheSlot];
+
+			if (entry.generation == heap->m_CacheGeneration)
+				Drain(entry);
+		}
+
+		s_CacheGenerations[heap->m_CacheSlot].store(0, std::memory_order_release);
+	}
+
+	Entry entries[k_MaxCachedHeaps]; /** @brief An entry per cache slot. */
+
+	HeapThreadCache* prev; /** @brief The previous cache in the registry. */
+	HeapThreadCache* next; /** @brief The next cache in the registry. */
+
+};	// HeapThreadCache
+
+static thread_local HeapThreadCache t_HeapCache;
+
+// Heap Allocator
+
+/** @brief The alignment TLSF guarantees for every block, tlsf_realloc only keeps larger alignments when it grows in place. */
+OC_STATIC constexpr sizet k_TlsfAlignment = sizeof(void*);
+
+/** @brief Extra space requested for a grown pool to fit the TLSF block headers and alignment gaps. */
+OC_STATIC constexpr sizet k_PoolSlack = 256;
+
+/** @brief The size class of a block that is freed to TLSF instead of a magazine. */
+OC_STATIC constexpr u32 k_UncachedBlock = 0xfffffffe;
+/** @brief The size class of a direct mapping. */
+OC_STATIC constexpr u32 k_DirectBlock = 0xffffffff;
+
+/**
+ * @brief The tag stored directly in front of every block the heap hands out.
+ * 
+ * @details The tag is part of the allocation. It is written before the block is handed out and only rewritten by
+ * the owner of the block, so Deallocate reads it without the lock. The TLSF size word in front of a block can't be
+ * read that way, TLSF rewrites its flag bits under the lock whenever a physical neighbour is allocated or freed.
+ */
+struct HeapBlockTag {
+	sizet size; /** @brief The usable size of the block. */
+	u32 offset; /** @brief The distance from the start of the TLSF block or mapping to the usable memory. */
+	u32 sizeClass; /** @brief The magazine the block returns to, or k_UncachedBlock or k_DirectBlock. */
+
+};	// HeapBlockTag
+
+static_assert(sizeof(HeapBlockTag) == HeapAllocator::k_CacheAlignment, "A tag in front of a cached block must keep it aligned.");
+
+/**
+ * @brief The header stored directly in front of a direct mapping, ending with the tag every block has.
+ */
+struct HeapDirectHeader {
+	sizet mappedSize; /** @brief The size of the whole mapping including the header page. */
+	HeapBlockTag tag; /** @brief The tag of the mapping. */
+
+};	// HeapDirectHeader
+
+/**
+ * @brief Gets the tag of a block handed out by a heap.
+ * 
+ * @param ptr The pointer to the block.
+ * @return HeapBlockTag* 
+ */
+OC_STATIC_INLINE HeapBlockTag* oBlockTag(const void* ptr) {
+	return reinterpret_cast<HeapBlockTag*>(const_cast<void*>(ptr)) - 1;
+}
 
 HeapAllocator::~HeapAllocator() { }
 
-void HeapAllocator::Init(sizet size) {
-	this->p_Memory = malloc(size);
-	this->m_TotalSize = size;
+void HeapAllocator::Init(sizet size, b8 threadCaching, sizet growSize, sizet directMapThreshold) {
+	this->p_Control = malloc(tlsf_size());
+	this->p_Handle = tlsf_create(this->p_Control);
+
+	this->p_Pools = nullptr;
+	this->p_SparePool = nullptr;
+	this->m_PoolCount = 0;
+
+	this->m_GrowSize = growSize ? growSize : size;
+	this->m_DirectMapThreshold = directMapThreshold;
+
+	this->m_TotalSize = 0;
 	this->m_AllocatedSize = 0;
 
-	this->p_Handle = tlsf_create_with_pool(this->p_Memory, size);
+	const Pool* initialPool = AddPool(size);
+	OASSERTM(initialPool, "Heap Allocator: Failed to map the initial pool!");
+
+	this->m_CacheSlot = -1;
+	if (!threadCaching)
+		return;
+
+	const u32 generation = s_NextCacheGeneration.fetch_add(1, std::memory_order_relaxed);
+
+	for (u8 i = 0; i < k_MaxCachedHeaps; i++) {
+		u32 expected = 0;
+
+		if (s_CacheGenerations[i].compare_exchange_strong(expected, generation, std::memory_order_acq_rel)) {
+			this->m_CacheSlot = i;
+			this->m_CacheGeneration = generation;
+
+			return;
+		}
+	}
+
+	// Every slot is taken, the heap works without thread caches.
+	//
+	oprint(CONSOLE_TEXT_YELLOW("Heap Allocator: No thread cache slots left, falling back to locked allocations.\n"));
 }
 
 void HeapAllocator::Shutdown() {
+	// The blocks cached by every thread go back before the leak check, and before the pools they point into are unmapped.
+	//
+	if (this->m_CacheSlot >= 0) {
+		HeapThreadCache::Retire(this);
+
+		this->m_CacheSlot = -1;
+	}
+
 #ifdef OC_DETAILED_ALLOCATIONS
-	if (s_Stats.allocatedBytes != s_Stats.freedBytes)
+	if (this->m_AllocatedSize != 0) {
 		oprint(CONSOLE_TEXT_RED("Allocations still present. Check your code!\n"));
 
-	void* pool = tlsf_get_pool(this->p_Handle);
-	tlsf_walk_pool(pool, ExitWalker, static_cast<void*>(&s_Stats));
+		for (Pool* pool = this->p_Pools; pool; pool = pool->next)
+			tlsf_walk_pool(pool->begin, ExitWalker, nullptr);
+	}
 
 	oprint(CONSOLE_TEXT_CYAN("Memory Heap Stats:\n"));
-	oprint(CONSOLE_TEXT_CYAN("\tAllocated Bytes: %i\n"), s_Stats.allocatedBytes);
-	oprint(CONSOLE_TEXT_CYAN("\tFreed Bytes: %i\n"), s_Stats.freedBytes);
-	oprint(CONSOLE_TEXT_CYAN("\tTotal Allocations: %i\n"), s_Stats.allocationCount);
-	oprint(CONSOLE_TEXT_CYAN("\tTotal Free's: %i\n"), s_Stats.freeCount);
+	oprint(CONSOLE_TEXT_CYAN("\tAllocated Bytes: %llu\n"), this->m_AllocatedSize);
+	oprint(CONSOLE_TEXT_CYAN("\tTotal Size: %llu\n"), this->m_TotalSize);
+	oprint(CONSOLE_TEXT_CYAN("\tPools: %u\n"), this->m_PoolCount);
 
 #endif
 
 	tlsf_destroy(this->p_Handle);
+	free(this->p_Control);
 
-	free(this->p_Memory);
-	this->p_Memory = this->p_Handle = nullptr;
+	while (this->p_Pools) {
+		Pool* pool = this->p_Pools;
+		this->p_Pools = pool->next;
+
+		oUnmapMemory(pool, pool->mappedSize);
+	}
+
+	this->p_Control = this->p_Handle = nullptr;
+	this->p_SparePool = nullptr;
+	this->m_PoolCount = 0;
 	this->m_TotalSize = this->m_AllocatedSize = 0;
 }
 
-void* HeapAllocator::Allocate(sizet size, OC_UNUSED sizet alignment) {
-#ifdef OC_DETAILED_ALLOCATIONS
+void* HeapAllocator::Allocate(sizet size, sizet alignment) {
+	return AllocateTagged(size, alignment, this->m_Tag);
+}
 
-	void* allocatedMemory = alignment == 1 ? tlsf_malloc(this->p_Handle, size) : tlsf_memalign(this->p_Handle, alignment, size);
-	this->m_AllocatedSize += s_Stats.Add(tlsf_block_size(allocatedMemory));
+void HeapAllocator::Deallocate(void* ptr) {
+	DeallocateTagged(ptr, this->m_Tag);
+}
 
-	return allocatedMemory;
+void* HeapAllocator::Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) {
+	return ReallocateTagged(ptr, oldSize, newSize, alignment, this->m_Tag);
+}
 
-#else
+void* HeapAllocator::AllocateTagged(sizet size, sizet alignment, OC_UNUSED MemoryTag tag) {
+	void* block = nullptr;
+
+	if (size >= this->m_DirectMapThreshold && alignment <= oPageSize()) {
+		block = AllocateDirect(size);
+	}
+	else if (this->m_CacheSlot < 0 || size > k_MaxCachedSize || alignment > k_CacheAlignment) {
+		block = AllocateBlock(size, alignment);
+	}
+	else {
+		const u8 sizeClass = oSizeClassCeil(size);
+		HeapMagazine& magazine = t_HeapCache.Get(this).magazines[sizeClass];
 
-	return tlsf_malloc(this->p_Handle, size);
+		if (magazine.count == 0)
+			magazine.count = AllocateBatch(magazine.blocks, k_MagazineBatch, sizeClass);
 
-#endif
+		if (magazine.count > 0)
+			block = magazine.blocks[--magazine.count];
+	}
+
+	// The block size is profiled so that Deallocate, which only knows the block, records the same amount.
+	//
+	if (block)
+		OC_PROFILE_ALLOCATE(tag, oBlockTag(block)->size);
+
+	return block;
 }
 
-void HeapAllocator::Deallocate(void* ptr) {
-#ifdef OC_DETAILED_ALLOCATIONS
+void HeapAllocator::DeallocateTagged(void* ptr, OC_UNUSED MemoryTag tag) {
+	if (!ptr)
+		return;
 
-	this->m_AllocatedSize -= s_Stats.Remove(tlsf_block_size(ptr));
+	// Only blocks handed out by the magazines carry a size class, see HeapBlockTag. Everything else, including the
+	// blocks of a heap without thread caches, goes back under the lock.
+	//
+	const HeapBlockTag* blockTag = oBlockTag(ptr);
 
-	tlsf_free(this->p_Handle, ptr);
+	OC_PROFILE_DEALLOCATE(tag, blockTag->size);
 
-#else
+	if (blockTag->sizeClass >= k_SizeClassCount) {
+		DeallocateBlock(ptr);
+
+		return;
+	}
 
-	tlsf_free(this->p_Handle, ptr);
+	HeapMagazine& magazine = t_HeapCache.Get(this).magazines[blockTag->sizeClass];
 
-#endif
+	if (magazine.count == k_MagazineSize) {
+		magazine.count -= k_MagazineBatch;
+
+		DeallocateBatch(magazine.blocks + magazine.count, k_MagazineBatch);
+	}
+
+	magazine.blocks[magazine.count++] = ptr;
+}
+
+void* HeapAllocator::ReallocateTagged(void* ptr, sizet oldSize, sizet newSize, sizet alignment, MemoryTag tag) {
+	if (!ptr)
+		return AllocateTagged(newSize, alignment, tag);
+
+	if (newSize == 0) {
+		DeallocateTagged(ptr, tag);
+
+		return nullptr;
+	}
+
+	// The block is often larger than requested, growing into that slack or shrinking keeps the block as is.
+	//
+	const sizet blockSize = oBlockTag(ptr)->size;
+	if (newSize <= blockSize)
+		return ptr;
+
+	void* block = nullptr;
+
+	if (newSize < this->m_DirectMapThreshold && alignment <= k_TlsfAlignment && oBlockTag(ptr)->sizeClass != k_DirectBlock) {
+		std::lock_guard<std::mutex> lock(this->m_Lock);
+
+		block = ReallocateLocked(ptr, newSize);
+	}
+
+	if (block) {
+		OC_PROFILE_DEALLOCATE(tag, blockSize);
+		OC_PROFILE_ALLOCATE(tag, oBlockTag(block)->size);
+
+		return block;
+	}
+
+	// Direct mappings, over aligned blocks and failed resizes are moved by hand.
+	//
+	block = AllocateTagged(newSize, alignment, tag);
+	if (!block)
+		return nullptr;
+
+	memcpy(block, ptr, oldSize < newSize ? oldSize : newSize);
+	DeallocateTagged(ptr, tag);
+
+	return block;
+}
+
+sizet HeapAllocator::BlockSize(const void* ptr) const {
+	return oBlockTag(ptr)->size;
+}
+
+void HeapAllocator::FlushThreadCache() {
+	if (this->m_CacheSlot < 0)
+		return;
+
+	HeapThreadCache::Drain(t_HeapCache.Get(this));
+}
+
+HeapAllocator::Pool* HeapAllocator::AddPool(sizet size) {
+	const sizet page = oPageSize();
+	const sizet headerSize = (sizeof(Pool) + k_CacheAlignment - 1) & ~(k_CacheAlignment - 1);
+	const sizet mappedSize = (headerSize + size + tlsf_pool_overhead() + page - 1) & ~(page - 1);
+
+	u8* memory = static_cast<u8*>(oMapMemory(mappedSize));
+	if (!memory)
+		return nullptr;
+
+	Pool* pool = reinterpret_cast<Pool*>(memory);
+	pool->begin = memory + headerSize;
+	pool->end = memory + mappedSize;
+	pool->mappedSize = mappedSize;
+	pool->usedSize = 0;
+
+	if (!tlsf_add_pool(this->p_Handle, pool->begin, mappedSize - headerSize)) {
+		oUnmapMemory(memory, mappedSize);
+
+		return nullptr;
+	}
+
+	// The initial pool stays at the front since it serves most of the allocations.
+	//
+	if (this->p_Pools) {
+		pool->next = this->p_Pools->next;
+		this->p_Pools->next = pool;
+	}
+	else {
+		pool->next = nullptr;
+		this->p_Pools = pool;
+	}
+
+	this->m_PoolCount++;
+	this->m_TotalSize += mappedSize;
+
+	return pool;
+}
+
+void HeapAllocator::ReleasePool(Pool* pool) {
+	tlsf_remove_pool(this->p_Handle, pool->begin);
+
+	Pool* previous = this->p_Pools;
+	while (previous->next != pool)
+		previous = previous->next;
+
+	previous->next = pool->next;
+
+	this->m_PoolCount--;
+	this->m_TotalSize -= pool->mappedSize;
+
+	oUnmapMemory(pool, pool->mappedSize);
+}
+
+void HeapAllocator::ClaimPool(Pool* pool, sizet size) {
+	pool->usedSize += size;
+
+	if (pool == this->p_SparePool)
+		this->p_SparePool = nullptr;
+}
+
+void HeapAllocator::VacatePool(Pool* pool, sizet size) {
+	pool->usedSize -= size;
+
+	if (pool->usedSize != 0 || pool == this->p_Pools)
+		return;
+
+	// An empty pool is a single free block again. The first grown pool to empty is kept as a spare, so a workload
+	// that allocates and frees around a pool boundary does not map and unmap a pool on every cycle.
+	//
+	if (!this->p_SparePool)
+		this->p_SparePool = pool;
+	else if (pool != this->p_SparePool)
+		ReleasePool(pool);
+}
+
+HeapAllocator::Pool* HeapAllocator::FindPool(const void* ptr) const {
+	const u8* address = static_cast<const u8*>(ptr);
+
+	for (Pool* pool = this->p_Pools; pool; pool = pool->next)
+		if (address >= pool->begin && address < pool->end)
+			return pool;
+
+	return nullptr;
+}
+
+void* HeapAllocator::AllocateLocked(sizet size, sizet alignment) {
+	// The tag takes the 16 bytes in front of the usable memory, larger alignments move it by a whole alignment.
+	//
+	const sizet offset = alignment > sizeof(HeapBlockTag) ? alignment : sizeof(HeapBlockTag);
+	const sizet tlsfSize = size + offset;
+
+	void* block = alignment <= k_TlsfAlignment ? tlsf_malloc(this->p_Handle, tlsfSize) : tlsf_memalign(this->p_Handle, alignment, tlsfSize);
+
+	if (!block) {
+		const sizet required = tlsfSize + alignment + k_PoolSlack;
+		if (!AddPool(required > this->m_GrowSize ? required : this->m_GrowSize))
+			return nullptr;
+
+		block = alignment <= k_TlsfAlignment ? tlsf_malloc(this->p_Handle, tlsfSize) : tlsf_memalign(this->p_Handle, alignment, tlsfSize);
+		if (!block)
+			return nullptr;
+	}
+
+	const sizet blockSize = tlsf_block_size(block);
+
+	ClaimPool(FindPool(block), blockSize);
+	this->m_AllocatedSize += blockSize;
+
+	u8* ptr = static_cast<u8*>(block) + offset;
+
+	HeapBlockTag* blockTag = oBlockTag(ptr);
+	blockTag->size = blockSize - offset;
+	blockTag->offset = static_cast<u32>(offset);
+	blockTag->sizeClass = k_UncachedBlock;
+
+	return ptr;
+}
+
+void HeapAllocator::DeallocateLocked(void* ptr) {
+	void* block = static_cast<u8*>(ptr) - oBlockTag(ptr)->offset;
+
+	Pool* pool = FindPool(block);
+	const sizet blockSize = tlsf_block_size(block);
+
+	this->m_AllocatedSize -= blockSize;
+
+	tlsf_free(this->p_Handle, block);
+
+	VacatePool(pool, blockSize);
+}
+
+void* HeapAllocator::ReallocateLocked(void* ptr, sizet size) {
+	const sizet offset = oBlockTag(ptr)->offset;
+	const sizet tlsfSize = size + offset;
+
+	void* oldBlock = static_cast<u8*>(ptr) - offset;
+
+	Pool* pool = FindPool(oldBlock);
+	const sizet blockSize = tlsf_block_size(oldBlock);
+
+	// tlsf_realloc leaves the block untouched when it can't find a new one, so the heap can grow and retry.
+	// It copies the tag along with the contents when the block moves.
+	//
+	void* block = tlsf_realloc(this->p_Handle, oldBlock, tlsfSize);
+	if (!block) {
+		if (!AddPool(tlsfSize + k_PoolSlack > this->m_GrowSize ? tlsfSize + k_PoolSlack : this->m_GrowSize))
+			return nullptr;
+
+		block = tlsf_realloc(this->p_Handle, oldBlock, tlsfSize);
+		if (!block)
+			return nullptr;
+	}
+
+	const sizet newBlockSize = tlsf_block_size(block);
+
+	// The new block is claimed first, a block resized in place must not leave its pool empty for a moment.
+	//
+	ClaimPool(FindPool(block), newBlockSize);
+	VacatePool(pool, blockSize);
+	this->m_AllocatedSize += newBlockSize - blockSize;
+
+	// A resized block no longer matches its size class and may have lost the cache alignment, so it leaves the
+	// magazines.
+	//
+	u8* newPtr = static_cast<u8*>(block) + offset;
+
+	HeapBlockTag* blockTag = oBlockTag(newPtr);
+	blockTag->size = newBlockSize - offset;
+	blockTag->sizeClass = k_UncachedBlock;
+
+	return newPtr;
+}
+
+void* HeapAllocator::AllocateDirect(sizet size) {
+	const sizet page = oPageSize();
+	const sizet mappedSize = ((size + page - 1) & ~(page - 1)) + page;
+
+	u8* memory = static_cast<u8*>(oMapMemory(mappedSize));
+	if (!memory)
+		return nullptr;
+
+	// The header lives at the end of the first page so the allocation itself stays page aligned.
+	//
+	u8* ptr = memory + page;
+	HeapDirectHeader* header = reinterpret_cast<HeapDirectHeader*>(ptr) - 1;
+	header->mappedSize = mappedSize;
+	header->tag.size = mappedSize - page;
+	header->tag.offset = static_cast<u32>(page);
+	header->tag.sizeClass = k_DirectBlock;
+
+	std::lock_guard<std::mutex> lock(this->m_Lock);
+
+	this->m_TotalSize += mappedSize;
+	this->m_AllocatedSize += header->tag.size;
+
+	return ptr;
+}
+
+void HeapAllocator::DeallocateDirect(void* ptr) {
+	HeapDirectHeader* header = static_cast<HeapDirectHeader*>(ptr) - 1;
+	const sizet mappedSize = header->mappedSize;
+
+	{
+		std::lock_guard<std::mutex> lock(this->m_Lock);
+
+		this->m_TotalSize -= mappedSize;
+		this->m_AllocatedSize -= header->tag.size;
+	}
+
+	oUnmapMemory(static_cast<u8*>(ptr) - oPageSize(), mappedSize);
+}
+
+void* HeapAllocator::AllocateBlock(sizet size, sizet alignment) {
+	std::lock_guard<std::mutex> lock(this->m_Lock);
+
+	return AllocateLocked(size, alignment);
+}
+
+void HeapAllocator::DeallocateBlock(void* ptr) {
+	if (oBlockTag(ptr)->sizeClass == k_DirectBlock) {
+		DeallocateDirect(ptr);
+
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(this->m_Lock);
+
+	DeallocateLocked(ptr);
+}
+
+u32 HeapAllocator::AllocateBatch(void** blocks, u32 count, u8 sizeClass) {
+	std::lock_guard<std::mutex> lock(this->m_Lock);
+
+	u32 allocated = 0;
+	while (allocated < count) {
+		// Every cached block is allocated at k_CacheAlignment so it can serve any request of its class.
+		//
+		void* block = AllocateLocked(k_SizeClasses[sizeClass], k_CacheAlignment);
+		if (!block)
+			break;
+
+		oBlockTag(block)->sizeClass = sizeClass;
+
+		blocks[allocated++] = block;
+	}
+
+	return allocated;
+}
+
+void HeapAllocator::DeallocateBatch(void** blocks, u32 count) {
+	if (count == 0)
+		return;
+
+	std::lock_guard<std::mutex> lock(this->m_Lock);
+
+	for (u32 i = 0; i < count; i++)
+		DeallocateLocked(blocks[i]);
 }
 
 // Stack Allocator
@@ -120,24 +863,30 @@ void StackAllocator::Init(sizet size) {
 	this->p_Memory = static_cast<u8*>(malloc(size));
 	this->m_AllocatedSize = 0;
 	this->m_TotalSize = size;
+	this->m_ScopeDepth = 0;
 }
 
 void StackAllocator::Shutdown() {
+	OASSERTM(this->m_ScopeDepth == 0, "Stack Allocator: Shutdown with %u scoped arenas still open!", this->m_ScopeDepth);
+
 	free(this->p_Memory);
+	this->p_Memory = nullptr;
 }
 
 void* StackAllocator::Allocate(sizet size, sizet alignment) {
 	OASSERT(size > 0);
 
-	const sizet newStart = oAlignmentAdjustment(alignment, this->p_Memory + this->m_AllocatedSize);
-	OASSERT(newStart > this->m_TotalSize);
-
+	const sizet newStart = this->m_AllocatedSize + oAlignmentAdjustment(alignment, this->p_Memory + this->m_AllocatedSize);
 	const sizet newSize = newStart + size;
+
 	if (newSize > this->m_TotalSize) {
 		OASSERTM(false, "MEMORY OVERFLOW |: Stack Allocator");
 		return nullptr;
 	}
 
+	// Padding is included so that rewinding removes exactly what was added.
+	OC_PROFILE_ALLOCATE(this->m_Tag, newSize - this->m_AllocatedSize);
+
 	this->m_AllocatedSize = newSize;
 	return this->p_Memory + newStart;
 }
@@ -147,7 +896,45 @@ void StackAllocator::Deallocate(void* ptr) {
 	OASSERTM(ptr < this->p_Memory + this->m_TotalSize, "Out of bound free on Stack Allocator. Attempting to free %p, %llu after beginning of buffer (memory %p, size %llu, allocated %llu).", static_cast<u8*>(ptr), static_cast<u8*>(ptr) - p_Memory, p_Memory, m_TotalSize, m_AllocatedSize);
 	OASSERTM(ptr < this->p_Memory + this->m_AllocatedSize, "Out of allocated bound free on Stack Allocator. Attempting to free %p, %llu after beginning of buffer (memory %p, size %llu, allocated %llu).", static_cast<u8*>(ptr), static_cast<u8*>(ptr) - p_Memory, p_Memory, m_TotalSize, m_AllocatedSize);
 
-	this->m_AllocatedSize = static_cast<u8*>(ptr) - this->p_Memory;
+	const sizet marker = static_cast<u8*>(ptr) - this->p_Memory;
+	OC_PROFILE_DEALLOCATE(this->m_Tag, this->m_AllocatedSize - marker);
+
+	this->m_AllocatedSize = marker;
+}
+
+void* StackAllocator::Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) {
+	u8* memory = static_cast<u8*>(ptr);
+
+	if (!memory || newSize == 0)
+		return Allocator::Reallocate(ptr, oldSize, newSize, alignment);
+
+	// Anything below the top can only shrink by keeping its memory. Growing it copies to the top, the old block
+	// is not freed since that would pop the new one as well.
+	//
+	if (memory + oldSize != this->p_Memory + this->m_AllocatedSize) {
+		if (newSize <= oldSize)
+			return ptr;
+
+		void* block = Allocate(newSize, alignment);
+		if (block)
+			memcpy(block, ptr, oldSize);
+
+		return block;
+	}
+
+	const sizet newTop = (memory - this->p_Memory) + newSize;
+	if (newTop > this->m_TotalSize) {
+		OASSERTM(false, "MEMORY OVERFLOW |: Stack Allocator");
+		return nullptr;
+	}
+
+	if (newTop > this->m_AllocatedSize)
+		OC_PROFILE_ALLOCATE(this->m_Tag, newTop - this->m_AllocatedSize);
+	else
+		OC_PROFILE_RELEASE(this->m_Tag, this->m_AllocatedSize - newTop, 0);
+
+	this->m_AllocatedSize = newTop;
+	return ptr;
 }
 
 sizet StackAllocator::GetMarker() const {
@@ -155,11 +942,17 @@ sizet StackAllocator::GetMarker() const {
 }
 
 void StackAllocator::FreeMarker(sizet marker) {
-	if (marker - this->m_AllocatedSize > 0)
-		this->m_AllocatedSize = marker;
+	if (marker >= this->m_AllocatedSize)
+		return;
+
+	OC_PROFILE_RELEASE(this->m_Tag, this->m_AllocatedSize - marker, 0);
+
+	this->m_AllocatedSize = marker;
 }
 
 void StackAllocator::Clear() {
+	OC_PROFILE_RELEASE(this->m_Tag, this->m_AllocatedSize, 0);
+
 	memset(this->p_Memory, 0, this->m_TotalSize);
 	this->m_AllocatedSize = 0;
 }
@@ -170,35 +963,69 @@ void DoubleStackAllocator::Init(sizet size) {
 	this->p_Memory = static_cast<u8*>(malloc(size));
 	this->m_TotalSize = this->m_Top = size;
 	this->m_Bottom = 0;
+	this->m_TopScopeDepth = this->m_BottomScopeDepth = 0;
 }
 
 void DoubleStackAllocator::Shutdown() {
+	OASSERTM(this->m_TopScopeDepth == 0 && this->m_BottomScopeDepth == 0, "Double Stack Allocator: Shutdown with scoped arenas still open!");
+
 	free(this->p_Memory);
+	this->p_Memory = nullptr;
 }
 
-void* DoubleStackAllocator::Allocate(OC_UNUSED sizet size, OC_UNUSED sizet alignment) {
-	OASSERT(false);
-	return nullptr;
+void* DoubleStackAllocator::Allocate(sizet size, sizet alignment) {
+	return AllocateBottom(size, alignment);
 }
 
 void DoubleStackAllocator::Deallocate(OC_UNUSED void* ptr) {
-	OASSERT(false);
+	// Generic code frees in any order, so memory is only released by the explicit top / bottom methods.
+}
+
+void* DoubleStackAllocator::Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) {
+	u8* memory = static_cast<u8*>(ptr);
+
+	// Deallocate is a no-op, so the default implementation copies without freeing anything.
+	//
+	if (!memory || newSize == 0)
+		return Allocator::Reallocate(ptr, oldSize, newSize, alignment);
+
+	if (memory + oldSize != this->p_Memory + this->m_Bottom)
+		return newSize <= oldSize ? ptr : Allocator::Reallocate(ptr, oldSize, newSize, alignment);
+
+	const sizet newBottom = (memory - this->p_Memory) + newSize;
+	if (newBottom > this->m_Top) {
+		OASSERTM(false, "MEMORY OVERFLOW CROSSING |: Double Stack Allocator");
+		return nullptr;
+	}
+
+	if (newBottom > this->m_Bottom)
+		OC_PROFILE_ALLOCATE(this->m_Tag, newBottom - this->m_Bottom);
+	else
+		OC_PROFILE_RELEASE(this->m_Tag, this->m_Bottom - newBottom, 0);
+
+	this->m_Bottom = newBottom;
+	return ptr;
 }
 
 void* DoubleStackAllocator::AllocateTop(sizet size, sizet alignment) {
 	OASSERT(size > 0);
 
-	const sizet newStart = oAlignmentAdjustment(alignment, this->p_Memory + this->m_Top);
-	if (newStart <= this->m_Bottom) {
+	// The top grows downwards, so the start is aligned down from the current top.
+	//
+	if (size > this->m_Top - this->m_Bottom) {
 		OASSERTM(false, "MEMORY OVERFLOW CROSSING |: Double Stack Allocator");
 		return nullptr;
 	}
 
-#ifdef OC_DETAILED_ALLOCATIONS
+	const sizet unaligned = this->m_Top - size;
+	const sizet newStart = unaligned - oAlignmentOffset(alignment, this->p_Memory + unaligned);
 
-	s_Stats.Add(size);
+	if (newStart < this->m_Bottom || newStart > unaligned) {
+		OASSERTM(false, "MEMORY OVERFLOW CROSSING |: Double Stack Allocator");
+		return nullptr;
+	}
 
-#endif
+	OC_PROFILE_ALLOCATE(this->m_Tag, this->m_Top - newStart);
 
 	this->m_Top = newStart;
 	return this->p_Memory + newStart;
@@ -207,19 +1034,15 @@ void* DoubleStackAllocator::AllocateTop(sizet size, sizet alignment) {
 void* DoubleStackAllocator::AllocateBottom(sizet size, sizet alignment) {
 	OASSERT(size > 0);
 
-	const sizet newStart = oAlignmentAdjustment(alignment, this->p_Memory + this->m_Bottom);
+	const sizet newStart = this->m_Bottom + oAlignmentAdjustment(alignment, this->p_Memory + this->m_Bottom);
 	const sizet newSize = newStart + size;
 
-	if (newSize >= m_Top) {
+	if (newSize > this->m_Top) {
 		OASSERTM(false, "MEMORY OVERFLOW CROSSING |: Double Stack Allocator");
 		return nullptr;
 	}
 
-#ifdef OC_DETAILED_ALLOCATIONS
-
-	s_Stats.Add(size);
-
-#endif
+	OC_PROFILE_ALLOCATE(this->m_Tag, newSize - this->m_Bottom);
 
 	this->m_Bottom = newSize;
 	return this->p_Memory + newStart;
@@ -227,28 +1050,20 @@ void* DoubleStackAllocator::AllocateBottom(sizet size, sizet alignment) {
 
 void DoubleStackAllocator::DeallocateTop(sizet size) {
 	if (size > this->m_TotalSize - this->m_Top)
-		this->m_Top = this->m_TotalSize;
-	else
-		this->m_Top += size;
-
-#ifdef OC_DETAILED_ALLOCATIONS
+		size = this->m_TotalSize - this->m_Top;
 
-	s_Stats.Remove(size);
+	OC_PROFILE_DEALLOCATE(this->m_Tag, size);
 
-#endif
+	this->m_Top += size;
 }
 
 void DoubleStackAllocator::DeallocateBottom(sizet size) {
 	if (size > this->m_Bottom)
-		this->m_Bottom = 0;
-	else
-		this->m_Bottom -= size;
-
-#ifdef OC_DETAILED_ALLOCATIONS
+		size = this->m_Bottom;
 
-	s_Stats.Remove(size);
+	OC_PROFILE_DEALLOCATE(this->m_Tag, size);
 
-#endif
+	this->m_Bottom -= size;
 }
 
 sizet DoubleStackAllocator::GetTopMarker() const {
@@ -260,21 +1075,112 @@ sizet DoubleStackAllocator::GetBottomMarker() const {
 }
 
 void DoubleStackAllocator::FreeTopMarker(sizet marker) {
-	if (marker > this->m_Top && marker < this->m_TotalSize)
-		this->m_Top = marker;
+	if (marker <= this->m_Top || marker > this->m_TotalSize)
+		return;
+
+	OC_PROFILE_RELEASE(this->m_Tag, marker - this->m_Top, 0);
+
+	this->m_Top = marker;
 }
 
 void DoubleStackAllocator::FreeBottomMarker(sizet marker) {
-	if (marker < this->m_Bottom)
-		this->m_Bottom = marker;
+	if (marker >= this->m_Bottom)
+		return;
+
+	OC_PROFILE_RELEASE(this->m_Tag, this->m_Bottom - marker, 0);
+
+	this->m_Bottom = marker;
 }
 
 void DoubleStackAllocator::ClearTop() {
-	this->m_Top = this->m_TotalSize;
+	FreeTopMarker(this->m_TotalSize);
 }
 
 void DoubleStackAllocator::ClearBottom() {
-	this->m_Bottom = 0;
+	FreeBottomMarker(0);
+}
+
+// Scoped Arena
+
+ScopedArena::ScopedArena(StackAllocator* stack) :
+	p_Stack(stack),
+	p_DoubleStack(nullptr),
+	m_Marker(stack->GetMarker()),
+	m_Depth(++stack->m_ScopeDepth),
+	m_Top(false)
+{
+	this->m_Tag = stack->Tag();
+}
+
+ScopedArena::ScopedArena(DoubleStackAllocator* stack, b8 top) :
+	p_Stack(nullptr),
+	p_DoubleStack(stack),
+	m_Marker(top ? stack->GetTopMarker() : stack->GetBottomMarker()),
+	m_Depth(top ? ++stack->m_TopScopeDepth : ++stack->m_BottomScopeDepth),
+	m_Top(top)
+{
+	this->m_Tag = stack->Tag();
+}
+
+ScopedArena::~ScopedArena() {
+	u32& depth = ScopeDepth();
+
+	OASSERTM(depth == this->m_Depth, "Scoped Arena: Arenas must be destroyed in reverse order of creation!");
+	depth--;
+
+	if (this->p_Stack)
+		this->p_Stack->FreeMarker(this->m_Marker);
+	else if (this->m_Top)
+		this->p_DoubleStack->FreeTopMarker(this->m_Marker);
+	else
+		this->p_DoubleStack->FreeBottomMarker(this->m_Marker);
+}
+
+void* ScopedArena::Allocate(sizet size, sizet alignment) {
+	OASSERTM(ScopeDepth() == this->m_Depth, "Scoped Arena: Only the innermost arena of a stack can allocate!");
+
+	if (this->p_Stack)
+		return this->p_Stack->Allocate(size, alignment);
+
+	return this->m_Top ? this->p_DoubleStack->AllocateTop(size, alignment) : this->p_DoubleStack->AllocateBottom(size, alignment);
+}
+
+void ScopedArena::Deallocate(OC_UNUSED void* ptr) {
+	// The memory is released when the arena is destroyed.
+}
+
+void* ScopedArena::Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) {
+	if (!ptr)
+		return Allocate(newSize, alignment);
+
+	if (newSize == 0)
+		return nullptr;
+
+	OASSERTM(ScopeDepth() == this->m_Depth, "Scoped Arena: Only the innermost arena of a stack can allocate!");
+
+	if (this->p_Stack)
+		return this->p_Stack->Reallocate(ptr, oldSize, newSize, alignment);
+
+	if (!this->m_Top)
+		return this->p_DoubleStack->Reallocate(ptr, oldSize, newSize, alignment);
+
+	// The top grows downwards, so its allocations can't grow in place.
+	//
+	if (newSize <= oldSize)
+		return ptr;
+
+	void* block = this->p_DoubleStack->AllocateTop(newSize, alignment);
+	if (block)
+		memcpy(block, ptr, oldSize);
+
+	return block;
+}
+
+u32& ScopedArena::ScopeDepth() const {
+	if (this->p_Stack)
+		return this->p_Stack->m_ScopeDepth;
+
+	return this->m_Top ? this->p_DoubleStack->m_TopScopeDepth : this->p_DoubleStack->m_BottomScopeDepth;
 }
 
 // Linear Allocator
@@ -289,72 +1195,267 @@ void LinearAllocator::Shutdown() {
 	free(this->p_Memory);
 }
 
-void* LinearAllocator::Allocate(sizet size, sizet alignment) {
-	OASSERT(size > 0);
+void LinearAllocator::Deallocate(OC_UNUSED void* ptr) {
+	// This allocator does not allocate on a per-pointer base, memory is released by Clear.
+}
 
-	const sizet newStart = oAlignmentAdjustment(alignment, this->p_Memory + this->m_AllocatedSize);
+void* LinearAllocator::Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) {
+	u8* memory = static_cast<u8*>(ptr);
 
-	OASSERT(newStart < this->m_TotalSize);
+	if (memory && newSize != 0 && newSize <= oldSize)
+		return ptr;
 
-	const sizet newSize = newStart + size;
+	if (!memory || newSize == 0 || memory + oldSize != this->p_Memory + this->m_AllocatedSize)
+		return Allocator::Reallocate(ptr, oldSize, newSize, alignment);
 
-	if (newSize > this->m_TotalSize) {
+	const sizet newTop = (memory - this->p_Memory) + newSize;
+	if (newTop > this->m_TotalSize) {
 		OASSERTM(false, "MEMORY OVERFLOW |: Linear Allocator");
 		return nullptr;
 	}
 
-#ifdef OC_DETAILED_ALLOCATIONS
+	OC_PROFILE_ALLOCATE(this->m_Tag, newTop - this->m_AllocatedSize);
 
-	s_Stats.Add(size);
+	this->m_AllocatedSize = newTop;
+	return ptr;
+}
 
-#endif
+void LinearAllocator::Clear() {
+	// The arena doesn't count its allocations, only the bytes are released.
+	OC_PROFILE_RELEASE(this->m_Tag, this->m_AllocatedSize, 0);
 
-	this->m_AllocatedSize = newSize;
-	return this->p_Memory + newStart;
+	this->m_AllocatedSize = 0;
 }
 
-void LinearAllocator::Deallocate(OC_UNUSED void* ptr) {
-	oprint("Linear Allocator Deallocate called when it does not do anything!");
-	// This allocator does not allocate on a per-pointer base.
+// Pool Allocator
+
+void PoolAllocator::Init(sizet blockSize, sizet blocksPerChunk, sizet alignment, b8 growable) {
+	OASSERT(blocksPerChunk > 0);
+	OASSERTM((alignment & (alignment - 1)) == 0, "Pool Allocator alignment must be a power of two!");
+
+	// Free blocks store the next pointer of the free list in place.
+	//
+	if (alignment < alignof(void*))
+		alignment = alignof(void*);
+	if (blockSize < sizeof(void*))
+		blockSize = sizeof(void*);
+
+	this->m_BlockSize = blockSize;
+	this->m_Alignment = alignment;
+	this->m_Stride = blockSize + oAlignmentAdjustment(alignment, reinterpret_cast<void*>(blockSize));
+	this->m_HeaderSize = sizeof(u8*) + oAlignmentAdjustment(alignment, reinterpret_cast<void*>(sizeof(u8*)));
+	this->m_BlocksPerChunk = blocksPerChunk;
+	this->m_Growable = growable;
+
+	this->p_FreeList = nullptr;
+	this->p_FirstChunk = this->p_LastChunk = nullptr;
+	this->m_ChunkCount = this->m_AllocatedBlocks = 0;
+
+	this->p_CurrentChunk = AllocateChunk();
+	this->m_ChunkUsed = 0;
 }
 
-void LinearAllocator::Clear() {
-#ifdef OC_DETAILED_ALLOCATIONS
+void PoolAllocator::Shutdown() {
+	u8* chunk = this->p_FirstChunk;
 
-	s_Stats.Remove(this->m_AllocatedSize);
+	while (chunk) {
+		u8* next = *reinterpret_cast<u8**>(chunk);
 
-#endif
+		oAlignedFree(chunk);
+		chunk = next;
+	}
 
-	this->m_AllocatedSize = 0;
+	OC_PROFILE_RELEASE(this->m_Tag, this->m_AllocatedBlocks * this->m_BlockSize, this->m_AllocatedBlocks);
+
+	this->p_FreeList = nullptr;
+	this->p_FirstChunk = this->p_LastChunk = this->p_CurrentChunk = nullptr;
+	this->m_ChunkCount = this->m_ChunkUsed = this->m_AllocatedBlocks = 0;
 }
 
-// Malloc Allocator
+void* PoolAllocator::Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) {
+	if (!ptr || newSize == 0)
+		return Allocator::Reallocate(ptr, oldSize, newSize, alignment);
 
-void* MallocAllocator::Allocate(sizet size, OC_UNUSED sizet alignment) {
-#ifdef OC_DETAILED_ALLOCATIONS
+	OASSERTM(newSize <= this->m_BlockSize, "Pool Allocator block size is %llu, requested %llu.", this->m_BlockSize, newSize);
 
-	// Since we can't track the amount of memory freed, don't add to the allocation amount (at least not yet).
-	s_Stats.Add(0);
+	return newSize <= this->m_BlockSize ? ptr : nullptr;
+}
 
-#endif
+void PoolAllocator::Reset() {
+	OC_PROFILE_RELEASE(this->m_Tag, this->m_AllocatedBlocks * this->m_BlockSize, this->m_AllocatedBlocks);
 
-	return malloc(size);
+	// Chunks are reused by bumping through them again, so nothing needs to be walked.
+	//
+	this->p_FreeList = nullptr;
+	this->p_CurrentChunk = this->p_FirstChunk;
+	this->m_ChunkUsed = 0;
+	this->m_AllocatedBlocks = 0;
 }
 
-void MallocAllocator::Deallocate(void* ptr) {
-#ifdef OC_DETAILED_ALLOCATIONS
+b8 PoolAllocator::NextChunk() {
+	u8* next = this->p_CurrentChunk ? *reinterpret_cast<u8**>(this->p_CurrentChunk) : nullptr;
 
-	// Since we can't track the amount of memory freed, don't add to the deallocation amount (at least not yet).
-	s_Stats.Remove(0);
+	if (!next) {
+		if (!this->m_Growable) {
+			OASSERTM(false, "MEMORY OVERFLOW |: Pool Allocator");
+			return false;
+		}
 
-#endif
+		next = AllocateChunk();
+		if (!next)
+			return false;
+	}
 
-	free(ptr);
+	this->p_CurrentChunk = next;
+	this->m_ChunkUsed = 0;
+
+	return true;
+}
+
+u8* PoolAllocator::AllocateChunk() {
+	u8* chunk = static_cast<u8*>(oAlignedAlloc(this->m_HeaderSize + this->m_Stride * this->m_BlocksPerChunk, this->m_Alignment));
+	if (!chunk)
+		return nullptr;
+
+	*reinterpret_cast<u8**>(chunk) = nullptr;
+
+	if (this->p_LastChunk)
+		*reinterpret_cast<u8**>(this->p_LastChunk) = chunk;
+	else
+		this->p_FirstChunk = chunk;
+
+	this->p_LastChunk = chunk;
+	this->m_ChunkCount++;
+
+	return chunk;
+}
+
+// Tagged Allocator
+
+void TaggedAllocator::Init(HeapAllocator* parent, MemoryTag tag, const MemoryBudget& budget, MemoryBudgetCallback callback) {
+	this->p_Parent = parent;
+	this->m_Tag = tag;
+
+	this->m_Budget = budget;
+	this->m_BudgetCallback = callback;
+
+	this->m_LiveBytes.store(0, std::memory_order_relaxed);
+	this->m_PeakBytes.store(0, std::memory_order_relaxed);
+}
+
+void* TaggedAllocator::Allocate(sizet size, sizet alignment) {
+	void* ptr = this->p_Parent->AllocateTagged(size, alignment, this->m_Tag);
+	if (!ptr)
+		return nullptr;
+
+	// The usable size is counted so that Deallocate, which only knows the pointer, removes the same amount.
+	//
+	const sizet blockSize = this->p_Parent->BlockSize(ptr);
+	const sizet previous = this->m_LiveBytes.fetch_add(blockSize, std::memory_order_relaxed);
+	const sizet live = previous + blockSize;
+
+	if (this->m_Budget.Hard && live > this->m_Budget.Hard) {
+		this->m_LiveBytes.fetch_sub(blockSize, std::memory_order_relaxed);
+		this->p_Parent->DeallocateTagged(ptr, this->m_Tag);
+
+		OnHardBudget(live, size);
+
+		return nullptr;
+	}
+
+	OnGrowth(previous, live);
+
+	return ptr;
+}
+
+void TaggedAllocator::Deallocate(void* ptr) {
+	if (!ptr)
+		return;
+
+	this->m_LiveBytes.fetch_sub(this->p_Parent->BlockSize(ptr), std::memory_order_relaxed);
+	this->p_Parent->DeallocateTagged(ptr, this->m_Tag);
+}
+
+void* TaggedAllocator::Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) {
+	if (!ptr)
+		return Allocate(newSize, alignment);
+
+	if (newSize == 0) {
+		Deallocate(ptr);
+
+		return nullptr;
+	}
+
+	const sizet blockSize = this->p_Parent->BlockSize(ptr);
+	if (newSize <= blockSize)
+		return ptr;
+
+	// The new block size is only known once the heap is done, so the budget is checked against the request.
+	// A resize can't be undone, the block rounding may therefore overshoot the hard budget slightly.
+	//
+	if (this->m_Budget.Hard) {
+		const sizet expected = LiveBytes() - blockSize + newSize;
+
+		if (expected > this->m_Budget.Hard) {
+			OnHardBudget(expected, newSize);
+
+			return nullptr;
+		}
+	}
+
+	void* block = this->p_Parent->ReallocateTagged(ptr, oldSize, newSize, alignment, this->m_Tag);
+	if (!block)
+		return nullptr;
+
+	const sizet growth = this->p_Parent->BlockSize(block) - blockSize;
+	const sizet previous = this->m_LiveBytes.fetch_add(growth, std::memory_order_relaxed);
+
+	OnGrowth(previous, previous + growth);
+
+	return block;
+}
+
+void TaggedAllocator::OnGrowth(sizet previous, sizet live) {
+	if (this->m_Budget.Soft && previous < this->m_Budget.Soft && live >= this->m_Budget.Soft && this->m_BudgetCallback)
+		this->m_BudgetCallback(this->m_Tag, MEMORY_BUDGET_SOFT, live, this->m_Budget.Soft);
+
+	sizet peak = this->m_PeakBytes.load(std::memory_order_relaxed);
+	while (live > peak && !this->m_PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) { }
+}
+
+void TaggedAllocator::OnHardBudget(sizet live, sizet size) {
+	if (this->m_BudgetCallback)
+		this->m_BudgetCallback(this->m_Tag, MEMORY_BUDGET_HARD, live, this->m_Budget.Hard);
+	else
+		oprint(CONSOLE_TEXT_RED("Tagged Allocator: Hard budget of %llu bytes reached, refusing %llu bytes.\n"), this->m_Budget.Hard, size);
 }
 
 // Memory Service
 
-static sizet s_Size = omega(32) + tlsf_size() + 8;
+static sizet s_Size = omega(32);
+
+/**
+ * @brief The scratch stack of a thread, freed by its destructor when the thread exits.
+ */
+struct ThreadScratchStack {
+	StackAllocator stack; /** @brief The stack, only valid once initialized. */
+	b8 initialized = false; /** @brief Records if the stack has been initialized. */
+
+	~ThreadScratchStack() {
+		if (this->initialized)
+			this->stack.Shutdown();
+	}
+
+};	// ThreadScratchStack
+
+static thread_local ThreadScratchStack t_ScratchStack{ };
+
+MemoryService::MemoryService() : m_SystemAllocator(), m_MallocAllocator(), m_TagAllocators(), m_FrameAllocators() {
+	// Tag allocators are usable before Init so that statics can hold on to them, their budgets are set by Init.
+	//
+	for (u8 tag = 0; tag < MEMORY_TAG_COUNT; tag++)
+		m_TagAllocators[tag].Init(&m_SystemAllocator, static_cast<MemoryTag>(tag));
+}
 
 MemoryService& MemoryService::Instance() {
 	if (!s_Instance)
@@ -364,11 +1465,107 @@ MemoryService& MemoryService::Instance() {
 }
 
 void MemoryService::Init(MemoryServiceConfig* config) {
-	m_SystemAllocator.Init(config ? config->MaxDynamicSize : s_Size);
+	const MemoryServiceConfig defaults;
+
+	if (config)
+		m_SystemAllocator.Init(config->MaxDynamicSize, config->ThreadCaching, config->DynamicGrowSize, config->DirectMapThreshold);
+	else
+		m_SystemAllocator.Init(s_Size);
+
+	const sizet frameSize = config ? config->FrameAllocatorSize : defaults.FrameAllocatorSize;
+	m_FrameBufferCount = oClamp<u8>(config ? config->FrameBufferCount : defaults.FrameBufferCount, 1, k_MaxFrameBuffers);
+
+	for (u8 i = 0; i < m_FrameBufferCount; i++) {
+		m_FrameAllocators[i].Init(frameSize);
+		m_FrameAllocators[i].SetTag(MEMORY_TAG_FRAME);
+	}
+
+	for (u8 tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+		m_TagAllocators[tag].SetBudget(config ? config->Budgets[tag] : defaults.Budgets[tag]);
+		m_TagAllocators[tag].SetBudgetCallback(config ? config->BudgetCallback : defaults.BudgetCallback);
+	}
+
+	m_ScratchStackSize = config ? config->ScratchStackSize : defaults.ScratchStackSize;
+
+	m_FrameIndex = 0;
+	m_FrameHighWaterMark = m_PeakFrameHighWaterMark = 0;
+}
+
+TaggedAllocator* MemoryService::TagAllocator(MemoryTag tag) {
+	OASSERTM(tag != MEMORY_TAG_FRAME && tag < MEMORY_TAG_COUNT, "There is no tag allocator for tag %u.", tag);
+
+	return &m_TagAllocators[tag];
+}
+
+StackAllocator* MemoryService::ScratchStack() {
+	if (!t_ScratchStack.initialized) {
+		t_ScratchStack.stack.Init(m_ScratchStackSize);
+		t_ScratchStack.stack.SetTag(MEMORY_TAG_SCRATCH);
+		t_ScratchStack.initialized = true;
+	}
+
+	return &t_ScratchStack.stack;
+}
+
+void MemoryService::EndFrame() {
+	// Before Init there are no frame arenas to cycle through.
+	//
+	if (m_FrameBufferCount == 0)
+		return;
+
+	m_FrameHighWaterMark = m_FrameAllocators[m_FrameIndex].AllocatedSize();
+	if (m_FrameHighWaterMark > m_PeakFrameHighWaterMark)
+		m_PeakFrameHighWaterMark = m_FrameHighWaterMark;
+
+	// The next arena was last used FrameBufferCount - 1 frames ago, so its memory can now be reused.
+	//
+	m_FrameIndex = (m_FrameIndex + 1) % m_FrameBufferCount;
+	m_FrameAllocators[m_FrameIndex].Clear();
+
+#ifdef OC_DETAILED_ALLOCATIONS
+
+	AllocationProfiler::Sample();
+
+#endif
 }
 
 void MemoryService::Shutdown() {
+	for (u8 i = 0; i < Instance().m_FrameBufferCount; i++) {
+		Instance().m_FrameAllocators[i].Clear();
+		Instance().m_FrameAllocators[i].Shutdown();
+	}
+
+#ifdef OC_DETAILED_ALLOCATIONS
+
+	for (u8 tag = 0; tag < MEMORY_TAG_COUNT; tag++)
+		if (Instance().m_TagAllocators[tag].LiveBytes() != 0)
+			oprint(CONSOLE_TEXT_RED("%s allocations still present (%llu bytes). Check your code!\n"), AllocationProfiler::TagName(static_cast<MemoryTag>(tag)), Instance().m_TagAllocators[tag].LiveBytes());
+
+#endif
+
 	Instance().m_SystemAllocator.Shutdown();
 
-	delete &Instance();
+#ifdef OC_DETAILED_ALLOCATIONS
+
+	AllocationSnapshot* snapshot = static_cast<AllocationSnapshot*>(malloc(sizeof(AllocationSnapshot)));
+	AllocationProfiler::Snapshot(*snapshot);
+
+	oprint(CONSOLE_TEXT_CYAN("Allocation Profile:\n"));
+	for (u8 tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+		const AllocationTagStats& stats = snapshot->tags[tag];
+		if (stats.allocationCount == 0)
+			continue;
+
+		oprint(CONSOLE_TEXT_CYAN("\t%s: %llu allocations, %llu frees, %llu bytes allocated, %llu bytes live, %llu bytes peak\n"),
+			AllocationProfiler::TagName(static_cast<MemoryTag>(tag)),
+			stats.allocationCount, stats.deallocationCount, stats.allocatedBytes, stats.liveBytes, stats.peakLiveBytes
+		);
+	}
+
+	free(snapshot);
+
+#endif
+
+	delete s_Instance;
+	s_Instance = nullptr;
 }
\ No newline at end of file
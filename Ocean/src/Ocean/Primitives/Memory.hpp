@@ -1,16 +1,23 @@
 #pragma once
 
+#include "Ocean/Types/Bool.hpp"
 #include "Ocean/Types/Integers.hpp"
 #include "Ocean/Types/Strings.hpp"
 
+#include "Ocean/Primitives/Assert.hpp"
+#include "Ocean/Primitives/Macros.hpp"
 #include "Ocean/Primitives/Service.hpp"
 
 // std
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <mutex>
 
-// Define this for detailed logs of where allocations and frees are completed (only when using alloc / free macros)
-#define OC_DETAILED_ALLOCATIONS 1
+// OC_DETAILED_ALLOCATIONS is defined by the build (see Ocean_ALLOCATION_PROFILING) to enable the AllocationProfiler.
+// Together with OC_VERBOSE every alloc / free macro also logs where it was called from.
+#include "Ocean/Primitives/AllocationProfiler.hpp"
 
 // So that compiler doesn't give warnings about unused includes.
 #ifdef OC_DETAILED_ALLOCATIONS
@@ -24,56 +31,42 @@
 #define omega(size) (size * 1024 * 1024)
 #define ogiga(size) (size * 1024 * 1024 * 1024)
 
+/** @brief The assumed size of a cache line in bytes. */
+#define OC_CACHE_LINE_SIZE 64
+
 
 
 uintptr_t oAlignmentOffset(sizet alignOf, const void* const ptr);
 
 uintptr_t oAlignmentAdjustment(sizet alignOf, const void* const ptr);
 
-
-
 /**
- * @brief A struct that holds stats about memory allocations in the lifetime.
+ * @brief Allocates memory from the C runtime at the given alignment. MSVC has no aligned_alloc, so Windows uses
+ * _aligned_malloc instead.
+ * 
+ * @param size The size in bytes to allocate.
+ * @param alignment The alignment of the allocation, a power of two.
+ * @return void* - The memory or nullptr on failure, free it with oAlignedFree().
  */
-struct MemoryStats {
-
-	sizet allocatedBytes; /** @brief The total number of bytes allocated in the stat's lifetime. */
-	sizet freedBytes; /** @brief The total number of bytes freed in the stat's lifetime. */
+void* oAlignedAlloc(sizet size, sizet alignment);
 
-	u32 allocationCount; /** @brief The number of allocations made in the stat's lifetime. */
-	u32 freeCount; /** @brief The number of frees made in the stat's lifetime. */
-
-	/**
-	 * @brief Add's data to the stat's such as the total allocatedBytes and the allocationCount. 
-	 * 
-	 * @param a The number of bytes to add.
-	 * @return The original value.
-	 */
-	sizet Add(sizet a) {
-		if (a) {
-			this->allocatedBytes += a;
-			this->allocationCount++;
-		}
-
-		return a;
-	}
-
-	/**
-	 * @brief Add's data to the stat's such as the total freedBytes and the freeCount.
-	 * 
-	 * @param a The number of bytes to "remove".
-	 * @return The original value.
-	 */
-	sizet Remove(sizet a) {
-		if (a) {
-			this->freedBytes += a;
-			this->freeCount++;
-		}
-
-		return a;
-	}
+/**
+ * @brief Resizes memory allocated by oAlignedAlloc(), keeping its alignment.
+ * 
+ * @param ptr The pointer to the memory, or nullptr to allocate.
+ * @param oldSize The current size in bytes.
+ * @param newSize The new size in bytes.
+ * @param alignment The alignment the memory was allocated with.
+ * @return void* - The resized memory or nullptr on failure, in which case ptr is left untouched.
+ */
+void* oAlignedRealloc(void* ptr, sizet oldSize, sizet newSize, sizet alignment);
 
-};	// MemoryStats
+/**
+ * @brief Frees memory allocated by oAlignedAlloc().
+ * 
+ * @param ptr The pointer to the memory.
+ */
+void oAlignedFree(void* ptr);
 
 
 
@@ -100,23 +93,76 @@ public:
 	 */
 	virtual void Deallocate(void* ptr) = 0;
 
+	/**
+	 * @brief Resizes an allocation, growing it in place when the allocator can and moving it otherwise.
+	 * 
+	 * @details The default implementation allocates a new block, copies the smaller of the two sizes and frees the
+	 * old block. A nullptr behaves like Allocate and a new size of 0 like Deallocate. On failure nullptr is returned
+	 * and the old allocation is left untouched. The contents are moved bytewise, so only use it for trivially
+	 * copyable data.
+	 * 
+	 * @param ptr The pointer to the memory to resize, or nullptr.
+	 * @param oldSize The size in bytes the memory was allocated or last resized with.
+	 * @param newSize The new size in bytes.
+	 * @param alignment The alignment of the allocation, must match the original alignment.
+	 * @return void* - The resized memory, which may be at a new address.
+	 */
+	virtual void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment = alignof(max_align_t));
+
+	/**
+	 * @return MemoryTag - The tag the allocator's allocations are profiled under.
+	 */
+	MemoryTag Tag() const { return this->m_Tag; }
+	/**
+	 * @brief Sets the tag the allocator's allocations are profiled under.
+	 * 
+	 * @param tag The MemoryTag.
+	 */
+	void SetTag(MemoryTag tag) { this->m_Tag = tag; }
+
+protected:
+	MemoryTag m_Tag = MEMORY_TAG_GENERAL; /** @brief The tag of the allocator, only used by the AllocationProfiler. */
+
 };	// Allocator
 
 
 
 /**
  * @brief The heap allocator allocates memory in as requested blocks.
+ * 
+ * @details The TLSF pools are guarded by a lock so the heap can be shared between threads. Small allocations are
+ * served from per-thread size-class caches (magazines) that are refilled from and drained to the pools in batches,
+ * so the lock is only taken once per batch instead of once per allocation.
+ * 
+ * The heap reserves its pools as virtual memory directly from the OS, so pages only become resident once they are
+ * touched. When the pools run out a new pool is added instead of failing. One empty grown pool is kept as a spare, any
+ * other grown pool is returned to the OS as soon as it is empty again. Allocations at or above the direct map threshold
+ * bypass TLSF and get their own mapping.
  */
-class HeapAllocator : public Allocator {
+class HeapAllocator final : public Allocator {
 public:
+	/** @brief The largest size in bytes that is served from the thread caches. */
+	OC_STATIC_EXPR sizet k_MaxCachedSize = 1024;
+	/** @brief The alignment of every block handed out by the thread caches. */
+	OC_STATIC_EXPR sizet k_CacheAlignment = 16;
+	/** @brief The default size in bytes from which allocations are mapped directly from the OS. */
+	OC_STATIC_EXPR sizet k_DirectMapThreshold = omega(1);
+
+public:
+	HeapAllocator() : m_Lock() { }
 	~HeapAllocator() override;
 
+	OC_NO_COPY(HeapAllocator);
+
 	/**
-	 * @brief Initializes the HeapAllocator to store a maximum of the given size.
+	 * @brief Initializes the HeapAllocator with an initial pool of the given size.
 	 * 
-	 * @param size The amount of memory to store in bytes.
+	 * @param size The size of the initial pool in bytes, this pool is kept until shutdown.
+	 * @param threadCaching Enables the per-thread size-class caches. (OPTIONAL)
+	 * @param growSize The minimum size of each pool added when the heap runs out, 0 uses the initial size. (OPTIONAL)
+	 * @param directMapThreshold The size in bytes from which allocations are mapped directly from the OS. (OPTIONAL)
 	 */
-	void Init(sizet size);
+	void Init(sizet size, b8 threadCaching = true, sizet growSize = 0, sizet directMapThreshold = k_DirectMapThreshold);
 	/**
 	 * @brief Clears all of the memory and shuts down the HeapAllocator.
 	 */
@@ -132,21 +178,220 @@ public:
 	 */
 	virtual void Deallocate(void* ptr) override;
 
+	/**
+	 * @copydoc Allocator::Reallocate()
+	 * 
+	 * @note Blocks grow in place when the physically next TLSF block is free. Direct mappings and alignments above
+	 * TLSF's own are always moved.
+	 */
+	virtual void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) override;
+
+	/**
+	 * @brief Allocates memory that is profiled under the given tag instead of the heap's own.
+	 * 
+	 * @param size The size in bytes to allocate.
+	 * @param alignment The alignment of the allocation.
+	 * @param tag The MemoryTag to profile the allocation under.
+	 * @return void* 
+	 */
+	void* AllocateTagged(sizet size, sizet alignment, MemoryTag tag);
+	/**
+	 * @brief Deallocates memory that is profiled under the given tag instead of the heap's own.
+	 * 
+	 * @param ptr The pointer to the memory to deallocate.
+	 * @param tag The MemoryTag the memory was allocated under.
+	 */
+	void DeallocateTagged(void* ptr, MemoryTag tag);
+	/**
+	 * @brief Resizes memory that is profiled under the given tag instead of the heap's own.
+	 * 
+	 * @param ptr The pointer to the memory to resize, or nullptr.
+	 * @param oldSize The size in bytes the memory was allocated or last resized with.
+	 * @param newSize The new size in bytes.
+	 * @param alignment The alignment of the allocation.
+	 * @param tag The MemoryTag the memory was allocated under.
+	 * @return void* 
+	 */
+	void* ReallocateTagged(void* ptr, sizet oldSize, sizet newSize, sizet alignment, MemoryTag tag);
+
+	/**
+	 * @brief Gets the usable size of an allocation, which is at least the size that was requested.
+	 * 
+	 * @param ptr A pointer returned by Allocate().
+	 * @return sizet 
+	 */
+	sizet BlockSize(const void* ptr) const;
+
+	/**
+	 * @brief Returns every block cached by the calling thread back to the heap.
+	 */
+	void FlushThreadCache();
+
+	/**
+	 * @return sizet - The total size of the pools and direct mappings in bytes.
+	 */
+	sizet TotalSize() const { return this->m_TotalSize; }
+	/**
+	 * @return sizet - The amount of memory allocated from the heap in bytes.
+	 */
+	sizet AllocatedSize() const { return this->m_AllocatedSize; }
+	/**
+	 * @return u32 - The number of TLSF pools the heap currently owns.
+	 */
+	u32 PoolCount() const { return this->m_PoolCount; }
+
 private:
-	void* p_Handle = nullptr; /** @brief The tlsf handle for the memory pool. */
-	void* p_Memory = nullptr; /** @brief The base memory pointer of the heap. */
+	friend struct HeapThreadCache;
+
+	/**
+	 * @brief The header placed at the start of every pool mapping.
+	 */
+	struct Pool {
+		Pool* next; /** @brief The next pool of the heap. */
+
+		u8* begin; /** @brief The first byte usable by TLSF. */
+		u8* end; /** @brief One past the last byte of the pool. */
+
+		sizet mappedSize; /** @brief The size of the mapping holding the pool. */
+		sizet usedSize; /** @brief The size of the blocks allocated from the pool. */
+
+	};	// Pool
+
+	/**
+	 * @brief Maps a new pool from the OS and adds it to TLSF.
+	 * 
+	 * @param size The minimum usable size of the pool in bytes.
+	 * @return Pool* - The new pool or nullptr if the OS is out of memory.
+	 */
+	Pool* AddPool(sizet size);
+	/**
+	 * @brief Removes an empty pool from TLSF and returns its memory to the OS.
+	 * 
+	 * @param pool The pool to release.
+	 */
+	void ReleasePool(Pool* pool);
+	/**
+	 * @brief Counts a new block against its pool. Expects the lock to be held.
+	 * 
+	 * @param pool The pool of the block.
+	 * @param size The size of the TLSF block.
+	 */
+	void ClaimPool(Pool* pool, sizet size);
+	/**
+	 * @brief Counts a freed block against its pool, keeping an empty grown pool as the spare or releasing it.
+	 * Expects the lock to be held.
+	 * 
+	 * @param pool The pool of the block.
+	 * @param size The size of the TLSF block.
+	 */
+	void VacatePool(Pool* pool, sizet size);
+	/**
+	 * @brief Finds the pool a TLSF block belongs to.
+	 * 
+	 * @param ptr The pointer to the block.
+	 * @return Pool* - The pool or nullptr if the block is not part of any pool.
+	 */
+	Pool* FindPool(const void* ptr) const;
+
+	/**
+	 * @brief Allocates a block from TLSF, growing the heap if needed. Expects the lock to be held.
+	 * 
+	 * @param size The size in bytes to allocate.
+	 * @param alignment The alignment of the allocation.
+	 * @return void* - The usable memory behind the block's tag, see HeapBlockTag in Memory.cpp.
+	 */
+	void* AllocateLocked(sizet size, sizet alignment);
+	/**
+	 * @brief Frees a TLSF block, an emptied grown pool is kept as the spare or released. Expects the lock to be held.
+	 * 
+	 * @param ptr The pointer to the block.
+	 */
+	void DeallocateLocked(void* ptr);
+	/**
+	 * @brief Resizes a TLSF block with tlsf_realloc, growing the heap if needed. Expects the lock to be held.
+	 * 
+	 * @param ptr The pointer to the block.
+	 * @param size The new size in bytes.
+	 * @return void* - The resized block with its tag updated, or nullptr if the block was left untouched.
+	 */
+	void* ReallocateLocked(void* ptr, sizet size);
+
+	/**
+	 * @brief Maps an allocation directly from the OS.
+	 * 
+	 * @param size The size in bytes to allocate.
+	 * @return void* 
+	 */
+	void* AllocateDirect(sizet size);
+	/**
+	 * @brief Returns a direct mapping to the OS.
+	 * 
+	 * @param ptr The pointer returned by AllocateDirect().
+	 */
+	void DeallocateDirect(void* ptr);
+
+	/**
+	 * @brief Allocates a block directly from the TLSF pool.
+	 * 
+	 * @param size The size in bytes to allocate.
+	 * @param alignment The alignment of the allocation.
+	 * @return void* 
+	 */
+	void* AllocateBlock(sizet size, sizet alignment);
+	/**
+	 * @brief Frees a block directly to the TLSF pool.
+	 * 
+	 * @param ptr The pointer to the block.
+	 */
+	void DeallocateBlock(void* ptr);
+
+	/**
+	 * @brief Allocates up to count blocks of the given size from the TLSF pool while holding the lock once.
+	 * 
+	 * @param blocks The array to write the blocks to.
+	 * @param count The number of blocks requested.
+	 * @param sizeClass The size class of the blocks, which their tags record for Deallocate.
+	 * @return u32 - The number of blocks allocated.
+	 */
+	u32 AllocateBatch(void** blocks, u32 count, u8 sizeClass);
+	/**
+	 * @brief Frees count blocks to the TLSF pool while holding the lock once.
+	 * 
+	 * @param blocks The array of blocks to free.
+	 * @param count The number of blocks to free.
+	 */
+	void DeallocateBatch(void** blocks, u32 count);
+
+private:
+	void* p_Handle = nullptr; /** @brief The tlsf handle for the memory pools. */
+	void* p_Control = nullptr; /** @brief The memory holding the tlsf control structure. */
+
+	Pool* p_Pools = nullptr; /** @brief The pools of the heap, the initial pool is always first. */
+	Pool* p_SparePool = nullptr; /** @brief An empty grown pool kept to absorb churn, nullptr if there is none. */
+	u32 m_PoolCount = 0; /** @brief The number of pools of the heap. */
+
+	sizet m_GrowSize = 0; /** @brief The minimum size of a grown pool. */
+	sizet m_DirectMapThreshold = k_DirectMapThreshold; /** @brief The size from which allocations bypass TLSF. */
 
 	sizet m_TotalSize = 0; /** @brief The total size of the heap. */
 	sizet m_AllocatedSize = 0; /** @brief The amount of memory that is allocated in the heap. */
 
+	std::mutex m_Lock; /** @brief Guards the tlsf pool against concurrent access. */
+
+	i32 m_CacheSlot = -1; /** @brief The thread cache slot of the heap, -1 if the heap is not cached. */
+	u32 m_CacheGeneration = 0; /** @brief The generation of the thread cache slot, used to discard stale caches. */
+
 };	// HeapAllocator
 
 
 
 /**
  * @brief An allocator that treats the memory as a stack, that can be pushed to and popped from.
+ * 
+ * @details Deallocate pops everything from the given pointer on, so it must be called in reverse allocation order.
+ * Generic code should use a ScopedArena on top of the stack instead.
  */
-class StackAllocator : public Allocator {
+class StackAllocator final : public Allocator {
 public:
 	/**
 	 * @brief Initializes the StackAllocator to store a maximum of the given size.
@@ -169,6 +414,13 @@ public:
 	 */
 	virtual void Deallocate(void* ptr) override;
 
+	/**
+	 * @copydoc Allocator::Reallocate()
+	 * 
+	 * @note The allocation at the top of the stack is resized in place.
+	 */
+	virtual void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) override;
+
 	/**
 	 * @brief Get the marker of the stack.
 	 * 
@@ -176,9 +428,9 @@ public:
 	 */
 	sizet GetMarker() const;
 	/**
-	 * @brief Free's the 
+	 * @brief Free's everything allocated after the marker was taken.
 	 * 
-	 * @param marker 
+	 * @param marker A marker returned by GetMarker().
 	 */
 	void FreeMarker(sizet marker);
 
@@ -187,20 +439,35 @@ public:
 	 */
 	void Clear();
 
+	/**
+	 * @return sizet - The number of bytes allocated, including alignment padding.
+	 */
+	sizet AllocatedSize() const { return this->m_AllocatedSize; }
+	/**
+	 * @return sizet - The total number of bytes the allocator can hold.
+	 */
+	sizet TotalSize() const { return this->m_TotalSize; }
+
 private:
+	friend class ScopedArena;
+
 	u8* p_Memory = nullptr; /** @brief The base memory pointer of the allocator. */
 
 	sizet m_TotalSize = 0; /** @brief The total size of the allocator. */
 	sizet m_AllocatedSize = 0; /** @brief The amount of memory that is allocated in the allocator. */
 
+	u32 m_ScopeDepth = 0; /** @brief The number of ScopedArenas open on the stack. */
+
 };	// StackAllocator
 
 
 
 /**
  * @brief An allocator that treats the memory as a double sided stack, that can be pushed and popped from both ends.
+ * 
+ * @details Used as a plain Allocator it allocates from the bottom, memory is then released through the markers.
  */
-class DoubleStackAllocator : public Allocator {
+class DoubleStackAllocator final : public Allocator {
 public:
 	/**
 	 * @brief Initializes the DoubleStackAllocator to store a maximum of the given size.
@@ -215,14 +482,25 @@ public:
 
 	/**
 	 * @copydoc Allocator::Allocate()
+	 * 
+	 * @note Allocates from the bottom of the stack.
 	 */
 	virtual void* Allocate(sizet size, sizet alignment) override;
 
 	/**
 	 * @copydoc Allocator::Deallocate() 
+	 * 
+	 * @note A no-op, memory is released by DeallocateTop / DeallocateBottom, the markers or the clears.
 	 */
 	virtual void Deallocate(void* ptr) override;
 
+	/**
+	 * @copydoc Allocator::Reallocate()
+	 * 
+	 * @note The last allocation at the bottom of the stack is resized in place.
+	 */
+	virtual void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) override;
+
 	/**
 	 * @brief Allocates memory at the top of the stack.
 	 * 
@@ -291,20 +569,94 @@ public:
 	void ClearBottom();
 
 private:
+	friend class ScopedArena;
+
 	u8* p_Memory = nullptr; /** @brief The base memory pointer of the allocator. */
 
 	sizet m_TotalSize = 0; /** @brief The total size of the allocator. */
 	sizet m_Top = 0; /** @brief The size distance from the top of the memory block. */
 	sizet m_Bottom = 0; /** @brief The size distance from the bottom of the memory block. */
 
+	u32 m_TopScopeDepth = 0; /** @brief The number of ScopedArenas open on the top of the stack. */
+	u32 m_BottomScopeDepth = 0; /** @brief The number of ScopedArenas open on the bottom of the stack. */
+
 };	// DoubleStackAllocator
 
 
 
+/**
+ * @brief A scope on a StackAllocator, or one side of a DoubleStackAllocator, that rewinds it when destroyed.
+ * 
+ * @details The arena captures the marker of its stack on construction and frees everything above it on destruction.
+ * Deallocate is a no-op, so the arena can be handed to generic code as an Allocator* for temporary work.
+ * Arenas nest, but only the innermost arena of a stack may allocate.
+ */
+class ScopedArena final : public Allocator {
+public:
+	/**
+	 * @brief Opens a scope on the given StackAllocator.
+	 * 
+	 * @param stack The StackAllocator to allocate from.
+	 */
+	explicit ScopedArena(StackAllocator* stack);
+	/**
+	 * @brief Opens a scope on one side of the given DoubleStackAllocator.
+	 * 
+	 * @param stack The DoubleStackAllocator to allocate from.
+	 * @param top Allocates from the top of the stack if true, from the bottom otherwise.
+	 */
+	ScopedArena(DoubleStackAllocator* stack, b8 top);
+	~ScopedArena() override;
+
+	ScopedArena(const ScopedArena&) = delete;
+	ScopedArena& operator = (const ScopedArena&) = delete;
+
+	/**
+	 * @copydoc Allocator::Allocate()
+	 */
+	virtual void* Allocate(sizet size, sizet alignment) override;
+
+	/**
+	 * @copydoc Allocator::Deallocate() 
+	 * 
+	 * @note A no-op, the memory is released when the arena is destroyed.
+	 */
+	virtual void Deallocate(void* ptr) override;
+
+	/**
+	 * @copydoc Allocator::Reallocate()
+	 * 
+	 * @note The last allocation grows in place, except on the top of a DoubleStackAllocator.
+	 */
+	virtual void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) override;
+
+	/**
+	 * @return sizet - The marker of the stack when the arena was opened.
+	 */
+	sizet Marker() const { return this->m_Marker; }
+
+private:
+	/**
+	 * @return u32& - The scope depth of the stack side the arena allocates from.
+	 */
+	u32& ScopeDepth() const;
+
+private:
+	StackAllocator* p_Stack = nullptr; /** @brief The stack of the arena, nullptr if the arena is on a DoubleStackAllocator. */
+	DoubleStackAllocator* p_DoubleStack = nullptr; /** @brief The double stack of the arena, nullptr if the arena is on a StackAllocator. */
+
+	sizet m_Marker = 0; /** @brief The marker the stack is rewound to. */
+	u32 m_Depth = 0; /** @brief The scope depth of the arena, used to catch allocations from an outer arena. */
+	b8 m_Top = false; /** @brief Records if the arena allocates from the top of a DoubleStackAllocator. */
+
+};	// ScopedArena
+
+
+
 /**
  * @brief An allocator that treat's memory as an array, memory cannot be deallocate memory without clearing the array.
  */
-class LinearAllocator : public Allocator {
+class LinearAllocator final : public Allocator {
 public:
 	/**
 	 * @brief Initializes the LinearAllocator to store a maximum of the given size.
@@ -320,18 +672,50 @@ public:
 	/**
 	 * @copydoc Allocator::Allocate()
 	 */
-	virtual void* Allocate(sizet size, sizet alignment) override;
+	virtual void* Allocate(sizet size, sizet alignment) override {
+		OASSERT(size > 0);
+
+		const sizet newStart = this->m_AllocatedSize + oAlignmentAdjustment(alignment, this->p_Memory + this->m_AllocatedSize);
+		const sizet newSize = newStart + size;
+
+		if (newSize > this->m_TotalSize) {
+			OASSERTM(false, "MEMORY OVERFLOW |: Linear Allocator");
+			return nullptr;
+		}
+
+		// Padding is included so that Clear removes exactly what was added.
+		OC_PROFILE_ALLOCATE(this->m_Tag, newSize - this->m_AllocatedSize);
+
+		this->m_AllocatedSize = newSize;
+		return this->p_Memory + newStart;
+	}
 
 	/**
 	 * @copydoc Allocator::Deallocate() 
 	 */
 	virtual void Deallocate(void* ptr) override;
 
+	/**
+	 * @copydoc Allocator::Reallocate()
+	 * 
+	 * @note The last allocation grows in place, shrinking never releases memory before Clear.
+	 */
+	virtual void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) override;
+
 	/**
 	 * @brief Clear's the allocator's memory.
 	 */
 	void Clear();
 
+	/**
+	 * @return sizet - The number of bytes allocated since the last Clear, including alignment padding.
+	 */
+	sizet AllocatedSize() const { return this->m_AllocatedSize; }
+	/**
+	 * @return sizet - The total number of bytes the allocator can hold.
+	 */
+	sizet TotalSize() const { return this->m_TotalSize; }
+
 private:
 	u8* p_Memory = nullptr; /** @brief The base memory pointer of the allocator. */
 
@@ -342,11 +726,230 @@ private:
 
 
 
+/**
+ * @brief An allocator that hands out fixed size blocks from an intrusive free list.
+ * 
+ * @details Blocks are carved from chunks lazily, so Allocate, Deallocate and Reset are all O(1).
+ * A growable pool links in a new chunk when the current chunks are exhausted, otherwise it overflows.
+ */
+class PoolAllocator final : public Allocator {
+public:
+	/**
+	 * @brief Initializes the PoolAllocator to store blocks of the given size.
+	 * 
+	 * @param blockSize The size of a block in bytes.
+	 * @param blocksPerChunk The number of blocks in each chunk.
+	 * @param alignment The alignment of every block, defaults to a cache line. (OPTIONAL)
+	 * @param growable Allows the pool to allocate more chunks when it is full. (OPTIONAL)
+	 */
+	void Init(sizet blockSize, sizet blocksPerChunk, sizet alignment = OC_CACHE_LINE_SIZE, b8 growable = false);
+	/**
+	 * @brief Clears all of the memory and shuts down the PoolAllocator.
+	 */
+	void Shutdown();
+
+	/**
+	 * @copydoc Allocator::Allocate()
+	 * 
+	 * @note The size must not exceed the block size, and the alignment must not exceed the pool's alignment.
+	 */
+	virtual void* Allocate(OC_UNUSED sizet size, OC_UNUSED sizet alignment) override {
+		OASSERTM(size <= this->m_BlockSize, "Pool Allocator block size is %llu, requested %llu.", this->m_BlockSize, size);
+		OASSERTM(alignment <= this->m_Alignment, "Pool Allocator alignment is %llu, requested %llu.", this->m_Alignment, alignment);
+
+		void* block = this->p_FreeList;
+
+		if (block) {
+			this->p_FreeList = *static_cast<void**>(block);
+		}
+		else {
+			if (this->m_ChunkUsed == this->m_BlocksPerChunk && !NextChunk())
+				return nullptr;
+
+			block = this->p_CurrentChunk + this->m_HeaderSize + this->m_ChunkUsed++ * this->m_Stride;
+		}
+
+		OC_PROFILE_ALLOCATE(this->m_Tag, this->m_BlockSize);
+
+		this->m_AllocatedBlocks++;
+		return block;
+	}
+
+	/**
+	 * @copydoc Allocator::Deallocate() 
+	 */
+	virtual void Deallocate(void* ptr) override {
+		if (!ptr)
+			return;
+
+		*static_cast<void**>(ptr) = this->p_FreeList;
+		this->p_FreeList = ptr;
+
+		OC_PROFILE_DEALLOCATE(this->m_Tag, this->m_BlockSize);
+
+		this->m_AllocatedBlocks--;
+	}
+
+	/**
+	 * @copydoc Allocator::Reallocate()
+	 * 
+	 * @note Every block already holds the block size, so this never moves. The new size must not exceed the block size.
+	 */
+	virtual void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) override;
+
+	/**
+	 * @brief Releases every block at once while keeping the chunks for reuse.
+	 */
+	void Reset();
+
+	/**
+	 * @return sizet - The usable size of a block in bytes.
+	 */
+	sizet BlockSize() const { return this->m_BlockSize; }
+	/**
+	 * @return sizet - The number of blocks currently allocated.
+	 */
+	sizet AllocatedBlocks() const { return this->m_AllocatedBlocks; }
+	/**
+	 * @return sizet - The number of blocks the current chunks can hold.
+	 */
+	sizet Capacity() const { return this->m_ChunkCount * this->m_BlocksPerChunk; }
+
+private:
+	/**
+	 * @brief Moves the bump position to the next chunk, allocating one if the pool is growable.
+	 * 
+	 * @return b8 - True if a chunk with free blocks is available, False otherwise.
+	 */
+	b8 NextChunk();
+
+	/**
+	 * @brief Allocates a new chunk and links it after the last chunk.
+	 * 
+	 * @return u8* - The chunk, or nullptr if the allocation failed.
+	 */
+	u8* AllocateChunk();
+
+private:
+	void* p_FreeList = nullptr; /** @brief The head of the intrusive list of freed blocks. */
+
+	u8* p_FirstChunk = nullptr; /** @brief The first chunk of the pool. */
+	u8* p_LastChunk = nullptr; /** @brief The last chunk of the pool. */
+	u8* p_CurrentChunk = nullptr; /** @brief The chunk that untouched blocks are bumped from. */
+
+	sizet m_BlockSize = 0; /** @brief The usable size of a block. */
+	sizet m_Stride = 0; /** @brief The distance between two blocks. */
+	sizet m_Alignment = 0; /** @brief The alignment of every block. */
+	sizet m_HeaderSize = 0; /** @brief The aligned size of a chunk header. */
+
+	sizet m_BlocksPerChunk = 0; /** @brief The number of blocks in each chunk. */
+	sizet m_ChunkCount = 0; /** @brief The number of allocated chunks. */
+	sizet m_ChunkUsed = 0; /** @brief The number of blocks bumped from the current chunk. */
+	sizet m_AllocatedBlocks = 0; /** @brief The number of blocks currently allocated. */
+
+	b8 m_Growable = false; /** @brief Records if the pool can allocate more chunks. */
+
+};	// PoolAllocator
+
+
+
 /**
  * @brief Allocates memory using classic C-style malloc and free.
  */
-class MallocAllocator : public Allocator {
+class MallocAllocator final : public Allocator {
+public:
+	/**
+	 * @copydoc Allocator::Allocate()
+	 */
+	virtual void* Allocate(sizet size, OC_UNUSED sizet alignment) override {
+		// Since we can't track the amount of memory freed, don't add to the allocation amount (at least not yet).
+		OC_PROFILE_ALLOCATE(this->m_Tag, 0);
+
+		return malloc(size);
+	}
+
+	/**
+	 * @copydoc Allocator::Deallocate() 
+	 */
+	virtual void Deallocate(void* ptr) override {
+		// Since we can't track the amount of memory freed, don't add to the deallocation amount (at least not yet).
+		OC_PROFILE_DEALLOCATE(this->m_Tag, 0);
+
+		free(ptr);
+	}
+
+	/**
+	 * @copydoc Allocator::Reallocate()
+	 */
+	virtual void* Reallocate(void* ptr, OC_UNUSED sizet oldSize, sizet newSize, OC_UNUSED sizet alignment) override {
+		if (newSize == 0) {
+			Deallocate(ptr);
+
+			return nullptr;
+		}
+
+		// Counted as a new allocation only, like Allocate.
+		if (!ptr)
+			OC_PROFILE_ALLOCATE(this->m_Tag, 0);
+
+		return realloc(ptr, newSize);
+	}
+
+};	// MallocAllocator
+
+
+
+/**
+ * @brief The level of a MemoryBudget.
+ */
+enum MemoryBudgetLevel : u8 {
+	/** @brief The soft budget, crossing it only notifies. */
+	MEMORY_BUDGET_SOFT = 0,
+	/** @brief The hard budget, allocations that would cross it fail. */
+	MEMORY_BUDGET_HARD,
+
+};	// MemoryBudgetLevel
+
+/**
+ * @brief A callback for when a TaggedAllocator crosses one of its budgets.
+ * 
+ * @details The callback runs on the allocating thread, inside Allocate. It may free memory of the same allocator,
+ * i.e. to evict cached resources, but a failed hard budget allocation is not retried.
+ */
+typedef void (*MemoryBudgetCallback)(MemoryTag tag, MemoryBudgetLevel level, sizet liveBytes, sizet budget);
+
+/**
+ * @brief The soft and hard limits in bytes of a TaggedAllocator, 0 means unlimited.
+ */
+struct MemoryBudget {
+
+	sizet Soft = 0; /** @brief Crossing this calls the budget callback once per crossing. */
+	sizet Hard = 0; /** @brief Allocations that would cross this fail and call the budget callback. */
+
+};	// MemoryBudget
+
+/**
+ * @brief An allocator that forwards to a HeapAllocator while tracking the live and peak bytes of a single MemoryTag.
+ * 
+ * @details The counters are atomic so a TaggedAllocator can be shared between threads like its heap.
+ */
+class TaggedAllocator final : public Allocator {
 public:
+	TaggedAllocator() : m_Budget(), m_LiveBytes(0), m_PeakBytes(0) { }
+	~TaggedAllocator() override = default;
+
+	OC_NO_COPY(TaggedAllocator);
+
+	/**
+	 * @brief Initializes the TaggedAllocator.
+	 * 
+	 * @param parent The HeapAllocator to allocate from.
+	 * @param tag The MemoryTag of the allocator.
+	 * @param budget The budget of the allocator. (OPTIONAL)
+	 * @param callback The callback to call when a budget is crossed. (OPTIONAL)
+	 */
+	void Init(HeapAllocator* parent, MemoryTag tag, const MemoryBudget& budget = MemoryBudget(), MemoryBudgetCallback callback = nullptr);
+
 	/**
 	 * @copydoc Allocator::Allocate()
 	 */
@@ -357,7 +960,69 @@ public:
 	 */
 	virtual void Deallocate(void* ptr) override;
 
-};	// MallocAllocator
+	/**
+	 * @copydoc Allocator::Reallocate()
+	 * 
+	 * @note The hard budget is checked against the requested growth before the heap is touched.
+	 */
+	virtual void* Reallocate(void* ptr, sizet oldSize, sizet newSize, sizet alignment) override;
+
+	/**
+	 * @return sizet - The number of bytes currently allocated.
+	 */
+	sizet LiveBytes() const { return this->m_LiveBytes.load(std::memory_order_relaxed); }
+	/**
+	 * @return sizet - The highest number of bytes allocated at once since Init or ResetPeak.
+	 */
+	sizet PeakBytes() const { return this->m_PeakBytes.load(std::memory_order_relaxed); }
+	/**
+	 * @brief Resets the peak to the current live bytes.
+	 */
+	void ResetPeak() { this->m_PeakBytes.store(LiveBytes(), std::memory_order_relaxed); }
+
+	/**
+	 * @return const MemoryBudget& - The budget of the allocator.
+	 */
+	const MemoryBudget& Budget() const { return this->m_Budget; }
+	/**
+	 * @brief Sets the budget of the allocator.
+	 * 
+	 * @param budget The MemoryBudget.
+	 */
+	void SetBudget(const MemoryBudget& budget) { this->m_Budget = budget; }
+	/**
+	 * @brief Sets the callback to call when a budget is crossed.
+	 * 
+	 * @param callback The MemoryBudgetCallback, nullptr to only log.
+	 */
+	void SetBudgetCallback(MemoryBudgetCallback callback) { this->m_BudgetCallback = callback; }
+
+private:
+	/**
+	 * @brief Calls the soft budget callback on an upward crossing and raises the peak.
+	 * 
+	 * @param previous The live bytes before the allocation.
+	 * @param live The live bytes after the allocation.
+	 */
+	void OnGrowth(sizet previous, sizet live);
+	/**
+	 * @brief Reports a refused allocation to the budget callback, or logs it.
+	 * 
+	 * @param live The live bytes the allocation would have reached.
+	 * @param size The requested size in bytes.
+	 */
+	void OnHardBudget(sizet live, sizet size);
+
+private:
+	HeapAllocator* p_Parent = nullptr; /** @brief The heap the memory comes from. */
+
+	MemoryBudget m_Budget; /** @brief The soft and hard budget. */
+	MemoryBudgetCallback m_BudgetCallback = nullptr; /** @brief Called when a budget is crossed. */
+
+	alignas(OC_CACHE_LINE_SIZE) std::atomic<sizet> m_LiveBytes; /** @brief The bytes currently allocated, on its own cache line. */
+	std::atomic<sizet> m_PeakBytes; /** @brief The highest value of m_LiveBytes. */
+
+};	// TaggedAllocator
 
 
 
@@ -366,7 +1031,19 @@ public:
  */
 struct MemoryServiceConfig {
 
-	sizet MaxDynamicSize = omega(16); /** @brief Default size of 16MB of dynamic memory. */
+	sizet MaxDynamicSize = omega(16); /** @brief Default size of 16MB for the initial pool of dynamic memory. */
+	sizet DynamicGrowSize = omega(16); /** @brief The minimum size of each pool added once the dynamic memory runs out. */
+	sizet DirectMapThreshold = HeapAllocator::k_DirectMapThreshold; /** @brief Allocations from this size on are mapped directly from the OS. */
+
+	b8 ThreadCaching = true; /** @brief Enables per-thread allocation caches in front of the system heap. */
+
+	sizet FrameAllocatorSize = omega(4); /** @brief Default size of 4MB for each frame arena. */
+	u8 FrameBufferCount = 2; /** @brief The number of frame arenas, memory from a frame stays valid for this many frames. */
+
+	sizet ScratchStackSize = omega(1); /** @brief Default size of 1MB for the scratch stack of each thread. */
+
+	MemoryBudget Budgets[MEMORY_TAG_COUNT] = { }; /** @brief The budget of each tag allocator, unlimited by default. MEMORY_TAG_FRAME is unused. */
+	MemoryBudgetCallback BudgetCallback = nullptr; /** @brief Called when a tag allocator crosses a budget. */
 
 };	// MemoryServiceConfig
 
@@ -375,7 +1052,11 @@ struct MemoryServiceConfig {
  */
 class MemoryService : public Service {
 public:
-	MemoryService() : m_SystemAllocator(), m_MallocAllocator() { }
+	/** @brief The maximum number of frame arenas. */
+	OC_STATIC_EXPR u8 k_MaxFrameBuffers = 4;
+
+public:
+	MemoryService();
 	~MemoryService() = default;
 
 	/**
@@ -399,15 +1080,58 @@ public:
 	/**
 	 * @brief Get's the system allocator of Ocean. I.e. the allocator used internally.
 	 * 
-	 * @return Allocator* 
+	 * @note The concrete allocators are final, so calls through the returned pointer are not virtual.
+	 * 
+	 * @return HeapAllocator* 
 	 */
-	Allocator* SystemAllocator()    { return &m_SystemAllocator; }
+	HeapAllocator* SystemAllocator()      { return &m_SystemAllocator; }
 	/**
 	 * @brief Get's the system allocator of the System. Which is unmanaged by Ocean.
 	 * 
-	 * @return Allocator* 
+	 * @return MallocAllocator* 
+	 */
+	MallocAllocator* UnmanagedAllocator() { return &m_MallocAllocator; }
+	/**
+	 * @brief Get's the frame allocator of the current frame. Memory from it is released automatically after FrameBufferCount frames.
+	 * 
+	 * @note Deallocate is a no-op on the frame allocator, and it must only be used from the main thread.
+	 * 
+	 * @return LinearAllocator* 
+	 */
+	LinearAllocator* FrameAllocator()     { return &m_FrameAllocators[m_FrameIndex]; }
+	/**
+	 * @brief Get's the allocator of a subsystem's MemoryTag. Its memory comes from the system allocator, but is
+	 * counted and budgeted per tag.
+	 * 
+	 * @note MEMORY_TAG_FRAME has no tag allocator, use FrameAllocator() instead.
+	 * 
+	 * @param tag The MemoryTag of the subsystem.
+	 * @return TaggedAllocator* 
+	 */
+	TaggedAllocator* TagAllocator(MemoryTag tag);
+	/**
+	 * @brief Get's the scratch stack of the calling thread, created on first use and freed when the thread exits.
+	 * 
+	 * @note Open a ScopedArena on it for temporary work instead of allocating from it directly.
+	 * 
+	 * @return StackAllocator* 
+	 */
+	StackAllocator* ScratchStack();
+
+	/**
+	 * @brief Ends the current frame, records its high water mark and resets the oldest frame arena for reuse.
+	 * When profiling is enabled this is also where the AllocationProfiler samples its peaks.
 	 */
-	Allocator* UnmanagedAllocator() { return &m_MallocAllocator; }
+	void EndFrame();
+
+	/**
+	 * @return sizet - The number of frame allocator bytes used by the last completed frame.
+	 */
+	sizet FrameHighWaterMark() const { return m_FrameHighWaterMark; }
+	/**
+	 * @return sizet - The largest number of frame allocator bytes used by any completed frame.
+	 */
+	sizet PeakFrameHighWaterMark() const { return m_PeakFrameHighWaterMark; }
 
 	/**
 	 * @brief Get's the name of the MemoryService.
@@ -422,26 +1146,44 @@ private:
 	HeapAllocator   m_SystemAllocator; /** @brief The HeapAllocator for Ocean's core allocations. */
 	MallocAllocator m_MallocAllocator; /** @brief The unmanaged allocator that uses malloc and free. */
 
-};	// MemoryService
+	TaggedAllocator m_TagAllocators[MEMORY_TAG_COUNT]; /** @brief The per subsystem allocators, indexed by MemoryTag. */
 
-/** @todo STL compliant allocator that routes to Ocean allocators. Example code at: https://howardhinnant.github.io/allocator_boilerplate.html */
+	LinearAllocator m_FrameAllocators[k_MaxFrameBuffers]; /** @brief The per-frame arenas, cycled through each frame. */
+	u8 m_FrameBufferCount = 0; /** @brief The number of frame arenas in use. */
+	u8 m_FrameIndex = 0; /** @brief The index of the current frame arena. */
+
+	sizet m_ScratchStackSize = omega(1); /** @brief The size of each thread's scratch stack. */
+
+	sizet m_FrameHighWaterMark = 0; /** @brief The bytes used by the last completed frame. */
+	sizet m_PeakFrameHighWaterMark = 0; /** @brief The most bytes used by any completed frame. */
+
+};	// MemoryService
 
 /** @brief Macro to get the system allocator from the MemoryService. */
 #define oSystemAllocator                     MemoryService::Instance().SystemAllocator()
 /** @brief Macro to get the unmanaged allocator from the MemoryService. */
 #define oUnmanagedAllocator                  MemoryService::Instance().UnmanagedAllocator()
+/** @brief Macro to get the current frame allocator from the MemoryService. */
+#define oFrameAllocator                      MemoryService::Instance().FrameAllocator()
+/** @brief Macro to get the allocator of the given MemoryTag from the MemoryService. */
+#define oTagAllocator(tag)                   MemoryService::Instance().TagAllocator(tag)
+/** @brief Macro to get the scratch stack of the calling thread from the MemoryService. */
+#define oScratchStack                        MemoryService::Instance().ScratchStack()
 
 #if OC_DETAILED_ALLOCATIONS && OC_VERBOSE
 
 	/** @brief Macro to allocate a chunk of memory of the given size from the given allocator. (VERBOSE implementation). @returns void* */
-	#define oalloca(size, allocator)			 ((allocator)->Allocate(size, 1)); oprintret(OCEAN_FUNCTIONLINE("Allocation Made!"))
+	#define oalloca(size, allocator)			 (OC_PROFILE_CALL_SITE(size), (allocator)->Allocate(size, 1)); oprintret(OCEAN_FUNCTIONLINE("Allocation Made!"))
 	/** @brief Macro to allocate a chunk of memory of the given size from the given allocator. (VERBOSE implementation). @returns u8* */
-	#define oallocam(size, allocator)			 (static_cast<u8*>((allocator)->Allocate(size, 1)); oprintret(OCEAN_FUNCTIONLINE("Mapped Allocation Made!"))
+	#define oallocam(size, allocator)			 (OC_PROFILE_CALL_SITE(size), static_cast<u8*>((allocator)->Allocate(size, 1))); oprintret(OCEAN_FUNCTIONLINE("Mapped Allocation Made!"))
 	/** @brief Macro to allocate an array of memory of the given type and count from the given allocator. (VERBOSE implementation). @returns type* */
-	#define oallocat(type, count, allocator)	 (static_cast<type*>((allocator)->Allocate(sizeof(type) * count, alignof(type)))); oprintret(OCEAN_FUNCTIONLINE("Type Allocation Made!"))
+	#define oallocat(type, count, allocator)	 (OC_PROFILE_CALL_SITE(sizeof(type) * count), static_cast<type*>((allocator)->Allocate(sizeof(type) * count, alignof(type)))); oprintret(OCEAN_FUNCTIONLINE("Type Allocation Made!"))
 
 	/** @brief Macro to allocate a chunk of memory of the given size from the given allocator with the given alignment. (VERBOSE implementation). @returns void* */
-	#define oallocaa(size, allocator, alignment) ((allocator)->Allocate(size, alignment)); oprintret(OCEAN_FUNCTIONLINE("Aligned Allocation Made!"))
+	#define oallocaa(size, allocator, alignment) (OC_PROFILE_CALL_SITE(size), (allocator)->Allocate(size, alignment)); oprintret(OCEAN_FUNCTIONLINE("Aligned Allocation Made!"))
+
+	/** @brief Macro to resize an array of the given type from oldCount to newCount elements in the given allocator. (VERBOSE implementation). @returns type* */
+	#define oreallocat(pointer, type, oldCount, newCount, allocator) (OC_PROFILE_CALL_SITE(sizeof(type) * (newCount)), static_cast<type*>((allocator)->Reallocate(pointer, sizeof(type) * (oldCount), sizeof(type) * (newCount), alignof(type)))); oprintret(OCEAN_FUNCTIONLINE("Reallocation Made!"))
 
 	/** @brief Macro to deallocate a chunk of memory from the given allocator with the given pointer. (VERBOSE implementation). */
 	#define ofree(pointer, allocator)			 ((allocator)->Deallocate(pointer)); oprintret(OCEAN_FUNCTIONLINE("Memory Freed!"))
@@ -449,14 +1191,17 @@ private:
 #else
 
 	/** @brief Macro to allocate a chunk of memory of the given size from the given allocator. @returns void* */
-	#define oalloca(size, allocator)			 ((allocator)->Allocate(size, 1))
+	#define oalloca(size, allocator)			 (OC_PROFILE_CALL_SITE(size), (allocator)->Allocate(size, 1))
 	/** @brief Macro to allocate a chunk of memory of the given size from the given allocator. @returns u8* */
-	#define oallocam(size, allocator)			 (static_cast<u8*>((allocator)->Allocate(size, 1))
+	#define oallocam(size, allocator)			 (OC_PROFILE_CALL_SITE(size), static_cast<u8*>((allocator)->Allocate(size, 1)))
 	/** @brief Macro to allocate an array of memory of the given type and count from the given allocator. @returns type* */
-	#define oallocat(type, count, allocator)	 (static_cast<type*>((allocator)->Allocate(sizeof(type) * count, alignof(type))))
+	#define oallocat(type, count, allocator)	 (OC_PROFILE_CALL_SITE(sizeof(type) * count), static_cast<type*>((allocator)->Allocate(sizeof(type) * count, alignof(type))))
 
 	/** @brief Macro to allocate a chunk of memory of the given size from the given allocator with the given alignment. @returns void* */
-	#define oallocaa(size, allocator, alignment) ((allocator)->Allocate(size, alignment))
+	#define oallocaa(size, allocator, alignment) (OC_PROFILE_CALL_SITE(size), (allocator)->Allocate(size, alignment))
+
+	/** @brief Macro to resize an array of the given type from oldCount to newCount elements in the given allocator. @returns type* */
+	#define oreallocat(pointer, type, oldCount, newCount, allocator) (OC_PROFILE_CALL_SITE(sizeof(type) * (newCount)), static_cast<type*>((allocator)->Reallocate(pointer, sizeof(type) * (oldCount), sizeof(type) * (newCount), alignof(type))))
 
 	/** @brief Macro to deallocate a chunk of memory from the given allocator with the given pointer. */
 	#define ofree(pointer, allocator)			 ((allocator)->Deallocate(pointer))
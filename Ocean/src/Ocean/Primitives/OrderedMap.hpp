@@ -0,0 +1,1307 @@
+#pragma once
+
+/**
+ * @file OrderedMap.hpp
+ * @brief A B+ tree ordered map.
+ *
+ * @details Every entry lives in a leaf, and each leaf stores its keys and values in two packed arrays. The inner nodes
+ * only hold separator keys and child pointers. A lookup then binary searches a few cache lines of keys per level
+ * instead of chasing one node per comparison like a red-black tree. The leaves are linked in key order, so iterating
+ * is a walk over packed arrays.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+#include "Ocean/Types/Iterator.hpp"
+
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
+#include "Ocean/Primitives/DynamicArray.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Memory.hpp"
+#include "Ocean/Primitives/Relocatable.hpp"
+
+// std
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief The default number of keys in an OrderedMap node, enough for the keys to fill four cache lines.
+ *
+ * @tparam K The key type.
+ * @return sizet
+ */
+template <class K>
+constexpr sizet DefaultOrderedMapFanout() {
+    const sizet fanout = (4 * OC_CACHE_LINE_SIZE) / sizeof(K);
+
+    return fanout < 8 ? 8 : (fanout > 128 ? 128 : fanout);
+}
+
+/**
+ * @brief An ordered map stored as a B+ tree.
+ *
+ * @details A node holds up to F keys and, apart from the root, at least F / 2. Inserts and erases move entries
+ * between nodes, so they invalidate iterators and references into the map.
+ *
+ * @tparam K The key type.
+ * @tparam T The value type.
+ * @tparam C The key ordering.
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
+ * @tparam F The most keys in a node.
+ */
+template <class K, class T, class C = std::less<K>, class A = MallocPolicy, sizet F = DefaultOrderedMapFanout<K>()>
+class OrderedMap {
+    static_assert(F >= 4, "An OrderedMap node needs room for at least 4 keys.");
+    static_assert(F < 0xFFFF, "An OrderedMap node counts its keys with a u16.");
+
+private:
+    /** @brief The fewest keys a node other than the root holds. */
+    OC_STATIC_EXPR sizet k_MinKeys = F / 2;
+    /** @brief The deepest a tree can get, every inner node below the root has at least 3 children. */
+    OC_STATIC_EXPR sizet k_MaxDepth = 48;
+
+    /** @brief The part shared by the leaves and the inner nodes. */
+    struct Node {
+        /** @brief The number of keys in the node. */
+        u16 count;
+        /** @brief True if the node is a Leaf. */
+        b8 leaf;
+
+    };  // Node
+
+    /** @brief A node holding entries, linked to its neighbours in key order. */
+    struct Leaf : Node {
+        /** @brief The previous leaf in key order. */
+        Leaf* prev;
+        /** @brief The next leaf in key order. */
+        Leaf* next;
+
+        /** @brief The keys, sorted. */
+        alignas(K) u8 keyStorage[F * sizeof(K)];
+        /** @brief The values, in the order of their keys. */
+        alignas(T) u8 valueStorage[F * sizeof(T)];
+
+        K* Keys() { return reinterpret_cast<K*>(this->keyStorage); }
+        T* Values() { return reinterpret_cast<T*>(this->valueStorage); }
+
+    };  // Leaf
+
+    /** @brief A node routing to count + 1 children. Child i holds the keys in [keys[i - 1], keys[i]). */
+    struct Inner : Node {
+        /** @brief The children. */
+        Node* children[F + 1];
+
+        /** @brief The separator keys, sorted. */
+        alignas(K) u8 keyStorage[F * sizeof(K)];
+
+        K* Keys() { return reinterpret_cast<K*>(this->keyStorage); }
+
+    };  // Inner
+
+    /** @brief An inner node passed on the way down, and the child that was taken. */
+    struct PathStep {
+        Inner* node;
+        sizet index;
+
+    };  // PathStep
+
+public:
+    /** @brief The key and value of an entry, as returned by the iterators. */
+    struct Reference {
+        const K& key;
+        T& value;
+
+    };  // Reference
+
+    /** @brief The key and value of an entry, as returned by the const iterators. */
+    struct ConstReference {
+        const K& key;
+        const T& value;
+
+    };  // ConstReference
+
+    /**
+     * @brief A bidirectional iterator over the entries in key order.
+     *
+     * @tparam Const True for a ConstIterator.
+     */
+    template <b8 Const>
+    class BasicIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using reference = std::conditional_t<Const, ConstReference, Reference>;
+        using value_type = reference;
+        using difference_type = std::ptrdiff_t;
+
+        /** @brief Lets operator -> return an entry that only exists as a Reference. */
+        struct Arrow {
+            reference entry;
+
+            const reference* operator -> () const { return &this->entry; }
+
+        };  // Arrow
+
+        using pointer = Arrow;
+
+    public:
+        BasicIterator() :
+            p_Leaf(nullptr),
+            m_Index(0)
+        { }
+        BasicIterator(Leaf* leaf, sizet index) :
+            p_Leaf(leaf),
+            m_Index(index)
+        { }
+        /**
+         * @brief Converts an Iterator to a ConstIterator.
+         *
+         * @param other The Iterator.
+         */
+        template <b8 OtherConst, class = std::enable_if_t<Const && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) :
+            p_Leaf(other.p_Leaf),
+            m_Index(other.m_Index)
+        { }
+
+        reference operator * () const {
+            return { this->p_Leaf->Keys()[this->m_Index], this->p_Leaf->Values()[this->m_Index] };
+        }
+        Arrow operator -> () const {
+            return { **this };
+        }
+
+        BasicIterator& operator ++ () {
+            // The end of the map is one past the last entry of the last leaf, so that it can be decremented.
+            //
+            if (++this->m_Index == this->p_Leaf->count && this->p_Leaf->next) {
+                this->p_Leaf = this->p_Leaf->next;
+                this->m_Index = 0;
+            }
+
+            return *this;
+        }
+        BasicIterator operator ++ (int) {
+            BasicIterator previous = *this;
+            ++*this;
+
+            return previous;
+        }
+        BasicIterator& operator -- () {
+            if (this->m_Index == 0) {
+                this->p_Leaf = this->p_Leaf->prev;
+                this->m_Index = this->p_Leaf->count;
+            }
+
+            --this->m_Index;
+
+            return *this;
+        }
+        BasicIterator operator -- (int) {
+            BasicIterator previous = *this;
+            --*this;
+
+            return previous;
+        }
+
+        b8 operator == (const BasicIterator& other) const {
+            return this->p_Leaf == other.p_Leaf && this->m_Index == other.m_Index;
+        }
+        b8 operator != (const BasicIterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        template <b8>
+        friend class BasicIterator;
+
+        friend class OrderedMap;
+
+    private:
+        /** @brief The leaf of the entry. */
+        Leaf* p_Leaf;
+        /** @brief The index of the entry in the leaf. */
+        sizet m_Index;
+
+    };  // BasicIterator
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    /** @brief The most keys in a node. */
+    OC_STATIC_EXPR sizet k_Fanout = F;
+
+public:
+    inline OrderedMap() :
+        m_Allocator(),
+        m_Compare(),
+        p_Root(nullptr),
+        p_First(nullptr),
+        p_Last(nullptr),
+        m_Size(0),
+        m_Height(0)
+    { }
+    /**
+     * @brief Construct a new empty OrderedMap that allocates from the given allocator.
+     *
+     * @param allocator The allocator policy to use.
+     */
+    inline explicit OrderedMap(const A& allocator) :
+        m_Allocator(allocator),
+        m_Compare(),
+        p_Root(nullptr),
+        p_First(nullptr),
+        p_Last(nullptr),
+        m_Size(0),
+        m_Height(0)
+    { }
+    /**
+     * @brief Construct a new OrderedMap from another OrderedMap, using the same allocator. The copy is bulk loaded,
+     * so its leaves are packed.
+     *
+     * @param other The OrderedMap to copy from.
+     */
+    inline OrderedMap(const OrderedMap& other) :
+        m_Allocator(other.m_Allocator),
+        m_Compare(other.m_Compare),
+        p_Root(nullptr),
+        p_First(nullptr),
+        p_Last(nullptr),
+        m_Size(0),
+        m_Height(0)
+    {
+        BuildSorted(other.Begin(), other.m_Size);
+    }
+    /**
+     * @brief Move an OrderedMap to a new OrderedMap.
+     *
+     * @param other The OrderedMap to move from.
+     */
+    inline OrderedMap(OrderedMap&& other) :
+        m_Allocator(other.m_Allocator),
+        m_Compare(std::move(other.m_Compare)),
+        p_Root(other.p_Root),
+        p_First(other.p_First),
+        p_Last(other.p_Last),
+        m_Size(other.m_Size),
+        m_Height(other.m_Height)
+    {
+        other.Forget();
+    }
+    /**
+     * @brief Construct a new OrderedMap from an initial list of entries, later duplicates of a key are ignored.
+     *
+     * @param list The keys and values to insert.
+     */
+    inline OrderedMap(std::initializer_list<std::pair<K, T>> list) :
+        OrderedMap()
+    {
+        for (const std::pair<K, T>& pair : list)
+            Emplace(pair.first, pair.second);
+    }
+    inline ~OrderedMap() {
+        Clear();
+    }
+
+    inline OrderedMap& operator = (const OrderedMap& other) {
+        if (this != &other) {
+            Clear();
+
+            this->m_Allocator = other.m_Allocator;
+            this->m_Compare = other.m_Compare;
+
+            BuildSorted(other.Begin(), other.m_Size);
+        }
+
+        return *this;
+    }
+    inline OrderedMap& operator = (OrderedMap&& other) {
+        if (this != &other) {
+            Clear();
+
+            this->m_Allocator = other.m_Allocator;
+            this->m_Compare = std::move(other.m_Compare);
+
+            this->p_Root = other.p_Root;
+            this->p_First = other.p_First;
+            this->p_Last = other.p_Last;
+            this->m_Size = other.m_Size;
+            this->m_Height = other.m_Height;
+
+            other.Forget();
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Finds the entry of a key.
+     *
+     * @param key The key to look for.
+     * @return Iterator - The entry, or End() if the key is not in the OrderedMap.
+     */
+    inline Iterator Find(const K& key) {
+        const Iterator it = LowerBound(key);
+
+        return (it != End() && !this->m_Compare(key, (*it).key)) ? it : End();
+    }
+    /**
+     * @brief Finds the entry of a key.
+     *
+     * @param key The key to look for.
+     * @return ConstIterator - The entry, or End() if the key is not in the OrderedMap.
+     */
+    inline ConstIterator Find(const K& key) const {
+        return const_cast<OrderedMap*>(this)->Find(key);
+    }
+
+    /**
+     * @param key The key to look for.
+     * @return b8 - True if the key is in the OrderedMap, False otherwise.
+     */
+    inline b8 Contains(const K& key) const {
+        return Find(key) != End();
+    }
+
+    /**
+     * @brief Gets the value of a key, throwing if it is not in the OrderedMap.
+     *
+     * @param key The key to look for.
+     * @return T&
+     */
+    inline T& At(const K& key) {
+        const Iterator it = Find(key);
+        if (it == End())
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Key is not in the OrderedMap!");
+
+        return (*it).value;
+    }
+    /**
+     * @brief Gets the value of a key, throwing if it is not in the OrderedMap.
+     *
+     * @param key The key to look for.
+     * @return const T&
+     */
+    inline const T& At(const K& key) const {
+        return const_cast<OrderedMap*>(this)->At(key);
+    }
+
+    /**
+     * @brief Gets the value of a key, inserting a value initialized one if the key is not in the OrderedMap.
+     *
+     * @param key The key to look for.
+     * @return T&
+     */
+    inline T& operator [] (const K& key) {
+        return (*Emplace(key).first).value;
+    }
+    /**
+     * @brief Gets the value of a key, inserting a value initialized one if the key is not in the OrderedMap.
+     *
+     * @param key The key to look for.
+     * @return T&
+     */
+    inline T& operator [] (K&& key) {
+        return (*Emplace(std::move(key)).first).value;
+    }
+
+    /**
+     * @brief Gets the first entry whose key is not less than the given key.
+     *
+     * @param key The key to search for.
+     * @return Iterator - The entry, or End() if every key is less.
+     */
+    inline Iterator LowerBound(const K& key) {
+        if (!this->p_Root)
+            return End();
+
+        Leaf* leaf = Descend(key, nullptr);
+
+        return MakeIterator(leaf, LowerIndex(leaf, key));
+    }
+    /**
+     * @copydoc LowerBound()
+     */
+    inline ConstIterator LowerBound(const K& key) const {
+        return const_cast<OrderedMap*>(this)->LowerBound(key);
+    }
+    /**
+     * @brief Gets the first entry whose key is greater than the given key.
+     *
+     * @param key The key to search for.
+     * @return Iterator - The entry, or End() if no key is greater.
+     */
+    inline Iterator UpperBound(const K& key) {
+        if (!this->p_Root)
+            return End();
+
+        Leaf* leaf = Descend(key, nullptr);
+
+        return MakeIterator(leaf, UpperIndex(leaf->Keys(), leaf->count, key));
+    }
+    /**
+     * @copydoc UpperBound()
+     */
+    inline ConstIterator UpperBound(const K& key) const {
+        return const_cast<OrderedMap*>(this)->UpperBound(key);
+    }
+
+    /**
+     * @brief Gets the entries with keys in [from, to).
+     *
+     * @param from The first key of the range.
+     * @param to The key that ends the range.
+     * @return IteratorRange<Iterator>
+     */
+    inline IteratorRange<Iterator> Range(const K& from, const K& to) {
+        if (!this->m_Compare(from, to))
+            return { End(), End() };
+
+        return { LowerBound(from), LowerBound(to) };
+    }
+    /**
+     * @copydoc Range()
+     */
+    inline IteratorRange<ConstIterator> Range(const K& from, const K& to) const {
+        if (!this->m_Compare(from, to))
+            return { End(), End() };
+
+        return { LowerBound(from), LowerBound(to) };
+    }
+
+    /**
+     * @brief Inserts a key and value if the key is not already in the OrderedMap.
+     *
+     * @param key The key.
+     * @param value The value.
+     * @return std::pair<Iterator, b8> - The entry of the key, and True if it was inserted.
+     */
+    inline std::pair<Iterator, b8> Insert(const K& key, const T& value) {
+        return Emplace(key, value);
+    }
+
+    /**
+     * @brief Constructs a value for the key in place, if the key is not already in the OrderedMap. The arguments are
+     * left untouched when the key exists.
+     *
+     * @tparam L The key argument type, a K is only constructed from it when inserting.
+     * @tparam Args
+     * @param key The key.
+     * @param args The type T constructor arguments.
+     * @return std::pair<Iterator, b8> - The entry of the key, and True if it was inserted.
+     */
+    template <class L, class ... Args>
+    std::pair<Iterator, b8> Emplace(L&& key, Args&& ... args) {
+        if (!this->p_Root) {
+            Leaf* root = NewLeaf();
+
+            this->p_Root = root;
+            this->p_First = root;
+            this->p_Last = root;
+        }
+
+        PathStep path[k_MaxDepth];
+
+        Leaf* leaf = Descend(key, path);
+        sizet index = LowerIndex(leaf, key);
+
+        if (index < leaf->count && !this->m_Compare(key, leaf->Keys()[index]))
+            return { Iterator(leaf, index), false };
+
+        // The arguments may refer to an entry that a split moves, so the entry is built first.
+        //
+        StagedValue<K> stagedKey(std::forward<L>(key));
+        StagedValue<T> stagedValue(std::forward<Args>(args)...);
+
+        if (leaf->count == F) {
+            Leaf* right = SplitLeaf(leaf, path);
+
+            if (index > leaf->count) {
+                index -= leaf->count;
+                leaf = right;
+            }
+        }
+
+        Relocate(leaf->Keys() + index + 1, leaf->Keys() + index, leaf->count - index);
+        Relocate(leaf->Values() + index + 1, leaf->Values() + index, leaf->count - index);
+
+        stagedKey.RelocateTo(&leaf->Keys()[index]);
+        stagedValue.RelocateTo(&leaf->Values()[index]);
+
+        leaf->count++;
+        this->m_Size++;
+
+        return { Iterator(leaf, index), true };
+    }
+
+    /**
+     * @brief Assigns the value of a key, inserting the key if it is not in the OrderedMap.
+     *
+     * @param key The key.
+     * @param value The value.
+     * @return std::pair<Iterator, b8> - The entry of the key, and True if it was inserted.
+     */
+    template <class L, class V>
+    std::pair<Iterator, b8> InsertOrAssign(L&& key, V&& value) {
+        std::pair<Iterator, b8> result = Emplace(std::forward<L>(key), std::forward<V>(value));
+
+        if (!result.second)
+            (*result.first).value = std::forward<V>(value);
+
+        return result;
+    }
+
+    /**
+     * @brief Erases the entry of a key.
+     *
+     * @param key The key to erase.
+     * @return b8 - True if the key was erased, False if it was not in the OrderedMap.
+     */
+    b8 Erase(const K& key) {
+        if (!this->p_Root)
+            return false;
+
+        PathStep path[k_MaxDepth];
+
+        Leaf* leaf = Descend(key, path);
+        const sizet index = LowerIndex(leaf, key);
+
+        if (index == leaf->count || this->m_Compare(key, leaf->Keys()[index]))
+            return false;
+
+        leaf->Keys()[index].~K();
+        leaf->Values()[index].~T();
+
+        Relocate(leaf->Keys() + index, leaf->Keys() + index + 1, leaf->count - index - 1);
+        Relocate(leaf->Values() + index, leaf->Values() + index + 1, leaf->count - index - 1);
+
+        leaf->count--;
+        this->m_Size--;
+
+        // Separators equal to the erased key can stay, they still split the keys correctly.
+        //
+        if (this->m_Height == 0) {
+            if (leaf->count == 0) {
+                FreeNode(leaf);
+                Forget();
+            }
+        }
+        else if (leaf->count < k_MinKeys) {
+            RebalanceLeaf(leaf, path);
+        }
+
+        return true;
+    }
+    /**
+     * @brief Erases the entry at the iterator.
+     *
+     * @param position The entry to erase.
+     * @return Iterator - The entry after the erased one.
+     */
+    inline Iterator Erase(ConstIterator position) {
+        Leaf* leaf = position.p_Leaf;
+        const sizet index = position.m_Index;
+
+        // A leaf with entries to spare needs no rebalancing, so there is no path to look up.
+        //
+        if (leaf->count > k_MinKeys && this->m_Height > 0) {
+            leaf->Keys()[index].~K();
+            leaf->Values()[index].~T();
+
+            Relocate(leaf->Keys() + index, leaf->Keys() + index + 1, leaf->count - index - 1);
+            Relocate(leaf->Values() + index, leaf->Values() + index + 1, leaf->count - index - 1);
+
+            leaf->count--;
+            this->m_Size--;
+
+            return MakeIterator(leaf, index);
+        }
+
+        const K key((*position).key);
+
+        Erase(key);
+
+        return UpperBound(key);
+    }
+
+    /**
+     * @brief Erases every entry and frees the nodes.
+     */
+    inline void Clear() {
+        if (this->p_Root)
+            FreeSubtree(this->p_Root);
+
+        Forget();
+    }
+
+    /**
+     * @brief Replaces the contents with entries in strictly increasing key order, building packed leaves bottom up
+     * without any searching or splitting.
+     *
+     * @tparam It A forward iterator over pairs, the key in first and the value in second.
+     * @param first The first entry.
+     * @param last One past the last entry.
+     */
+    template <class It>
+    void BulkLoad(It first, It last) {
+        sizet count = 0;
+
+        // The previous entry is kept by hand, a forward iterator can't step back.
+        //
+        for (It it = first, previous = first; it != last; previous = it, ++it, count++) {
+            if (count && !this->m_Compare(previous->first, it->first))
+                throw Ocean::Exception(Ocean::Error::INVALID_ARGUMENT, "OrderedMap::BulkLoad needs keys in strictly increasing order!");
+        }
+
+        Clear();
+
+        BuildSorted(PairAdapter<It>{ first }, count);
+    }
+
+    /**
+     * @brief Gets a Iterator to the entry with the smallest key.
+     *
+     * @return Iterator
+     */
+    inline Iterator Begin() { return Iterator(this->p_First, 0); }
+    inline Iterator begin() { return Begin(); }
+    /**
+     * @brief Gets a ConstIterator to the entry with the smallest key.
+     *
+     * @return ConstIterator
+     */
+    inline ConstIterator Begin() const { return ConstIterator(this->p_First, 0); }
+    inline ConstIterator begin() const { return Begin(); }
+    /**
+     * @brief Gets a Iterator past the entry with the largest key.
+     *
+     * @return Iterator
+     */
+    inline Iterator End() { return Iterator(this->p_Last, this->p_Last ? this->p_Last->count : 0); }
+    inline Iterator end() { return End(); }
+    /**
+     * @brief Gets a ConstIterator past the entry with the largest key.
+     *
+     * @return ConstIterator
+     */
+    inline ConstIterator End() const { return ConstIterator(this->p_Last, this->p_Last ? this->p_Last->count : 0); }
+    inline ConstIterator end() const { return End(); }
+
+    /**
+     * @return A - The allocator policy of the OrderedMap.
+     */
+    inline A GetAllocator() const { return this->m_Allocator; }
+
+    /**
+     * @return b8 - True if the OrderedMap has no entries, False otherwise.
+     */
+    inline b8 Empty() const { return this->m_Size == 0; }
+    /**
+     * @return sizet - The number of entries.
+     */
+    inline sizet Size() const { return this->m_Size; }
+    /**
+     * @return sizet - The number of inner node levels above the leaves.
+     */
+    inline sizet Height() const { return this->m_Height; }
+
+private:
+    /** @brief Reads the entries of a BulkLoad input the way the iterators of an OrderedMap are read. */
+    template <class It>
+    struct PairAdapter {
+        It it;
+
+        ConstReference operator * () const { return { this->it->first, this->it->second }; }
+        PairAdapter& operator ++ () { ++this->it; return *this; }
+
+    };  // PairAdapter
+
+    /**
+     * @brief Moves count objects to memory that may overlap, ending the lifetime of the sources. The destination
+     * slots must not hold live objects except where they overlap the sources.
+     *
+     * @tparam U The object type.
+     * @param destination The first destination.
+     * @param source The first source.
+     * @param count The number of objects.
+     */
+    template <class U>
+    OC_STATIC void Relocate(U* destination, U* source, sizet count) {
+        if (count == 0 || destination == source)
+            return;
+
+        if constexpr (IsTriviallyRelocatable_v<U>) {
+            memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(U));
+        }
+        else if (destination < source) {
+            for (sizet i = 0; i < count; i++) {
+                new (&destination[i]) U(std::move(source[i]));
+
+                source[i].~U();
+            }
+        }
+        else {
+            for (sizet i = count; i-- > 0; ) {
+                new (&destination[i]) U(std::move(source[i]));
+
+                source[i].~U();
+            }
+        }
+    }
+
+    /**
+     * @return sizet - The index of the first of count keys that is not less than the key.
+     */
+    template <class L>
+    inline sizet LowerIndex(Leaf* leaf, const L& key) const {
+        return static_cast<sizet>(std::lower_bound(leaf->Keys(), leaf->Keys() + leaf->count, key, this->m_Compare) - leaf->Keys());
+    }
+    /**
+     * @return sizet - The index of the first of count keys that is greater than the key.
+     */
+    template <class L>
+    inline sizet UpperIndex(K* keys, sizet count, const L& key) const {
+        return static_cast<sizet>(std::upper_bound(keys, keys + count, key, this->m_Compare) - keys);
+    }
+
+    /**
+     * @brief Walks from the root to the leaf that holds or would hold a key.
+     *
+     * @param key The key.
+     * @param path Receives the inner nodes on the way, it may be nullptr.
+     * @return Leaf*
+     */
+    template <class L>
+    Leaf* Descend(const L& key, PathStep* path) const {
+        Node* node = this->p_Root;
+
+        for (sizet depth = 0; !node->leaf; depth++) {
+            Inner* inner = static_cast<Inner*>(node);
+            const sizet index = UpperIndex(inner->Keys(), inner->count, key);
+
+            if (path)
+                path[depth] = { inner, index };
+
+            node = inner->children[index];
+        }
+
+        return static_cast<Leaf*>(node);
+    }
+
+    /**
+     * @brief Makes an iterator from a position that may be one past the end of a leaf.
+     *
+     * @param leaf The leaf.
+     * @param index The index in the leaf.
+     * @return Iterator
+     */
+    inline Iterator MakeIterator(Leaf* leaf, sizet index) const {
+        if (index == leaf->count && leaf->next)
+            return Iterator(leaf->next, 0);
+
+        return Iterator(leaf, index);
+    }
+
+    /**
+     * @brief Moves the upper half of a full leaf to a new leaf after it.
+     *
+     * @param leaf The full leaf.
+     * @param path The inner nodes above the leaf.
+     * @return Leaf* - The new leaf.
+     */
+    Leaf* SplitLeaf(Leaf* leaf, PathStep* path) {
+        Leaf* right = NewLeaf();
+
+        const sizet middle = F / 2;
+
+        Relocate(right->Keys(), leaf->Keys() + middle, F - middle);
+        Relocate(right->Values(), leaf->Values() + middle, F - middle);
+
+        right->count = static_cast<u16>(F - middle);
+        leaf->count = static_cast<u16>(middle);
+
+        right->prev = leaf;
+        right->next = leaf->next;
+
+        if (leaf->next)
+            leaf->next->prev = right;
+        else
+            this->p_Last = right;
+
+        leaf->next = right;
+
+        InsertSeparator(path, this->m_Height, K(right->Keys()[0]), right);
+
+        return right;
+    }
+
+    /**
+     * @brief Adds a node split off from a child to the parent of the child, splitting the parent if it is full.
+     *
+     * @param path The inner nodes above the child.
+     * @param depth The depth of the child.
+     * @param separator The smallest key of the new node.
+     * @param right The new node, which goes right of the child.
+     */
+    void InsertSeparator(PathStep* path, sizet depth, K&& separator, Node* right) {
+        if (depth == 0) {
+            Inner* root = NewInner();
+
+            new (&root->Keys()[0]) K(std::move(separator));
+            root->children[0] = this->p_Root;
+            root->children[1] = right;
+            root->count = 1;
+
+            this->p_Root = root;
+            this->m_Height++;
+
+            return;
+        }
+
+        Inner* inner = path[depth - 1].node;
+        const sizet index = path[depth - 1].index;
+
+        if (inner->count < F) {
+            InsertIntoInner(inner, index, std::move(separator), right);
+
+            return;
+        }
+
+        // Counting the new separator there are F + 1 keys. The middle one moves up and the keys right of it go to a
+        // new node, which leaves both nodes with at least F / 2 keys.
+        //
+        Inner* sibling = NewInner();
+
+        const sizet middle = F / 2;
+
+        if (index == middle) {
+            Relocate(sibling->Keys(), inner->Keys() + middle, F - middle);
+
+            sibling->children[0] = right;
+            memcpy(sibling->children + 1, inner->children + middle + 1, (F - middle) * sizeof(Node*));
+
+            sibling->count = static_cast<u16>(F - middle);
+            inner->count = static_cast<u16>(middle);
+
+            InsertSeparator(path, depth - 1, std::move(separator), sibling);
+
+            return;
+        }
+
+        const sizet split = index < middle ? middle - 1 : middle;
+
+        K promoted(std::move(inner->Keys()[split]));
+        inner->Keys()[split].~K();
+
+        Relocate(sibling->Keys(), inner->Keys() + split + 1, F - split - 1);
+        memcpy(sibling->children, inner->children + split + 1, (F - split) * sizeof(Node*));
+
+        sibling->count = static_cast<u16>(F - split - 1);
+        inner->count = static_cast<u16>(split);
+
+        if (index < middle)
+            InsertIntoInner(inner, index, std::move(separator), right);
+        else
+            InsertIntoInner(sibling, index - split - 1, std::move(separator), right);
+
+        InsertSeparator(path, depth - 1, std::move(promoted), sibling);
+    }
+
+    /**
+     * @brief Inserts a separator and the child right of it into an inner node that has room.
+     *
+     * @param inner The inner node.
+     * @param index The index of the child that was split.
+     * @param separator The separator.
+     * @param right The new child.
+     */
+    void InsertIntoInner(Inner* inner, sizet index, K&& separator, Node* right) {
+        Relocate(inner->Keys() + index + 1, inner->Keys() + index, inner->count - index);
+        new (&inner->Keys()[index]) K(std::move(separator));
+
+        memmove(inner->children + index + 2, inner->children + index + 1, (inner->count - index) * sizeof(Node*));
+        inner->children[index + 1] = right;
+
+        inner->count++;
+    }
+
+    /**
+     * @brief Removes a separator and the child right of it from an inner node.
+     *
+     * @param inner The inner node.
+     * @param index The index of the separator.
+     */
+    void RemoveFromInner(Inner* inner, sizet index) {
+        inner->Keys()[index].~K();
+        Relocate(inner->Keys() + index, inner->Keys() + index + 1, inner->count - index - 1);
+
+        memmove(inner->children + index + 1, inner->children + index + 2, (inner->count - index - 1) * sizeof(Node*));
+
+        inner->count--;
+    }
+
+    /**
+     * @brief Refills a leaf that fell below the minimum, from a sibling with keys to spare or by merging with one.
+     *
+     * @param leaf The leaf.
+     * @param path The inner nodes above the leaf.
+     */
+    void RebalanceLeaf(Leaf* leaf, PathStep* path) {
+        Inner* parent = path[this->m_Height - 1].node;
+        const sizet index = path[this->m_Height - 1].index;
+
+        Leaf* left = index > 0 ? static_cast<Leaf*>(parent->children[index - 1]) : nullptr;
+        Leaf* right = index < parent->count ? static_cast<Leaf*>(parent->children[index + 1]) : nullptr;
+
+        if (left && left->count > k_MinKeys) {
+            Relocate(leaf->Keys() + 1, leaf->Keys(), leaf->count);
+            Relocate(leaf->Values() + 1, leaf->Values(), leaf->count);
+
+            Relocate(leaf->Keys(), left->Keys() + left->count - 1, 1);
+            Relocate(leaf->Values(), left->Values() + left->count - 1, 1);
+
+            left->count--;
+            leaf->count++;
+
+            parent->Keys()[index - 1] = leaf->Keys()[0];
+
+            return;
+        }
+
+        if (right && right->count > k_MinKeys) {
+            Relocate(leaf->Keys() + leaf->count, right->Keys(), 1);
+            Relocate(leaf->Values() + leaf->count, right->Values(), 1);
+
+            Relocate(right->Keys(), right->Keys() + 1, right->count - 1);
+            Relocate(right->Values(), right->Values() + 1, right->count - 1);
+
+            leaf->count++;
+            right->count--;
+
+            parent->Keys()[index] = right->Keys()[0];
+
+            return;
+        }
+
+        if (left) {
+            MergeLeaves(left, leaf);
+            RemoveFromInner(parent, index - 1);
+        }
+        else {
+            MergeLeaves(leaf, right);
+            RemoveFromInner(parent, index);
+        }
+
+        RebalanceInner(path, this->m_Height - 1);
+    }
+
+    /**
+     * @brief Moves every entry of a leaf to the end of its left neighbour, and frees it.
+     *
+     * @param left The leaf that is kept.
+     * @param right The leaf that is freed.
+     */
+    void MergeLeaves(Leaf* left, Leaf* right) {
+        Relocate(left->Keys() + left->count, right->Keys(), right->count);
+        Relocate(left->Values() + left->count, right->Values(), right->count);
+
+        left->count += right->count;
+
+        left->next = right->next;
+
+        if (right->next)
+            right->next->prev = left;
+        else
+            this->p_Last = left;
+
+        FreeNode(right);
+    }
+
+    /**
+     * @brief Refills an inner node that fell below the minimum, rotating a key through the parent from a sibling or
+     * merging with one. The root only shrinks the tree once it has a single child.
+     *
+     * @param path The inner nodes from the root.
+     * @param depth The depth of the node in the path.
+     */
+    void RebalanceInner(PathStep* path, sizet depth) {
+        Inner* node = path[depth].node;
+
+        if (depth == 0) {
+            if (node->count == 0) {
+                this->p_Root = node->children[0];
+                this->m_Height--;
+
+                FreeNode(node);
+            }
+
+            return;
+        }
+
+        if (node->count >= k_MinKeys)
+            return;
+
+        Inner* parent = path[depth - 1].node;
+        const sizet index = path[depth - 1].index;
+
+        Inner* left = index > 0 ? static_cast<Inner*>(parent->children[index - 1]) : nullptr;
+        Inner* right = index < parent->count ? static_cast<Inner*>(parent->children[index + 1]) : nullptr;
+
+        if (left && left->count > k_MinKeys) {
+            Relocate(node->Keys() + 1, node->Keys(), node->count);
+            memmove(node->children + 1, node->children, (node->count + 1) * sizeof(Node*));
+
+            new (&node->Keys()[0]) K(std::move(parent->Keys()[index - 1]));
+            node->children[0] = left->children[left->count];
+
+            parent->Keys()[index - 1] = std::move(left->Keys()[left->count - 1]);
+            left->Keys()[left->count - 1].~K();
+
+            left->count--;
+            node->count++;
+
+            return;
+        }
+
+        if (right && right->count > k_MinKeys) {
+            new (&node->Keys()[node->count]) K(std::move(parent->Keys()[index]));
+            node->children[node->count + 1] = right->children[0];
+
+            parent->Keys()[index] = std::move(right->Keys()[0]);
+            right->Keys()[0].~K();
+
+            Relocate(right->Keys(), right->Keys() + 1, right->count - 1);
+            memmove(right->children, right->children + 1, right->count * sizeof(Node*));
+
+            right->count--;
+            node->count++;
+
+            return;
+        }
+
+        if (left) {
+            MergeInner(left, node, parent->Keys()[index - 1]);
+            RemoveFromInner(parent, index - 1);
+        }
+        else {
+            MergeInner(node, right, parent->Keys()[index]);
+            RemoveFromInner(parent, index);
+        }
+
+        RebalanceInner(path, depth - 1);
+    }
+
+    /**
+     * @brief Moves the separator from the parent and every key and child of an inner node to the end of its left
+     * neighbour, and frees it.
+     *
+     * @param left The inner node that is kept.
+     * @param right The inner node that is freed.
+     * @param separator The parent's separator between the two, it is moved from.
+     */
+    void MergeInner(Inner* left, Inner* right, K& separator) {
+        new (&left->Keys()[left->count]) K(std::move(separator));
+
+        Relocate(left->Keys() + left->count + 1, right->Keys(), right->count);
+        memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(Node*));
+
+        left->count += right->count + 1;
+
+        FreeNode(right);
+    }
+
+    /**
+     * @brief Builds the tree from count entries in strictly increasing key order. The entries are spread evenly over
+     * the fewest nodes that hold them, level by level.
+     *
+     * @tparam Source An iterator whose entries have a key and a value.
+     * @param source The first entry.
+     * @param count The number of entries.
+     */
+    template <class Source>
+    void BuildSorted(Source source, sizet count) {
+        if (count == 0)
+            return;
+
+        DynamicArray<Node*> level;
+
+        const sizet leaves = (count + F - 1) / F;
+        level.Reserve(leaves);
+
+        Leaf* previous = nullptr;
+
+        for (sizet i = 0; i < leaves; i++) {
+            Leaf* leaf = NewLeaf();
+            const sizet entries = count / leaves + (i < count % leaves ? 1 : 0);
+
+            for (sizet j = 0; j < entries; j++, ++source) {
+                const auto entry = *source;
+
+                new (&leaf->Keys()[j]) K(entry.key);
+                new (&leaf->Values()[j]) T(entry.value);
+
+                leaf->count++;
+                this->m_Size++;
+            }
+
+            leaf->prev = previous;
+
+            if (previous)
+                previous->next = leaf;
+            else
+                this->p_First = leaf;
+
+            previous = leaf;
+
+            level.PushBack(leaf);
+        }
+
+        this->p_Last = previous;
+
+        while (level.Size() > 1) {
+            DynamicArray<Node*> parents;
+
+            const sizet nodes = (level.Size() + F) / (F + 1);
+            parents.Reserve(nodes);
+
+            sizet child = 0;
+
+            for (sizet i = 0; i < nodes; i++) {
+                Inner* inner = NewInner();
+                const sizet children = level.Size() / nodes + (i < level.Size() % nodes ? 1 : 0);
+
+                inner->children[0] = level[child++];
+
+                for (sizet j = 1; j < children; j++) {
+                    new (&inner->Keys()[j - 1]) K(SmallestKey(level[child]));
+                    inner->children[j] = level[child++];
+
+                    inner->count++;
+                }
+
+                parents.PushBack(inner);
+            }
+
+            level = std::move(parents);
+            this->m_Height++;
+        }
+
+        this->p_Root = level[0];
+    }
+
+    /**
+     * @return const K& - The smallest key under a node.
+     */
+    OC_STATIC const K& SmallestKey(Node* node) {
+        while (!node->leaf)
+            node = static_cast<Inner*>(node)->children[0];
+
+        return static_cast<Leaf*>(node)->Keys()[0];
+    }
+
+    /**
+     * @return Leaf* - A new empty leaf.
+     */
+    Leaf* NewLeaf() {
+        void* memory = oallocaa(sizeof(Leaf), &this->m_Allocator, alignof(Leaf));
+        if (!memory)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to allocate an OrderedMap node!");
+
+        Leaf* leaf = new (memory) Leaf;
+        leaf->count = 0;
+        leaf->leaf = true;
+        leaf->prev = nullptr;
+        leaf->next = nullptr;
+
+        return leaf;
+    }
+    /**
+     * @return Inner* - A new empty inner node.
+     */
+    Inner* NewInner() {
+        void* memory = oallocaa(sizeof(Inner), &this->m_Allocator, alignof(Inner));
+        if (!memory)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to allocate an OrderedMap node!");
+
+        Inner* inner = new (memory) Inner;
+        inner->count = 0;
+        inner->leaf = false;
+
+        return inner;
+    }
+
+    /**
+     * @brief Frees a node, whose keys and values must already be destroyed or moved out.
+     *
+     * @param node The node.
+     */
+    inline void FreeNode(Node* node) {
+        ofree(node, &this->m_Allocator);
+    }
+
+    /**
+     * @brief Destroys and frees a node and every node under it.
+     *
+     * @param node The node.
+     */
+    void FreeSubtree(Node* node) {
+        if (node->leaf) {
+            Leaf* leaf = static_cast<Leaf*>(node);
+
+            if constexpr (!std::is_trivially_destructible_v<K> || !std::is_trivially_destructible_v<T>) {
+                for (sizet i = 0; i < leaf->count; i++) {
+                    leaf->Keys()[i].~K();
+                    leaf->Values()[i].~T();
+                }
+            }
+        }
+        else {
+            Inner* inner = static_cast<Inner*>(node);
+
+            for (sizet i = 0; i <= inner->count; i++)
+                FreeSubtree(inner->children[i]);
+
+            if constexpr (!std::is_trivially_destructible_v<K>) {
+                for (sizet i = 0; i < inner->count; i++)
+                    inner->Keys()[i].~K();
+            }
+        }
+
+        FreeNode(node);
+    }
+
+    /**
+     * @brief Empties the OrderedMap without touching its nodes, after they were freed or handed to another map.
+     */
+    inline void Forget() {
+        this->p_Root = nullptr;
+        this->p_First = nullptr;
+        this->p_Last = nullptr;
+        this->m_Size = 0;
+        this->m_Height = 0;
+    }
+
+private:
+    /** @brief The allocator policy of the OrderedMap. */
+    A m_Allocator;
+    /** @brief The key ordering. */
+    C m_Compare;
+
+    /** @brief The root node, a Leaf while the tree has a single level. */
+    Node* p_Root;
+    /** @brief The leaf with the smallest keys. */
+    Leaf* p_First;
+    /** @brief The leaf with the largest keys. */
+    Leaf* p_Last;
+
+    /** @brief The number of entries. */
+    sizet m_Size;
+    /** @brief The number of inner node levels above the leaves. */
+    sizet m_Height;
+
+};  // OrderedMap
@@ -0,0 +1,44 @@
+#pragma once
+
+/**
+ * @file ParallelFor.hpp
+ * @brief Splitting a range of work over short lived threads, for the containers' bulk algorithms.
+ */
+
+#include "Ocean/Types/Integers.hpp"
+
+// std
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Splits the range [0, count) into one contiguous part per thread and runs the body on every part. The
+ * calling thread runs the first part.
+ *
+ * @tparam F A callable taking the begin and end of a part, which must not throw.
+ * @param threads The number of threads to use, 0 and 1 run the body on the calling thread.
+ * @param count The size of the range.
+ * @param body The body to run on every part.
+ */
+template <class F>
+inline void oParallelFor(u32 threads, sizet count, F&& body) {
+    const sizet parts = std::min<sizet>(std::max<u32>(threads, 1), count);
+
+    if (parts <= 1) {
+        body(sizet(0), count);
+
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(parts - 1);
+
+    for (sizet part = 1; part < parts; part++)
+        workers.emplace_back([&body, part, parts, count]() { body(count * part / parts, count * (part + 1) / parts); });
+
+    body(sizet(0), count / parts);
+
+    for (std::thread& worker : workers)
+        worker.join();
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+/**
+ * @file Relocatable.hpp
+ * @brief Marks the types that containers may relocate with memcpy.
+ *
+ * @details Relocating an object is moving it to a new address and destroying the old one. For most types, including
+ * ones with non-trivial move constructors like the smart pointers, the result is the same as copying the bytes and
+ * forgetting the source. Containers use this to grow with a memcpy, or an in place realloc, instead of moving each
+ * element.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+// std
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief True if T can be relocated with memcpy. Defaults to the trivially copyable types.
+ *
+ * @details Specialize this for a type that does not hold a pointer into itself, and is not registered by its address
+ * anywhere else, to let the containers relocate it bytewise. A class can also opt in from its own definition with
+ * a public `using TriviallyRelocatable = std::true_type;`, which also works for private nested types.
+ *
+ * @tparam T The data type.
+ */
+template <class T, class = void>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> { };
+
+/** @brief A class that declares a TriviallyRelocatable member type uses it. */
+template <class T>
+struct IsTriviallyRelocatable<T, std::void_t<typename T::TriviallyRelocatable>> : T::TriviallyRelocatable { };
+
+/** @brief A shared_ptr only points at its control block, never into itself. */
+template <class T>
+struct IsTriviallyRelocatable<std::shared_ptr<T>> : std::true_type { };
+
+/** @brief A unique_ptr with the default deleter is a single owning pointer. */
+template <class T>
+struct IsTriviallyRelocatable<std::unique_ptr<T>> : std::true_type { };
+
+/**
+ * @brief Shorthand for IsTriviallyRelocatable<T>::value.
+ *
+ * @tparam T The data type.
+ */
+template <class T>
+inline constexpr b8 IsTriviallyRelocatable_v = IsTriviallyRelocatable<T>::value;
+
+/**
+ * @brief A value that a container builds before making room for it, because its constructor arguments may refer to an
+ * element that is about to move.
+ *
+ * @details A trivially relocatable value is kept in raw storage and copied bytewise into place, so types that are
+ * relocatable but not movable can be staged too. Other values are move constructed into place and destroyed with the
+ * StagedValue.
+ *
+ * @tparam T The data type.
+ */
+template <class T>
+class StagedValue {
+public:
+    template <class ... Args>
+    explicit StagedValue(Args&& ... args) :
+        m_Relocated(false)
+    {
+        new (this->m_Storage) T(std::forward<Args>(args)...);
+    }
+    ~StagedValue() {
+        if (!this->m_Relocated)
+            Get()->~T();
+    }
+
+    StagedValue(const StagedValue&) = delete;
+    StagedValue& operator = (const StagedValue&) = delete;
+
+    /**
+     * @brief Moves the value into the given uninitialized memory.
+     *
+     * @param destination The memory to construct the value in.
+     * @return T* - The value at its new address.
+     */
+    T* RelocateTo(void* destination) {
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            memcpy(destination, static_cast<const void*>(this->m_Storage), sizeof(T));
+
+            this->m_Relocated = true;
+
+            return static_cast<T*>(destination);
+        }
+        else {
+            return new (destination) T(std::move(*Get()));
+        }
+    }
+
+private:
+    T* Get() { return std::launder(reinterpret_cast<T*>(this->m_Storage)); }
+
+private:
+    /** @brief The storage of the value. */
+    alignas(T) u8 m_Storage[sizeof(T)];
+    /** @brief True once the bytes have been relocated, the value then belongs to the container. */
+    b8 m_Relocated;
+
+};  // StagedValue
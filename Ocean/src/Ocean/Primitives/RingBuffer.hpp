@@ -0,0 +1,545 @@
+#pragma once
+
+/**
+ * @file RingBuffer.hpp
+ * @brief Bounded lock-free queues for handing work between threads.
+ *
+ * @details SpscRing connects one producer thread to one consumer thread, e.g. the render thread's command queue.
+ * MpmcRing accepts any number of producers and consumers, e.g. a log queue drained by a writer thread. Both have a
+ * power of two capacity fixed at construction, never allocate after it, and keep the indexes that different threads
+ * write on separate cache lines.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Macros.hpp"
+#include "Ocean/Primitives/Memory.hpp"
+
+// std
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Rounds a requested ring capacity up to a power of two, at least 2.
+ *
+ * @param requested The requested capacity.
+ * @return sizet
+ */
+inline sizet oRingCapacity(sizet requested) {
+    if (requested == 0)
+        throw Ocean::Exception(Ocean::Error::INVALID_ARGUMENT, "A ring needs room for at least one element!");
+
+    if (requested > (std::numeric_limits<sizet>::max() >> 1) + 1)
+        throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested ring capacity is too large!");
+
+    sizet capacity = 2;
+    while (capacity < requested)
+        capacity <<= 1;
+
+    return capacity;
+}
+
+/**
+ * @brief A bounded single producer, single consumer queue.
+ *
+ * @details Every operation is wait-free. Each side keeps a private copy of the other side's index and only reloads
+ * it when the ring looks full or empty, so in the steady state a push or pop touches no cache line the other thread
+ * writes.
+ *
+ * Only one thread may push and only one thread may pop at a time.
+ *
+ * @tparam T The element type.
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
+ */
+template <class T, class A = MallocPolicy>
+class alignas(OC_CACHE_LINE_SIZE) SpscRing {
+public:
+    /**
+     * @brief Construct a new SpscRing.
+     *
+     * @param capacity The least number of elements the ring holds, rounded up to a power of two.
+     * @param allocator The allocator policy to use.
+     */
+    inline explicit SpscRing(sizet capacity, const A& allocator = A()) :
+        m_Allocator(allocator),
+        p_Buffer(nullptr),
+        m_Mask(oRingCapacity(capacity) - 1),
+        m_Head(0),
+        m_CachedTail(0),
+        m_Tail(0),
+        m_CachedHead(0)
+    {
+        const sizet slots = this->m_Mask + 1;
+
+        this->p_Buffer = oallocat(T, slots, &this->m_Allocator);
+        if (!this->p_Buffer)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to allocate the SpscRing!");
+    }
+    inline ~SpscRing() {
+        const sizet tail = this->m_Tail.load(std::memory_order_relaxed);
+
+        for (sizet i = this->m_Head.load(std::memory_order_relaxed); i != tail; i++)
+            this->p_Buffer[i & this->m_Mask].~T();
+
+        ofree(this->p_Buffer, &this->m_Allocator);
+    }
+
+    OC_NO_COPY(SpscRing);
+
+    /**
+     * @brief Pushes a copy of an element.
+     *
+     * @param value The element.
+     * @return b8 - True if it was pushed, False if the ring is full.
+     */
+    inline b8 TryPush(const T& value) { return TryEmplace(value); }
+    /**
+     * @brief Pushes an element by moving it, it is left untouched if the ring is full.
+     *
+     * @param value The element.
+     * @return b8 - True if it was pushed, False if the ring is full.
+     */
+    inline b8 TryPush(T&& value) { return TryEmplace(std::move(value)); }
+
+    /**
+     * @brief Constructs an element at the back of the ring. Producer only.
+     *
+     * @tparam Args
+     * @param args The type T constructor arguments.
+     * @return b8 - True if it was pushed, False if the ring is full.
+     */
+    template <class ... Args>
+    b8 TryEmplace(Args&& ... args) {
+        const sizet tail = this->m_Tail.load(std::memory_order_relaxed);
+
+        if (tail - this->m_CachedHead > this->m_Mask) {
+            this->m_CachedHead = this->m_Head.load(std::memory_order_acquire);
+
+            if (tail - this->m_CachedHead > this->m_Mask)
+                return false;
+        }
+
+        new (&this->p_Buffer[tail & this->m_Mask]) T(std::forward<Args>(args)...);
+
+        this->m_Tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Pushes as many of count elements as fit, publishing them to the consumer at once. Producer only.
+     *
+     * @tparam It An input iterator over elements, they are copied or moved as it yields them.
+     * @param first The first element.
+     * @param count The number of elements.
+     * @return sizet - The number of elements pushed, the first ones of the input.
+     */
+    template <class It>
+    sizet TryPushBatch(It first, sizet count) {
+        const sizet tail = this->m_Tail.load(std::memory_order_relaxed);
+
+        if (count > this->m_Mask + 1 - (tail - this->m_CachedHead))
+            this->m_CachedHead = this->m_Head.load(std::memory_order_acquire);
+
+        const sizet space = this->m_Mask + 1 - (tail - this->m_CachedHead);
+        const sizet pushed = count < space ? count : space;
+
+        for (sizet i = 0; i < pushed; i++, ++first)
+            new (&this->p_Buffer[(tail + i) & this->m_Mask]) T(*first);
+
+        this->m_Tail.store(tail + pushed, std::memory_order_release);
+
+        return pushed;
+    }
+
+    /**
+     * @brief Pops the front element. Consumer only.
+     *
+     * @param value Receives the element by move assignment.
+     * @return b8 - True if an element was popped, False if the ring is empty.
+     */
+    b8 TryPop(T& value) {
+        const sizet head = this->m_Head.load(std::memory_order_relaxed);
+
+        if (head == this->m_CachedTail) {
+            this->m_CachedTail = this->m_Tail.load(std::memory_order_acquire);
+
+            if (head == this->m_CachedTail)
+                return false;
+        }
+
+        T& slot = this->p_Buffer[head & this->m_Mask];
+
+        value = std::move(slot);
+        slot.~T();
+
+        this->m_Head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Pops up to max elements, handing their slots back to the producer at once. Consumer only.
+     *
+     * @tparam It An output iterator, each element is move assigned to it.
+     * @param out The first output.
+     * @param max The most elements to pop.
+     * @return sizet - The number of elements popped.
+     */
+    template <class It>
+    sizet TryPopBatch(It out, sizet max) {
+        const sizet head = this->m_Head.load(std::memory_order_relaxed);
+
+        if (this->m_CachedTail - head < max)
+            this->m_CachedTail = this->m_Tail.load(std::memory_order_acquire);
+
+        const sizet available = this->m_CachedTail - head;
+        const sizet popped = max < available ? max : available;
+
+        for (sizet i = 0; i < popped; i++, ++out) {
+            T& slot = this->p_Buffer[(head + i) & this->m_Mask];
+
+            *out = std::move(slot);
+            slot.~T();
+        }
+
+        this->m_Head.store(head + popped, std::memory_order_release);
+
+        return popped;
+    }
+
+    /**
+     * @return sizet - The number of elements, exact only while neither side is working.
+     */
+    inline sizet SizeApprox() const {
+        return this->m_Tail.load(std::memory_order_acquire) - this->m_Head.load(std::memory_order_acquire);
+    }
+    /**
+     * @return b8 - True if the ring looks empty, exact only while neither side is working.
+     */
+    inline b8 EmptyApprox() const { return SizeApprox() == 0; }
+    /**
+     * @return sizet - The number of elements the ring holds.
+     */
+    inline sizet Capacity() const { return this->m_Mask + 1; }
+
+private:
+    /** @brief The allocator policy of the ring. */
+    A m_Allocator;
+    /** @brief The elements, indexed by position & m_Mask. */
+    T* p_Buffer;
+    /** @brief The capacity minus one. */
+    sizet m_Mask;
+
+    /** @brief The position of the front element, written by the consumer. */
+    alignas(OC_CACHE_LINE_SIZE) std::atomic<sizet> m_Head;
+    /** @brief The consumer's copy of m_Tail. */
+    sizet m_CachedTail;
+
+    /** @brief The position after the back element, written by the producer. */
+    alignas(OC_CACHE_LINE_SIZE) std::atomic<sizet> m_Tail;
+    /** @brief The producer's copy of m_Head. */
+    sizet m_CachedHead;
+
+};  // SpscRing
+
+/**
+ * @brief A bounded multi producer, multi consumer queue.
+ *
+ * @details Each cell carries a sequence number saying whether it is ready to be written or read for a given
+ * position, so a push or pop claims a position with a single compare exchange and then works on its cell alone.
+ * Without contention that exchange succeeds the first time. Under contention the operations are lock-free, a thread
+ * only retries because another one made progress. A full ring fails a push and an empty one fails a pop.
+ *
+ * @tparam T The element type.
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
+ */
+template <class T, class A = MallocPolicy>
+class alignas(OC_CACHE_LINE_SIZE) MpmcRing {
+private:
+    /** @brief An element slot and its sequence number. */
+    struct Cell {
+        /** @brief Equals the position when the cell can be written, and the position + 1 when it can be read. */
+        std::atomic<sizet> sequence;
+        /** @brief The element. */
+        alignas(T) u8 storage[sizeof(T)];
+
+        T* Value() { return reinterpret_cast<T*>(this->storage); }
+
+    };  // Cell
+
+public:
+    /**
+     * @brief Construct a new MpmcRing.
+     *
+     * @param capacity The least number of elements the ring holds, rounded up to a power of two.
+     * @param allocator The allocator policy to use.
+     */
+    inline explicit MpmcRing(sizet capacity, const A& allocator = A()) :
+        m_Allocator(allocator),
+        p_Cells(nullptr),
+        m_Mask(oRingCapacity(capacity) - 1),
+        m_EnqueuePosition(0),
+        m_DequeuePosition(0)
+    {
+        const sizet cells = this->m_Mask + 1;
+
+        this->p_Cells = oallocat(Cell, cells, &this->m_Allocator);
+        if (!this->p_Cells)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to allocate the MpmcRing!");
+
+        for (sizet i = 0; i <= this->m_Mask; i++)
+            new (&this->p_Cells[i].sequence) std::atomic<sizet>(i);
+    }
+    inline ~MpmcRing() {
+        const sizet end = this->m_EnqueuePosition.load(std::memory_order_relaxed);
+
+        for (sizet i = this->m_DequeuePosition.load(std::memory_order_relaxed); i != end; i++)
+            this->p_Cells[i & this->m_Mask].Value()->~T();
+
+        ofree(this->p_Cells, &this->m_Allocator);
+    }
+
+    OC_NO_COPY(MpmcRing);
+
+    /**
+     * @brief Pushes a copy of an element.
+     *
+     * @param value The element.
+     * @return b8 - True if it was pushed, False if the ring is full.
+     */
+    inline b8 TryPush(const T& value) { return TryEmplace(value); }
+    /**
+     * @brief Pushes an element by moving it, it is left untouched if the ring is full.
+     *
+     * @param value The element.
+     * @return b8 - True if it was pushed, False if the ring is full.
+     */
+    inline b8 TryPush(T&& value) { return TryEmplace(std::move(value)); }
+
+    /**
+     * @brief Constructs an element at the back of the ring.
+     *
+     * @tparam Args
+     * @param args The type T constructor arguments.
+     * @return b8 - True if it was pushed, False if the ring is full.
+     */
+    template <class ... Args>
+    b8 TryEmplace(Args&& ... args) {
+        sizet position = this->m_EnqueuePosition.load(std::memory_order_relaxed);
+
+        for (;;) {
+            Cell& cell = this->p_Cells[position & this->m_Mask];
+
+            const sizet sequence = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+            if (difference == 0) {
+                if (this->m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    new (cell.Value()) T(std::forward<Args>(args)...);
+
+                    cell.sequence.store(position + 1, std::memory_order_release);
+
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                // The cell still holds the element from one lap ago.
+                //
+                return false;
+            }
+            else {
+                position = this->m_EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Pushes as many of count elements as there are free cells in a row, claiming them with one exchange.
+     *
+     * @tparam It An input iterator over elements, they are copied or moved as it yields them.
+     * @param first The first element.
+     * @param count The number of elements.
+     * @return sizet - The number of elements pushed, the first ones of the input.
+     */
+    template <class It>
+    sizet TryPushBatch(It first, sizet count) {
+        sizet position = this->m_EnqueuePosition.load(std::memory_order_relaxed);
+        sizet claimed = 0;
+
+        for (;;) {
+            claimed = CountReady(position, count, 0);
+
+            if (claimed == 0) {
+                const sizet sequence = this->p_Cells[position & this->m_Mask].sequence.load(std::memory_order_acquire);
+
+                if (static_cast<std::ptrdiff_t>(sequence - position) < 0)
+                    return 0;
+
+                position = this->m_EnqueuePosition.load(std::memory_order_relaxed);
+            }
+            else if (this->m_EnqueuePosition.compare_exchange_weak(position, position + claimed, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        for (sizet i = 0; i < claimed; i++, ++first) {
+            Cell& cell = this->p_Cells[(position + i) & this->m_Mask];
+
+            new (cell.Value()) T(*first);
+
+            cell.sequence.store(position + i + 1, std::memory_order_release);
+        }
+
+        return claimed;
+    }
+
+    /**
+     * @brief Pops the front element.
+     *
+     * @param value Receives the element by move assignment.
+     * @return b8 - True if an element was popped, False if the ring is empty.
+     */
+    b8 TryPop(T& value) {
+        sizet position = this->m_DequeuePosition.load(std::memory_order_relaxed);
+
+        for (;;) {
+            Cell& cell = this->p_Cells[position & this->m_Mask];
+
+            const sizet sequence = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+
+            if (difference == 0) {
+                if (this->m_DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    Release(cell, position, value);
+
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                // The cell has not been written for this lap yet.
+                //
+                return false;
+            }
+            else {
+                position = this->m_DequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Pops up to max elements that are ready in a row, claiming them with one exchange.
+     *
+     * @tparam It An output iterator, each element is move assigned to it.
+     * @param out The first output.
+     * @param max The most elements to pop.
+     * @return sizet - The number of elements popped.
+     */
+    template <class It>
+    sizet TryPopBatch(It out, sizet max) {
+        sizet position = this->m_DequeuePosition.load(std::memory_order_relaxed);
+        sizet claimed = 0;
+
+        for (;;) {
+            claimed = CountReady(position, max, 1);
+
+            if (claimed == 0) {
+                const sizet sequence = this->p_Cells[position & this->m_Mask].sequence.load(std::memory_order_acquire);
+
+                if (static_cast<std::ptrdiff_t>(sequence - (position + 1)) < 0)
+                    return 0;
+
+                position = this->m_DequeuePosition.load(std::memory_order_relaxed);
+            }
+            else if (this->m_DequeuePosition.compare_exchange_weak(position, position + claimed, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        for (sizet i = 0; i < claimed; i++, ++out)
+            Release(this->p_Cells[(position + i) & this->m_Mask], position + i, *out);
+
+        return claimed;
+    }
+
+    /**
+     * @return sizet - The number of elements, exact only while no thread is working on the ring.
+     */
+    inline sizet SizeApprox() const {
+        const sizet dequeue = this->m_DequeuePosition.load(std::memory_order_acquire);
+        const sizet enqueue = this->m_EnqueuePosition.load(std::memory_order_acquire);
+
+        return enqueue > dequeue ? enqueue - dequeue : 0;
+    }
+    /**
+     * @return b8 - True if the ring looks empty, exact only while no thread is working on the ring.
+     */
+    inline b8 EmptyApprox() const { return SizeApprox() == 0; }
+    /**
+     * @return sizet - The number of elements the ring holds.
+     */
+    inline sizet Capacity() const { return this->m_Mask + 1; }
+
+private:
+    /**
+     * @brief Counts the cells in a row from a position whose sequence is position + offset, i.e. free cells for an
+     * offset of 0 and full cells for an offset of 1.
+     *
+     * @param position The first position.
+     * @param max The most cells to count.
+     * @param offset The offset of a ready cell's sequence from its position.
+     * @return sizet
+     */
+    inline sizet CountReady(sizet position, sizet max, sizet offset) const {
+        sizet ready = 0;
+
+        while (ready < max && ready <= this->m_Mask) {
+            const sizet sequence = this->p_Cells[(position + ready) & this->m_Mask].sequence.load(std::memory_order_acquire);
+
+            if (sequence != position + ready + offset)
+                break;
+
+            ready++;
+        }
+
+        return ready;
+    }
+
+    /**
+     * @brief Moves the element out of a claimed cell and hands the cell to the producer of the next lap.
+     *
+     * @param cell The cell.
+     * @param position The position the cell was claimed at.
+     * @param value Receives the element.
+     */
+    template <class V>
+    inline void Release(Cell& cell, sizet position, V&& value) {
+        T* element = cell.Value();
+
+        value = std::move(*element);
+        element->~T();
+
+        cell.sequence.store(position + this->m_Mask + 1, std::memory_order_release);
+    }
+
+private:
+    /** @brief The allocator policy of the ring. */
+    A m_Allocator;
+    /** @brief The cells, indexed by position & m_Mask. */
+    Cell* p_Cells;
+    /** @brief The capacity minus one. */
+    sizet m_Mask;
+
+    /** @brief The next position to push to, contended by the producers. */
+    alignas(OC_CACHE_LINE_SIZE) std::atomic<sizet> m_EnqueuePosition;
+    /** @brief The next position to pop from, contended by the consumers. */
+    alignas(OC_CACHE_LINE_SIZE) std::atomic<sizet> m_DequeuePosition;
+
+};  // MpmcRing
@@ -1,5 +1,19 @@
 #pragma once
 
+/**
+ * @file SinglyLinkedList.hpp
+ * @brief A singly linked list that keeps a tail pointer and takes its nodes from a pool.
+ *
+ * @details Nodes are carved from chunks that grow geometrically, and erased nodes return to a free list in the
+ * list's pool instead of to the allocator. Once the list has grown to its working size, inserting and erasing only
+ * relink pooled nodes. Splicing a whole list also hands over its pool, so it stays O(1) and every node keeps being
+ * freed by the pool that owns its chunk.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
 #include "Ocean/Primitives/Exceptions.hpp"
 #include "Ocean/Primitives/Memory.hpp"
 
@@ -7,15 +21,24 @@
 
 // std
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 /**
  * @brief A Singly Linked List that stores data via one-directionaly connected nodes.
- * 
+ *
+ * @details PushFront, PushBack, PopFront, InsertAfter, EraseAfter and Splice are O(1). Positional access walks from
+ * the head, and PopBack walks to the node before the tail.
+ *
  * @tparam T The data type.
+ * @tparam A The allocator policy of the node pool, see AllocatorPolicy.hpp.
  */
-template <class T>
-class SinglyLinkedList : public List<T> {
+template <class T, class A = MallocPolicy>
+class SinglyLinkedList : public List<T, SinglyLinkedList<T, A>> {
 private:
     /**
      * @brief A data node within the Singly Linked List.
@@ -24,161 +47,774 @@ private:
         /** @brief A pointer to the next Node. */
         Node* next;
 
-        /** @brief The stored data of type T. */
-        T data;
+        /** @brief The storage of the data, constructed only while the Node is in the list. */
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        inline T& Data() { return *std::launder(reinterpret_cast<T*>(this->storage)); }
 
     };  // Node
 
+    /**
+     * @brief A block of Nodes allocated at once, the Nodes follow the header.
+     */
+    struct Chunk {
+        /** @brief A pointer to the next Chunk of the pool. */
+        Chunk* next;
+        /** @brief The number of Nodes in the Chunk. */
+        sizet count;
+
+    };  // Chunk
+
+    /** @brief The size of a Chunk header, padded so that the first Node is aligned. */
+    OC_STATIC_EXPR sizet k_ChunkHeader = (sizeof(Chunk) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+    /** @brief The number of Nodes in the first Chunk. */
+    OC_STATIC_EXPR sizet k_MinimumChunk = 16;
+    /** @brief The largest number of Nodes a Chunk grows to. */
+    OC_STATIC_EXPR sizet k_MaximumChunk = 4096;
+
+public:
+    /**
+     * @brief A forward iterator over the data of the list.
+     *
+     * @tparam Const True for a ConstIterator.
+     */
+    template <b8 Const>
+    class BasicIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+    public:
+        BasicIterator() :
+            p_Node(nullptr)
+        { }
+        explicit BasicIterator(Node* node) :
+            p_Node(node)
+        { }
+        /**
+         * @brief Converts an Iterator to a ConstIterator.
+         *
+         * @param other The Iterator.
+         */
+        template <b8 OtherConst, class = std::enable_if_t<Const && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) :
+            p_Node(other.p_Node)
+        { }
+
+        reference operator * () const { return this->p_Node->Data(); }
+        pointer operator -> () const { return &this->p_Node->Data(); }
+
+        BasicIterator& operator ++ () {
+            this->p_Node = this->p_Node->next;
+
+            return *this;
+        }
+        BasicIterator operator ++ (int) {
+            BasicIterator previous = *this;
+            ++*this;
+
+            return previous;
+        }
+
+        b8 operator == (const BasicIterator& other) const { return this->p_Node == other.p_Node; }
+        b8 operator != (const BasicIterator& other) const { return this->p_Node != other.p_Node; }
+
+    private:
+        template <b8>
+        friend class BasicIterator;
+
+        friend class SinglyLinkedList;
+
+    private:
+        /** @brief The Node, or nullptr at the end. */
+        Node* p_Node;
+
+    };  // BasicIterator
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
 public:
     SinglyLinkedList() :
-        List<T>(),
-        p_Head(nullptr)
+        List<T, SinglyLinkedList>(),
+        m_Allocator(),
+        p_Head(nullptr),
+        p_Tail(nullptr),
+        p_Free(nullptr),
+        p_FreeTail(nullptr),
+        p_Chunks(nullptr),
+        p_LastChunk(nullptr),
+        m_Capacity(0)
+    { }
+    /**
+     * @brief Construct a new empty Singly Linked List that allocates its nodes from the given allocator.
+     *
+     * @param allocator The allocator policy to use.
+     */
+    explicit SinglyLinkedList(const A& allocator) :
+        List<T, SinglyLinkedList>(),
+        m_Allocator(allocator),
+        p_Head(nullptr),
+        p_Tail(nullptr),
+        p_Free(nullptr),
+        p_FreeTail(nullptr),
+        p_Chunks(nullptr),
+        p_LastChunk(nullptr),
+        m_Capacity(0)
     { }
+    /**
+     * @brief Construct a new Singly Linked List from another Singly Linked List, using the same allocator.
+     *
+     * @param other The Singly Linked List to copy from.
+     */
+    SinglyLinkedList(const SinglyLinkedList& other) :
+        SinglyLinkedList(other.m_Allocator)
+    {
+        Reserve(other.m_Size);
 
+        for (const T& data : other)
+            PushBack(data);
+    }
     /**
-     * @brief Insert the given data into the Singly Linked List at a position via move.
-     * 
-     * @param pos The position to insert to.
+     * @brief Move a Singly Linked List to a new Singly Linked List, the nodes and the pool are taken over.
+     *
+     * @param other The Singly Linked List to move from.
+     */
+    SinglyLinkedList(SinglyLinkedList&& other) :
+        SinglyLinkedList(other.m_Allocator)
+    {
+        Adopt(other);
+    }
+    ~SinglyLinkedList() {
+        Release();
+    }
+
+    SinglyLinkedList& operator = (const SinglyLinkedList& other) {
+        if (this != &other) {
+            Clear();
+            Reserve(other.m_Size);
+
+            for (const T& data : other)
+                PushBack(data);
+        }
+
+        return *this;
+    }
+    SinglyLinkedList& operator = (SinglyLinkedList&& other) {
+        if (this != &other) {
+            Release();
+
+            this->m_Allocator = other.m_Allocator;
+            Adopt(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Equality comparison, node by node. Container provides operator != from it.
+     *
+     * @param other The Singly Linked List to compare with.
+     * @return b8 - True if equal, False otherwise.
+     */
+    inline b8 operator == (const SinglyLinkedList& other) const {
+        if (this->m_Size != other.m_Size)
+            return false;
+
+        return std::equal(Begin(), End(), other.Begin());
+    }
+
+    /**
+     * @brief Insert the given data into the Singly Linked List at a position via copy.
+     *
+     * @param pos The position to insert to, the front and the back are O(1).
      * @param data The data to store.
      */
-    virtual void Insert(u16 pos, const T& data) {
+    void Insert(u16 pos, const T& data) {
         if (pos > this->m_Size)
             throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to insert out of List range!");
 
-        Node* newNode = oallocat(Node, 1, oUnmanagedAllocator);
+        if (pos == 0)
+            EmplaceFront(data);
+        else if (pos == this->m_Size)
+            EmplaceBack(data);
+        else
+            LinkAfter(NodeAt(pos - 1), data);
+    }
 
-        if (pos == 0) {
-            newNode->next = this->p_Head;
-            this->p_Head = newNode;
-        }
-        else {
-            Node* curr = this->p_Head;
-
-            // Start at 1 so that the curr is the node before the insert position.
-            //
-            for (u16 i = 1; i < pos; i++)
-                curr = curr->next;
-
-            // If a node exists after the insert position, then it must be linked correctly.
-            //
-            if (curr->next) {
-                newNode->next = curr->next;
-                curr->next = newNode;
-            }
-            else {
-                newNode->next = nullptr;
-                curr->next = newNode;
-            }
-        }
+    /**
+     * @brief Copies the data to the front of the Singly Linked List.
+     *
+     * @param data The data to store.
+     */
+    inline void PushFront(const T& data) { EmplaceFront(data); }
+    /**
+     * @brief Moves the data to the front of the Singly Linked List.
+     *
+     * @param data The data to store.
+     */
+    inline void PushFront(T&& data) { EmplaceFront(std::move(data)); }
+    /**
+     * @brief Copies the data to the back of the Singly Linked List.
+     *
+     * @param data The data to store.
+     */
+    inline void PushBack(const T& data) { EmplaceBack(data); }
+    /**
+     * @brief Moves the data to the back of the Singly Linked List.
+     *
+     * @param data The data to store.
+     */
+    inline void PushBack(T&& data) { EmplaceBack(std::move(data)); }
 
-        newNode->data = std::move(data);
-        this->m_Size++;
+    /**
+     * @brief Constructs the data in place at the front of the Singly Linked List.
+     *
+     * @tparam Args
+     * @param args The type T constructor arguments.
+     * @return T& - The new data.
+     */
+    template <class ... Args>
+    T& EmplaceFront(Args&& ... args) {
+        Node* node = Construct(std::forward<Args>(args)...);
+
+        node->next = this->p_Head;
+        this->p_Head = node;
+
+        if (!this->p_Tail)
+            this->p_Tail = node;
+
+        return node->Data();
     }
+    /**
+     * @brief Constructs the data in place at the back of the Singly Linked List.
+     *
+     * @tparam Args
+     * @param args The type T constructor arguments.
+     * @return T& - The new data.
+     */
+    template <class ... Args>
+    T& EmplaceBack(Args&& ... args) {
+        if (!this->p_Tail)
+            return EmplaceFront(std::forward<Args>(args)...);
 
+        return LinkAfter(this->p_Tail, std::forward<Args>(args)...)->Data();
+    }
     /**
-     * @brief Deconstructs and clears the Singly Linked List.
-     * 
-     * @note Does not handle pointer data.
+     * @brief Constructs the data in place after a position.
+     *
+     * @tparam Args
+     * @param pos The position to insert after, which must not be End().
+     * @param args The type T constructor arguments.
+     * @return Iterator - The position of the new data.
+     */
+    template <class ... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&& ... args) {
+        return Iterator(LinkAfter(pos.p_Node, std::forward<Args>(args)...));
+    }
+    /**
+     * @brief Copies the data after a position.
+     *
+     * @param pos The position to insert after, which must not be End().
+     * @param data The data to store.
+     * @return Iterator - The position of the new data.
      */
-    virtual void Clear() {
-        Node* next = this->p_Head;
+    inline Iterator InsertAfter(ConstIterator pos, const T& data) { return EmplaceAfter(pos, data); }
+    /**
+     * @brief Moves the data after a position.
+     *
+     * @param pos The position to insert after, which must not be End().
+     * @param data The data to store.
+     * @return Iterator - The position of the new data.
+     */
+    inline Iterator InsertAfter(ConstIterator pos, T&& data) { return EmplaceAfter(pos, std::move(data)); }
 
-        for (u16 i = 0; i < this->m_Size; i++) {
-            Node* curr = next;
-            next = next->next;
+    /**
+     * @brief Deconstructs and clears the Singly Linked List, the nodes stay in the pool.
+     *
+     * @note Does not handle pointer data.
+     */
+    void Clear() {
+        if (!this->p_Head)
+            return;
 
-            curr->data.~T();
-            ofree(curr, oUnmanagedAllocator);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (Node* node = this->p_Head; node; node = node->next)
+                node->Data().~T();
         }
 
+        // The whole chain goes back to the pool at once.
+        //
+        this->p_Tail->next = this->p_Free;
+        this->p_Free = this->p_Head;
+
+        if (!this->p_FreeTail)
+            this->p_FreeTail = this->p_Tail;
+
         this->p_Head = nullptr;
+        this->p_Tail = nullptr;
+        this->m_Size = 0;
     }
 
     /**
      * @brief Deconstructs and removes the object at the given position.
-     * 
+     *
      * @param pos The position to erase.
-     * 
+     *
      * @note Does not handle pointer data.
      */
-    virtual void Erase(u16 pos) {
+    void Erase(u16 pos) {
         if (pos >= this->m_Size)
             throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to Erase List Node that does not exist!");
 
-        Node* toDelete = this->p_Head;
-
-        if (pos == 0) {
-            this->p_Head = this->p_Head->next;
-        }
-        else {
-            Node* curr = this->p_Head;
-
-            // Start at 1 so that the curr is the node before the insert position.
-            //
-            for (u16 i = 1; i < pos; i++)
-                curr = curr->next;
-
-            toDelete = curr->next;
-            curr->next = toDelete->next;
-        }
+        UnlinkAfter(pos == 0 ? nullptr : NodeAt(pos - 1));
+    }
+    /**
+     * @brief Deconstructs and removes the object after a position.
+     *
+     * @param pos The position before the object to erase, which must not be the last position.
+     * @return Iterator - The position after the erased object.
+     */
+    inline Iterator EraseAfter(ConstIterator pos) {
+        UnlinkAfter(pos.p_Node);
 
-        toDelete->data.~T();
-        ofree(toDelete, oUnmanagedAllocator);
-        this->m_Size--;
+        return Iterator(pos.p_Node->next);
     }
     /**
      * @brief Deconstructs and removes the first encountered object with the given data.
-     * 
+     *
      * @param data The data of the node to remove.
-     * 
+     *
      * @note Does not handle pointer data.
      */
-    virtual void Remove(const T& data) {
-        Node* curr = this->p_Head;
+    void Remove(const T& data) {
+        Node* prev = nullptr;
 
-        while (curr->next && curr->data != data)
-            curr = curr->next;
+        for (Node* node = this->p_Head; node; prev = node, node = node->next) {
+            if (node->Data() == data) {
+                UnlinkAfter(prev);
 
-        
+                return;
+            }
+        }
     }
     /**
      * @brief Deconstructs and removes all objects with the given data.
-     * 
+     *
      * @param data The data of the nodes to remove.
-     * 
+     *
      * @note Does not handle pointer data.
      */
-    virtual void RemoveAll(const T& data) = 0;
+    void RemoveAll(const T& data) {
+        // The data may be stored in the list, so it is compared against a copy.
+        //
+        const T value = data;
+        Node* prev = nullptr;
+        Node* node = this->p_Head;
+
+        while (node) {
+            if (node->Data() == value) {
+                UnlinkAfter(prev);
+                node = prev ? prev->next : this->p_Head;
+            }
+            else {
+                prev = node;
+                node = node->next;
+            }
+        }
+    }
 
     /**
      * @brief Erases the first node in the List.
-     * 
+     *
      * @note Does not handle pointer data.
      */
-    virtual void PopFront() = 0;
+    void PopFront() {
+        if (this->m_Size == 0)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to PopFront an empty List!");
+
+        UnlinkAfter(nullptr);
+    }
     /**
-     * @brief Erases the last node in the List.
-     * 
+     * @brief Erases the last node in the List, walking to the node before it.
+     *
      * @note Does not handle pointer data.
      */
-    virtual void PopBack() = 0;
+    void PopBack() {
+        if (this->m_Size == 0)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to PopBack an empty List!");
+
+        UnlinkAfter(this->m_Size == 1 ? nullptr : NodeAt(this->m_Size - 2));
+    }
+
+    /**
+     * @brief Moves every node of another Singly Linked List to the back of this one, leaving the other empty.
+     *
+     * @details When both lists allocate from the same allocator this is O(1), the other list's pool is taken over
+     * with its nodes. Otherwise the data is moved node by node.
+     *
+     * @param other The Singly Linked List to take the nodes of.
+     */
+    void Splice(SinglyLinkedList& other) {
+        if (&other == this || other.m_Size == 0)
+            return;
+
+        if (this->m_Allocator != other.m_Allocator) {
+            for (T& data : other)
+                EmplaceBack(std::move(data));
 
+            other.Clear();
+
+            return;
+        }
+
+        if (static_cast<sizet>(this->m_Size) + other.m_Size > std::numeric_limits<u16>::max())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Attempt to grow a List past its maximum size!");
+
+        if (this->p_Tail)
+            this->p_Tail->next = other.p_Head;
+        else
+            this->p_Head = other.p_Head;
+
+        this->p_Tail = other.p_Tail;
+        this->m_Size += other.m_Size;
+
+        other.p_Head = nullptr;
+        other.p_Tail = nullptr;
+        other.m_Size = 0;
+
+        AdoptPool(other);
+    }
     /**
-     * @brief Merges the List with the List given.
-     * 
+     * @brief Merges the List with the List given, by splicing its nodes onto the back.
+     *
      * @param other The List to merge into this List.
      */
-    virtual void Merge(List<T>& other) = 0;
+    inline void Merge(SinglyLinkedList& other) { Splice(other); }
     /**
-     * @brief Removes all duplicate nodes within the List to make all nodes unique.
+     * @brief Removes all duplicate nodes within the List to make all nodes unique, keeping the first of each.
      */
-    virtual void MakeUnique() = 0;
+    void MakeUnique() {
+        for (Node* node = this->p_Head; node; node = node->next) {
+            Node* prev = node;
+
+            while (prev->next) {
+                if (prev->next->Data() == node->Data())
+                    UnlinkAfter(prev);
+                else
+                    prev = prev->next;
+            }
+        }
+    }
     /**
      * @brief Reverses the List order.
      */
-    virtual void Reverse() = 0;
+    void Reverse() {
+        Node* prev = nullptr;
+        Node* node = this->p_Head;
+
+        this->p_Tail = node;
+
+        while (node) {
+            Node* next = node->next;
+
+            node->next = prev;
+            prev = node;
+            node = next;
+        }
+
+        this->p_Head = prev;
+    }
+
+    /**
+     * @brief Fills the pool so that the list holds at least the given number of nodes without allocating.
+     *
+     * @param capacity The number of nodes.
+     */
+    void Reserve(sizet capacity) {
+        if (capacity > this->m_Capacity)
+            AddChunk(capacity - this->m_Capacity);
+    }
+
+    /**
+     * @brief Gets the first data in the List.
+     *
+     * @return T&
+     */
+    inline T& Front() { return this->p_Head->Data(); }
+    /**
+     * @brief Gets the first data in the List.
+     *
+     * @return const T&
+     */
+    inline const T& Front() const { return this->p_Head->Data(); }
+    /**
+     * @brief Gets the last data in the List.
+     *
+     * @return T&
+     */
+    inline T& Back() { return this->p_Tail->Data(); }
+    /**
+     * @brief Gets the last data in the List.
+     *
+     * @return const T&
+     */
+    inline const T& Back() const { return this->p_Tail->Data(); }
+
+    /**
+     * @brief Gets a Iterator to the first data of the List.
+     *
+     * @return Iterator
+     */
+    inline Iterator Begin() { return Iterator(this->p_Head); }
+    inline Iterator begin() { return Begin(); }
+    /**
+     * @brief Gets a ConstIterator to the first data of the List.
+     *
+     * @return ConstIterator
+     */
+    inline ConstIterator Begin() const { return ConstIterator(this->p_Head); }
+    inline ConstIterator begin() const { return Begin(); }
+    /**
+     * @brief Gets a Iterator past the last data of the List.
+     *
+     * @return Iterator
+     */
+    inline Iterator End() { return Iterator(nullptr); }
+    inline Iterator end() { return End(); }
+    /**
+     * @brief Gets a ConstIterator past the last data of the List.
+     *
+     * @return ConstIterator
+     */
+    inline ConstIterator End() const { return ConstIterator(nullptr); }
+    inline ConstIterator end() const { return End(); }
+
+    /**
+     * @return sizet - The number of nodes in the pool, in use or free.
+     */
+    inline sizet Capacity() const { return this->m_Capacity; }
+    /**
+     * @return const A& - The allocator policy of the node pool.
+     */
+    inline const A& GetAllocator() const { return this->m_Allocator; }
+
+private:
+    /**
+     * @brief Walks from the head to a node.
+     *
+     * @param pos The position of the node, which must be in the List.
+     * @return Node*
+     */
+    inline Node* NodeAt(sizet pos) const {
+        Node* node = this->p_Head;
+
+        for (sizet i = 0; i < pos; i++)
+            node = node->next;
+
+        return node;
+    }
+
+    /**
+     * @brief Takes a node from the pool and constructs its data, the node is not yet linked.
+     *
+     * @tparam Args
+     * @param args The type T constructor arguments.
+     * @return Node*
+     */
+    template <class ... Args>
+    Node* Construct(Args&& ... args) {
+        if (this->m_Size == std::numeric_limits<u16>::max())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Attempt to grow a List past its maximum size!");
+
+        if (!this->p_Free)
+            AddChunk(std::clamp(this->m_Capacity, k_MinimumChunk, k_MaximumChunk));
+
+        Node* node = this->p_Free;
+        new (node->storage) T(std::forward<Args>(args)...);
+
+        // The node only leaves the pool once the data is built, so a throwing constructor loses nothing.
+        //
+        this->p_Free = node->next;
+
+        if (!this->p_Free)
+            this->p_FreeTail = nullptr;
+
+        this->m_Size++;
+
+        return node;
+    }
+    /**
+     * @brief Constructs a node and links it after another.
+     *
+     * @tparam Args
+     * @param prev The node to link after.
+     * @param args The type T constructor arguments.
+     * @return Node* - The new node.
+     */
+    template <class ... Args>
+    Node* LinkAfter(Node* prev, Args&& ... args) {
+        Node* node = Construct(std::forward<Args>(args)...);
+
+        node->next = prev->next;
+        prev->next = node;
+
+        if (prev == this->p_Tail)
+            this->p_Tail = node;
+
+        return node;
+    }
+    /**
+     * @brief Unlinks a node, destroys its data and returns it to the pool.
+     *
+     * @param prev The node before the one to unlink, or nullptr to unlink the head.
+     */
+    void UnlinkAfter(Node* prev) {
+        Node* node = prev ? prev->next : this->p_Head;
+
+        if (prev)
+            prev->next = node->next;
+        else
+            this->p_Head = node->next;
+
+        if (node == this->p_Tail)
+            this->p_Tail = prev;
+
+        node->Data().~T();
+
+        node->next = this->p_Free;
+        this->p_Free = node;
+
+        if (!this->p_FreeTail)
+            this->p_FreeTail = node;
+
+        this->m_Size--;
+    }
+
+    /**
+     * @brief Allocates a chunk of nodes and adds them to the free list.
+     *
+     * @param count The number of nodes.
+     */
+    void AddChunk(sizet count) {
+        void* memory = oallocaa(k_ChunkHeader + count * sizeof(Node), &this->m_Allocator, std::max(alignof(Chunk), alignof(Node)));
+        if (!memory)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to allocate Singly Linked List nodes!");
+
+        Chunk* chunk = new (memory) Chunk{ nullptr, count };
+        Node* nodes = reinterpret_cast<Node*>(static_cast<unsigned char*>(memory) + k_ChunkHeader);
+
+        for (sizet i = 0; i + 1 < count; i++)
+            nodes[i].next = &nodes[i + 1];
+
+        nodes[count - 1].next = this->p_Free;
+
+        if (!this->p_Free)
+            this->p_FreeTail = &nodes[count - 1];
+
+        this->p_Free = nodes;
+
+        if (this->p_LastChunk)
+            this->p_LastChunk->next = chunk;
+        else
+            this->p_Chunks = chunk;
+
+        this->p_LastChunk = chunk;
+        this->m_Capacity += count;
+    }
+
+    /**
+     * @brief Takes over the free nodes and chunks of another list's pool, which must share the allocator.
+     *
+     * @param other The list to take the pool of, after its nodes have been unlinked.
+     */
+    void AdoptPool(SinglyLinkedList& other) {
+        if (other.p_Free) {
+            if (this->p_FreeTail)
+                this->p_FreeTail->next = other.p_Free;
+            else
+                this->p_Free = other.p_Free;
+
+            this->p_FreeTail = other.p_FreeTail;
+        }
+
+        if (other.p_Chunks) {
+            if (this->p_LastChunk)
+                this->p_LastChunk->next = other.p_Chunks;
+            else
+                this->p_Chunks = other.p_Chunks;
+
+            this->p_LastChunk = other.p_LastChunk;
+        }
+
+        this->m_Capacity += other.m_Capacity;
+
+        other.p_Free = nullptr;
+        other.p_FreeTail = nullptr;
+        other.p_Chunks = nullptr;
+        other.p_LastChunk = nullptr;
+        other.m_Capacity = 0;
+    }
+    /**
+     * @brief Takes over the nodes and the pool of another list, this list must be empty with no pool.
+     *
+     * @param other The list to take over, which is left empty.
+     */
+    void Adopt(SinglyLinkedList& other) {
+        this->p_Head = other.p_Head;
+        this->p_Tail = other.p_Tail;
+        this->m_Size = other.m_Size;
+
+        other.p_Head = nullptr;
+        other.p_Tail = nullptr;
+        other.m_Size = 0;
+
+        AdoptPool(other);
+    }
+
+    /**
+     * @brief Destroys the data and frees every chunk of the pool.
+     */
+    void Release() {
+        Clear();
+
+        Chunk* chunk = this->p_Chunks;
+
+        while (chunk) {
+            Chunk* next = chunk->next;
+            ofree(chunk, &this->m_Allocator);
+            chunk = next;
+        }
+
+        this->p_Free = nullptr;
+        this->p_FreeTail = nullptr;
+        this->p_Chunks = nullptr;
+        this->p_LastChunk = nullptr;
+        this->m_Capacity = 0;
+    }
 
 protected:
+    /** @brief The allocator policy of the node pool. */
+    A m_Allocator;
+
+    /** @brief The first node of the List. */
     Node* p_Head;
+    /** @brief The last node of the List. */
+    Node* p_Tail;
+
+    /** @brief The first free node of the pool. */
+    Node* p_Free;
+    /** @brief The last free node of the pool, so that a spliced pool is joined in O(1). */
+    Node* p_FreeTail;
+
+    /** @brief The first chunk of the pool. */
+    Chunk* p_Chunks;
+    /** @brief The last chunk of the pool. */
+    Chunk* p_LastChunk;
+    /** @brief The number of nodes in the pool's chunks. */
+    sizet m_Capacity;
 
 };  // SinglyLinkedList
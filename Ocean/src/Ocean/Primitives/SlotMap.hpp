@@ -0,0 +1,697 @@
+#pragma once
+
+/**
+ * @file SlotMap.hpp
+ * @brief A generational slot map, storing objects densely and naming them with handles.
+ *
+ * @details A handle packs a slot index and the generation of the slot when the handle was made. Erasing an object
+ * bumps the generation of its slot, so every handle made before then stops resolving instead of reaching whatever
+ * object reuses the slot. The slots point into a dense array of objects, which is kept packed by moving the last
+ * object into the hole an erase leaves.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+#include "Ocean/Types/Iterator.hpp"
+
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
+#include "Ocean/Primitives/DynamicArray.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Memory.hpp"
+#include "Ocean/Primitives/Relocatable.hpp"
+
+// std
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief A handle to an object in a SlotMap, an index and a generation packed in an unsigned integer.
+ *
+ * @details Generations start at 1, so the zero handle never resolves and is used as the null handle.
+ *
+ * @tparam U The unsigned integer type of the handle.
+ * @tparam IndexBits The number of low bits that hold the slot index, the rest hold the generation.
+ */
+template <class U, u32 IndexBits>
+class SlotHandle {
+    static_assert(std::is_unsigned_v<U>, "A SlotHandle is packed in an unsigned integer.");
+    static_assert(IndexBits > 0 && IndexBits < sizeof(U) * 8, "A SlotHandle needs bits for both the index and the generation.");
+
+public:
+    using ValueType = U;
+
+    /** @brief The number of bits that hold the slot index. */
+    OC_STATIC_EXPR u32 k_IndexBits = IndexBits;
+    /** @brief The number of bits that hold the generation. */
+    OC_STATIC_EXPR u32 k_GenerationBits = sizeof(U) * 8 - IndexBits;
+    /** @brief The largest slot index. */
+    OC_STATIC_EXPR U k_MaxIndex = static_cast<U>((U(1) << IndexBits) - 1);
+    /** @brief The largest generation. */
+    OC_STATIC_EXPR U k_MaxGeneration = static_cast<U>(std::numeric_limits<U>::max() >> IndexBits);
+
+public:
+    constexpr SlotHandle() :
+        m_Value(0)
+    { }
+    /**
+     * @brief Construct a new SlotHandle from a slot index and generation.
+     *
+     * @param index The slot index, at most k_MaxIndex.
+     * @param generation The generation of the slot, at most k_MaxGeneration.
+     */
+    constexpr SlotHandle(U index, U generation) :
+        m_Value(static_cast<U>((generation << IndexBits) | index))
+    { }
+
+    /**
+     * @brief Rebuilds a handle from the value of Value(), e.g. after storing it in a plain integer.
+     *
+     * @param value The packed handle.
+     * @return SlotHandle
+     */
+    OC_STATIC constexpr SlotHandle FromValue(U value) {
+        SlotHandle handle;
+        handle.m_Value = value;
+
+        return handle;
+    }
+
+    constexpr b8 operator == (const SlotHandle& other) const { return this->m_Value == other.m_Value; }
+    constexpr b8 operator != (const SlotHandle& other) const { return this->m_Value != other.m_Value; }
+
+    /**
+     * @return U - The slot index.
+     */
+    constexpr U Index() const { return static_cast<U>(this->m_Value & k_MaxIndex); }
+    /**
+     * @return U - The generation of the slot when the handle was made.
+     */
+    constexpr U Generation() const { return static_cast<U>(this->m_Value >> IndexBits); }
+    /**
+     * @return U - The packed handle.
+     */
+    constexpr U Value() const { return this->m_Value; }
+
+    /**
+     * @return b8 - True if this is the null handle, False otherwise.
+     */
+    constexpr b8 IsNull() const { return this->m_Value == 0; }
+
+private:
+    /** @brief The generation in the high bits and the index in the low bits. */
+    U m_Value;
+
+};  // SlotHandle
+
+/** @brief A 32 bit handle, for up to about a million slots that each survive 4095 erases. */
+using SlotHandle32 = SlotHandle<u32, 20>;
+/** @brief A 64 bit handle, for up to about four billion slots that each survive four billion erases. */
+using SlotHandle64 = SlotHandle<u64, 32>;
+
+namespace std {
+
+    /**
+     * @brief Hashes a SlotHandle by its packed value, so handles can key a HashMap.
+     */
+    template <class U, u32 IndexBits>
+    struct hash<SlotHandle<U, IndexBits>> {
+        sizet operator () (const SlotHandle<U, IndexBits>& handle) const noexcept {
+            return hash<U>()(handle.Value());
+        }
+
+    };  // hash<SlotHandle>
+
+}  // std
+
+/**
+ * @brief A container that owns objects, names them with generational handles, and keeps them packed for iteration.
+ *
+ * @details Insert and Erase are O(1), and resolving a handle is two array reads. Erase moves the last object into
+ * the erased one's place, so the iteration order is not the insertion order and pointers to objects are invalidated
+ * by any Insert or Erase. Handles are never invalidated except by erasing their object.
+ *
+ * A slot whose generation runs out is retired instead of reused, so a handle can never resolve to a later object.
+ *
+ * @tparam T The object type.
+ * @tparam H The handle type, see SlotHandle32 and SlotHandle64.
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
+ */
+template <class T, class H = SlotHandle32, class A = MallocPolicy>
+class SlotMap {
+private:
+    using U = typename H::ValueType;
+
+    /** @brief The end of the free slot list. */
+    OC_STATIC_EXPR U k_NoSlot = std::numeric_limits<U>::max();
+    /** @brief The generation of a retired slot, which no handle can hold. */
+    OC_STATIC_EXPR U k_Retired = k_NoSlot;
+    /** @brief The capacity of the dense array when the first object is inserted. */
+    OC_STATIC_EXPR sizet k_MinimumCapacity = 8;
+
+    static_assert(H::k_MaxGeneration < k_Retired, "A SlotMap needs a generation that no handle can hold.");
+
+    /** @brief A slot, which a handle names. */
+    struct Slot {
+        /** @brief The index of the object in the dense array, or the next free slot if the slot is free. */
+        U dense;
+        /** @brief The generation of the handle to the current or next object in the slot. */
+        U generation;
+
+        b8 operator == (const Slot& other) const { return this->dense == other.dense && this->generation == other.generation; }
+
+    };  // Slot
+
+public:
+    using Handle = H;
+    using Iterator = RandomAccessIterator<T>;
+    using ConstIterator = RandomAccessIterator<const T>;
+
+public:
+    inline SlotMap() :
+        m_Allocator(),
+        p_Values(nullptr),
+        p_Owners(nullptr),
+        m_Size(0),
+        m_Capacity(0),
+        m_Slots(),
+        m_FreeHead(k_NoSlot)
+    { }
+    /**
+     * @brief Construct a new empty SlotMap that allocates from the given allocator.
+     *
+     * @param allocator The allocator policy to use.
+     */
+    inline explicit SlotMap(const A& allocator) :
+        m_Allocator(allocator),
+        p_Values(nullptr),
+        p_Owners(nullptr),
+        m_Size(0),
+        m_Capacity(0),
+        m_Slots(allocator),
+        m_FreeHead(k_NoSlot)
+    { }
+    /**
+     * @brief Construct a new SlotMap from another SlotMap, using the same allocator. Handles to the other SlotMap's
+     * objects resolve to the copies.
+     *
+     * @param other The SlotMap to copy from.
+     */
+    inline SlotMap(const SlotMap& other) :
+        m_Allocator(other.m_Allocator),
+        p_Values(nullptr),
+        p_Owners(nullptr),
+        m_Size(0),
+        m_Capacity(0),
+        m_Slots(other.m_Slots),
+        m_FreeHead(other.m_FreeHead)
+    {
+        CopyValuesFrom(other);
+    }
+    /**
+     * @brief Move a SlotMap to a new SlotMap, handles to the moved objects resolve in the new SlotMap.
+     *
+     * @param other The SlotMap to move from.
+     */
+    inline SlotMap(SlotMap&& other) :
+        m_Allocator(other.m_Allocator),
+        p_Values(other.p_Values),
+        p_Owners(other.p_Owners),
+        m_Size(other.m_Size),
+        m_Capacity(other.m_Capacity),
+        m_Slots(std::move(other.m_Slots)),
+        m_FreeHead(other.m_FreeHead)
+    {
+        other.Forget();
+    }
+    inline ~SlotMap() {
+        Release();
+    }
+
+    inline SlotMap& operator = (const SlotMap& other) {
+        if (this != &other) {
+            Release();
+
+            this->m_Allocator = other.m_Allocator;
+            this->m_Slots = other.m_Slots;
+            this->m_FreeHead = other.m_FreeHead;
+
+            CopyValuesFrom(other);
+        }
+
+        return *this;
+    }
+    inline SlotMap& operator = (SlotMap&& other) {
+        if (this != &other) {
+            Release();
+
+            this->m_Allocator = other.m_Allocator;
+            this->p_Values = other.p_Values;
+            this->p_Owners = other.p_Owners;
+            this->m_Size = other.m_Size;
+            this->m_Capacity = other.m_Capacity;
+            this->m_Slots = std::move(other.m_Slots);
+            this->m_FreeHead = other.m_FreeHead;
+
+            other.Forget();
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Inserts a copy of an object.
+     *
+     * @param value The object.
+     * @return Handle - The handle of the new object.
+     */
+    inline Handle Insert(const T& value) { return Emplace(value); }
+    /**
+     * @brief Inserts an object by moving it.
+     *
+     * @param value The object.
+     * @return Handle - The handle of the new object.
+     */
+    inline Handle Insert(T&& value) { return Emplace(std::move(value)); }
+
+    /**
+     * @brief Constructs a new object at the end of the dense array.
+     *
+     * @tparam Args
+     * @param args The type T constructor arguments.
+     * @return Handle - The handle of the new object.
+     */
+    template <class ... Args>
+    Handle Emplace(Args&& ... args) {
+        if (this->m_FreeHead == k_NoSlot) {
+            if (this->m_Slots.Size() > H::k_MaxIndex)
+                throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "SlotMap has no slots left for its handle type!");
+
+            this->m_Slots.PushBack({ k_NoSlot, 1 });
+            this->m_FreeHead = static_cast<U>(this->m_Slots.Size() - 1);
+        }
+
+        if (this->m_Size == this->m_Capacity) {
+            // The arguments may refer to an object, which is moved by the growth. So the object is built first.
+            //
+            StagedValue<T> staged(std::forward<Args>(args)...);
+
+            SetCapacity(NextCapacity());
+
+            staged.RelocateTo(&this->p_Values[this->m_Size]);
+        }
+        else {
+            new (&this->p_Values[this->m_Size]) T(std::forward<Args>(args)...);
+        }
+
+        const U index = this->m_FreeHead;
+        Slot& slot = this->m_Slots[index];
+
+        this->m_FreeHead = slot.dense;
+
+        slot.dense = static_cast<U>(this->m_Size);
+        this->p_Owners[this->m_Size] = index;
+        this->m_Size++;
+
+        return Handle(index, slot.generation);
+    }
+
+    /**
+     * @brief Erases the object of a handle.
+     *
+     * @param handle The handle.
+     * @return b8 - True if the object was erased, False if the handle did not resolve.
+     */
+    b8 Erase(Handle handle) {
+        if (!Contains(handle))
+            return false;
+
+        const U dense = this->m_Slots[handle.Index()].dense;
+        const sizet last = this->m_Size - 1;
+
+        this->p_Values[dense].~T();
+
+        if (dense != last) {
+            RelocateValue(&this->p_Values[last], &this->p_Values[dense]);
+
+            this->p_Owners[dense] = this->p_Owners[last];
+            this->m_Slots[this->p_Owners[dense]].dense = dense;
+        }
+
+        this->m_Size--;
+
+        FreeSlot(handle.Index());
+
+        return true;
+    }
+
+    /**
+     * @param handle The handle.
+     * @return b8 - True if the handle resolves to an object, False if it is null or stale.
+     */
+    inline b8 Contains(Handle handle) const {
+        const U index = handle.Index();
+
+        // A free slot holds the generation of the next handle to it, which was never given out.
+        //
+        return index < this->m_Slots.Size() && this->m_Slots[index].generation == handle.Generation();
+    }
+
+    /**
+     * @brief Resolves a handle.
+     *
+     * @param handle The handle.
+     * @return T* - The object, or nullptr if the handle does not resolve.
+     */
+    inline T* Get(Handle handle) {
+        return Contains(handle) ? &this->p_Values[this->m_Slots[handle.Index()].dense] : nullptr;
+    }
+    /**
+     * @brief Resolves a handle.
+     *
+     * @param handle The handle.
+     * @return const T* - The object, or nullptr if the handle does not resolve.
+     */
+    inline const T* Get(Handle handle) const {
+        return Contains(handle) ? &this->p_Values[this->m_Slots[handle.Index()].dense] : nullptr;
+    }
+
+    /**
+     * @brief Resolves a handle, throwing if it does not resolve.
+     *
+     * @param handle The handle.
+     * @return T&
+     */
+    inline T& At(Handle handle) {
+        if (!Contains(handle))
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "SlotMap handle is null or stale!");
+
+        return this->p_Values[this->m_Slots[handle.Index()].dense];
+    }
+    /**
+     * @brief Resolves a handle, throwing if it does not resolve.
+     *
+     * @param handle The handle.
+     * @return const T&
+     */
+    inline const T& At(Handle handle) const {
+        return const_cast<SlotMap*>(this)->At(handle);
+    }
+
+    /**
+     * @brief Resolves a handle that is known to resolve, without checking it.
+     *
+     * @param handle The handle.
+     * @return T&
+     */
+    inline T& operator [] (Handle handle) { return this->p_Values[this->m_Slots[handle.Index()].dense]; }
+    /**
+     * @brief Resolves a handle that is known to resolve, without checking it.
+     *
+     * @param handle The handle.
+     * @return const T&
+     */
+    inline const T& operator [] (Handle handle) const { return this->p_Values[this->m_Slots[handle.Index()].dense]; }
+
+    /**
+     * @brief Gets the handle of the object at an index of the dense array, e.g. while iterating.
+     *
+     * @param index The index in the dense array.
+     * @return Handle
+     */
+    inline Handle HandleAt(sizet index) const {
+        const U slot = this->p_Owners[index];
+
+        return Handle(slot, this->m_Slots[slot].generation);
+    }
+
+    /**
+     * @brief Erases every object, every handle to them stops resolving. The slots and the dense array are kept for
+     * reuse.
+     */
+    void Clear() {
+        for (sizet i = 0; i < this->m_Size; i++) {
+            this->p_Values[i].~T();
+            this->m_Slots[this->p_Owners[i]].generation++;
+        }
+
+        this->m_Size = 0;
+
+        // Rebuild the free list so the lowest slots are reused first.
+        //
+        this->m_FreeHead = k_NoSlot;
+
+        for (sizet i = this->m_Slots.Size(); i-- > 0; ) {
+            Slot& slot = this->m_Slots[i];
+
+            if (slot.generation > H::k_MaxGeneration)
+                slot.generation = k_Retired;
+
+            if (slot.generation != k_Retired) {
+                slot.dense = this->m_FreeHead;
+                this->m_FreeHead = static_cast<U>(i);
+            }
+        }
+    }
+
+    /**
+     * @brief Makes room for space more objects without reallocating.
+     *
+     * @param space The number of objects to make room for.
+     */
+    inline void Reserve(sizet space) {
+        if (space > MaxSize() - this->m_Size)
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested SlotMap capacity is too large!");
+
+        if (this->m_Size + space > this->m_Capacity)
+            SetCapacity(this->m_Size + space);
+
+        this->m_Slots.Reserve(space);
+    }
+
+    /**
+     * @brief Gets a Iterator to the first object of the dense array.
+     *
+     * @return Iterator
+     */
+    inline Iterator Begin() { return Iterator(this->p_Values); }
+    inline Iterator begin() { return Begin(); }
+    /**
+     * @brief Gets a ConstIterator to the first object of the dense array.
+     *
+     * @return ConstIterator
+     */
+    inline ConstIterator Begin() const { return ConstIterator(this->p_Values); }
+    inline ConstIterator begin() const { return Begin(); }
+    /**
+     * @brief Gets a Iterator past the last object of the dense array.
+     *
+     * @return Iterator
+     */
+    inline Iterator End() { return Iterator(this->p_Values + this->m_Size); }
+    inline Iterator end() { return End(); }
+    /**
+     * @brief Gets a ConstIterator past the last object of the dense array.
+     *
+     * @return ConstIterator
+     */
+    inline ConstIterator End() const { return ConstIterator(this->p_Values + this->m_Size); }
+    inline ConstIterator end() const { return End(); }
+
+    /**
+     * @brief Gets the dense array of objects.
+     *
+     * @return T*
+     */
+    inline T* Data() { return this->p_Values; }
+    /**
+     * @brief Gets the dense array of objects.
+     *
+     * @return const T*
+     */
+    inline const T* Data() const { return this->p_Values; }
+
+    /**
+     * @return A - The allocator policy of the SlotMap.
+     */
+    inline A GetAllocator() const { return this->m_Allocator; }
+
+    /**
+     * @return b8 - True if the SlotMap has no objects, False otherwise.
+     */
+    inline b8 Empty() const { return this->m_Size == 0; }
+    /**
+     * @return sizet - The number of objects.
+     */
+    inline sizet Size() const { return this->m_Size; }
+    /**
+     * @return sizet - The number of objects the SlotMap can hold before reallocating.
+     */
+    inline sizet Capacity() const { return this->m_Capacity; }
+    /**
+     * @return sizet - The most objects a SlotMap with this handle type can hold.
+     */
+    OC_STATIC_EXPR sizet MaxSize() {
+        return std::min(static_cast<sizet>(H::k_MaxIndex) + 1, std::numeric_limits<sizet>::max() / sizeof(T));
+    }
+
+private:
+    /**
+     * @brief Bumps the generation of an emptied slot and puts it on the free list, or retires it if the generation
+     * ran out.
+     *
+     * @param index The slot index.
+     */
+    inline void FreeSlot(U index) {
+        Slot& slot = this->m_Slots[index];
+
+        if (slot.generation == H::k_MaxGeneration) {
+            slot.generation = k_Retired;
+
+            return;
+        }
+
+        slot.generation++;
+        slot.dense = this->m_FreeHead;
+
+        this->m_FreeHead = index;
+    }
+
+    /**
+     * @return sizet - The capacity to grow to when the dense array is full.
+     */
+    inline sizet NextCapacity() const {
+        if (this->m_Size >= MaxSize())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "SlotMap is full!");
+
+        return std::min(std::max(this->m_Capacity * 2, k_MinimumCapacity), MaxSize());
+    }
+
+    /**
+     * @brief Reallocates the dense array and the owner of each object, relocating the objects.
+     *
+     * @param capacity The new capacity, not smaller than the size.
+     */
+    void SetCapacity(sizet capacity) {
+        // The owners are grown first, a failure to grow the objects then leaves a SlotMap that still works.
+        //
+        U* owners = oreallocat(this->p_Owners, U, this->m_Capacity, capacity, &this->m_Allocator);
+        if (!owners)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to grow the SlotMap!");
+
+        this->p_Owners = owners;
+
+        T* values = nullptr;
+
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            values = oreallocat(this->p_Values, T, this->m_Capacity, capacity, &this->m_Allocator);
+            if (!values)
+                throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to grow the SlotMap!");
+        }
+        else {
+            values = oallocat(T, capacity, &this->m_Allocator);
+            if (!values)
+                throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to grow the SlotMap!");
+
+            for (sizet i = 0; i < this->m_Size; i++)
+                RelocateValue(&this->p_Values[i], &values[i]);
+
+            if (this->p_Values)
+                ofree(this->p_Values, &this->m_Allocator);
+        }
+
+        this->p_Values = values;
+        this->m_Capacity = capacity;
+    }
+
+    /**
+     * @brief Moves an object to uninitialized memory and ends the source's lifetime.
+     *
+     * @param source The object to move.
+     * @param destination The memory to move it to.
+     */
+    OC_STATIC void RelocateValue(T* source, T* destination) {
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            memcpy(static_cast<void*>(destination), static_cast<const void*>(source), sizeof(T));
+        }
+        else {
+            new (destination) T(std::move(*source));
+
+            source->~T();
+        }
+    }
+
+    /**
+     * @brief Copies the objects and their owners of another SlotMap into this empty one, keeping their dense order.
+     *
+     * @param other The SlotMap to copy.
+     */
+    void CopyValuesFrom(const SlotMap& other) {
+        if (other.m_Size == 0)
+            return;
+
+        SetCapacity(other.m_Size);
+
+        for (sizet i = 0; i < other.m_Size; i++) {
+            new (&this->p_Values[i]) T(other.p_Values[i]);
+
+            this->m_Size++;
+        }
+
+        memcpy(this->p_Owners, other.p_Owners, other.m_Size * sizeof(U));
+    }
+
+    /**
+     * @brief Destroys the objects and frees the dense array. The slots are left to their DynamicArray.
+     */
+    void Release() {
+        for (sizet i = 0; i < this->m_Size; i++)
+            this->p_Values[i].~T();
+
+        if (this->p_Values)
+            ofree(this->p_Values, &this->m_Allocator);
+
+        if (this->p_Owners)
+            ofree(this->p_Owners, &this->m_Allocator);
+
+        this->p_Values = nullptr;
+        this->p_Owners = nullptr;
+        this->m_Size = 0;
+        this->m_Capacity = 0;
+    }
+
+    /**
+     * @brief Empties the SlotMap without touching its memory, after it was handed to another SlotMap.
+     */
+    inline void Forget() {
+        this->p_Values = nullptr;
+        this->p_Owners = nullptr;
+        this->m_Size = 0;
+        this->m_Capacity = 0;
+        this->m_Slots.Clear();
+        this->m_FreeHead = k_NoSlot;
+    }
+
+private:
+    /** @brief The allocator policy of the SlotMap. */
+    A m_Allocator;
+
+    /** @brief The objects, packed. */
+    T* p_Values;
+    /** @brief The slot of each object in p_Values. */
+    U* p_Owners;
+    /** @brief The number of objects. */
+    sizet m_Size;
+    /** @brief The capacity of p_Values and p_Owners. */
+    sizet m_Capacity;
+
+    /** @brief The slots, indexed by the handles. */
+    DynamicArray<Slot, A> m_Slots;
+    /** @brief The first free slot, or k_NoSlot if every slot is taken or retired. */
+    U m_FreeHead;
+
+};  // SlotMap
@@ -0,0 +1,728 @@
+#pragma once
+
+#include "Ocean/Types/Integers.hpp"
+#include "Ocean/Types/Iterator.hpp"
+
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
+#include "Ocean/Primitives/Memory.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Relocatable.hpp"
+
+#include "Ocean/Primitives/Structures/Container.hpp"
+
+// std
+#include <initializer_list>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief A dynamically sized array that stores its first N elements inline.
+ *
+ * @details Short lists never touch the allocator and keep their elements next to the rest of the owning object. Once
+ * the array outgrows N elements it spills to the allocator and grows geometrically, like a DynamicArray. The API is the
+ * same as DynamicArray's, so the two can be swapped at a call site.
+ *
+ * @tparam T The data type.
+ * @tparam N The number of elements stored inline.
+ * @tparam A The allocator policy used after spilling, see AllocatorPolicy.hpp.
+ */
+template <class T, sizet N, class A = MallocPolicy>
+class OC_EMPTY_BASES SmallArray : public Container<SmallArray<T, N, A>>, private PolicyStorage<A> {
+    static_assert(N > 0, "A SmallArray needs at least one inline element, use a DynamicArray instead.");
+
+public:
+    using Iterator = RandomAccessIterator<T>;
+    using ConstIterator = RandomAccessIterator<const T>;
+
+    /** @brief The factor the capacity is multiplied with when the array is full. */
+    OC_STATIC_EXPR sizet k_GrowthFactor = 2;
+
+public:
+    inline SmallArray() :
+        PolicyStorage<A>(A()),
+        m_Size(0),
+        m_Capacity(N),
+        p_Data(InlineData())
+    { }
+    /**
+     * @brief Construct a new empty Small Array that spills to the given allocator.
+     *
+     * @param allocator The allocator policy to use.
+     */
+    inline explicit SmallArray(const A& allocator) :
+        PolicyStorage<A>(allocator),
+        m_Size(0),
+        m_Capacity(N),
+        p_Data(InlineData())
+    { }
+    /**
+     * @brief Construct a new Small Array with room for at least the given number of elements.
+     *
+     * @param size The initial capacity, the inline storage is used if it is large enough.
+     * @param allocator The allocator policy to use. (OPTIONAL)
+     */
+    inline SmallArray(sizet size, const A& allocator = A()) :
+        PolicyStorage<A>(allocator),
+        m_Size(0),
+        m_Capacity(N),
+        p_Data(InlineData())
+    {
+        if (size > N)
+            SetCapacity(size);
+    }
+    /**
+     * @brief Construct a new Small Array from another Small Array, using the same allocator.
+     *
+     * @param rhs The Small Array to copy from.
+     */
+    inline SmallArray(const SmallArray& rhs) :
+        PolicyStorage<A>(rhs.Policy()),
+        m_Size(0),
+        m_Capacity(N),
+        p_Data(InlineData())
+    {
+        if (rhs.m_Size > N)
+            SetCapacity(rhs.m_Size);
+
+        CopyConstruct(rhs.p_Data, rhs.m_Size);
+    }
+    /**
+     * @brief Move a Small Array to a new Small Array.
+     * @note Inline elements are relocated one by one, spilled ones are taken over with their allocation.
+     *
+     * @param other The Small Array to move data from.
+     */
+    inline SmallArray(SmallArray&& other) :
+        PolicyStorage<A>(other.Policy()),
+        m_Size(0),
+        m_Capacity(N),
+        p_Data(InlineData())
+    {
+        Adopt(other);
+    }
+    /**
+     * @brief Construct a new Small Array from an initial list.
+     *
+     * @param list The initial list of type T to store.
+     */
+    inline SmallArray(const std::initializer_list<T>& list) :
+        PolicyStorage<A>(A()),
+        m_Size(0),
+        m_Capacity(N),
+        p_Data(InlineData())
+    {
+        if (list.size() > N)
+            SetCapacity(list.size());
+
+        // The elements of an initializer list are const, so they can only be copied.
+        //
+        CopyConstruct(list.begin(), list.size());
+    }
+    inline ~SmallArray() {
+        Release();
+    }
+
+    inline SmallArray& operator = (const SmallArray& rhs) {
+        if (this != &rhs) {
+            Clear();
+
+            if (this->m_Capacity < rhs.m_Size)
+                SetCapacity(rhs.m_Size);
+
+            CopyConstruct(rhs.p_Data, rhs.m_Size);
+        }
+
+        return *this;
+    }
+    inline SmallArray& operator = (SmallArray&& other) {
+        if (this != &other) {
+            Release();
+
+            // A spilled allocation is adopted, so the allocator that owns it comes along.
+            //
+            this->Policy() = other.Policy();
+
+            Adopt(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Equality comparison, element by element. Container provides operator != from it.
+     *
+     * @param other The SmallArray to compare with.
+     * @return b8 - True if equal, False otherwise.
+     */
+    inline b8 operator == (const SmallArray& other) const {
+        if (this->m_Size != other.m_Size)
+            return false;
+
+        return std::equal(this->Begin(), this->End(), other.Begin());
+    }
+    /** @brief The policy base has an operator != of its own, this one compares arrays. */
+    using Container<SmallArray<T, N, A>>::operator !=;
+
+    /**
+     * @brief Gets the element at the given index with range checking.
+     *
+     * @param index The index to get in the Array.
+     * @return T&
+     */
+    inline constexpr T& At(sizet index) {
+        if (index >= this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Array range!");
+
+        return this->p_Data[index];
+    }
+    /**
+     * @brief Gets the element at the given index with range checking.
+     *
+     * @param index The index to get in the Array.
+     * @return const T&
+     */
+    inline constexpr const T& At(sizet index) const {
+        if (index >= this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Array range!");
+
+        return this->p_Data[index];
+    }
+
+    /**
+     * @brief Gets the element at the given index.
+     *
+     * @param i The index to get in the Array.
+     * @return T&
+     */
+    inline constexpr T& operator [] (sizet i) { return this->p_Data[i]; }
+    /**
+     * @brief Gets the element at the given index.
+     *
+     * @param i The index to get in the Array.
+     * @return const T&
+     */
+    inline constexpr const T& operator [] (sizet i) const { return this->p_Data[i]; }
+
+    /**
+     * @brief Gets the first element in the Array.
+     *
+     * @return T&
+     */
+    inline constexpr T& Front() { return this->p_Data[0]; }
+    /**
+     * @brief Gets the first element in the Array.
+     *
+     * @return const T&
+     */
+    inline constexpr const T& Front() const { return this->p_Data[0]; }
+    /**
+     * @brief Gets the last element in the Array.
+     *
+     * @return T&
+     */
+    inline constexpr T& Back() { return this->p_Data[this->m_Size - 1]; }
+    /**
+     * @brief Gets the last element in the Array.
+     *
+     * @return const T&
+     */
+    inline constexpr const T& Back() const { return this->p_Data[this->m_Size - 1]; }
+
+    /**
+     * @brief Gets a Iterator to the beginning of the SmallArray.
+     *
+     * @return Iterator
+     */
+    inline constexpr Iterator Begin() { return Iterator(this->p_Data); }
+    inline constexpr Iterator begin() { return Begin(); }
+    /**
+     * @brief Gets a ConstIterator to the beginning of the SmallArray.
+     *
+     * @return ConstIterator
+     */
+    inline constexpr ConstIterator Begin() const { return ConstIterator(this->p_Data); }
+    inline constexpr ConstIterator begin() const { return Begin(); }
+    /**
+     * @brief Gets a Iterator to the end of the SmallArray.
+     *
+     * @return Iterator
+     */
+    inline constexpr Iterator End() { return Iterator(this->p_Data + this->m_Size); }
+    inline constexpr Iterator end() { return End(); }
+    /**
+     * @brief Gets a ConstIterator to the end of the SmallArray.
+     *
+     * @return ConstIterator
+     */
+    inline constexpr ConstIterator End() const { return ConstIterator(this->p_Data + this->m_Size); }
+    inline constexpr ConstIterator end() const { return End(); }
+
+    /**
+     * @brief Constructs a new object of type T at the given position.
+     *
+     * @tparam Args
+     * @param pos The position to construct a new object at.
+     * @param args The type T constructor arguments.
+     */
+    template <class ... Args>
+    inline void Emplace(sizet pos, Args&& ... args) {
+        if (pos > this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Array range!");
+
+        if (pos == this->m_Size) {
+            EmplaceBack(std::forward<Args>(args)...);
+
+            return;
+        }
+
+        // The arguments may refer to an element, so the value is built before anything is moved.
+        //
+        StagedValue<T> value(std::forward<Args>(args)...);
+
+        if (this->m_Size == this->m_Capacity)
+            SetCapacity(NextCapacity(this->m_Size + 1));
+
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            memmove(static_cast<void*>(this->p_Data + pos + 1), static_cast<const void*>(this->p_Data + pos), (this->m_Size - pos) * sizeof(T));
+        }
+        else {
+            // Shift elements to the right to make space for the new element. The last one moves into raw memory.
+            //
+            new (&this->p_Data[this->m_Size]) T(std::move(this->p_Data[this->m_Size - 1]));
+
+            for (sizet i = this->m_Size - 1; i > pos; i--)
+                this->p_Data[i] = std::move(this->p_Data[i - 1]);
+
+            this->p_Data[pos].~T();
+        }
+
+        value.RelocateTo(&this->p_Data[pos]);
+
+        this->m_Size++;
+    }
+    /**
+     * @brief Constructs a new object of type T at the end of the Small Array.
+     *
+     * @tparam Args
+     * @param args The type T constructor arguments.
+     * @return T& - The new element.
+     */
+    template <class ... Args>
+    inline T& EmplaceBack(Args&& ... args) {
+        if (this->m_Size == this->m_Capacity)
+            return GrowAndEmplaceBack(std::forward<Args>(args)...);
+
+        T* element = new (&this->p_Data[this->m_Size]) T(std::forward<Args>(args)...);
+
+        this->m_Size++;
+
+        return *element;
+    }
+
+    /**
+     * @brief Copies an object to the end of the Small Array.
+     *
+     * @param value The object to copy.
+     */
+    inline void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+    /**
+     * @brief Moves an object to the end of the Small Array.
+     *
+     * @param value The object to move.
+     */
+    inline void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+    /**
+     * @brief Deconstructs and removes the last object of the Small Array.
+     */
+    inline void PopBack() {
+        if (this->m_Size == 0)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to PopBack an empty Array!");
+
+        this->m_Size--;
+
+        this->p_Data[this->m_Size].~T();
+    }
+
+    /**
+     * @brief Deconstructs the elements within the Small Array. A spilled array keeps its allocation.
+     */
+    inline void Clear() {
+        Destroy(0, this->m_Size);
+
+        this->m_Size = 0;
+    }
+
+    /**
+     * @brief Deconstructs and removes the object at the given position.
+     *
+     * @param pos The integer position of the object.
+     */
+    inline void Erase(sizet pos) {
+        if (pos >= this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Array range!");
+
+        Erase(pos, pos + 1);
+    }
+    /**
+     * @brief Deconstructs and removes the object at the given position.
+     *
+     * @param pos The Iterator position of the object.
+     */
+    inline void Erase(Iterator pos) {
+        Erase(static_cast<sizet>(pos - Begin()));
+    }
+    /**
+     * @brief Deconstructs and removes the object at the given position.
+     *
+     * @param pos The ConstIterator position of the object.
+     */
+    inline void Erase(ConstIterator pos) {
+        Erase(static_cast<sizet>(pos - ConstIterator(this->p_Data)));
+    }
+    /**
+     * @brief Deconstructs and removes the objects within a given range.
+     *
+     * @param first The first integer position in the range.
+     * @param last The last integer position in the range.
+     * @return sizet - The number of objects erased.
+     */
+    inline sizet Erase(sizet first, sizet last) {
+        if (first >= this->m_Size || last > this->m_Size || first >= last)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Invalid range for Erase!");
+
+        const sizet count = last - first;
+
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            Destroy(first, last);
+
+            memmove(static_cast<void*>(this->p_Data + first), static_cast<const void*>(this->p_Data + last), (this->m_Size - last) * sizeof(T));
+        }
+        else {
+            // Shift elements to the left to fill the space, then deconstruct the moved-from tail.
+            //
+            std::move(this->p_Data + last, this->p_Data + this->m_Size, this->p_Data + first);
+
+            Destroy(this->m_Size - count, this->m_Size);
+        }
+
+        this->m_Size -= count;
+        return count;
+    }
+    /**
+     * @brief Deconstructs and removes the objects within a given range.
+     *
+     * @param first The first Iterator position in the range.
+     * @param last The last Iterator position in the range.
+     * @return sizet - The number of objects erased.
+     */
+    inline sizet Erase(Iterator first, Iterator last) {
+        return Erase(static_cast<sizet>(first - Begin()), static_cast<sizet>(last - Begin()));
+    }
+    /**
+     * @brief Deconstructs and removes the objects within a given range.
+     *
+     * @param first The first ConstIterator position in the range.
+     * @param last The last ConstIterator position in the range.
+     * @return sizet - The number of objects erased.
+     */
+    inline sizet Erase(ConstIterator first, ConstIterator last) {
+        const ConstIterator begin(this->p_Data);
+
+        return Erase(static_cast<sizet>(first - begin), static_cast<sizet>(last - begin));
+    }
+
+    /**
+     * @brief Reserves the requested amount of space.
+     * @note Reserve accounts for the number of existing items in the Small Array. Making the total requested capacity = space + Size().
+     *
+     * @param space The number of free elements to make space for.
+     */
+    inline void Reserve(sizet space) {
+        if (space > MaxSize() - this->m_Size)
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested Array capacity is too large!");
+
+        if (this->m_Capacity < (space + this->m_Size))
+            SetCapacity(space + this->m_Size);
+    }
+    /**
+     * @brief Releases the capacity that is not used by any element, moving the elements back inline if they fit.
+     */
+    inline void ShrinkToFit() {
+        if (this->m_Capacity > this->m_Size && !IsInline())
+            SetCapacity(this->m_Size);
+    }
+
+    /**
+     * @brief Gets the internal data pointer.
+     *
+     * @return T*
+     */
+    inline constexpr T* Data() { return this->p_Data; }
+    /**
+     * @brief Gets the internal data pointer.
+     *
+     * @return const T*
+     */
+    inline constexpr const T* Data() const { return this->p_Data; }
+
+    /**
+     * @return const A& - The allocator policy of the SmallArray.
+     */
+    inline const A& GetAllocator() const { return this->Policy(); }
+
+    /**
+     * @return b8 - True if the elements are stored inline, False if the array has spilled to its allocator.
+     */
+    inline b8 IsInline() const { return this->p_Data == InlineData(); }
+
+    /**
+     * @return b8 - True if the Array is empty, False otherwise.
+     */
+    inline constexpr b8 Empty() const { return this->m_Size == 0; }
+    /**
+     * @return sizet - The size of the Array.
+     */
+    inline constexpr sizet Size() const { return this->m_Size; }
+    /**
+     * @return sizet - The capacity of the Array.
+     */
+    inline constexpr sizet Capacity() const { return this->m_Capacity; }
+    /**
+     * @return sizet - The number of elements that are stored inline.
+     */
+    inline static constexpr sizet InlineCapacity() { return N; }
+    /**
+     * @return sizet - The largest number of elements the Array can address.
+     */
+    inline static constexpr sizet MaxSize() { return std::numeric_limits<sizet>::max() / sizeof(T); }
+
+    /**
+     * @brief Gets a JSON useable format of the SmallArray.
+     *
+     * @param os
+     * @param rhs
+     * @return std::ostream&
+     */
+    inline friend std::ostream& operator << (std::ostream& os, const SmallArray<T, N, A>& rhs) {
+        os << "{ ";
+
+        for (sizet i = 0; i < rhs.m_Size; i++)
+            os << (i == 0 ? "" : ", ") << rhs.p_Data[i];
+
+        os << " }";
+
+        return os;
+    }
+
+protected:
+    inline T* InlineData() { return reinterpret_cast<T*>(this->m_Inline); }
+    inline const T* InlineData() const { return reinterpret_cast<const T*>(this->m_Inline); }
+
+    /**
+     * @brief Gets the capacity to grow to, so that at least the required number of elements fit.
+     *
+     * @param required The number of elements that must fit.
+     * @return sizet
+     */
+    inline sizet NextCapacity(sizet required) const {
+        if (required > MaxSize())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested Array capacity is too large!");
+
+        const sizet capacity = this->m_Capacity > MaxSize() / k_GrowthFactor ? MaxSize() : this->m_Capacity * k_GrowthFactor;
+
+        return std::max(capacity, required);
+    }
+
+    /**
+     * @brief The slow path of EmplaceBack, taken when the array is full.
+     *
+     * @tparam Args
+     * @param args The type T constructor arguments.
+     * @return T& - The new element.
+     */
+    template <class ... Args>
+    T& GrowAndEmplaceBack(Args&& ... args) {
+        // The arguments may refer to an element, which is moved by the growth. So the value is built first.
+        //
+        StagedValue<T> value(std::forward<Args>(args)...);
+
+        SetCapacity(NextCapacity(this->m_Size + 1));
+
+        T* element = value.RelocateTo(&this->p_Data[this->m_Size]);
+
+        this->m_Size++;
+
+        return *element;
+    }
+
+    /**
+     * @brief Moves the elements to storage for exactly the given number of elements, or to the inline storage if they fit.
+     * @note The capacity must not be smaller than the current size.
+     *
+     * @param capacity The new capacity.
+     */
+    inline void SetCapacity(sizet capacity) {
+        if (capacity > MaxSize())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested Array capacity is too large!");
+
+        const b8 wasInline = IsInline();
+
+        if (capacity <= N) {
+            if (wasInline)
+                return;
+
+            // Move back into the inline storage.
+            //
+            T* heapData = this->p_Data;
+
+            Relocate(InlineData(), heapData, this->m_Size);
+            ofree(heapData, &this->Policy());
+
+            this->p_Data = InlineData();
+            this->m_Capacity = N;
+
+            return;
+        }
+
+        if (capacity == this->m_Capacity)
+            return;
+
+        T* newData = nullptr;
+
+        // A spilled block of trivially relocatable elements can be grown in place by the allocator.
+        //
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            if (!wasInline) {
+                newData = oreallocat(this->p_Data, T, this->m_Capacity, capacity, &this->Policy());
+                if (!newData)
+                    throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to resize the Array!");
+
+                this->p_Data = newData;
+                this->m_Capacity = capacity;
+
+                return;
+            }
+        }
+
+        newData = oallocat(T, capacity, &this->Policy());
+        if (!newData)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to resize the Array!");
+
+        Relocate(newData, this->p_Data, this->m_Size);
+
+        if (!wasInline)
+            ofree(this->p_Data, &this->Policy());
+
+        this->p_Data = newData;
+        this->m_Capacity = capacity;
+    }
+
+    /**
+     * @brief Moves count elements from source to the uninitialized destination, destroying the sources.
+     */
+    inline static void Relocate(T* destination, T* source, sizet count) {
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            if (count)
+                memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+        }
+        else {
+            for (sizet i = 0; i < count; i++) {
+                new (&destination[i]) T(std::move(source[i]));
+
+                source[i].~T();
+            }
+        }
+    }
+
+    /**
+     * @brief Takes over the elements of another Small Array, leaving it empty and inline.
+     * @note This array must be empty and inline.
+     *
+     * @param other The Small Array to take the elements from.
+     */
+    inline void Adopt(SmallArray& other) {
+        if (other.IsInline()) {
+            Relocate(InlineData(), other.p_Data, other.m_Size);
+        }
+        else {
+            this->p_Data = other.p_Data;
+            this->m_Capacity = other.m_Capacity;
+        }
+
+        this->m_Size = other.m_Size;
+
+        other.p_Data = other.InlineData();
+        other.m_Size = 0;
+        other.m_Capacity = N;
+    }
+
+    /**
+     * @brief Copy constructs the given elements at the end of the array.
+     * @note The capacity must already fit the elements.
+     *
+     * @param data The elements to copy.
+     * @param count The number of elements.
+     */
+    inline void CopyConstruct(const T* data, sizet count) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count)
+                memcpy(static_cast<void*>(this->p_Data + this->m_Size), static_cast<const void*>(data), count * sizeof(T));
+
+            this->m_Size += count;
+        }
+        else {
+            for (sizet i = 0; i < count; i++) {
+                new (&this->p_Data[this->m_Size]) T(data[i]);
+
+                this->m_Size++;
+            }
+        }
+    }
+
+    /**
+     * @brief Deconstructs the elements in the range [first, last).
+     *
+     * @param first The first position to deconstruct.
+     * @param last One past the last position to deconstruct.
+     */
+    inline void Destroy(sizet first, sizet last) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (sizet i = first; i < last; i++)
+                this->p_Data[i].~T();
+        }
+    }
+
+    /**
+     * @brief Deconstructs every element and frees a spilled allocation, leaving the array empty and inline.
+     */
+    inline void Release() {
+        Clear();
+
+        if (!IsInline())
+            ofree(this->p_Data, &this->Policy());
+
+        this->p_Data = InlineData();
+        this->m_Capacity = N;
+    }
+
+protected:
+    /** @brief The number of elements in the SmallArray. */
+    sizet m_Size;
+    /** @brief The number of elements that fit in the current storage, N while inline. */
+    sizet m_Capacity;
+    /** @brief The data pointer of the SmallArray, pointing at m_Inline until the array spills. */
+    T* p_Data;
+
+    /** @brief The inline storage of the first N elements. */
+    alignas(T) u8 m_Inline[N * sizeof(T)];
+
+};  // SmallArray
@@ -0,0 +1,618 @@
+#pragma once
+
+/**
+ * @file SoAArray.hpp
+ * @brief A dynamically sized array that stores each field of its elements in a separate stream.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
+#include "Ocean/Primitives/Memory.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Relocatable.hpp"
+#include "Ocean/Primitives/Span.hpp"
+
+// std
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief A dynamically sized array of elements made of the given fields, with every field kept in its own stream.
+ *
+ * @details A loop that reads two fields of a wide element only pulls those two streams through the cache, and each
+ * stream is a plain array the compiler can vectorize. All streams live in one allocation, every stream starting on a
+ * cache line, so growing the array costs one allocation and the streams are freed together.
+ *
+ * Elements are accessed as a tuple of references, so `auto [position, velocity] = particles[i];` works. Hot loops
+ * should take the streams with Field<I>() and index them directly.
+ *
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
+ * @tparam Fields The field types, in stream order.
+ */
+template <class A, class ... Fields>
+class BasicSoAArray : private PolicyStorage<A> {
+    static_assert(sizeof...(Fields) > 0, "A SoAArray needs at least one field.");
+    static_assert((!std::is_reference_v<Fields> && ...), "SoAArray fields must be value types.");
+
+public:
+    using Reference = std::tuple<Fields&...>;
+    using ConstReference = std::tuple<const Fields&...>;
+
+    /** @brief The type of the field at index I. */
+    template <sizet I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    /** @brief The number of fields, and so of streams. */
+    OC_STATIC_EXPR sizet k_FieldCount = sizeof...(Fields);
+    /** @brief The alignment of every stream, a cache line. */
+    OC_STATIC_EXPR sizet k_StreamAlignment = std::max({ static_cast<sizet>(64), alignof(Fields)... });
+    /** @brief The factor the capacity is multiplied with when the array is full. */
+    OC_STATIC_EXPR sizet k_GrowthFactor = 2;
+    /** @brief The smallest capacity the array grows to. */
+    OC_STATIC_EXPR sizet k_MinimumCapacity = 16;
+
+private:
+    using Indices = std::index_sequence_for<Fields...>;
+
+public:
+    inline BasicSoAArray() :
+        PolicyStorage<A>(A()),
+        m_Size(0),
+        m_Capacity(0),
+        p_Block(nullptr),
+        m_Streams()
+    { }
+    /**
+     * @brief Construct a new empty SoA Array with the given allocator.
+     *
+     * @param allocator The allocator policy to use.
+     */
+    inline explicit BasicSoAArray(const A& allocator) :
+        PolicyStorage<A>(allocator),
+        m_Size(0),
+        m_Capacity(0),
+        p_Block(nullptr),
+        m_Streams()
+    { }
+    /**
+     * @brief Construct a new empty SoA Array with room for the given number of elements.
+     *
+     * @param capacity The initial capacity.
+     * @param allocator The allocator policy to use. (OPTIONAL)
+     */
+    inline BasicSoAArray(sizet capacity, const A& allocator = A()) :
+        PolicyStorage<A>(allocator),
+        m_Size(0),
+        m_Capacity(0),
+        p_Block(nullptr),
+        m_Streams()
+    {
+        SetCapacity(capacity);
+    }
+    /**
+     * @brief Construct a new SoA Array from another SoA Array, using the same allocator.
+     *
+     * @param rhs The SoA Array to copy from.
+     */
+    inline BasicSoAArray(const BasicSoAArray& rhs) :
+        PolicyStorage<A>(rhs.Policy()),
+        m_Size(0),
+        m_Capacity(0),
+        p_Block(nullptr),
+        m_Streams()
+    {
+        SetCapacity(rhs.m_Size);
+
+        CopyConstruct(rhs, Indices{});
+    }
+    /**
+     * @brief Construct a new SoA Array by taking the streams of another SoA Array.
+     *
+     * @param rhs The SoA Array to move from, left empty.
+     */
+    inline BasicSoAArray(BasicSoAArray&& rhs) noexcept :
+        PolicyStorage<A>(rhs.Policy()),
+        m_Size(rhs.m_Size),
+        m_Capacity(rhs.m_Capacity),
+        p_Block(rhs.p_Block),
+        m_Streams(rhs.m_Streams)
+    {
+        rhs.m_Size = 0;
+        rhs.m_Capacity = 0;
+        rhs.p_Block = nullptr;
+        rhs.m_Streams = { };
+    }
+    inline ~BasicSoAArray() {
+        Release();
+    }
+
+    /**
+     * @brief Copies the elements of another SoA Array, reusing the streams if they are large enough.
+     *
+     * @param rhs The SoA Array to copy from.
+     * @return BasicSoAArray&
+     */
+    inline BasicSoAArray& operator = (const BasicSoAArray& rhs) {
+        if (this == &rhs)
+            return *this;
+
+        Clear();
+
+        if (this->m_Capacity < rhs.m_Size)
+            SetCapacity(rhs.m_Size);
+
+        CopyConstruct(rhs, Indices{});
+
+        return *this;
+    }
+    /**
+     * @brief Takes the streams of another SoA Array, releasing the current ones.
+     *
+     * @param rhs The SoA Array to move from, left empty.
+     * @return BasicSoAArray&
+     */
+    inline BasicSoAArray& operator = (BasicSoAArray&& rhs) noexcept {
+        if (this == &rhs)
+            return *this;
+
+        Release();
+
+        this->Policy() = rhs.Policy();
+        this->m_Size = rhs.m_Size;
+        this->m_Capacity = rhs.m_Capacity;
+        this->p_Block = rhs.p_Block;
+        this->m_Streams = rhs.m_Streams;
+
+        rhs.m_Size = 0;
+        rhs.m_Capacity = 0;
+        rhs.p_Block = nullptr;
+        rhs.m_Streams = { };
+
+        return *this;
+    }
+
+    /**
+     * @brief Gets the fields of the element at the given index with range checking.
+     *
+     * @param index The index of the element.
+     * @return Reference - A tuple of references to the fields.
+     */
+    inline Reference At(sizet index) {
+        if (index >= this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of SoA Array range!");
+
+        return ReferenceAt(index, Indices{});
+    }
+    /**
+     * @brief Gets the fields of the element at the given index with range checking.
+     *
+     * @param index The index of the element.
+     * @return ConstReference - A tuple of references to the fields.
+     */
+    inline ConstReference At(sizet index) const {
+        if (index >= this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of SoA Array range!");
+
+        return ReferenceAt(index, Indices{});
+    }
+    /**
+     * @brief Gets the fields of the element at the given index.
+     *
+     * @param i The index of the element.
+     * @return Reference - A tuple of references to the fields.
+     */
+    inline Reference operator [] (sizet i) { return ReferenceAt(i, Indices{}); }
+    /**
+     * @brief Gets the fields of the element at the given index.
+     *
+     * @param i The index of the element.
+     * @return ConstReference - A tuple of references to the fields.
+     */
+    inline ConstReference operator [] (sizet i) const { return ReferenceAt(i, Indices{}); }
+
+    /**
+     * @return Reference - The fields of the last element.
+     */
+    inline Reference Back() { return ReferenceAt(this->m_Size - 1, Indices{}); }
+    /**
+     * @return ConstReference - The fields of the last element.
+     */
+    inline ConstReference Back() const { return ReferenceAt(this->m_Size - 1, Indices{}); }
+
+    /**
+     * @brief Gets the stream of a field, the way hot loops should read and write it.
+     * @note The Span is invalidated by anything that changes the capacity.
+     *
+     * @tparam I The index of the field.
+     * @return Span<FieldType<I>>
+     */
+    template <sizet I>
+    inline Span<FieldType<I>> Field() { return Span<FieldType<I>>(std::get<I>(this->m_Streams), this->m_Size); }
+    /**
+     * @brief Gets the stream of a field.
+     * @note The Span is invalidated by anything that changes the capacity.
+     *
+     * @tparam I The index of the field.
+     * @return Span<const FieldType<I>>
+     */
+    template <sizet I>
+    inline Span<const FieldType<I>> Field() const { return Span<const FieldType<I>>(std::get<I>(this->m_Streams), this->m_Size); }
+
+    /**
+     * @tparam I The index of the field.
+     * @return FieldType<I>* - The first value of the field's stream, aligned to k_StreamAlignment.
+     */
+    template <sizet I>
+    inline FieldType<I>* Data() { return std::get<I>(this->m_Streams); }
+    /**
+     * @tparam I The index of the field.
+     * @return const FieldType<I>* - The first value of the field's stream, aligned to k_StreamAlignment.
+     */
+    template <sizet I>
+    inline const FieldType<I>* Data() const { return std::get<I>(this->m_Streams); }
+
+    /**
+     * @brief Adds an element at the end of the SoA Array.
+     *
+     * @tparam Args
+     * @param values One value for each field, in field order.
+     */
+    template <class ... Args>
+    inline void PushBack(Args&& ... values) {
+        static_assert(sizeof...(Args) == sizeof...(Fields), "PushBack takes one value for every field.");
+
+        if (this->m_Size == this->m_Capacity) {
+            // The values may refer to an element, which is moved by the growth. So they are copied first.
+            //
+            std::tuple<Fields...> staged(std::forward<Args>(values)...);
+
+            SetCapacity(NextCapacity(this->m_Size + 1));
+
+            ConstructFromTuple(this->m_Size, std::move(staged), Indices{});
+        }
+        else {
+            ConstructAt(this->m_Size, Indices{}, std::forward<Args>(values)...);
+        }
+
+        this->m_Size++;
+    }
+    /**
+     * @brief Removes the last element of the SoA Array.
+     */
+    inline void PopBack() {
+        if (this->m_Size == 0)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to PopBack an empty SoA Array!");
+
+        this->m_Size--;
+
+        DestroyAt(this->m_Size, Indices{});
+    }
+
+    /**
+     * @brief Removes the element at the given index, shifting the following elements down to keep their order.
+     *
+     * @param pos The index of the element.
+     */
+    inline void Erase(sizet pos) {
+        if (pos >= this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of SoA Array range!");
+
+        ForEachField([&](auto field) { EraseField(std::get<decltype(field)::value>(this->m_Streams), pos); });
+
+        this->m_Size--;
+    }
+    /**
+     * @brief Removes the element at the given index by moving the last element into its place.
+     * @note This does not keep the order of the elements, but only moves one element.
+     *
+     * @param pos The index of the element.
+     */
+    inline void EraseUnordered(sizet pos) {
+        if (pos >= this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of SoA Array range!");
+
+        ForEachField([&](auto field) { EraseFieldUnordered(std::get<decltype(field)::value>(this->m_Streams), pos); });
+
+        this->m_Size--;
+    }
+    /**
+     * @brief Removes every element, keeping the capacity.
+     */
+    inline void Clear() {
+        ForEachField([&](auto field) { DestroyField(std::get<decltype(field)::value>(this->m_Streams)); });
+
+        this->m_Size = 0;
+    }
+
+    /**
+     * @brief Reserves room for the given number of elements past the current size.
+     *
+     * @param space The number of elements to make room for.
+     */
+    inline void Reserve(sizet space) {
+        if (space > MaxSize() - this->m_Size)
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested SoA Array capacity is too large!");
+
+        if (this->m_Size + space > this->m_Capacity)
+            SetCapacity(this->m_Size + space);
+    }
+    /**
+     * @brief Reduces the capacity to the current size.
+     */
+    inline void ShrinkToFit() {
+        SetCapacity(this->m_Size);
+    }
+
+    /**
+     * @return const A& - The allocator policy.
+     */
+    inline const A& GetAllocator() const { return this->Policy(); }
+
+    /**
+     * @return b8 - True if the SoA Array has no elements, False otherwise.
+     */
+    inline b8 Empty() const { return this->m_Size == 0; }
+    /**
+     * @return sizet - The number of elements.
+     */
+    inline sizet Size() const { return this->m_Size; }
+    /**
+     * @return sizet - The number of elements that fit before the streams are reallocated.
+     */
+    inline sizet Capacity() const { return this->m_Capacity; }
+    /**
+     * @return sizet - The largest number of elements whose streams fit in one allocation.
+     */
+    inline static constexpr sizet MaxSize() {
+        return (std::numeric_limits<sizet>::max() - k_StreamAlignment * (k_FieldCount + 1)) / (sizeof(Fields) + ...);
+    }
+
+private:
+    /**
+     * @brief Gets the capacity to grow to, so that at least the required number of elements fit.
+     *
+     * @param required The number of elements that must fit.
+     * @return sizet
+     */
+    inline sizet NextCapacity(sizet required) const {
+        if (required > MaxSize())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested SoA Array capacity is too large!");
+
+        const sizet grown = this->m_Capacity > MaxSize() / k_GrowthFactor ? MaxSize() : this->m_Capacity * k_GrowthFactor;
+
+        return std::max({ grown, required, k_MinimumCapacity });
+    }
+
+    /**
+     * @tparam T The field type.
+     * @param capacity The number of elements.
+     * @return sizet - The bytes a stream of the field takes, rounded up so the next stream starts on a cache line.
+     */
+    template <class T>
+    inline static constexpr sizet StreamBytes(sizet capacity) {
+        return (capacity * sizeof(T) + k_StreamAlignment - 1) & ~(k_StreamAlignment - 1);
+    }
+
+    /**
+     * @brief Moves every stream into one new allocation of exactly the given capacity.
+     * @note The capacity must not be smaller than the current size.
+     *
+     * @param capacity The new capacity.
+     */
+    inline void SetCapacity(sizet capacity) {
+        if (capacity == this->m_Capacity)
+            return;
+
+        if (capacity > MaxSize())
+            throw Ocean::Exception(Ocean::Error::LENGTH_ERROR, "Requested SoA Array capacity is too large!");
+
+        if (capacity == 0) {
+            Release();
+
+            return;
+        }
+
+        // Policies may ignore the alignment, so the block has the slack to align the first stream by hand.
+        //
+        const sizet bytes = (StreamBytes<Fields>(capacity) + ...) + k_StreamAlignment - 1;
+
+        void* block = oallocaa(bytes, &this->Policy(), k_StreamAlignment);
+        if (!block)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to resize the SoA Array!");
+
+        u8* cursor = static_cast<u8*>(block) + (k_StreamAlignment - reinterpret_cast<uintptr_t>(block) % k_StreamAlignment) % k_StreamAlignment;
+
+        std::tuple<Fields*...> streams;
+        ForEachField([&](auto field) {
+            using T = FieldType<decltype(field)::value>;
+
+            std::get<decltype(field)::value>(streams) = reinterpret_cast<T*>(cursor);
+            cursor += StreamBytes<T>(capacity);
+
+            RelocateField(std::get<decltype(field)::value>(this->m_Streams), std::get<decltype(field)::value>(streams));
+        });
+
+        if (this->p_Block)
+            ofree(this->p_Block, &this->Policy());
+
+        this->p_Block = block;
+        this->m_Streams = streams;
+        this->m_Capacity = capacity;
+    }
+
+    /**
+     * @brief Moves the values of a stream into uninitialized memory.
+     *
+     * @tparam T The field type.
+     * @param from The current stream.
+     * @param to The new stream.
+     */
+    template <class T>
+    inline void RelocateField(T* from, T* to) {
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            if (this->m_Size)
+                memcpy(static_cast<void*>(to), static_cast<const void*>(from), this->m_Size * sizeof(T));
+        }
+        else {
+            for (sizet i = 0; i < this->m_Size; i++) {
+                new (&to[i]) T(std::move(from[i]));
+
+                from[i].~T();
+            }
+        }
+    }
+
+    /**
+     * @brief Removes a value from a stream, shifting the following values down.
+     *
+     * @tparam T The field type.
+     * @param stream The stream.
+     * @param pos The index of the value.
+     */
+    template <class T>
+    inline void EraseField(T* stream, sizet pos) {
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            stream[pos].~T();
+
+            memmove(static_cast<void*>(stream + pos), static_cast<const void*>(stream + pos + 1), (this->m_Size - pos - 1) * sizeof(T));
+        }
+        else {
+            for (sizet i = pos; i + 1 < this->m_Size; i++)
+                stream[i] = std::move(stream[i + 1]);
+
+            stream[this->m_Size - 1].~T();
+        }
+    }
+    /**
+     * @brief Removes a value from a stream, moving the last value into its place.
+     *
+     * @tparam T The field type.
+     * @param stream The stream.
+     * @param pos The index of the value.
+     */
+    template <class T>
+    inline void EraseFieldUnordered(T* stream, sizet pos) {
+        const sizet last = this->m_Size - 1;
+
+        if (pos != last)
+            stream[pos] = std::move(stream[last]);
+
+        stream[last].~T();
+    }
+    /**
+     * @brief Deconstructs every value of a stream.
+     *
+     * @tparam T The field type.
+     * @param stream The stream.
+     */
+    template <class T>
+    inline void DestroyField(T* stream) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (sizet i = 0; i < this->m_Size; i++)
+                stream[i].~T();
+        }
+    }
+
+    template <sizet ... I>
+    inline Reference ReferenceAt(sizet index, std::index_sequence<I...>) {
+        return Reference(std::get<I>(this->m_Streams)[index]...);
+    }
+    template <sizet ... I>
+    inline ConstReference ReferenceAt(sizet index, std::index_sequence<I...>) const {
+        return ConstReference(std::get<I>(this->m_Streams)[index]...);
+    }
+
+    template <sizet ... I, class ... Args>
+    inline void ConstructAt(sizet index, std::index_sequence<I...>, Args&& ... values) {
+        (new (&std::get<I>(this->m_Streams)[index]) FieldType<I>(std::forward<Args>(values)), ...);
+    }
+    template <sizet ... I>
+    inline void ConstructFromTuple(sizet index, std::tuple<Fields...>&& values, std::index_sequence<I...>) {
+        (new (&std::get<I>(this->m_Streams)[index]) FieldType<I>(std::move(std::get<I>(values))), ...);
+    }
+    template <sizet ... I>
+    inline void DestroyAt(sizet index, std::index_sequence<I...>) {
+        (DestroyValue(std::get<I>(this->m_Streams)[index]), ...);
+    }
+    template <class T>
+    inline static void DestroyValue(T& value) {
+        value.~T();
+    }
+
+    /**
+     * @brief Calls the function once for every field, with the field's index as a std::integral_constant.
+     *
+     * @param function The function to call.
+     */
+    template <class F>
+    inline static void ForEachField(F&& function) {
+        ForEachField(function, Indices{});
+    }
+    template <class F, sizet ... I>
+    inline static void ForEachField(F& function, std::index_sequence<I...>) {
+        (function(std::integral_constant<sizet, I>{}), ...);
+    }
+
+    /**
+     * @brief Copy constructs every element of another SoA Array at the start of the streams.
+     * @note The array must be empty and its capacity must already fit the elements.
+     */
+    template <sizet ... I>
+    inline void CopyConstruct(const BasicSoAArray& rhs, std::index_sequence<I...>) {
+        (CopyField(std::get<I>(this->m_Streams), std::get<I>(rhs.m_Streams), rhs.m_Size), ...);
+
+        this->m_Size = rhs.m_Size;
+    }
+    template <class T>
+    inline static void CopyField(T* to, const T* from, sizet count) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count)
+                memcpy(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+        }
+        else {
+            for (sizet i = 0; i < count; i++)
+                new (&to[i]) T(from[i]);
+        }
+    }
+
+    /**
+     * @brief Deconstructs every element and frees the streams.
+     */
+    inline void Release() {
+        Clear();
+
+        if (this->p_Block)
+            ofree(this->p_Block, &this->Policy());
+
+        this->p_Block = nullptr;
+        this->m_Streams = { };
+        this->m_Capacity = 0;
+    }
+
+private:
+    /** @brief The number of elements. */
+    sizet m_Size;
+    /** @brief The number of elements the streams have room for. */
+    sizet m_Capacity;
+
+    /** @brief The allocation holding every stream. */
+    void* p_Block;
+    /** @brief The first value of every field, each on a cache line in p_Block. */
+    std::tuple<Fields*...> m_Streams;
+
+};  // BasicSoAArray
+
+/**
+ * @brief A SoA Array on the default allocator policy.
+ *
+ * @tparam Fields The field types, in stream order.
+ */
+template <class ... Fields>
+using SoAArray = BasicSoAArray<MallocPolicy, Fields...>;
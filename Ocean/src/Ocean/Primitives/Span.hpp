@@ -0,0 +1,113 @@
+#pragma once
+
+/**
+ * @file Span.hpp
+ * @brief A non-owning view of contiguous elements.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+#include "Ocean/Types/Iterator.hpp"
+
+#include "Ocean/Primitives/Exceptions.hpp"
+
+// std
+#include <type_traits>
+
+/**
+ * @brief A pointer and a number of elements, for handing a container's storage to a loop without the container.
+ *
+ * @details A Span does not own its elements, it is invalidated by whatever invalidates the pointer it was made from.
+ *
+ * @tparam T The data type, const for a read only view.
+ */
+template <class T>
+class Span {
+public:
+    using Iterator = RandomAccessIterator<T>;
+
+public:
+    inline constexpr Span() :
+        p_Data(nullptr),
+        m_Size(0)
+    { }
+    /**
+     * @brief Construct a new Span.
+     *
+     * @param data The first element.
+     * @param size The number of elements.
+     */
+    inline constexpr Span(T* data, sizet size) :
+        p_Data(data),
+        m_Size(size)
+    { }
+    /**
+     * @brief Construct a read only Span from a writable one.
+     *
+     * @param other The Span to view.
+     */
+    template <class U, class = std::enable_if_t<std::is_same_v<const U, T> && !std::is_same_v<U, T>>>
+    inline constexpr Span(const Span<U>& other) :
+        p_Data(other.Data()),
+        m_Size(other.Size())
+    { }
+
+    /**
+     * @brief Gets the element at the given index with range checking.
+     *
+     * @param index The index of the element.
+     * @return T&
+     */
+    inline constexpr T& At(sizet index) const {
+        if (index >= this->m_Size)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Index out of Span range!");
+
+        return this->p_Data[index];
+    }
+    /**
+     * @brief Gets the element at the given index.
+     *
+     * @param i The index of the element.
+     * @return T&
+     */
+    inline constexpr T& operator [] (sizet i) const { return this->p_Data[i]; }
+
+    /**
+     * @brief Gets the elements [offset, offset + count) as a Span.
+     *
+     * @param offset The index of the first element.
+     * @param count The number of elements.
+     * @return Span
+     */
+    inline constexpr Span Subspan(sizet offset, sizet count) const {
+        if (offset > this->m_Size || count > this->m_Size - offset)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Subspan out of Span range!");
+
+        return Span(this->p_Data + offset, count);
+    }
+
+    inline constexpr Iterator Begin() const { return Iterator(this->p_Data); }
+    inline constexpr Iterator begin() const { return Begin(); }
+    inline constexpr Iterator End() const { return Iterator(this->p_Data + this->m_Size); }
+    inline constexpr Iterator end() const { return End(); }
+
+    /**
+     * @return T* - The first element.
+     */
+    inline constexpr T* Data() const { return this->p_Data; }
+    /**
+     * @return sizet - The number of elements.
+     */
+    inline constexpr sizet Size() const { return this->m_Size; }
+    /**
+     * @return b8 - True if the Span has no elements, False otherwise.
+     */
+    inline constexpr b8 Empty() const { return this->m_Size == 0; }
+
+private:
+    /** @brief The first element. */
+    T* p_Data;
+    /** @brief The number of elements. */
+    sizet m_Size;
+
+};  // Span
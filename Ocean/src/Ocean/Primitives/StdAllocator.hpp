@@ -0,0 +1,102 @@
+#pragma once
+
+/**
+ * @file StdAllocator.hpp
+ * @brief An STL compliant allocator that routes std containers to Ocean allocators.
+ * 
+ * @details Adapted from the boilerplate at: https://howardhinnant.github.io/allocator_boilerplate.html
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+#include "Ocean/Primitives/Memory.hpp"
+
+// std
+#include <new>
+#include <type_traits>
+
+/**
+ * @brief An STL allocator that wraps an Ocean Allocator.
+ * 
+ * @details The adapter is stateful, two adapters are only equal if they wrap the same Allocator. The Allocator is
+ * propagated on copy, move and swap so that memory is always returned to the Allocator that handed it out.
+ * 
+ * @tparam T The data type.
+ */
+template <class T>
+class OceanStdAllocator {
+public:
+    using value_type = T;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+public:
+    /**
+     * @brief Construct a new OceanStdAllocator that uses the system allocator.
+     */
+    OceanStdAllocator() noexcept :
+        p_Allocator(oSystemAllocator)
+    { }
+    /**
+     * @brief Construct a new OceanStdAllocator that uses the given Allocator.
+     * 
+     * @param allocator The Allocator to route allocations to.
+     */
+    OceanStdAllocator(Allocator* allocator) noexcept :
+        p_Allocator(allocator)
+    { }
+    /**
+     * @brief Construct a new OceanStdAllocator from an adapter of another type, as required for rebinding.
+     * 
+     * @tparam U The other data type.
+     * @param other The adapter to copy the Allocator from.
+     */
+    template <class U>
+    OceanStdAllocator(const OceanStdAllocator<U>& other) noexcept :
+        p_Allocator(other.GetAllocator())
+    { }
+
+    /**
+     * @brief Allocates memory for count objects of type T.
+     * 
+     * @param count The number of objects.
+     * @return T* 
+     */
+    OC_NO_DISCARD T* allocate(sizet count) {
+        T* ptr = oallocat(T, count, this->p_Allocator);
+
+        if (!ptr)
+            throw std::bad_alloc();
+
+        return ptr;
+    }
+    /**
+     * @brief Deallocates memory previously returned by allocate.
+     * 
+     * @param ptr The pointer to the memory.
+     */
+    void deallocate(T* ptr, OC_UNUSED sizet count) noexcept {
+        ofree(ptr, this->p_Allocator);
+    }
+
+    /**
+     * @brief Gets the wrapped Allocator.
+     * 
+     * @return Allocator* 
+     */
+    Allocator* GetAllocator() const noexcept { return this->p_Allocator; }
+
+    template <class U>
+    b8 operator == (const OceanStdAllocator<U>& other) const noexcept { return this->p_Allocator == other.GetAllocator(); }
+    template <class U>
+    b8 operator != (const OceanStdAllocator<U>& other) const noexcept { return this->p_Allocator != other.GetAllocator(); }
+
+private:
+    /** @brief The Allocator that memory is routed to. */
+    Allocator* p_Allocator;
+
+};  // OceanStdAllocator
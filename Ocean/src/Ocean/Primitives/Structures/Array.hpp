@@ -1,9 +1,9 @@
 #pragma once
 
-#include "Ocean/Primitives/Abstract/Container.hpp"
+#include "Ocean/Primitives/Structures/Container.hpp"
 
 template <class T>
-class Array : public Container {
+class Array : public Container<Array<T>> {
 public:
     /** @todo Abstract Array Class. */
 
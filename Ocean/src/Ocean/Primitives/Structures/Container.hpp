@@ -1,43 +1,38 @@
 #pragma once
 
 #include "Ocean/Types/Bool.hpp"
-#include "Ocean/Types/Strings.hpp"
 
 #include "Ocean/Primitives/Macros.hpp"
 
-// std
-#include <ostream>
-
 // May be of use: https://archive.org/details/optimized-c/page/336/mode/2up
 
 /**
- * @brief A abstract Container class defining the requirements of all Ocean Containers.
+ * @brief The base of Ocean's Containers, a CRTP mixin without virtual functions.
+ *
+ * @details The base is empty and has no vtable, so it adds nothing to a Container's layout. Each Container defines
+ * operator == against its own type and the base derives operator != from it, so comparisons resolve at compile time.
+ * Comparing two different Container types does not compile.
+ *
+ * The destructor is protected and not virtual, a Container is never deleted through a pointer to this base. The base
+ * is a literal type, so constexpr Containers such as FixedArray derive from it too.
+ *
+ * @tparam Derived The Container type.
  */
+template <class Derived>
 class Container {
 public:
-    virtual ~Container() = default;
-
-    virtual b8 operator == (const Container& other) const {
-        if (typeid(*this) != typeid(other))
-            return false;
-
-        return true;
-    }
-    virtual b8 operator != (const Container& other) const {
-        return !(*this == other);
-    }
-
     /**
-     * @brief Gets a JSON useable format of the Container.
-     * 
-     * @param os 
-     * @param rhs 
-     * @return std::ostream& 
+     * @brief In-equality comparison with a Container of the same type.
+     *
+     * @param other The Container to compare with.
+     * @return b8 - True if unequal, False otherwise.
      */
-    friend std::ostream& operator << (std::ostream& os, const Container& rhs) {
-        os << &rhs;
-
-        return os;
+    constexpr b8 operator != (const Derived& other) const {
+        return !(static_cast<const Derived&>(*this) == other);
     }
 
+protected:
+    Container() = default;
+    ~Container() = default;
+
 };  // Container
@@ -3,49 +3,51 @@
 /**
  * @file Graph.hpp
  * @author Evan F.
- * @brief The header of the abstract Graph container.
- * 
+ * @brief The header of the Graph container base.
+ *
  * @copyright Copyright (c) 2025
- * 
+ *
  */
 
 #include "Ocean/Types/Bool.hpp"
 #include "Ocean/Types/Integers.hpp"
 
-#include "Ocean/Primitives/Abstract/Container.hpp"
+#include "Ocean/Primitives/Macros.hpp"
+#include "Ocean/Primitives/ParallelFor.hpp"
+
+#include "Ocean/Primitives/Structures/Container.hpp"
+
+// std
+#include <limits>
 
 /**
- * @brief The abstract Graph container.
- * 
- * @tparam T The data type.
+ * @brief A directed edge between two vertices, as given to a graph to build from.
  */
-template <class T>
-class Graph : public Container {
+struct GraphEdge {
+    /** @brief The starting vertex. */
+    u32 from;
+    /** @brief The ending vertex. */
+    u32 to;
+
+};  // GraphEdge
+
+/**
+ * @brief The base of Ocean's Graphs, a CRTP mixin without virtual functions, for directed graphs over the vertices
+ * 0 to VertexCount() - 1.
+ *
+ * @details A Graph defines AddEdge(u32, u32), RemoveEdge(u32, u32), IsAdjacent(u32, u32), VertexCount(), EdgeCount()
+ * and operator ==, adding an edge that exists or removing one that does not does nothing.
+ *
+ * @tparam Derived The Graph type.
+ */
+template <class Derived>
+class Graph : public Container<Derived> {
 public:
-    virtual ~Graph() = default;
-
-    /**
-     * @brief Adds an edge from vertex to vertex.
-     * 
-     * @param from A unique index of the starting vertex.
-     * @param to A unique index of the ending vertex.
-     */
-    virtual void AddEdge(u16 from, u16 to) = 0;
-    /**
-     * @brief Removes an edge from vertex to vertex.
-     * 
-     * @param from A unique index of the starting vertex.
-     * @param to A unique index of the ending vertex.
-     */
-    virtual void RemoveEdge(u16 from, u16 to) = 0;
-
-    /**
-     * @brief Determines if the given vertex's share an edge.
-     * 
-     * @param from A unique index of the starting vertex.
-     * @param to A unique index of the ending vertex.
-     * @return b8
-     */
-    virtual b8 IsAdjacent(u16 from, u16 to) = 0;
+    /** @brief The distance of a vertex that a traversal did not reach. */
+    OC_STATIC_EXPR u32 k_Unreached = std::numeric_limits<u32>::max();
+
+protected:
+    Graph() = default;
+    ~Graph() = default;
 
 };  // Graph
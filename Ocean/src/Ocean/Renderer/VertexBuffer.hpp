@@ -16,7 +16,7 @@
 #include "Ocean/Types/Strings.hpp"
 
 #include "Ocean/Primitives/Assert.hpp"
-#include "Ocean/Primitives/DynamicArray.hpp"
+#include "Ocean/Primitives/SmallArray.hpp"
 
 // std
 #include <initializer_list>
@@ -170,6 +170,13 @@ namespace Ocean {
          * @brief A collection of BufferElement's to represent a layout.
          */
         class BufferLayout {
+        private:
+            /** @brief The number of BufferElements stored inline, enough for the common vertex formats. */
+            OC_STATIC_EXPR sizet k_InlineElements = 8;
+
+        public:
+            using ElementArray = SmallArray<BufferElement, k_InlineElements>;
+
         public:
             BufferLayout() : m_Elements(), m_Stride(0) { }
             /**
@@ -192,35 +199,35 @@ namespace Ocean {
             /**
              * @brief Get the list of BufferElements in the layout.
              * 
-             * @return const DynamicArray<BufferElement>& 
+             * @return const ElementArray& 
              */
-            OC_INLINE const DynamicArray<BufferElement>& GetElements() const { return this->m_Elements; }
+            OC_INLINE const ElementArray& GetElements() const { return this->m_Elements; }
 
             /**
              * @brief Get's an iterator to the begining of the array.
              * 
-             * @return DynamicArray<BufferElement>::iterator 
+             * @return ElementArray::Iterator 
              */
-            OC_INLINE DynamicArray<BufferElement>::Iterator begin() { return m_Elements.begin(); }
+            OC_INLINE ElementArray::Iterator begin() { return m_Elements.begin(); }
             /**
              * @brief Get's a const iterator to the begining of the array.
              * 
-             * @return DynamicArray<BufferElement>::cons_iterator 
+             * @return ElementArray::ConstIterator 
              */
-            OC_INLINE DynamicArray<BufferElement>::ConstIterator begin() const { return m_Elements.begin(); }
+            OC_INLINE ElementArray::ConstIterator begin() const { return m_Elements.begin(); }
 
             /**
              * @brief Get's an iterator to the end of the array.
              * 
-             * @return DynamicArray<BufferElement>::iterator 
+             * @return ElementArray::Iterator 
              */
-            OC_INLINE DynamicArray<BufferElement>::Iterator end() { return m_Elements.end(); }
+            OC_INLINE ElementArray::Iterator end() { return m_Elements.end(); }
             /**
              * @brief Get's a const iterator to the end of the array.
              * 
-             * @return DynamicArray<BufferElement>::iterator 
+             * @return ElementArray::ConstIterator 
              */
-            OC_INLINE DynamicArray<BufferElement>::ConstIterator end() const { return m_Elements.end(); }
+            OC_INLINE ElementArray::ConstIterator end() const { return m_Elements.end(); }
 
         private:
             /**
@@ -238,7 +245,7 @@ namespace Ocean {
                 }
             }
 
-            DynamicArray<BufferElement> m_Elements; /** @brief The list of elements in the layout. */
+            ElementArray m_Elements; /** @brief The list of elements in the layout. */
 
             /**
              * @brief The stride of the layout.
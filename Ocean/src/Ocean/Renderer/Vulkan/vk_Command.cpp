@@ -7,6 +7,9 @@
 #include "Ocean/Renderer/Vulkan/vk_Vulkan.hpp"
 #include "Ocean/Renderer/Vulkan/vk_Instance.hpp"
 
+// std
+#include <cstring>
+
 // libs
 #include <glad/vulkan.h>
 
@@ -58,7 +61,7 @@ namespace Ocean {
         vkCommandPool::vkCommandPool(u32 queueIndex) :
             m_Pool(VK_NULL_HANDLE),
             m_QueueIndex(queueIndex),
-            m_Buffers(0)
+            m_Buffers()
         {
             const VkCommandPoolCreateInfo poolInfo {
                 VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
@@ -73,23 +76,43 @@ namespace Ocean {
         }
 
         vkCommandPool::~vkCommandPool() {
-            this->m_Buffers.clear();
+            this->m_Buffers.Clear();
 
             vkDestroyCommandPool(vkInstance::Get().Device()->Logical(), this->m_Pool, nullptr);
         }
 
         void vkCommandPool::CreateBuffer(cstring name, b8 primary) {
-            if (this->m_Buffers.find(name) != this->m_Buffers.end())
+            if (Find(name) != this->m_Buffers.Size())
                 throw Exception(Error::INVALID_ARGUMENT, "Attempting to create a buffer that already exists! vkCommandPool::CreateBuffer.");
 
-            this->m_Buffers.try_emplace(name, this->m_Pool, primary);
+            this->m_Buffers.EmplaceBack(name, this->m_Pool, primary);
         }
 
         void vkCommandPool::DestroyBuffer(cstring name) {
-            if (this->m_Buffers.find(name) == this->m_Buffers.end())
+            const sizet index = Find(name);
+
+            if (index == this->m_Buffers.Size())
                 throw Exception(Error::INVALID_ARGUMENT, "Attempting to destroy a buffer that does not exist! vkCommandPool::DestroyBuffer.");
 
-            this->m_Buffers.erase(name);
+            this->m_Buffers.Erase(index);
+        }
+
+        const vkCommandPool::vkCommandBuffer& vkCommandPool::Buffer(cstring name) const {
+            const sizet index = Find(name);
+
+            if (index == this->m_Buffers.Size())
+                throw Exception(Error::INVALID_ARGUMENT, "Attempting to get a buffer that does not exist! vkCommandPool::Buffer.");
+
+            return this->m_Buffers[index].buffer;
+        }
+
+        sizet vkCommandPool::Find(cstring name) const {
+            sizet index = 0;
+
+            while (index < this->m_Buffers.Size() && strcmp(this->m_Buffers[index].name, name) != 0)
+                index++;
+
+            return index;
         }
 
     } // namespace Splash
@@ -14,7 +14,10 @@
 #include "Ocean/Types/Strings.hpp"
 
 #include "Ocean/Primitives/Macros.hpp"
-#include "Ocean/Primitives/HashMap.hpp"
+#include "Ocean/Primitives/SmallArray.hpp"
+
+// std
+#include <type_traits>
 
 // libs
 #include <glad/vulkan.h>
@@ -32,6 +35,10 @@ namespace Ocean {
             * @brief Wrapper class for a Vulkan Command Buffer.
             */
             class vkCommandBuffer {
+            public:
+                /** @brief Only holds Vulkan handles, so arrays may move it bytewise without freeing the buffer. */
+                using TriviallyRelocatable = std::true_type;
+
             public:
                 vkCommandBuffer();
                 /**
@@ -57,6 +64,27 @@ namespace Ocean {
 
             };  // vkCommandBuffer
 
+            /**
+             * @brief A vkCommandBuffer and the name it is looked up by.
+             */
+            struct NamedBuffer {
+                /** @brief Relocatable because the buffer is. */
+                using TriviallyRelocatable = std::true_type;
+
+                /** @brief The name of the buffer. E.g. "primary3D". */
+                cstring name;
+                /** @brief The command buffer. */
+                vkCommandBuffer buffer;
+
+                NamedBuffer(cstring name, VkCommandPool pool, b8 primary) : name(name), buffer(pool, primary) { }
+
+                b8 operator == (const NamedBuffer& other) const { return this->buffer == other.buffer; }
+
+            };  // NamedBuffer
+
+            /** @brief The number of command buffers stored inline, a pool rarely holds more than a handful. */
+            OC_STATIC_EXPR sizet k_InlineBuffers = 4;
+
         public:
             /**
              * @brief Constructs a new vkCommandPool object.
@@ -92,14 +120,23 @@ namespace Ocean {
              * @param name The name of the command buffer to get.
              * @return const vkCommandBuffer&
              */
-            OC_INLINE const vkCommandBuffer& Buffer(cstring name) { return this->m_Buffers[name]; }
+            const vkCommandBuffer& Buffer(cstring name) const;
+
+        private:
+            /**
+             * @brief Finds the index of the named buffer.
+             * 
+             * @param name The name of the buffer.
+             * @return sizet - The index in m_Buffers, or its size if there is no such buffer.
+             */
+            sizet Find(cstring name) const;
 
         private:
             VkCommandPool m_Pool; /** @brief The Vulkan command pool. */
 
             u32 m_QueueIndex; /** @brief The queue family index that the command pool is assigned to. */
 
-            UnorderedMap<cstring, vkCommandBuffer> m_Buffers; /** @brief The list of vkCommandBuffer's that are stored by name. */
+            SmallArray<NamedBuffer, k_InlineBuffers> m_Buffers; /** @brief The list of vkCommandBuffer's that are stored by name. A short list is searched faster than it is hashed. */
 
         };  // vkCommandPool
 
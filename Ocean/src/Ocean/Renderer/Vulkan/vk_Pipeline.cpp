@@ -1,5 +1,6 @@
 #include "vk_Pipeline.hpp"
 
+#include "Ocean/Primitives/Assert.hpp"
 #include "Ocean/Primitives/Macros.hpp"
 #include "Ocean/Types/FloatingPoints.hpp"
 
@@ -18,7 +19,7 @@ namespace Ocean {
         vkPipeline::vkPipeline() :
             m_Pipeline(VK_NULL_HANDLE),
             m_Layout(VK_NULL_HANDLE),
-            m_RenderPasses(0),
+            m_RenderPasses(),
             m_Shader()
         {
             
@@ -29,6 +30,8 @@ namespace Ocean {
         }
 
         void vkPipeline::Invalidate() {
+            OASSERTM(!this->m_RenderPasses.Empty(), "A vkPipeline needs a RenderPass!");
+
             // ============================== VIEWPORT ==============================
             //
             VkViewport viewport {
@@ -60,7 +63,7 @@ namespace Ocean {
                 VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
                 nullptr,
                 0,
-                dynamicStates.Size(),
+                static_cast<u32>(dynamicStates.Size()),
                 dynamicStates.Data()
             };
 
@@ -225,7 +228,7 @@ namespace Ocean {
                 &colorBlendState,
                 &dynamicState,
                 this->m_Layout,
-                this->m_RenderPasses[0].RenderPass(),
+                this->m_RenderPasses.Begin()->value.RenderPass(),
                 0,
                 VK_NULL_HANDLE,
                 0
@@ -29,8 +29,8 @@ namespace Ocean {
             vkPipeline();
             ~vkPipeline();
 
-            OC_INLINE void AddRenderPass(cstring name, const vkRenderPass& renderPass) { this->m_RenderPasses[name] = renderPass; Invalidate(); }
-            OC_INLINE void RemoveRenderPass(cstring name) { this->m_RenderPasses.erase(name); Invalidate(); }
+            OC_INLINE void AddRenderPass(cstring name, const vkRenderPass& renderPass) { this->m_RenderPasses.InsertOrAssign(name, renderPass); Invalidate(); }
+            OC_INLINE void RemoveRenderPass(cstring name) { this->m_RenderPasses.Erase(name); Invalidate(); }
 
             void Invalidate();
 
@@ -42,7 +42,7 @@ namespace Ocean {
             VkPipelineLayout m_Layout;
 
             /** @todo From my understanding (and according to the code), only one renderpass can be assigned to a pipeline. And multiple render passes / pipelines are only needed when you wish to access image data from another rendered image. */
-            UnorderedMap<cstring, vkRenderPass> m_RenderPasses;
+            HashMap<String, vkRenderPass> m_RenderPasses;
 
             Ref<vkShader> m_Shader;
 
@@ -25,15 +25,19 @@ namespace Ocean {
             m_Format(),
             m_ColorSpace(),
             m_Extent(),
-            m_Images(0)
+            m_Images()
         {
+            // The queue and format lists are only needed while the swapchain is set up, the arena releases them at the end.
+            //
+            ScopedArena scratch(oScratchStack);
+
             u32 queueCount;
             vkGetPhysicalDeviceQueueFamilyProperties(vkInstance::Get().Device()->Physical(), &queueCount, nullptr);
 
-            VkQueueFamilyProperties* queueProperties = oallocat(VkQueueFamilyProperties, queueCount, oSystemAllocator);
+            VkQueueFamilyProperties* queueProperties = oallocat(VkQueueFamilyProperties, queueCount, &scratch);
             vkGetPhysicalDeviceQueueFamilyProperties(vkInstance::Get().Device()->Physical(), &queueCount, queueProperties);
 
-            b32* supportsPresentation = oallocat(b32, queueCount, oSystemAllocator);
+            b32* supportsPresentation = oallocat(b32, queueCount, &scratch);
             for (u32 i = 0; i < queueCount; i++)
                 vkGetPhysicalDeviceSurfaceSupportKHR(vkInstance::Get().Device()->Physical(), i, surface, &supportsPresentation[i]);
 
@@ -66,9 +70,6 @@ namespace Ocean {
                 }
             }
 
-            ofree(supportsPresentation, oSystemAllocator);
-            ofree(queueProperties, oSystemAllocator);
-
             if (this->m_GraphicsQueueIndex == u32_max || this->m_PresentQueueIndex == u32_max)
                 throw Exception(Error::SYSTEM_ERROR, "Could not find a graphics and presentation queue.");
 
@@ -98,7 +99,7 @@ namespace Ocean {
                 vkGetPhysicalDeviceSurfaceFormatsKHR(vkInstance::Get().Device()->Physical(), surface, &formatCount, nullptr)
             );
 
-            VkSurfaceFormatKHR* surfaceFormats = oallocat(VkSurfaceFormatKHR, formatCount, oSystemAllocator);
+            VkSurfaceFormatKHR* surfaceFormats = oallocat(VkSurfaceFormatKHR, formatCount, &scratch);
             vkCheck(
                 vkGetPhysicalDeviceSurfaceFormatsKHR(vkInstance::Get().Device()->Physical(), surface, &formatCount, surfaceFormats)
             );
@@ -117,8 +118,6 @@ namespace Ocean {
 
             this->m_ColorSpace = surfaceFormats[0].colorSpace;
 
-            ofree(surfaceFormats, oSystemAllocator);
-
             CreateSwapchain();
         }
 
@@ -220,13 +219,14 @@ namespace Ocean {
                 vkGetSwapchainImagesKHR(vkInstance::Get().Device()->Logical(), this->m_Swapchain, &swapchainImageCount, nullptr)
             );
 
-            VkImage* swapchainImages = oallocat(VkImage, swapchainImageCount, oSystemAllocator);
+            SmallArray<VkImage, k_InlineImages> swapchainImages(swapchainImageCount);
             vkCheck(
-                vkGetSwapchainImagesKHR(vkInstance::Get().Device()->Logical(), this->m_Swapchain, &swapchainImageCount, swapchainImages)
+                vkGetSwapchainImagesKHR(vkInstance::Get().Device()->Logical(), this->m_Swapchain, &swapchainImageCount, swapchainImages.Data())
             );
 
-            // Reserve so that if there is more images than the last it will grow ahead of time.
+            // The old images were owned by the old swapchain, the array is refilled for the new one.
             //
+            this->m_Images.Clear();
             this->m_Images.Reserve(swapchainImageCount);
 
             // Create all of the image views for each image.
@@ -236,7 +236,7 @@ namespace Ocean {
                     VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
                     nullptr,
                     0,
-                    (this->m_Images[i].image = swapchainImages[i]),
+                    (this->m_Images.EmplaceBack(SwapchainImage { swapchainImages[i], VK_NULL_HANDLE }).image),
                     VK_IMAGE_VIEW_TYPE_2D,
                     this->m_Format,
                     {
@@ -258,8 +258,6 @@ namespace Ocean {
                     vkCreateImageView(vkInstance::Get().Device()->Logical(), &colorViewInfo, nullptr, &this->m_Images[i].view)
                 );
             }
-
-            ofree(swapchainImages, oSystemAllocator);
         }
 
     } // namespace Splash
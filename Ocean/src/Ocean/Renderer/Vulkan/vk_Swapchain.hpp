@@ -9,8 +9,8 @@
  * 
  */
 
-#include "Ocean/Primitives/DynamicArray.hpp"
 #include "Ocean/Primitives/Macros.hpp"
+#include "Ocean/Primitives/SmallArray.hpp"
 
 // libs
 #include <glad/vulkan.h>
@@ -35,6 +35,9 @@ namespace Ocean {
 
             };  // SwapchainImage
 
+            /** @brief The number of swapchain images stored inline, enough for triple buffering with a spare. */
+            OC_STATIC_EXPR sizet k_InlineImages = 4;
+
         public:
             vkSwapchain(VkSurfaceKHR surface);
             ~vkSwapchain();
@@ -61,7 +64,7 @@ namespace Ocean {
             VkColorSpaceKHR m_ColorSpace;
             VkExtent2D m_Extent;
 
-            DynamicArray<SwapchainImage> m_Images;
+            SmallArray<SwapchainImage, k_InlineImages> m_Images;
 
         };  // vkSwapchain
 
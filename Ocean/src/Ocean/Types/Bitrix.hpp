@@ -1,138 +1,1017 @@
 #pragma once
 
+/**
+ * @file Bitrix.hpp
+ * @brief A bit matrix for collision and occupancy grids.
+ *
+ * @details The bits are stored row-major in one block of 64-bit words, bit x of row y is bit x % 64 of word
+ * y * WordsPerRow() + x / 64. The bits past the width in the last word of a row are always zero, so the bulk
+ * operations run the kernels in BitKernels.hpp over the whole block at once.
+ *
+ * The region algorithms, flood fill, component labeling, dilation, erosion and the cellular automaton step, work on
+ * whole words too. The ones that take a thread count split large grids into bands of rows.
+ */
+
 #include "Ocean/Types/Bool.hpp"
 #include "Ocean/Types/Integers.hpp"
-#include "Ocean/Types/Bix.hpp"
 
+#include "Ocean/Primitives/AllocatorPolicy.hpp"
+#include "Ocean/Primitives/BitKernels.hpp"
+#include "Ocean/Primitives/DynamicArray.hpp"
+#include "Ocean/Primitives/Exceptions.hpp"
 #include "Ocean/Primitives/Macros.hpp"
+#include "Ocean/Primitives/Memory.hpp"
+#include "Ocean/Primitives/ParallelFor.hpp"
 
 // std
+#include <algorithm>
+#include <cstring>
 #include <ostream>
+#include <utility>
+
+class Bitrix2DAccess {
+public:
+    inline Bitrix2DAccess(u64* column, sizet rowWords, u16 x) :
+        p_Column(column),
+        m_RowWords(rowWords),
+        m_Bit(x % 64)
+    { }
+
+    BitReference operator [] (u16 y) {
+        return { this->p_Column[y * this->m_RowWords], this->m_Bit };
+    }
 
-class Bitrix2DAccess;
+    b8 operator [] (u16 y) const {
+        return (this->p_Column[y * this->m_RowWords] >> this->m_Bit) & 1;
+    }
+
+private:
+    /** @brief The word of the first row that holds the column. */
+    u64* const p_Column;
+
+    /** @brief The distance between the words of consecutive rows. */
+    const sizet m_RowWords;
+    /** @brief The bit of the column in its words. */
+    const u32 m_Bit;
+
+};  // BitrixAccess
 
 /**
  * @brief A bit-compressed matrix, only holding true or false at a position.
+ *
+ * @details The words and the scratch memory of the region algorithms come from the allocator policy.
+ *
+ * @tparam A The allocator policy, see AllocatorPolicy.hpp.
  */
-class  Bitrix2D {
+template <class A>
+class BasicBitrix2D : private PolicyStorage<A> {
 private:
-    OC_STATIC_EXPR u8 k_BixSize = sizeof(Bix8) * 8;
+    /** @brief The fewest words a grid has before its algorithms are spread over threads. */
+    OC_STATIC_EXPR sizet k_ParallelWords = 1 << 16;
 
 public:
-    Bitrix2D();
-    Bitrix2D(const Bitrix2D&);
-    Bitrix2D(Bitrix2D&&);
-    Bitrix2D& operator = (const Bitrix2D&);
-    Bitrix2D& operator = (Bitrix2D&&);
+    /** @brief The neighbor counts that bring a clear cell to life in Conway's Game of Life, for Step. */
+    OC_STATIC_EXPR u16 k_LifeBirth = 1 << 3;
+    /** @brief The neighbor counts that keep a set cell alive in Conway's Game of Life, for Step. */
+    OC_STATIC_EXPR u16 k_LifeSurvive = (1 << 2) | (1 << 3);
+
+public:
+    inline BasicBitrix2D() :
+        PolicyStorage<A>(A()),
+        m_Width(0),
+        m_Height(0),
+        m_RowWords(0),
+        p_Bits(nullptr)
+    { }
+    /**
+     * @brief Construct a new empty Bitrix2D that allocates from the given allocator.
+     *
+     * @param allocator The allocator policy to use.
+     */
+    inline explicit BasicBitrix2D(const A& allocator) :
+        PolicyStorage<A>(allocator),
+        m_Width(0),
+        m_Height(0),
+        m_RowWords(0),
+        p_Bits(nullptr)
+    { }
     /**
      * @brief Construct a new Bitrix2D object.
      *
      * @param width The width to use for the matrix edges.
+     * @param allocator The allocator policy to use. (OPTIONAL)
      */
-    Bitrix2D(u16 width);
+    inline BasicBitrix2D(u16 width, const A& allocator = A()) :
+        PolicyStorage<A>(allocator),
+        m_Width(0),
+        m_Height(0),
+        m_RowWords(0),
+        p_Bits(nullptr)
+    {
+        Resize(width, width, false);
+    }
     /**
      * @brief Construct a new Bitrix2D object.
-     * 
+     *
      * @param width The width of the matrix.
      * @param height The height of the matrix.
+     * @param allocator The allocator policy to use. (OPTIONAL)
      */
-    Bitrix2D(u16 width, u16 height);
-    virtual ~Bitrix2D();
+    inline BasicBitrix2D(u16 width, u16 height, const A& allocator = A()) :
+        PolicyStorage<A>(allocator),
+        m_Width(0),
+        m_Height(0),
+        m_RowWords(0),
+        p_Bits(nullptr)
+    {
+        Resize(width, height, false);
+    }
+    /**
+     * @brief Construct a new Bitrix2D from another Bitrix2D, using the same allocator.
+     *
+     * @param rhs The Bitrix2D to copy from.
+     */
+    inline BasicBitrix2D(const BasicBitrix2D& rhs) :
+        PolicyStorage<A>(rhs.Policy()),
+        m_Width(rhs.m_Width),
+        m_Height(rhs.m_Height),
+        m_RowWords(rhs.m_RowWords),
+        p_Bits(nullptr)
+    {
+        const sizet total = this->m_RowWords * this->m_Height;
+
+        if (total > 0) {
+            this->p_Bits = AllocateWords(total);
+            memcpy(this->p_Bits, rhs.p_Bits, total * sizeof(u64));
+        }
+    }
+    /**
+     * @brief Move a Bitrix2D to a new Bitrix2D, the other Bitrix2D is left empty.
+     *
+     * @param rhs The Bitrix2D to move from.
+     */
+    inline BasicBitrix2D(BasicBitrix2D&& rhs) :
+        PolicyStorage<A>(rhs.Policy()),
+        m_Width(rhs.m_Width),
+        m_Height(rhs.m_Height),
+        m_RowWords(rhs.m_RowWords),
+        p_Bits(rhs.p_Bits)
+    {
+        rhs.p_Bits = nullptr;
+        rhs.m_Width = rhs.m_Height = 0;
+        rhs.m_RowWords = 0;
+    }
+    inline ~BasicBitrix2D() {
+        Release();
+    }
+
+    inline BasicBitrix2D& operator = (const BasicBitrix2D& rhs) {
+        if (this == &rhs)
+            return *this;
+
+        const sizet total = rhs.m_RowWords * rhs.m_Height;
+
+        // The words are only reallocated when the sizes differ.
+        //
+        if (total != this->m_RowWords * this->m_Height) {
+            Release();
+
+            if (total > 0)
+                this->p_Bits = AllocateWords(total);
+        }
+
+        if (total > 0)
+            memcpy(this->p_Bits, rhs.p_Bits, total * sizeof(u64));
+
+        this->m_Width = rhs.m_Width;
+        this->m_Height = rhs.m_Height;
+        this->m_RowWords = rhs.m_RowWords;
+
+        return *this;
+    }
+    inline BasicBitrix2D& operator = (BasicBitrix2D&& rhs) {
+        if (this == &rhs)
+            return *this;
+
+        Release();
+
+        // The words are adopted, so the allocator that owns them comes along.
+        //
+        this->Policy() = rhs.Policy();
+        this->m_Width = rhs.m_Width;
+        this->m_Height = rhs.m_Height;
+        this->m_RowWords = rhs.m_RowWords;
+        this->p_Bits = rhs.p_Bits;
+
+        rhs.p_Bits = nullptr;
+        rhs.m_Width = rhs.m_Height = 0;
+        rhs.m_RowWords = 0;
+
+        return *this;
+    }
+
+    /**
+     * @return b8 - True if both matrices are the same size and hold the same bits, False otherwise.
+     */
+    inline b8 operator == (const BasicBitrix2D& other) const {
+        if (this->m_Width != other.m_Width || this->m_Height != other.m_Height)
+            return false;
+
+        return Empty() || memcmp(this->p_Bits, other.p_Bits, this->m_RowWords * this->m_Height * sizeof(u64)) == 0;
+    }
+    /**
+     * @return b8 - True if the matrices differ, False otherwise.
+     */
+    inline b8 operator != (const BasicBitrix2D& other) const { return !(*this == other); }
 
     /**
      * @brief Set's the value of the given position.
-     * 
+     *
      * @param x The x-coordinate of the position.
      * @param y The y-coordinate of the position.
      * @param value The value to set at the position.
      */
-    virtual void Set(u16 x, u16 y, b8 value);
+    inline void Set(u16 x, u16 y, b8 value) {
+        u64& word = Row(y)[x / 64];
+        const u64 bit = u64(1) << (x % 64);
+
+        word = value ? word | bit : word & ~bit;
+    }
     /**
      * @brief Get's the value at the given position.
-     * 
+     *
      * @param x The x-coordinate of the position.
      * @param y The y-coordinate of the position.
-     * @return b8 
+     * @return b8
      */
-    virtual b8 Get(u16 x, u16 y) const;
+    inline b8 Get(u16 x, u16 y) const { return (Row(y)[x / 64] >> (x % 64)) & 1; }
 
-    Bitrix2DAccess operator [] (u16 x);
-    const Bitrix2DAccess operator [] (u16 x) const;
+    inline Bitrix2DAccess operator [] (u16 x) {
+        return { this->p_Bits + x / 64, this->m_RowWords, x };
+    }
+    inline const Bitrix2DAccess operator [] (u16 x) const {
+        return { this->p_Bits + x / 64, this->m_RowWords, x };
+    }
 
     /**
      * @brief Ensures that the matrix has enough space to fit the given edge width.
-     * 
+     *
      * @param width The required width of the matrix edges.
      * @param value The value to set for any new columns / rows.
      */
-    virtual void Reserve(u16 width, b8 value);
+    inline void Reserve(u16 width, b8 value) {
+        if (this->m_Width < width || this->m_Height < width)
+            Resize(std::max(width, this->m_Width), std::max(width, this->m_Height), value);
+    }
     /**
      * @brief Ensures that the matrix has enough space to fit the given width and height.
-     * 
+     *
      * @param width The required width of the matrix.
      * @param height The required height of the matrix.
      * @param value The value to set for any new columns / rows.
      */
-    virtual void Reserve(u16 width, u16 height, b8 value);
+    inline void Reserve(u16 width, u16 height, b8 value) {
+        if (this->m_Width < width || this->m_Height < height)
+            Resize(std::max(width, this->m_Width), std::max(height, this->m_Height), value);
+    }
+    /**
+     * @brief Changes the size of the matrix, keeping the bits that are inside both sizes.
+     *
+     * @param width The new width of the matrix.
+     * @param height The new height of the matrix.
+     * @param value The value to set for any new columns / rows. (OPTIONAL)
+     */
+    void Resize(u16 width, u16 height, b8 value = false) {
+        const sizet rowWords = RowWordsFor(width);
+        const sizet total = rowWords * height;
+
+        u64* bits = nullptr;
+
+        if (total > 0) {
+            bits = AllocateWords(total);
+            memset(bits, value ? 0xff : 0, total * sizeof(u64));
+        }
+
+        // The kept columns are copied a word at a time, the word the old width ends in is merged with the new value.
+        //
+        const u16 keptRows = std::min(height, this->m_Height);
+        const u16 keptColumns = std::min(width, this->m_Width);
+
+        const sizet fullWords = keptColumns / 64;
+        const u64 partMask = (u64(1) << (keptColumns % 64)) - 1;
+
+        for (u16 y = 0; y < keptRows; y++) {
+            u64* row = bits + y * rowWords;
+            const u64* old = Row(y);
+
+            memcpy(row, old, fullWords * sizeof(u64));
+
+            if (partMask != 0)
+                row[fullWords] = (old[fullWords] & partMask) | (row[fullWords] & ~partMask);
+        }
+
+        Release();
+
+        this->p_Bits = bits;
+        this->m_Width = width;
+        this->m_Height = height;
+        this->m_RowWords = rowWords;
+
+        Trim();
+    }
 
     /**
      * @brief Checks if the Bitrix is empty.
-     * 
-     * @return b8 
+     *
+     * @return b8
      */
-    b8 Empty() const { return this->m_Width == 0; }
+    b8 Empty() const { return this->m_Width == 0 || this->m_Height == 0; }
 
     u16 Width() const { return this->m_Width; }
-    u16 Height() const { return this->m_VirtHeight; }
+    u16 Height() const { return this->m_Height; }
+
+    void Clear(b8 value = false) {
+        if (Empty())
+            return;
+
+        memset(this->p_Bits, value ? 0xff : 0, this->m_RowWords * this->m_Height * sizeof(u64));
+        Trim();
+    }
+
+    /** @brief Keeps the bits set in both matrices, which must be the same size. */
+    inline BasicBitrix2D& operator &= (const BasicBitrix2D& other) {
+        CheckSize(other);
+        oBitsAnd(this->p_Bits, this->p_Bits, other.p_Bits, this->m_RowWords * this->m_Height);
+
+        return *this;
+    }
+    /** @brief Sets the bits set in either matrix, which must be the same size. */
+    inline BasicBitrix2D& operator |= (const BasicBitrix2D& other) {
+        CheckSize(other);
+        oBitsOr(this->p_Bits, this->p_Bits, other.p_Bits, this->m_RowWords * this->m_Height);
+
+        return *this;
+    }
+    /** @brief Flips the bits set in the other matrix, which must be the same size. */
+    inline BasicBitrix2D& operator ^= (const BasicBitrix2D& other) {
+        CheckSize(other);
+        oBitsXor(this->p_Bits, this->p_Bits, other.p_Bits, this->m_RowWords * this->m_Height);
+
+        return *this;
+    }
+    /** @brief Clears the bits set in the other matrix, which must be the same size. */
+    inline BasicBitrix2D& AndNot(const BasicBitrix2D& other) {
+        CheckSize(other);
+        oBitsAndNot(this->p_Bits, this->p_Bits, other.p_Bits, this->m_RowWords * this->m_Height);
+
+        return *this;
+    }
+
+    inline BasicBitrix2D operator & (const BasicBitrix2D& other) const { return BasicBitrix2D(*this) &= other; }
+    inline BasicBitrix2D operator | (const BasicBitrix2D& other) const { return BasicBitrix2D(*this) |= other; }
+    inline BasicBitrix2D operator ^ (const BasicBitrix2D& other) const { return BasicBitrix2D(*this) ^= other; }
+    inline BasicBitrix2D operator ~ () const {
+        BasicBitrix2D flipped(*this);
+        flipped.Flip();
+
+        return flipped;
+    }
+
+    /**
+     * @brief Flips every bit.
+     */
+    inline void Flip() {
+        oBitsNot(this->p_Bits, this->p_Bits, this->m_RowWords * this->m_Height);
+        Trim();
+    }
+    /**
+     * @brief Moves every bit by the given offset, bits moved off the matrix are lost and the uncovered bits are clear.
+     *
+     * @param dx The number of columns to move by, positive towards higher x.
+     * @param dy The number of rows to move by, positive towards higher y.
+     */
+    void Shift(i32 dx, i32 dy) {
+        if (Empty())
+            return;
+
+        if (dx <= -this->m_Width || dx >= this->m_Width || dy <= -this->m_Height || dy >= this->m_Height) {
+            Clear(false);
+
+            return;
+        }
+
+        // Rows move as whole blocks of words.
+        //
+        const sizet rowBytes = this->m_RowWords * sizeof(u64);
+        const u16 moved = static_cast<u16>(dy < 0 ? -dy : dy);
+        const sizet keptBytes = (this->m_Height - moved) * rowBytes;
+
+        if (dy > 0) {
+            memmove(Row(moved), Row(0), keptBytes);
+            memset(Row(0), 0, moved * rowBytes);
+        }
+        else if (dy < 0) {
+            memmove(Row(0), Row(moved), keptBytes);
+            memset(Row(static_cast<u16>(this->m_Height - moved)), 0, moved * rowBytes);
+        }
+
+        if (dx == 0)
+            return;
+
+        for (u16 y = 0; y < this->m_Height; y++) {
+            if (dx > 0)
+                oBitsShiftUp(Row(y), Row(y), this->m_RowWords, static_cast<sizet>(dx));
+            else
+                oBitsShiftDown(Row(y), Row(y), this->m_RowWords, static_cast<sizet>(-dx));
+        }
+
+        // Only moving up pushes bits past the width, moving down pulls in the clear bits past it.
+        //
+        if (dx > 0)
+            Trim();
+    }
+
+    /**
+     * @return sizet - The number of set bits.
+     */
+    inline sizet Count() const { return oBitsCount(this->p_Bits, this->m_RowWords * this->m_Height); }
+    /**
+     * @param y The row.
+     * @return sizet - The number of set bits in the row.
+     */
+    inline sizet CountRow(u16 y) const { return oBitsCount(Row(y), this->m_RowWords); }
+    /**
+     * @brief Counts the set bits in a rectangle of the matrix.
+     *
+     * @param x The x-coordinate of the rectangle's first column.
+     * @param y The y-coordinate of the rectangle's first row.
+     * @param width The number of columns in the rectangle.
+     * @param height The number of rows in the rectangle.
+     * @return sizet
+     */
+    sizet CountRegion(u16 x, u16 y, u16 width, u16 height) const {
+        if (static_cast<u32>(x) + width > this->m_Width || static_cast<u32>(y) + height > this->m_Height)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to count a Bitrix2D region out of range!");
+
+        sizet count = 0;
+
+        for (u16 row = y; row < y + height; row++)
+            count += oBitsCountRange(Row(row), x, static_cast<sizet>(x) + width);
+
+        return count;
+    }
+
+    /**
+     * @brief Finds the set cells connected to a cell through set cells, moving up, down, left and right. A scanline
+     * fill, every row span is found and set a word at a time.
+     *
+     * @param x The x-coordinate of the cell to start from.
+     * @param y The y-coordinate of the cell to start from.
+     * @return BasicBitrix2D - A matrix of the same size with the connected cells set, empty of bits if the cell is
+     * clear.
+     */
+    BasicBitrix2D FloodFill(u16 x, u16 y) const {
+        if (x >= this->m_Width || y >= this->m_Height)
+            throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to flood fill from a Bitrix2D cell out of range!");
+
+        BasicBitrix2D filled(this->m_Width, this->m_Height, this->Policy());
+
+        if (!Get(x, y))
+            return filled;
+
+        const sizet words = this->m_RowWords;
+
+        // Seeds are packed as y << 16 | x. Each popped seed fills its whole span, then seeds one cell of every unfilled
+        // run beside the span in the rows above and below.
+        //
+        DynamicArray<u32, A> seeds(this->Policy());
+        seeds.PushBack(static_cast<u32>(y) << 16 | x);
+
+        while (!seeds.Empty()) {
+            const u32 seed = seeds.Back();
+            seeds.PopBack();
+
+            const u16 sx = static_cast<u16>(seed & u16_max);
+            const u16 sy = static_cast<u16>(seed >> 16);
+
+            if (filled.Get(sx, sy))
+                continue;
+
+            const sizet begin = FindRunStart(Row(sy), sx);
+            const sizet end = FindClear(Row(sy), words, sx, this->m_Width);
+
+            SetBits(filled.Row(sy), begin, end);
+
+            for (i32 ny = sy - 1; ny <= sy + 1; ny += 2) {
+                if (ny < 0 || ny >= this->m_Height)
+                    continue;
+
+                const u64* row = Row(static_cast<u16>(ny));
+                const u64* done = filled.Row(static_cast<u16>(ny));
+
+                u64 carry = 0;
+
+                for (sizet w = begin / 64; w <= (end - 1) / 64; w++) {
+                    u64 open = row[w] & ~done[w];
+
+                    if (w == begin / 64)
+                        open &= ~u64(0) << (begin % 64);
+                    if (w == (end - 1) / 64)
+                        open &= ~u64(0) >> (63 - (end - 1) % 64);
+
+                    const u64 starts = open & ~((open << 1) | carry);
+                    carry = open >> 63;
+
+                    for (u64 set = starts; set != 0; set &= set - 1)
+                        seeds.PushBack(static_cast<u32>(ny) << 16 | static_cast<u32>(w * 64 + oFirstBit(set)));
+                }
+            }
+        }
+
+        return filled;
+    }
+    /**
+     * @brief Labels the 4-connected regions of set cells. The set runs of every row are found from the words, and
+     * the runs that overlap between rows are joined, so the work follows the number of runs rather than cells.
+     *
+     * @tparam L The allocator policy of the labels.
+     * @param labels The label of every cell, row-major, 0 for clear cells and 1 to the region count for set cells.
+     * Regions are numbered in the order their first cell appears.
+     * @param threads The number of threads to use. (OPTIONAL)
+     * @return u32 - The number of regions.
+     */
+    template <class L>
+    u32 LabelComponents(DynamicArray<u32, L>& labels, u32 threads = 1) const {
+        const sizet words = this->m_RowWords;
+        const u16 height = this->m_Height;
+        const u32 parts = words * height >= k_ParallelWords ? threads : 1;
+
+        const sizet cells = static_cast<sizet>(this->m_Width) * height;
+
+        // Labels of the right size are reused as they are, every cell is written below.
+        //
+        if (labels.Size() != cells) {
+            labels.Clear();
+            labels.Reserve(cells);
+
+            for (sizet i = 0; i < cells; i++)
+                labels.PushBack(0);
+        }
+
+        if (Empty())
+            return 0;
+
+        // The runs of every row, row y holds the runs from offsets[y] to offsets[y + 1].
+        //
+        DynamicArray<sizet, A> offsets(height + 1, this->Policy());
+        for (u32 y = 0; y <= height; y++)
+            offsets.PushBack(0);
+
+        oParallelFor(parts, height, [&](sizet first, sizet last) {
+            for (sizet y = first; y < last; y++)
+                ForEachRunStart(Row(static_cast<u16>(y)), words, [&](sizet) { offsets[y + 1]++; });
+        });
+
+        for (u32 y = 0; y < height; y++)
+            offsets[y + 1] += offsets[y];
+
+        const sizet runCount = offsets[height];
+
+        DynamicArray<u32, A> begins(runCount, this->Policy());
+        DynamicArray<u32, A> ends(runCount, this->Policy());
+        DynamicArray<u32, A> parents(runCount, this->Policy());
+
+        for (sizet i = 0; i < runCount; i++) {
+            begins.PushBack(0);
+            ends.PushBack(0);
+            parents.PushBack(static_cast<u32>(i));
+        }
+
+        oParallelFor(parts, height, [&](sizet first, sizet last) {
+            for (sizet y = first; y < last; y++) {
+                const u64* row = Row(static_cast<u16>(y));
+                sizet run = offsets[y];
+
+                ForEachRunStart(row, words, [&](sizet start) {
+                    begins[run] = static_cast<u32>(start);
+                    ends[run] = static_cast<u32>(FindClear(row, words, start, this->m_Width));
+                    run++;
+                });
+            }
+        });
+
+        // A union-find over the runs, sets are joined under the earlier root so every parent comes before its run.
+        //
+        auto find = [&](u32 run) {
+            while (parents[run] != run) {
+                parents[run] = parents[parents[run]];
+                run = parents[run];
+            }
+
+            return run;
+        };
+
+        auto joinRows = [&](sizet y) {
+            sizet above = offsets[y - 1];
+            sizet below = offsets[y];
+
+            while (above < offsets[y] && below < offsets[y + 1]) {
+                if (begins[above] < ends[below] && begins[below] < ends[above]) {
+                    const u32 a = find(static_cast<u32>(above));
+                    const u32 b = find(static_cast<u32>(below));
+
+                    if (a < b)
+                        parents[b] = a;
+                    else if (b < a)
+                        parents[a] = b;
+                }
+
+                if (ends[above] < ends[below])
+                    above++;
+                else
+                    below++;
+            }
+        };
+
+        // Each band joins the rows inside it, which only touches its own runs, the rows between bands are joined after.
+        //
+        const sizet bands = std::min<sizet>(std::max<u32>(parts, 1), height);
+
+        oParallelFor(parts, height, [&](sizet first, sizet last) {
+            for (sizet y = first + 1; y < last; y++)
+                joinRows(y);
+        });
+
+        for (sizet band = 1; band < bands; band++)
+            joinRows(height * band / bands);
+
+        // Every parent comes before its run, so one pass in order numbers the sets by their first cell.
+        //
+        DynamicArray<u32, A> ids(runCount, this->Policy());
+        u32 count = 0;
+
+        for (sizet run = 0; run < runCount; run++)
+            ids.PushBack(parents[run] == run ? ++count : ids[parents[run]]);
+
+        oParallelFor(parts, height, [&](sizet first, sizet last) {
+            for (sizet y = first; y < last; y++) {
+                u32* row = labels.Data() + y * this->m_Width;
+                memset(row, 0, this->m_Width * sizeof(u32));
+
+                for (sizet run = offsets[y]; run < offsets[y + 1]; run++)
+                    std::fill(row + begins[run], row + ends[run], ids[run]);
+            }
+        });
+
+        return count;
+    }
+
+    /**
+     * @brief Grows the set cells by a radius, every cell within radius columns and rows of a set cell is set.
+     * Shifts by doubling distances, so a radius costs O(log radius) passes over the grid.
+     *
+     * @param radius The radius of the square to grow by.
+     * @param threads The number of threads to use. (OPTIONAL)
+     */
+    void Dilate(u16 radius, u32 threads = 1) {
+        if (radius == 0 || Empty())
+            return;
+
+        const sizet words = this->m_RowWords;
+        const u16 height = this->m_Height;
+        const u32 parts = words * height >= k_ParallelWords ? threads : 1;
+
+        // The bodies must not throw or share the policy, so the scratch rows of every band are allocated up front.
+        //
+        const sizet bands = std::min<sizet>(std::max<u32>(parts, 1), height);
+
+        DynamicArray<u64, A> scratch(bands * 2 * words, this->Policy());
+        for (sizet i = 0; i < bands * 2 * words; i++)
+            scratch.PushBack(0);
+
+        // Each pass grows the covered distance from reach to reach + step, with a step of at most reach + 1 so the
+        // covered cells stay contiguous.
+        //
+        oParallelFor(parts, height, [&](sizet first, sizet last) {
+            // A band starts at height * band / bands, so its index rounds back up from the first row.
+            const sizet band = (first * bands + height - 1) / height;
+
+            u64* up = scratch.Data() + band * 2 * words;
+            u64* down = up + words;
+
+            for (sizet y = first; y < last; y++) {
+                u64* row = Row(static_cast<u16>(y));
+
+                for (u16 reach = 0; reach < radius;) {
+                    const u16 step = std::min<u16>(reach + 1, radius - reach);
+
+                    oBitsShiftUp(up, row, words, step);
+                    oBitsShiftDown(down, row, words, step);
+                    oBitsOr(row, row, up, words);
+                    oBitsOr(row, row, down, words);
+
+                    reach += step;
+                }
+            }
+        });
+
+        Trim();
+
+        BasicBitrix2D previous(this->Policy());
+
+        for (u16 reach = 0; reach < radius;) {
+            const u16 step = std::min<u16>(reach + 1, radius - reach);
+
+            previous = *this;
+
+            oParallelFor(parts, height, [&](sizet first, sizet last) {
+                for (sizet y = first; y < last; y++) {
+                    u64* row = Row(static_cast<u16>(y));
+
+                    if (y >= step)
+                        oBitsOr(row, row, previous.Row(static_cast<u16>(y - step)), words);
+                    if (y + step < height)
+                        oBitsOr(row, row, previous.Row(static_cast<u16>(y + step)), words);
+                }
+            });
+
+            reach += step;
+        }
+    }
+    /**
+     * @brief Shrinks the set cells by a radius, a cell stays set only if every cell within radius columns and rows
+     * of it is set. The cells outside the matrix count as set, so the edges do not wear away.
+     *
+     * @param radius The radius of the square to shrink by.
+     * @param threads The number of threads to use. (OPTIONAL)
+     */
+    void Erode(u16 radius, u32 threads = 1) {
+        Flip();
+        Dilate(radius, threads);
+        Flip();
+    }
+
+    /**
+     * @brief Advances a life-like cellular automaton by one generation. The eight neighbor counts of 64 cells are
+     * summed at once with bitwise adders, cells outside the matrix are clear.
+     *
+     * @param birth Bit n is set if a clear cell with n set neighbors becomes set, see k_LifeBirth.
+     * @param survive Bit n is set if a set cell with n set neighbors stays set, see k_LifeSurvive.
+     * @param threads The number of threads to use. (OPTIONAL)
+     */
+    void Step(u16 birth, u16 survive, u32 threads = 1) {
+        if (Empty())
+            return;
+
+        const sizet words = this->m_RowWords;
+        const u16 height = this->m_Height;
+        const u32 parts = words * height >= k_ParallelWords ? threads : 1;
+
+        BasicBitrix2D next(this->m_Width, height, this->Policy());
+
+        oParallelFor(parts, height, [&](sizet first, sizet last) {
+            for (sizet y = first; y < last; y++) {
+                const u64* above = y > 0 ? Row(static_cast<u16>(y - 1)) : nullptr;
+                const u64* middle = Row(static_cast<u16>(y));
+                const u64* below = y + 1 < height ? Row(static_cast<u16>(y + 1)) : nullptr;
+
+                u64* out = next.Row(static_cast<u16>(y));
+
+                for (sizet w = 0; w < words; w++) {
+                    // Four bit planes of the neighbor count of every cell in the word, summed one neighbor at a time.
+                    //
+                    u64 s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+
+                    auto add = [&](u64 neighbor) {
+                        const u64 c0 = s0 & neighbor;
+                        s0 ^= neighbor;
+                        const u64 c1 = s1 & c0;
+                        s1 ^= c0;
+                        const u64 c2 = s2 & c1;
+                        s2 ^= c1;
+                        s3 |= c2;
+                    };
+
+                    auto addRow = [&](const u64* row, b8 center) {
+                        if (!row)
+                            return;
+
+                        add((row[w] << 1) | (w > 0 ? row[w - 1] >> 63 : 0));
+                        add((row[w] >> 1) | (w + 1 < words ? row[w + 1] << 63 : 0));
+
+                        if (center)
+                            add(row[w]);
+                    };
+
+                    addRow(above, true);
+                    addRow(middle, false);
+                    addRow(below, true);
+
+                    const u64 alive = middle[w];
+                    u64 result = 0;
+
+                    for (u32 n = 0; n <= 8; n++) {
+                        const u64 match = (n & 1 ? s0 : ~s0) & (n & 2 ? s1 : ~s1) & (n & 4 ? s2 : ~s2) & (n & 8 ? s3 : ~s3);
+
+                        if ((birth >> n) & 1)
+                            result |= match & ~alive;
+                        if ((survive >> n) & 1)
+                            result |= match & alive;
+                    }
+
+                    out[w] = result;
+                }
+            }
+        });
+
+        next.Trim();
+
+        *this = std::move(next);
+    }
 
-    void Clear(b8 value = false);
+    /**
+     * @param y The row.
+     * @return u64* - The words of the row, WordsPerRow() of them.
+     */
+    inline u64* Row(u16 y) { return this->p_Bits + y * this->m_RowWords; }
+    /**
+     * @param y The row.
+     * @return const u64* - The words of the row, WordsPerRow() of them.
+     */
+    inline const u64* Row(u16 y) const { return this->p_Bits + y * this->m_RowWords; }
+    /**
+     * @return sizet - The number of words in a row.
+     */
+    inline sizet WordsPerRow() const { return this->m_RowWords; }
+    /**
+     * @return u64* - The words of every row, one after the other.
+     */
+    inline u64* Data() { return this->p_Bits; }
+    /**
+     * @return const u64* - The words of every row, one after the other.
+     */
+    inline const u64* Data() const { return this->p_Bits; }
 
     /**
-     * @brief Outputs the Bitrix2D to the ostream in a readable string format. 
-     * 
+     * @return const A& - The allocator policy of the Bitrix2D.
+     */
+    inline const A& GetAllocator() const { return this->Policy(); }
+
+    /**
+     * @brief Outputs the Bitrix2D to the ostream in a readable string format.
+     *
      * @param os The ostream to output to.
      * @param rhs The Bitrix2D to output.
-     * @return std::ostream& 
+     * @return std::ostream&
      */
-    friend std::ostream& operator << (std::ostream& os, const Bitrix2D& rhs);
+    friend std::ostream& operator << (std::ostream& os, const BasicBitrix2D& rhs) {
+        for (u16 i = 0; i < rhs.m_Height; i++) {
+            for (u16 k = 0; k < rhs.m_Width; k++)
+                os << rhs.Get(k, i) << " ";
 
-protected:
+            os << "\n";
+        }
+
+        return os;
+    }
+
+private:
     /**
-     * @brief Internal resize function to resize the matrix if necessary.
-     * 
-     * @param width The new width of the matrix.
-     * @param height The new height of the matrix.
-     * @param value The value to set for any new columns / rows.
+     * @return sizet - The number of words that hold a row of the given width.
      */
-    virtual void Resize(u16 width, u16 height, b8 value);
+    OC_STATIC_INLINE sizet RowWordsFor(u16 width) {
+        return (static_cast<sizet>(width) + 63) / 64;
+    }
 
-    /** @brief The width of the matrix. This width corresponds to the number columns in a row. */
-    u16 m_Width;
-    /** @brief The virtual height of the matrix. This height corresponds to the number of bits in a column. */
-    u16 m_VirtHeight;
-    /** @brief The real height of the matrix. This height corresponds to the number of Bix8's in a column. */
-    u16 m_RealHeight;
+    /**
+     * @brief Sets the bits [begin, end) of a row.
+     */
+    OC_STATIC_INLINE void SetBits(u64* row, sizet begin, sizet end) {
+        if (begin >= end)
+            return;
 
-    /** @brief The bit-operable data as a 2D array. */
-    Bix8** p_Bits;
+        const sizet first = begin / 64;
+        const sizet last = (end - 1) / 64;
 
-};  // Bitrix2D
+        const u64 head = ~u64(0) << (begin % 64);
+        const u64 tail = ~u64(0) >> (63 - (end - 1) % 64);
 
-class Bitrix2DAccess {
-public:
-    Bitrix2DAccess(Bix8* column, u16 virtHeight);
+        if (first == last) {
+            row[first] |= head & tail;
+
+            return;
+        }
+
+        row[first] |= head;
 
-    BixAccess operator [] (u16 y) {
-        return this->p_Column[y / 8][y & 7];
+        for (sizet w = first + 1; w < last; w++)
+            row[w] = ~u64(0);
+
+        row[last] |= tail;
     }
 
-    b8 operator [] (u16 y) const {
-        return const_cast<const Bix8*>(this->p_Column)[y / 8][y & 7];
+    /**
+     * @return sizet - The first clear bit of a row at or after from, or width if the row is set to its end.
+     */
+    OC_STATIC_INLINE sizet FindClear(const u64* row, sizet words, sizet from, sizet width) {
+        sizet w = from / 64;
+        u64 clear = ~row[w] & (~u64(0) << (from % 64));
+
+        while (clear == 0) {
+            if (++w == words)
+                return width;
+
+            clear = ~row[w];
+        }
+
+        return std::min(w * 64 + oFirstBit(clear), width);
+    }
+
+    /**
+     * @return sizet - The first bit of the set run that holds the set bit x.
+     */
+    OC_STATIC_INLINE sizet FindRunStart(const u64* row, sizet x) {
+        sizet w = x / 64;
+        u64 clear = ~row[w] & (~u64(0) >> (63 - x % 64));
+
+        while (clear == 0) {
+            if (w == 0)
+                return 0;
+
+            clear = ~row[--w];
+        }
+
+        return w * 64 + oLastBit(clear) + 1;
+    }
+
+    /**
+     * @brief Calls a function with the first bit of every set run of a row.
+     */
+    template <class F>
+    OC_STATIC_INLINE void ForEachRunStart(const u64* row, sizet words, F&& function) {
+        u64 carry = 0;
+
+        for (sizet w = 0; w < words; w++) {
+            const u64 starts = row[w] & ~((row[w] << 1) | carry);
+            carry = row[w] >> 63;
+
+            for (u64 set = starts; set != 0; set &= set - 1)
+                function(w * 64 + oFirstBit(set));
+        }
+    }
+
+    /**
+     * @brief Allocates the given number of words from the allocator policy.
+     */
+    inline u64* AllocateWords(sizet count) {
+        u64* words = oallocat(u64, count, &this->Policy());
+        if (!words)
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Bitrix2D failed to allocate its words!");
+
+        return words;
+    }
+
+    /**
+     * @brief Throws if the other matrix is a different size.
+     */
+    inline void CheckSize(const BasicBitrix2D& other) const {
+        if (this->m_Width != other.m_Width || this->m_Height != other.m_Height)
+            throw Ocean::Exception(Ocean::Error::INVALID_ARGUMENT, "Attempt to combine Bitrix2D's of different sizes!");
+    }
+    /**
+     * @brief Clears the bits past the width in the last word of every row.
+     */
+    inline void Trim() {
+        if (this->m_Width % 64 == 0)
+            return;
+
+        const u64 mask = (u64(1) << (this->m_Width % 64)) - 1;
+
+        for (u16 y = 0; y < this->m_Height; y++)
+            Row(y)[this->m_RowWords - 1] &= mask;
+    }
+    /**
+     * @brief Frees the words.
+     */
+    inline void Release() {
+        if (this->p_Bits != nullptr)
+            ofree(this->p_Bits, &this->Policy());
+
+        this->p_Bits = nullptr;
     }
 
 private:
-    Bix8* const p_Column;
+    /** @brief The width of the matrix. This width corresponds to the number columns in a row. */
+    u16 m_Width;
+    /** @brief The height of the matrix. This height corresponds to the number of rows. */
+    u16 m_Height;
+    /** @brief The number of words in a row. */
+    sizet m_RowWords;
 
-    const u16 m_VirtHeight;
+    /** @brief The rows of the matrix, m_RowWords words each. */
+    u64* p_Bits;
 
-};  // BitrixAccess
+};  // BasicBitrix2D
+
+/** @brief A Bitrix2D that allocates with malloc. */
+using Bitrix2D = BasicBitrix2D<MallocPolicy>;
@@ -0,0 +1,486 @@
+#include "Bitrix3D.hpp"
+
+#include "Ocean/Primitives/Exceptions.hpp"
+#include "Ocean/Primitives/Memory.hpp"
+
+// std
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+/**
+ * @return u32 - The bit of the brick that holds a voxel in its chunk.
+ */
+static u32 BrickOf(i32 x, i32 y, i32 z) {
+    return ((x >> 2) & 3) | ((y >> 2) & 3) << 2 | ((z >> 2) & 3) << 4;
+}
+
+/**
+ * @return u64 - The bit of a voxel in its brick.
+ */
+static u64 VoxelBit(i32 x, i32 y, i32 z) {
+    return u64(1) << ((x & 3) | (y & 3) << 2 | (z & 3) << 4);
+}
+
+Bitrix3D::Bitrix3D() :
+    m_Chunks(),
+    m_Count(0),
+    m_ChunkMin { std::numeric_limits<i32>::max(), std::numeric_limits<i32>::max(), std::numeric_limits<i32>::max() },
+    m_ChunkMax { std::numeric_limits<i32>::min(), std::numeric_limits<i32>::min(), std::numeric_limits<i32>::min() }
+{ }
+
+Bitrix3D::Bitrix3D(const Bitrix3D& rhs) :
+    m_Chunks(),
+    m_Count(0)
+{
+    *this = rhs;
+}
+
+Bitrix3D::Bitrix3D(Bitrix3D&& rhs) :
+    m_Chunks(),
+    m_Count(0)
+{
+    *this = std::move(rhs);
+}
+
+Bitrix3D& Bitrix3D::operator = (const Bitrix3D& rhs) {
+    if (this == &rhs)
+        return *this;
+
+    Release();
+
+    // The map copies the chunks as they are, then every chunk gets its own copy of its bricks.
+    //
+    this->m_Chunks = rhs.m_Chunks;
+
+    for (auto it = this->m_Chunks.Begin(); it != this->m_Chunks.End(); ++it) {
+        Chunk& chunk = it->value;
+        const u32 count = oPopcount(chunk.mask);
+
+        u64* bricks = oallocat(u64, count, oUnmanagedAllocator);
+        if (!bricks) {
+            // The chunks from here on still point at the bricks of rhs, so they are cut loose before the release.
+            //
+            for (; it != this->m_Chunks.End(); ++it)
+                it->value.p_Bricks = nullptr;
+
+            Clear();
+
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to copy Bitrix3D bricks!");
+        }
+
+        memcpy(bricks, chunk.p_Bricks, count * sizeof(u64));
+
+        chunk.p_Bricks = bricks;
+        chunk.capacity = count;
+    }
+
+    this->m_Count = rhs.m_Count;
+
+    std::copy(rhs.m_ChunkMin, rhs.m_ChunkMin + 3, this->m_ChunkMin);
+    std::copy(rhs.m_ChunkMax, rhs.m_ChunkMax + 3, this->m_ChunkMax);
+
+    return *this;
+}
+
+Bitrix3D& Bitrix3D::operator = (Bitrix3D&& rhs) {
+    if (this == &rhs)
+        return *this;
+
+    Release();
+
+    this->m_Chunks = std::move(rhs.m_Chunks);
+    this->m_Count = rhs.m_Count;
+
+    std::copy(rhs.m_ChunkMin, rhs.m_ChunkMin + 3, this->m_ChunkMin);
+    std::copy(rhs.m_ChunkMax, rhs.m_ChunkMax + 3, this->m_ChunkMax);
+
+    rhs.m_Chunks.Clear();
+    rhs.Clear();
+
+    return *this;
+}
+
+Bitrix3D::~Bitrix3D()
+{
+    Release();
+}
+
+b8 Bitrix3D::operator == (const Bitrix3D& other) const {
+    if (this->m_Count != other.m_Count || this->m_Chunks.Size() != other.m_Chunks.Size())
+        return false;
+
+    for (const auto& entry : this->m_Chunks) {
+        const auto it = other.m_Chunks.Find(entry.key);
+
+        if (it == other.m_Chunks.End() || it->value.mask != entry.value.mask)
+            return false;
+
+        if (memcmp(entry.value.p_Bricks, it->value.p_Bricks, oPopcount(entry.value.mask) * sizeof(u64)) != 0)
+            return false;
+    }
+
+    return true;
+}
+
+void Bitrix3D::Set(i32 x, i32 y, i32 z, b8 value) {
+    if (!InRange(x, y, z))
+        throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to set a Bitrix3D voxel out of range!");
+
+    const u64 key = ChunkKey(x >> 4, y >> 4, z >> 4);
+    const u32 brick = BrickOf(x, y, z);
+    const u64 bit = VoxelBit(x, y, z);
+
+    auto it = this->m_Chunks.Find(key);
+
+    if (!value) {
+        if (it == this->m_Chunks.End())
+            return;
+
+        u64* word = FindBrick(it->value, brick);
+
+        if (!word || (*word & bit) == 0)
+            return;
+
+        *word &= ~bit;
+        this->m_Count--;
+
+        if (*word == 0)
+            RemoveBrick(key, it->value, brick);
+
+        return;
+    }
+
+    if (it == this->m_Chunks.End()) {
+        it = this->m_Chunks.Emplace(key, Chunk { 0, nullptr, 0 }).first;
+
+        const i32 chunk[3] = { x >> 4, y >> 4, z >> 4 };
+        for (u32 axis = 0; axis < 3; axis++) {
+            this->m_ChunkMin[axis] = std::min(this->m_ChunkMin[axis], chunk[axis]);
+            this->m_ChunkMax[axis] = std::max(this->m_ChunkMax[axis], chunk[axis]);
+        }
+    }
+
+    u64& word = AddBrick(key, it->value, brick);
+
+    if ((word & bit) == 0) {
+        word |= bit;
+        this->m_Count++;
+    }
+}
+
+b8 Bitrix3D::Get(i32 x, i32 y, i32 z) const {
+    if (!InRange(x, y, z))
+        return false;
+
+    const auto it = this->m_Chunks.Find(ChunkKey(x >> 4, y >> 4, z >> 4));
+
+    if (it == this->m_Chunks.End())
+        return false;
+
+    const u64* word = FindBrick(it->value, BrickOf(x, y, z));
+
+    return word && (*word & VoxelBit(x, y, z)) != 0;
+}
+
+void Bitrix3D::SetRegion(i32 x, i32 y, i32 z, u32 width, u32 height, u32 depth, b8 value) {
+    const i64 x1 = static_cast<i64>(x) + width;
+    const i64 y1 = static_cast<i64>(y) + height;
+    const i64 z1 = static_cast<i64>(z) + depth;
+
+    if (!InRange(x, y, z) || x1 > k_Max || y1 > k_Max || z1 > k_Max)
+        throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to set a Bitrix3D region out of range!");
+
+    if (width == 0 || height == 0 || depth == 0)
+        return;
+
+    // The voxels of a brick of a chunk that are in the box.
+    //
+    auto brickVoxels = [&](i64 cx, i64 cy, i64 cz, u32 brick) {
+        return CubeMaskInBox(cx * 16 + (brick & 3) * 4, cy * 16 + ((brick >> 2) & 3) * 4, cz * 16 + (brick >> 4) * 4, 1,
+                             x, x1, y, y1, z, z1);
+    };
+
+    for (i32 cz = z >> 4; cz <= static_cast<i32>((z1 - 1) >> 4); cz++) {
+        for (i32 cy = y >> 4; cy <= static_cast<i32>((y1 - 1) >> 4); cy++) {
+            for (i32 cx = x >> 4; cx <= static_cast<i32>((x1 - 1) >> 4); cx++) {
+                const u64 key = ChunkKey(cx, cy, cz);
+                const u64 bricks = CubeMaskInBox(cx * 16, cy * 16, cz * 16, 4, x, x1, y, y1, z, z1);
+
+                auto it = this->m_Chunks.Find(key);
+
+                if (!value) {
+                    if (it == this->m_Chunks.End())
+                        continue;
+
+                    // Removing the chunk's last brick erases the chunk, which only happens on the last brick here.
+                    //
+                    for (u64 present = it->value.mask & bricks; present != 0; present &= present - 1) {
+                        const u32 brick = oFirstBit(present);
+                        const u64 voxels = brickVoxels(cx, cy, cz, brick);
+
+                        u64& word = *FindBrick(it->value, brick);
+
+                        this->m_Count -= oPopcount(word & voxels);
+                        word &= ~voxels;
+
+                        if (word == 0)
+                            RemoveBrick(key, it->value, brick);
+                    }
+
+                    continue;
+                }
+
+                if (it == this->m_Chunks.End()) {
+                    it = this->m_Chunks.Emplace(key, Chunk { 0, nullptr, 0 }).first;
+
+                    const i32 chunk[3] = { cx, cy, cz };
+                    for (u32 axis = 0; axis < 3; axis++) {
+                        this->m_ChunkMin[axis] = std::min(this->m_ChunkMin[axis], chunk[axis]);
+                        this->m_ChunkMax[axis] = std::max(this->m_ChunkMax[axis], chunk[axis]);
+                    }
+                }
+
+                for (u64 remaining = bricks; remaining != 0; remaining &= remaining - 1) {
+                    const u32 brick = oFirstBit(remaining);
+                    const u64 voxels = brickVoxels(cx, cy, cz, brick);
+
+                    u64& word = AddBrick(key, it->value, brick);
+
+                    this->m_Count += oPopcount(voxels & ~word);
+                    word |= voxels;
+                }
+            }
+        }
+    }
+}
+
+void Bitrix3D::Clear() {
+    Release();
+
+    this->m_Count = 0;
+
+    std::fill(this->m_ChunkMin, this->m_ChunkMin + 3, std::numeric_limits<i32>::max());
+    std::fill(this->m_ChunkMax, this->m_ChunkMax + 3, std::numeric_limits<i32>::min());
+}
+
+sizet Bitrix3D::CountRegion(i32 x, i32 y, i32 z, u32 width, u32 height, u32 depth) const {
+    sizet count = 0;
+
+    ForEachBrickInRegion(x, y, z, width, height, depth, [&](u64 voxels, i64, i64, i64) { count += oPopcount(voxels); });
+
+    return count;
+}
+
+sizet Bitrix3D::BrickCount() const {
+    sizet count = 0;
+
+    for (const auto& entry : this->m_Chunks)
+        count += oPopcount(entry.value.mask);
+
+    return count;
+}
+
+b8 Bitrix3D::Raycast(f32 originX, f32 originY, f32 originZ, f32 directionX, f32 directionY, f32 directionZ,
+                     f32 maxDistance, Bitrix3DHit& hit) const {
+    const f64 length = std::sqrt(static_cast<f64>(directionX) * directionX + static_cast<f64>(directionY) * directionY +
+                                 static_cast<f64>(directionZ) * directionZ);
+
+    if (!(length > 0.0))
+        throw Ocean::Exception(Ocean::Error::INVALID_ARGUMENT, "Attempt to raycast a Bitrix3D without a direction!");
+
+    if (Empty() || !(maxDistance >= 0.0f))
+        return false;
+
+    const f64 origin[3] = { originX, originY, originZ };
+    const f64 direction[3] = { directionX / length, directionY / length, directionZ / length };
+
+    // The ray is clipped to the box of chunks that have held voxels, so the walk never crosses the empty space
+    // around them however far it may look.
+    //
+    f64 enter = 0.0;
+    f64 exit = maxDistance;
+    i32 axis = -1;
+
+    i64 low[3];
+    i64 high[3];
+    i32 step[3];
+
+    for (u32 a = 0; a < 3; a++) {
+        low[a] = static_cast<i64>(this->m_ChunkMin[a]) * 16;
+        high[a] = (static_cast<i64>(this->m_ChunkMax[a]) + 1) * 16;
+        step[a] = direction[a] > 0.0 ? 1 : direction[a] < 0.0 ? -1 : 0;
+
+        if (step[a] == 0) {
+            if (origin[a] < low[a] || origin[a] >= high[a])
+                return false;
+
+            continue;
+        }
+
+        f64 nearest = (low[a] - origin[a]) / direction[a];
+        f64 farthest = (high[a] - origin[a]) / direction[a];
+
+        if (nearest > farthest)
+            std::swap(nearest, farthest);
+
+        if (nearest > enter) {
+            enter = nearest;
+            axis = static_cast<i32>(a);
+        }
+
+        exit = std::min(exit, farthest);
+    }
+
+    if (enter > exit)
+        return false;
+
+    i64 voxel[3];
+
+    for (u32 a = 0; a < 3; a++)
+        voxel[a] = std::clamp(static_cast<i64>(std::floor(origin[a] + direction[a] * enter)), low[a], high[a] - 1);
+
+    if (axis >= 0)
+        voxel[axis] = step[axis] > 0 ? low[axis] : high[axis] - 1;
+
+    // Each step leaves the largest empty cell around the voxel, a chunk, a brick or the voxel itself. The other
+    // coordinates are kept in the cell and never move backwards, so rounding can not stall the walk.
+    //
+    u64 lastKey = ~u64(0);
+    const Chunk* chunk = nullptr;
+
+    f64 distance = enter;
+
+    while (true) {
+        const i32 x = static_cast<i32>(voxel[0]);
+        const i32 y = static_cast<i32>(voxel[1]);
+        const i32 z = static_cast<i32>(voxel[2]);
+
+        const u64 key = ChunkKey(x >> 4, y >> 4, z >> 4);
+
+        if (key != lastKey) {
+            const auto it = this->m_Chunks.Find(key);
+
+            chunk = it == this->m_Chunks.End() ? nullptr : &it->value;
+            lastKey = key;
+        }
+
+        i64 size = 16;
+
+        if (chunk) {
+            const u64* word = FindBrick(*chunk, BrickOf(x, y, z));
+
+            size = word ? 1 : 4;
+
+            if (word && (*word & VoxelBit(x, y, z)) != 0) {
+                hit.x = x;
+                hit.y = y;
+                hit.z = z;
+                hit.distance = static_cast<f32>(distance);
+                hit.normalX = static_cast<i8>(axis == 0 ? -step[0] : 0);
+                hit.normalY = static_cast<i8>(axis == 1 ? -step[1] : 0);
+                hit.normalZ = static_cast<i8>(axis == 2 ? -step[2] : 0);
+
+                return true;
+            }
+        }
+
+        f64 next = std::numeric_limits<f64>::infinity();
+
+        for (u32 a = 0; a < 3; a++) {
+            if (step[a] == 0)
+                continue;
+
+            const i64 cell = voxel[a] & ~(size - 1);
+            const f64 boundary = static_cast<f64>(step[a] > 0 ? cell + size : cell);
+            const f64 t = (boundary - origin[a]) / direction[a];
+
+            if (t < next) {
+                next = t;
+                axis = static_cast<i32>(a);
+            }
+        }
+
+        if (next > exit)
+            return false;
+
+        for (u32 a = 0; a < 3; a++) {
+            const i64 cell = voxel[a] & ~(size - 1);
+
+            if (static_cast<i32>(a) == axis) {
+                voxel[a] = step[a] > 0 ? cell + size : cell - 1;
+
+                continue;
+            }
+
+            const i64 at = static_cast<i64>(std::floor(origin[a] + direction[a] * next));
+
+            voxel[a] = std::clamp(step[a] > 0 ? std::max(voxel[a], at) : std::min(voxel[a], at), cell, cell + size - 1);
+        }
+
+        distance = next;
+    }
+}
+
+u64& Bitrix3D::AddBrick(u64 key, Chunk& chunk, u32 brick) {
+    const u64 bit = u64(1) << brick;
+    const u32 index = oPopcount(chunk.mask & (bit - 1));
+
+    if (chunk.mask & bit)
+        return chunk.p_Bricks[index];
+
+    const u32 count = oPopcount(chunk.mask);
+
+    // The bricks grow by doubling up to the 64 a chunk can have.
+    //
+    if (count == chunk.capacity) {
+        const u32 capacity = std::max<u32>(chunk.capacity * 2, 1);
+
+        u64* bricks = oallocat(u64, capacity, oUnmanagedAllocator);
+        if (!bricks) {
+            if (chunk.mask == 0)
+                this->m_Chunks.Erase(key);
+
+            throw Ocean::Exception(Ocean::Error::BAD_ALLOC, "Failed to allocate Bitrix3D bricks!");
+        }
+
+        if (chunk.p_Bricks) {
+            memcpy(bricks, chunk.p_Bricks, count * sizeof(u64));
+            ofree(chunk.p_Bricks, oUnmanagedAllocator);
+        }
+
+        chunk.p_Bricks = bricks;
+        chunk.capacity = capacity;
+    }
+
+    memmove(chunk.p_Bricks + index + 1, chunk.p_Bricks + index, (count - index) * sizeof(u64));
+
+    chunk.p_Bricks[index] = 0;
+    chunk.mask |= bit;
+
+    return chunk.p_Bricks[index];
+}
+
+void Bitrix3D::RemoveBrick(u64 key, Chunk& chunk, u32 brick) {
+    const u64 bit = u64(1) << brick;
+    const u32 index = oPopcount(chunk.mask & (bit - 1));
+    const u32 count = oPopcount(chunk.mask);
+
+    memmove(chunk.p_Bricks + index, chunk.p_Bricks + index + 1, (count - index - 1) * sizeof(u64));
+
+    chunk.mask &= ~bit;
+
+    if (chunk.mask == 0) {
+        ofree(chunk.p_Bricks, oUnmanagedAllocator);
+
+        this->m_Chunks.Erase(key);
+    }
+}
+
+void Bitrix3D::Release() {
+    for (auto& entry : this->m_Chunks)
+        ofree(entry.value.p_Bricks, oUnmanagedAllocator);
+
+    this->m_Chunks.Clear();
+}
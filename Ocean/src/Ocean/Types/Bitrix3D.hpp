@@ -0,0 +1,401 @@
+#pragma once
+
+/**
+ * @file Bitrix3D.hpp
+ * @brief A sparse bit volume for voxel occupancy in large worlds.
+ *
+ * @details The volume is split into 4x4x4 bricks that each fit in a 64-bit word, bit x + 4y + 16z of a brick is the
+ * voxel at that offset in it. Bricks are grouped into chunks of 4x4x4 bricks, 16 voxels on a side, which are kept in a
+ * HashMap by their position. A chunk holds a word with a bit for every brick that has a set voxel, and only those
+ * bricks, in the order of their bits. A brick's place in a chunk is the number of mask bits below its own.
+ *
+ * Bricks and chunks are removed when their last voxel is cleared, so memory follows the occupied space. The two levels
+ * of masks let region iteration and raycasts skip empty chunks and bricks without visiting their voxels.
+ */
+
+#include "Ocean/Types/Bool.hpp"
+#include "Ocean/Types/FloatingPoints.hpp"
+#include "Ocean/Types/Integers.hpp"
+
+#include "Ocean/Primitives/BitKernels.hpp"
+#include "Ocean/Primitives/HashMap.hpp"
+#include "Ocean/Primitives/Macros.hpp"
+
+// std
+#include <algorithm>
+
+/**
+ * @brief Where a Bitrix3D raycast hit a set voxel.
+ */
+struct Bitrix3DHit {
+    /** @brief The x-coordinate of the voxel hit. */
+    i32 x;
+    /** @brief The y-coordinate of the voxel hit. */
+    i32 y;
+    /** @brief The z-coordinate of the voxel hit. */
+    i32 z;
+
+    /** @brief The distance along the ray to where it entered the voxel, 0 if it started inside. */
+    f32 distance;
+
+    /** @brief The x-component of the normal of the face the ray entered through, all 0 if it started inside. */
+    i8 normalX;
+    /** @brief The y-component of the normal of the face the ray entered through. */
+    i8 normalY;
+    /** @brief The z-component of the normal of the face the ray entered through. */
+    i8 normalZ;
+
+};  // Bitrix3DHit
+
+/**
+ * @brief A sparse, bit-compressed volume, only holding true or false at a position.
+ */
+class Bitrix3D {
+private:
+    /** @brief The number of bits of a chunk coordinate in a chunk key. */
+    OC_STATIC_EXPR u32 k_KeyBits = 21;
+
+public:
+    /** @brief The lowest coordinate on every axis. */
+    OC_STATIC_EXPR i32 k_Min = -(1 << (k_KeyBits + 3));
+    /** @brief One past the highest coordinate on every axis. */
+    OC_STATIC_EXPR i32 k_Max = 1 << (k_KeyBits + 3);
+
+public:
+    Bitrix3D();
+    Bitrix3D(const Bitrix3D&);
+    Bitrix3D(Bitrix3D&&);
+    Bitrix3D& operator = (const Bitrix3D&);
+    Bitrix3D& operator = (Bitrix3D&&);
+    ~Bitrix3D();
+
+    /**
+     * @return b8 - True if both volumes hold the same set voxels, False otherwise.
+     */
+    b8 operator == (const Bitrix3D& other) const;
+    /**
+     * @return b8 - True if the volumes differ, False otherwise.
+     */
+    inline b8 operator != (const Bitrix3D& other) const { return !(*this == other); }
+
+    /**
+     * @brief Set's the value of the given position, throws if the position is outside [k_Min, k_Max).
+     *
+     * @param x The x-coordinate of the position.
+     * @param y The y-coordinate of the position.
+     * @param z The z-coordinate of the position.
+     * @param value The value to set at the position. (OPTIONAL)
+     */
+    void Set(i32 x, i32 y, i32 z, b8 value = true);
+    /**
+     * @brief Get's the value at the given position, positions outside [k_Min, k_Max) are clear.
+     *
+     * @param x The x-coordinate of the position.
+     * @param y The y-coordinate of the position.
+     * @param z The z-coordinate of the position.
+     * @return b8
+     */
+    b8 Get(i32 x, i32 y, i32 z) const;
+    /**
+     * @brief Sets every position of a box to the value, a brick at a time.
+     *
+     * @param x The x-coordinate of the box's first corner.
+     * @param y The y-coordinate of the box's first corner.
+     * @param z The z-coordinate of the box's first corner.
+     * @param width The size of the box along x.
+     * @param height The size of the box along y.
+     * @param depth The size of the box along z.
+     * @param value The value to set. (OPTIONAL)
+     */
+    void SetRegion(i32 x, i32 y, i32 z, u32 width, u32 height, u32 depth, b8 value = true);
+
+    /**
+     * @brief Clears every voxel and frees the bricks.
+     */
+    void Clear();
+
+    /**
+     * @brief Checks if the Bitrix is empty.
+     *
+     * @return b8
+     */
+    inline b8 Empty() const { return this->m_Count == 0; }
+    /**
+     * @return sizet - The number of set voxels.
+     */
+    inline sizet Count() const { return this->m_Count; }
+    /**
+     * @brief Counts the set voxels in a box, a brick at a time.
+     *
+     * @param x The x-coordinate of the box's first corner.
+     * @param y The y-coordinate of the box's first corner.
+     * @param z The z-coordinate of the box's first corner.
+     * @param width The size of the box along x.
+     * @param height The size of the box along y.
+     * @param depth The size of the box along z.
+     * @return sizet
+     */
+    sizet CountRegion(i32 x, i32 y, i32 z, u32 width, u32 height, u32 depth) const;
+
+    /**
+     * @return sizet - The number of bricks with a set voxel.
+     */
+    sizet BrickCount() const;
+    /**
+     * @return sizet - The number of chunks with a set voxel.
+     */
+    inline sizet ChunkCount() const { return this->m_Chunks.Size(); }
+
+    /**
+     * @brief Calls a function with the position of every set voxel, in no particular order.
+     *
+     * @tparam F A callable taking the x, y and z coordinates as i32.
+     * @param function The function to call.
+     */
+    template <class F>
+    inline void ForEachSet(F&& function) const {
+        for (const auto& entry : this->m_Chunks)
+            ForEachBrickInChunk(entry.key, entry.value, entry.value.mask, k_Min, k_Max, k_Min, k_Max, k_Min, k_Max,
+                                [&](u64 voxels, i64 x, i64 y, i64 z) { ForEachVoxel(voxels, x, y, z, function); });
+    }
+    /**
+     * @brief Calls a function with the position of every set voxel in a box, in no particular order. Only the chunks
+     * and bricks that hold set voxels are visited.
+     *
+     * @tparam F A callable taking the x, y and z coordinates as i32.
+     * @param x The x-coordinate of the box's first corner.
+     * @param y The y-coordinate of the box's first corner.
+     * @param z The z-coordinate of the box's first corner.
+     * @param width The size of the box along x.
+     * @param height The size of the box along y.
+     * @param depth The size of the box along z.
+     * @param function The function to call.
+     */
+    template <class F>
+    inline void ForEachSetInRegion(i32 x, i32 y, i32 z, u32 width, u32 height, u32 depth, F&& function) const {
+        ForEachBrickInRegion(x, y, z, width, height, depth,
+                             [&](u64 voxels, i64 bx, i64 by, i64 bz) { ForEachVoxel(voxels, bx, by, bz, function); });
+    }
+
+    /**
+     * @brief Walks a ray through the volume to the first set voxel. Empty chunks and bricks are crossed in one step.
+     *
+     * @param originX The x-coordinate of the ray's start.
+     * @param originY The y-coordinate of the ray's start.
+     * @param originZ The z-coordinate of the ray's start.
+     * @param directionX The x-component of the ray's direction, which does not need to be normalized.
+     * @param directionY The y-component of the ray's direction.
+     * @param directionZ The z-component of the ray's direction.
+     * @param maxDistance The furthest distance along the ray to look.
+     * @param hit The voxel hit, only written if there is one.
+     * @return b8 - True if the ray hit a set voxel within the distance, False otherwise.
+     */
+    b8 Raycast(f32 originX, f32 originY, f32 originZ, f32 directionX, f32 directionY, f32 directionZ,
+               f32 maxDistance, Bitrix3DHit& hit) const;
+
+private:
+    /**
+     * @brief The bricks of a 16x16x16 block of voxels.
+     */
+    struct Chunk {
+        /** @brief A bit for every brick of the chunk that has a set voxel. */
+        u64 mask;
+        /** @brief The bricks in the mask, in the order of their bits. */
+        u64* p_Bricks;
+        /** @brief The number of bricks that fit in p_Bricks. */
+        u32 capacity;
+
+    };  // Chunk
+
+    /**
+     * @return u64 - The key of the chunk at the chunk coordinates.
+     */
+    OC_STATIC_INLINE u64 ChunkKey(i32 cx, i32 cy, i32 cz) {
+        constexpr u64 mask = (u64(1) << k_KeyBits) - 1;
+
+        return (static_cast<u64>(cx) & mask) | (static_cast<u64>(cy) & mask) << k_KeyBits |
+               (static_cast<u64>(cz) & mask) << (2 * k_KeyBits);
+    }
+    /**
+     * @return i32 - One chunk coordinate of a chunk key.
+     */
+    OC_STATIC_INLINE i32 KeyCoordinate(u64 key, u32 axis) {
+        constexpr u32 unused = 32 - k_KeyBits;
+
+        return static_cast<i32>(static_cast<u32>(key >> (axis * k_KeyBits)) << unused) >> unused;
+    }
+    /**
+     * @return b8 - True if the position is within [k_Min, k_Max) on every axis.
+     */
+    OC_STATIC_INLINE b8 InRange(i32 x, i32 y, i32 z) {
+        return x >= k_Min && x < k_Max && y >= k_Min && y < k_Max && z >= k_Min && z < k_Max;
+    }
+    /**
+     * @brief The mask of the cells of a 4x4x4 cube, bit x + 4y + 16z, that fall in the ranges of each axis.
+     *
+     * @return u64
+     */
+    OC_STATIC_INLINE u64 CubeMask(u32 x0, u32 x1, u32 y0, u32 y1, u32 z0, u32 z1) {
+        const u64 xs = ((u64(1) << x1) - (u64(1) << x0)) * 0x1111'1111'1111'1111ull;
+        const u64 ys = ((u64(1) << (4 * y1)) - (u64(1) << (4 * y0))) * 0x0001'0001'0001'0001ull;
+        const u64 zs = (z1 == 4 ? ~u64(0) : (u64(1) << (16 * z1)) - 1) & ~((u64(1) << (16 * z0)) - 1);
+
+        return xs & ys & zs;
+    }
+    /**
+     * @brief The mask of the cells of a cube of 4x4x4 cells, each of a size, that overlap a box.
+     *
+     * @param cubeX The x-coordinate of the cube's first cell.
+     * @param cubeY The y-coordinate of the cube's first cell.
+     * @param cubeZ The z-coordinate of the cube's first cell.
+     * @param size The size of a cell.
+     * @return u64
+     */
+    OC_STATIC_INLINE u64 CubeMaskInBox(i64 cubeX, i64 cubeY, i64 cubeZ, i64 size,
+                                       i64 x0, i64 x1, i64 y0, i64 y1, i64 z0, i64 z1) {
+        auto first = [size](i64 cube, i64 begin) { return static_cast<u32>(std::clamp<i64>((begin - cube) / size, 0, 4)); };
+        auto last = [size](i64 cube, i64 end) { return static_cast<u32>(std::clamp<i64>((end - cube + size - 1) / size, 0, 4)); };
+
+        return CubeMask(first(cubeX, x0), last(cubeX, x1), first(cubeY, y0), last(cubeY, y1),
+                        first(cubeZ, z0), last(cubeZ, z1));
+    }
+
+    /**
+     * @brief Calls a function with the voxels of a brick, from its first voxel's position.
+     */
+    template <class F>
+    OC_STATIC_INLINE void ForEachVoxel(u64 voxels, i64 x, i64 y, i64 z, F& function) {
+        for (; voxels != 0; voxels &= voxels - 1) {
+            const u32 voxel = oFirstBit(voxels);
+
+            function(static_cast<i32>(x + (voxel & 3)), static_cast<i32>(y + ((voxel >> 2) & 3)),
+                     static_cast<i32>(z + (voxel >> 4)));
+        }
+    }
+    /**
+     * @brief Calls a function with the set voxels of every brick of a chunk in the brick mask that overlap a box, as
+     * the masked brick and the position of its first voxel.
+     */
+    template <class F>
+    OC_STATIC void ForEachBrickInChunk(u64 key, const Chunk& chunk, u64 bricks, i64 x0, i64 x1, i64 y0, i64 y1,
+                                       i64 z0, i64 z1, F&& function) {
+        const i64 chunkX = static_cast<i64>(KeyCoordinate(key, 0)) * 16;
+        const i64 chunkY = static_cast<i64>(KeyCoordinate(key, 1)) * 16;
+        const i64 chunkZ = static_cast<i64>(KeyCoordinate(key, 2)) * 16;
+
+        u32 index = 0;
+
+        for (u64 present = chunk.mask; present != 0; present &= present - 1, index++) {
+            const u32 brick = oFirstBit(present);
+
+            if (((bricks >> brick) & 1) == 0)
+                continue;
+
+            const i64 brickX = chunkX + (brick & 3) * 4;
+            const i64 brickY = chunkY + ((brick >> 2) & 3) * 4;
+            const i64 brickZ = chunkZ + (brick >> 4) * 4;
+
+            u64 voxels = chunk.p_Bricks[index];
+            if (x0 > brickX || x1 < brickX + 4 || y0 > brickY || y1 < brickY + 4 || z0 > brickZ || z1 < brickZ + 4)
+                voxels &= CubeMaskInBox(brickX, brickY, brickZ, 1, x0, x1, y0, y1, z0, z1);
+
+            if (voxels != 0)
+                function(voxels, brickX, brickY, brickZ);
+        }
+    }
+    /**
+     * @brief Calls a function with the set voxels of every brick that overlaps a box, as the masked brick and the
+     * position of its first voxel. Only the chunks and bricks that hold set voxels are visited.
+     */
+    template <class F>
+    void ForEachBrickInRegion(i32 x, i32 y, i32 z, u32 width, u32 height, u32 depth, F&& function) const;
+
+    /**
+     * @return u64* - The brick of a chunk, or nullptr if it has no set voxel.
+     */
+    OC_STATIC_INLINE u64* FindBrick(const Chunk& chunk, u32 brick) {
+        if (((chunk.mask >> brick) & 1) == 0)
+            return nullptr;
+
+        return chunk.p_Bricks + oPopcount(chunk.mask & ((u64(1) << brick) - 1));
+    }
+    /**
+     * @brief Gets the brick of a chunk, adding a clear one if it has none. Throws BAD_ALLOC if the bricks can't
+     * grow, a chunk that is left without bricks is removed first.
+     *
+     * @return u64&
+     */
+    u64& AddBrick(u64 key, Chunk& chunk, u32 brick);
+    /**
+     * @brief Removes the brick of a chunk, and the chunk when it was its last.
+     */
+    void RemoveBrick(u64 key, Chunk& chunk, u32 brick);
+    /**
+     * @brief Frees the bricks of every chunk.
+     */
+    void Release();
+
+private:
+    /** @brief The chunks with a set voxel, by the key of their chunk coordinates. */
+    HashMap<u64, Chunk> m_Chunks;
+
+    /** @brief The number of set voxels. */
+    sizet m_Count;
+
+    /** @brief The lowest chunk coordinates that ever held a set voxel, the raycast skips the space around them. */
+    i32 m_ChunkMin[3];
+    /** @brief The highest chunk coordinates that ever held a set voxel. */
+    i32 m_ChunkMax[3];
+
+};  // Bitrix3D
+
+template <class F>
+void Bitrix3D::ForEachBrickInRegion(i32 x, i32 y, i32 z, u32 width, u32 height, u32 depth, F&& function) const {
+    if (width == 0 || height == 0 || depth == 0 || Empty())
+        return;
+
+    const i64 x1 = static_cast<i64>(x) + width;
+    const i64 y1 = static_cast<i64>(y) + height;
+    const i64 z1 = static_cast<i64>(z) + depth;
+
+    const i64 first[3] = { static_cast<i64>(x) >> 4, static_cast<i64>(y) >> 4, static_cast<i64>(z) >> 4 };
+    const i64 last[3] = { (x1 - 1) >> 4, (y1 - 1) >> 4, (z1 - 1) >> 4 };
+
+    const u64 spanned = static_cast<u64>(last[0] - first[0] + 1) * static_cast<u64>(last[1] - first[1] + 1) *
+                        static_cast<u64>(last[2] - first[2] + 1);
+
+    auto visit = [&](u64 key, const Chunk& chunk) {
+        const u64 bricks = CubeMaskInBox(static_cast<i64>(KeyCoordinate(key, 0)) * 16,
+                                         static_cast<i64>(KeyCoordinate(key, 1)) * 16,
+                                         static_cast<i64>(KeyCoordinate(key, 2)) * 16, 4, x, x1, y, y1, z, z1);
+
+        if ((chunk.mask & bricks) != 0)
+            ForEachBrickInChunk(key, chunk, bricks, x, x1, y, y1, z, z1, function);
+    };
+
+    // Small boxes look up the chunks they cover, large ones walk the chunks and skip the ones outside.
+    //
+    if (spanned <= this->m_Chunks.Size()) {
+        for (i64 cz = first[2]; cz <= last[2]; cz++) {
+            for (i64 cy = first[1]; cy <= last[1]; cy++) {
+                for (i64 cx = first[0]; cx <= last[0]; cx++) {
+                    const u64 key = ChunkKey(static_cast<i32>(cx), static_cast<i32>(cy), static_cast<i32>(cz));
+                    const auto it = this->m_Chunks.Find(key);
+
+                    if (it != this->m_Chunks.End())
+                        visit(key, it->value);
+                }
+            }
+        }
+    }
+    else {
+        for (const auto& entry : this->m_Chunks) {
+            const i64 cx = KeyCoordinate(entry.key, 0);
+            const i64 cy = KeyCoordinate(entry.key, 1);
+            const i64 cz = KeyCoordinate(entry.key, 2);
+
+            if (cx >= first[0] && cx <= last[0] && cy >= first[1] && cy <= last[1] && cz >= first[2] && cz <= last[2])
+                visit(entry.key, entry.value);
+        }
+    }
+}
@@ -7,7 +7,7 @@
 // std
 #include <iostream>
 
-BixAccess::BixAccess(Bix &bix, u8 index) :
+BixAccess::BixAccess(Bix8 &bix, u8 index) :
     m_Ref(bix),
     m_Index(index)
 { }
@@ -39,25 +39,6 @@ Bix8::Bix8(const std::initializer_list<b8>& list) :
     }
 }
 
-Bix8::~Bix8()
-{ }
-
-b8 Bix8::operator == (const Bix8 &other) const {
-    return this->m_Val & other.m_Val;
-}
-
-b8 Bix8::operator != (const Bix8 &other) const {
-    return !(*this == other);
-}
-
-BixAccess Bix8::operator [] (u8 index) {
-    return { *this, index };
-}
-
-b8 Bix8::operator [] (u8 index) const {
-    return this->m_Val & (1U << Pos(index));
-}
-
 b8 Bix8::At(u8 index) const {
     if (index >= sizeof(u8) * 8)
         throw Ocean::Exception(Ocean::Error::OUT_OF_RANGE, "Attempt to access bit out of range!");
@@ -82,10 +63,6 @@ void Bix8::Set(u8 index, b8 value) {
         this->m_Val |= 1 << Pos(index);
 }
 
-void Bix8::Mask(u8 mask) {
-    this->m_Val &= mask;
-}
-
 std::ostream &operator << (std::ostream &os, const Bix8 &rhs) {
     for (u8 i = 0; i < sizeof(u8) * 8; i++)
         os << rhs[i];
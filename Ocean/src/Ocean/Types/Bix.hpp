@@ -3,24 +3,16 @@
 #include "Ocean/Types/Bool.hpp"
 #include "Ocean/Types/Integers.hpp"
 
+#include "Ocean/Primitives/Macros.hpp"
+
 // std
 #include <initializer_list>
 #include <ostream>
 
-/**
- * @brief A base Bix.
- */
-class Bix {
-public:
-    virtual ~Bix() = default;
-
-    virtual b8 At(u8 index) const = 0;
-    virtual void Set(u8 index, b8 value) = 0;
-};
-
+class Bix8;
 
 /**
- * @brief Accesses one bit in a Bix, enabling bool setting.
+ * @brief Accesses one bit in a Bix8, enabling bool setting.
  */
 class BixAccess {
     public:
@@ -29,7 +21,7 @@ class BixAccess {
         BixAccess& operator = (const BixAccess& rhs) = delete;
         BixAccess& operator = (BixAccess&&) = delete;
 
-        BixAccess(Bix &bix, u8 index);
+        BixAccess(Bix8 &bix, u8 index);
 
         /**
          * @brief Set's the position to the given val in the Bix.
@@ -37,26 +29,23 @@ class BixAccess {
          * @param val The val to set the bit.
          * @return BixAccess& 
          */
-        BixAccess& operator = (b8 val) {
-            this->m_Ref.Set(this->m_Index, val);
+        inline BixAccess& operator = (b8 val);
 
-            return *this;
-        }
-
-        operator b8() {
-            return this->m_Ref.At(this->m_Index);
-        }
+        inline operator b8();
 
     private:
-        Bix& m_Ref;
+        Bix8& m_Ref;
         u8 m_Index;
 
     };  // BixAccess
 
 /**
- * @brief A bitwise wrapper for 8 bits.
+ * @brief A bitwise wrapper for 8 bits, indexed from the most significant bit.
+ *
+ * @details Kept for the code that reads bits left to right. New code should use BitSet<8>, or BitSet and BitVector
+ * for more bits, which index from the least significant bit and work on whole words.
  */
-class Bix8 : public Bix {
+class Bix8 {
 public:
     Bix8();
     /**
@@ -77,27 +66,26 @@ public:
      * @param list An initializer list of booleans to represent the bits. Must not exceed a length of 8.
      */
     Bix8(const std::initializer_list<b8>& list);
-    ~Bix8();
 
     /**
      * @return b8 - True if this is equal to other, False otherwise.
      */
-    b8 operator == (const Bix8 &other) const;
+    inline b8 operator == (const Bix8 &other) const { return this->m_Val == other.m_Val; }
     /**
      * @return b8 - True if this is not equal to other, False otherwise.
      */
-    b8 operator != (const Bix8 &other) const;
+    inline b8 operator != (const Bix8 &other) const { return this->m_Val != other.m_Val; }
 
     /**
      * @param index The index of the bit, from left to right starting at 0.
      * @return BixAccess 
      */
-    BixAccess operator [] (u8 index);
+    inline BixAccess operator [] (u8 index) { return { *this, index }; }
     /**
      * @param index The index of the bit, from left to right starting at 0.
      * @return b8 - True if the bit is 1, False if it is 0.
      */
-    b8 operator [] (u8 index) const;
+    inline b8 operator [] (u8 index) const { return (this->m_Val >> Pos(index)) & 1; }
 
     /**
      * @brief Operates the same as index [] access with range access safety.
@@ -105,7 +93,7 @@ public:
      * @param index The index of the bit, from left to right starting at 0.
      * @return b8 - True if the bit is 1, False if it is 0.
      */
-    virtual b8 At(u8 index) const override;
+    b8 At(u8 index) const;
 
     /**
      * @brief Flips the bit at the given index.
@@ -119,13 +107,13 @@ public:
      * @param index The index of the bit value to get, from left to right starting at 0.
      * @param value The value to set the bit. True == 1, False == 0.
      */
-    virtual void Set(u8 index, b8 value) override;
+    void Set(u8 index, b8 value);
     /**
      * @brief Masks the internal value with the given mask.
      * 
      * @param mask A bitwise mask for a u8 value.
      */
-    void Mask(u8 mask);
+    inline void Mask(u8 mask) { this->m_Val &= mask; }
 
     /**
      * @brief Get's a copy of the internal value.
@@ -155,10 +143,22 @@ private:
      * @param index The left to right index.
      * @return u8 
      */
-    u8 Pos(u8 index) const { return (sizeof(u8) * 8 - index - 1); }
+    OC_STATIC_EXPR u8 Pos(u8 index) { return static_cast<u8>(sizeof(u8) * 8 - index - 1); }
 
 private:
     /** @brief The internal 8-bit value. */
     u8 m_Val;
 
 };  // Bix8
+
+static_assert(sizeof(Bix8) == sizeof(u8), "A Bix8 must be a single byte so arrays of them pack.");
+
+inline BixAccess& BixAccess::operator = (b8 val) {
+    this->m_Ref.Set(this->m_Index, val);
+
+    return *this;
+}
+
+inline BixAccess::operator b8() {
+    return this->m_Ref.At(this->m_Index);
+}
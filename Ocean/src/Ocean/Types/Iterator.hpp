@@ -22,24 +22,27 @@ public:
     using pointer = T*;
     using reference = T&;
 
-    InputIterator(pointer ptr) :
+    constexpr InputIterator(pointer ptr) :
         p_Ptr(ptr)
     { }
 
-    reference operator * () {
+    constexpr reference operator * () const {
         return *this->p_Ptr;
     }
+    constexpr pointer operator -> () const {
+        return this->p_Ptr;
+    }
 
-    InputIterator& operator ++ () {
+    constexpr InputIterator& operator ++ () {
         ++this->p_Ptr;
 
         return *this;
     }
 
-    b8 operator == (const InputIterator& other) const {
+    constexpr b8 operator == (const InputIterator& other) const {
         return this->p_Ptr == other.p_Ptr;
     }
-    b8 operator != (const InputIterator& other) const {
+    constexpr b8 operator != (const InputIterator& other) const {
         return this->p_Ptr != other.p_Ptr;
     }
 
@@ -98,7 +101,7 @@ public:
     using pointer = T*;
     using reference = T&;
 
-    ForwardIterator(pointer ptr) :
+    constexpr ForwardIterator(pointer ptr) :
         InputIterator<T>(ptr)
     { }
 
@@ -118,11 +121,11 @@ public:
     using pointer = T*;
     using reference = T&;
 
-    BidirectionalIterator(pointer ptr) :
+    constexpr BidirectionalIterator(pointer ptr) :
         ForwardIterator<T>(ptr)
     { }
 
-    BidirectionalIterator& operator -- () {
+    constexpr BidirectionalIterator& operator -- () {
         --this->p_Ptr;
 
         return *this;
@@ -144,19 +147,50 @@ public:
     using pointer = T*;
     using reference = T&;
 
-    RandomAccessIterator(pointer ptr) :
+    constexpr RandomAccessIterator(pointer ptr) :
         BidirectionalIterator<T>(ptr)
     { }
 
-    RandomAccessIterator operator + (difference_type n) const {
+    constexpr RandomAccessIterator operator + (difference_type n) const {
         return RandomAccessIterator<T>(this->p_Ptr + n);
     }
-    RandomAccessIterator operator - (difference_type n) const {
+    constexpr RandomAccessIterator operator - (difference_type n) const {
         return RandomAccessIterator<T>(this->p_Ptr - n);
     }
 
-    difference_type operator - (const RandomAccessIterator<T>& rai) {
+    constexpr difference_type operator - (const RandomAccessIterator<T>& rai) const {
         return this->p_Ptr - rai.p_Ptr;
     }
 
 };  // RandomAccessIterator
+
+/**
+ * @brief A pair of iterators that can be used in a range-based for loop, e.g. a sub range of a container.
+ * 
+ * @tparam I The iterator type.
+ */
+template <class I>
+class IteratorRange {
+public:
+    constexpr IteratorRange(I first, I last) :
+        m_First(first),
+        m_Last(last)
+    { }
+
+    constexpr I Begin() const { return this->m_First; }
+    constexpr I begin() const { return Begin(); }
+    constexpr I End() const { return this->m_Last; }
+    constexpr I end() const { return End(); }
+
+    /**
+     * @return b8 - True if the range has no elements, False otherwise.
+     */
+    constexpr b8 Empty() const { return this->m_First == this->m_Last; }
+
+private:
+    /** @brief The first element of the range. */
+    I m_First;
+    /** @brief One past the last element of the range. */
+    I m_Last;
+
+};  // IteratorRange
@@ -0,0 +1,137 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef OC_DETAILED_ALLOCATIONS
+
+TEST_CASE(AllocationProfiler_Histogram_Buckets) {
+    REQUIRE(AllocationProfiler::HistogramBucket(0) == 0);
+    REQUIRE(AllocationProfiler::HistogramBucket(1) == 0);
+    REQUIRE(AllocationProfiler::HistogramBucket(2) == 1);
+    REQUIRE(AllocationProfiler::HistogramBucket(3) == 2);
+    REQUIRE(AllocationProfiler::HistogramBucket(64) == 6);
+    REQUIRE(AllocationProfiler::HistogramBucket(65) == 7);
+    REQUIRE(AllocationProfiler::HistogramBucket(ogiga(static_cast<sizet>(1024))) == k_AllocationHistogramBuckets - 1);
+}
+
+TEST_CASE(AllocationProfiler_Records_Per_Tag) {
+    static AllocationSnapshot before, after;
+    AllocationProfiler::Snapshot(before);
+
+    PoolAllocator pool;
+    pool.Init(48, 8);
+    pool.SetTag(MEMORY_TAG_SCRATCH);
+
+    void* a = pool.Allocate(48, 16);
+    void* b = pool.Allocate(48, 16);
+    void* c = pool.Allocate(48, 16);
+    pool.Deallocate(b);
+
+    AllocationProfiler::Snapshot(after);
+
+    const AllocationTagStats& first = before.tags[MEMORY_TAG_SCRATCH];
+    const AllocationTagStats& second = after.tags[MEMORY_TAG_SCRATCH];
+
+    REQUIRE(second.allocationCount - first.allocationCount == 3);
+    REQUIRE(second.deallocationCount - first.deallocationCount == 1);
+    REQUIRE(second.allocatedBytes - first.allocatedBytes == 3 * 48);
+    REQUIRE(second.liveBytes - first.liveBytes == 2 * 48);
+    REQUIRE(second.peakLiveBytes >= second.liveBytes);
+    REQUIRE(second.histogram[AllocationProfiler::HistogramBucket(48)] - first.histogram[AllocationProfiler::HistogramBucket(48)] == 3);
+
+    // Other tags are untouched.
+    REQUIRE(after.tags[MEMORY_TAG_AUDIO].allocationCount == before.tags[MEMORY_TAG_AUDIO].allocationCount);
+
+    pool.Deallocate(a);
+    pool.Deallocate(c);
+    pool.Shutdown();
+}
+
+TEST_CASE(AllocationProfiler_Records_Call_Sites) {
+    HeapAllocator heap;
+    heap.Init(omega(1));
+
+    void* ptr = oalloca(100, &heap); const u32 line = __LINE__;
+    ofree(ptr, &heap);
+
+    static AllocationSnapshot snapshot;
+    AllocationProfiler::Snapshot(snapshot);
+
+    b8 found = false;
+    for (u32 i = 0; i < snapshot.callSiteCount; i++) {
+        const AllocationCallSiteStats& site = snapshot.callSites[i];
+
+        if (site.line == line && strcmp(site.file, __FILE__) == 0) {
+            REQUIRE(site.allocationCount == 1);
+            REQUIRE(site.requestedBytes == 100);
+
+            found = true;
+        }
+    }
+
+    REQUIRE(found);
+
+    heap.Shutdown();
+}
+
+TEST_CASE(AllocationProfiler_Merges_Threads) {
+    static AllocationSnapshot before, after;
+    AllocationProfiler::Snapshot(before);
+
+    HeapAllocator heap;
+    heap.Init(omega(4));
+    heap.SetTag(MEMORY_TAG_AUDIO);
+
+    std::vector<std::thread> threads;
+    for (u32 t = 0; t < 4; t++) {
+        threads.emplace_back([&heap]() {
+            for (u32 i = 0; i < 1000; i++)
+                heap.Deallocate(heap.Allocate(64, 16));
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    AllocationProfiler::Snapshot(after);
+
+    REQUIRE(after.tags[MEMORY_TAG_AUDIO].allocationCount - before.tags[MEMORY_TAG_AUDIO].allocationCount == 4000);
+    REQUIRE(after.tags[MEMORY_TAG_AUDIO].deallocationCount - before.tags[MEMORY_TAG_AUDIO].deallocationCount == 4000);
+    REQUIRE(after.tags[MEMORY_TAG_AUDIO].liveBytes == before.tags[MEMORY_TAG_AUDIO].liveBytes);
+
+    heap.Shutdown();
+}
+
+TEST_CASE(AllocationProfiler_Export) {
+    const char* jsonPath = "AllocationProfilerTests.json";
+    const char* csvPath = "AllocationProfilerTests.csv";
+
+    REQUIRE(AllocationProfiler::ExportJson(jsonPath));
+    REQUIRE(AllocationProfiler::ExportCsv(csvPath));
+
+    std::stringstream json;
+    json << std::ifstream(jsonPath).rdbuf();
+
+    REQUIRE(json.str().find("\"tags\"") != std::string::npos);
+    REQUIRE(json.str().find("\"Scratch\"") != std::string::npos);
+    REQUIRE(json.str().find("\"callSites\"") != std::string::npos);
+
+    std::stringstream csv;
+    csv << std::ifstream(csvPath).rdbuf();
+
+    REQUIRE(csv.str().rfind("kind,name,line", 0) == 0);
+    REQUIRE(csv.str().find("tag,Renderer,") != std::string::npos);
+
+    std::remove(jsonPath);
+    std::remove(csvPath);
+}
+
+#endif
@@ -0,0 +1,355 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <algorithm>
+#include <bitset>
+#include <random>
+#include <vector>
+
+TEST_CASE(Bit_Kernels_Words) {
+    REQUIRE(oPopcount(0) == 0);
+    REQUIRE(oPopcount(~u64(0)) == 64);
+    REQUIRE(oFirstBit(u64(1) << 63) == 63);
+    REQUIRE(oFirstBit(0b1010'0000) == 5);
+    REQUIRE(oLastBit(0b1010'0000) == 7);
+
+    const u64 word = 0x8000'0100'0000'0011;
+    REQUIRE(oSelectBit(word, 0) == 0);
+    REQUIRE(oSelectBit(word, 1) == 4);
+    REQUIRE(oSelectBit(word, 2) == 40);
+    REQUIRE(oSelectBit(word, 3) == 63);
+}
+
+TEST_CASE(Bit_Kernels_Match_Scalar) {
+    // Odd lengths leave a tail after the vector loops.
+    std::mt19937_64 random(5);
+
+    for (sizet count : { 0, 1, 3, 7, 64, 101 }) {
+        std::vector<u64> a(count), b(count), out(count);
+
+        for (sizet i = 0; i < count; i++) {
+            a[i] = random();
+            b[i] = random() & random();
+        }
+
+        sizet expected = 0;
+        for (sizet i = 0; i < count; i++)
+            expected += std::bitset<64>(a[i]).count();
+
+        REQUIRE(oBitsCount(a.data(), count) == expected);
+
+        oBitsAnd(out.data(), a.data(), b.data(), count);
+        for (sizet i = 0; i < count; i++)
+            REQUIRE(out[i] == (a[i] & b[i]));
+
+        oBitsOr(out.data(), a.data(), b.data(), count);
+        for (sizet i = 0; i < count; i++)
+            REQUIRE(out[i] == (a[i] | b[i]));
+
+        oBitsXor(out.data(), a.data(), b.data(), count);
+        for (sizet i = 0; i < count; i++)
+            REQUIRE(out[i] == (a[i] ^ b[i]));
+
+        oBitsAndNot(out.data(), a.data(), b.data(), count);
+        for (sizet i = 0; i < count; i++)
+            REQUIRE(out[i] == (a[i] & ~b[i]));
+
+        // In place, the output is the first input.
+        const std::vector<u64> original = a;
+
+        oBitsNot(a.data(), a.data(), count);
+        for (sizet i = 0; i < count; i++)
+            REQUIRE(a[i] == ~original[i]);
+    }
+
+    std::vector<u64> sparse(40, 0);
+    REQUIRE(oBitsFindFirst(sparse.data(), sparse.size(), 0) == 40 * 64);
+    REQUIRE(!oBitsAny(sparse.data(), sparse.size()));
+
+    sparse[37] = u64(1) << 9;
+    REQUIRE(oBitsFindFirst(sparse.data(), sparse.size(), 0) == 37 * 64 + 9);
+    REQUIRE(oBitsFindFirst(sparse.data(), sparse.size(), 37 * 64 + 9) == 37 * 64 + 9);
+    REQUIRE(oBitsFindFirst(sparse.data(), sparse.size(), 37 * 64 + 10) == 40 * 64);
+    REQUIRE(oBitsSelect(sparse.data(), sparse.size(), 0) == 37 * 64 + 9);
+    REQUIRE(oBitsSelect(sparse.data(), sparse.size(), 1) == 40 * 64);
+}
+
+TEST_CASE(Bit_Kernels_Shift_And_Range) {
+    // Shifts against a bit by bit reference, into a copy and in place.
+    std::mt19937_64 random(8);
+
+    for (sizet count : { 1, 2, 5, 9, 13 }) {
+        std::vector<u64> in(count);
+        for (u64& word : in)
+            word = random();
+
+        auto bit = [&](sizet index) -> b8 { return index < count * 64 && ((in[index / 64] >> (index % 64)) & 1); };
+
+        for (sizet shift : { 0, 1, 31, 63, 64, 65, 130, 400, 900 }) {
+            std::vector<u64> up(count), down(in);
+
+            oBitsShiftUp(up.data(), in.data(), count, shift);
+            oBitsShiftDown(down.data(), down.data(), count, shift);
+
+            for (sizet i = 0; i < count * 64; i++) {
+                REQUIRE(((up[i / 64] >> (i % 64)) & 1) == (i >= shift && bit(i - shift)));
+                REQUIRE(((down[i / 64] >> (i % 64)) & 1) == bit(i + shift));
+            }
+
+            std::vector<u64> inPlace(in);
+            oBitsShiftUp(inPlace.data(), inPlace.data(), count, shift);
+            REQUIRE(inPlace == up);
+        }
+
+        for (sizet begin : { 0, 3, 64, 70 }) {
+            for (sizet end : { 0, 5, 64, 127, 200 }) {
+                const sizet last = std::min<sizet>(end, count * 64);
+
+                sizet expected = 0;
+                for (sizet i = begin; i < last; i++)
+                    expected += bit(i);
+
+                REQUIRE(oBitsCountRange(in.data(), begin, last) == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE(BitSet_Bits) {
+    BitSet<100> bits;
+
+    REQUIRE(bits.Size() == 100);
+    REQUIRE(bits.WordCount() == 2);
+    REQUIRE(bits.None());
+
+    bits.Set(0);
+    bits.Set(64);
+    bits[99] = true;
+    bits.Set(50, true);
+    bits.Flip(3);
+
+    REQUIRE(bits.Count() == 5);
+    REQUIRE(bits[99]);
+    REQUIRE(bits.Test(3));
+    REQUIRE(!bits.Test(4));
+
+    bits.Reset(3);
+    bits[50] = false;
+    REQUIRE(bits.Count() == 3);
+    REQUIRE(bits.At(64));
+    REQUIRE_THROW_AS(bits.At(100), Ocean::Exception);
+
+    // The bits past the size stay clear, so flipping everything counts only real bits.
+    bits.Flip();
+    REQUIRE(bits.Count() == 97);
+    REQUIRE(!bits.All());
+
+    bits.Clear(true);
+    REQUIRE(bits.All());
+    REQUIRE(bits.Count() == 100);
+    REQUIRE(bits == ~BitSet<100>());
+
+    bits.Clear();
+    REQUIRE(bits == BitSet<100>());
+
+    const BitSet<8> small(0x1ff);
+    REQUIRE(small.Count() == 8);
+    REQUIRE(small.All());
+}
+
+TEST_CASE(BitSet_Search_Rank_Select) {
+    BitSet<300> bits;
+
+    REQUIRE(bits.FindFirst() == 300);
+    REQUIRE(bits.Select(0) == 300);
+
+    const std::vector<sizet> set = { 2, 63, 64, 130, 299 };
+    for (sizet index : set)
+        bits.Set(index);
+
+    REQUIRE(bits.FindFirst() == 2);
+    REQUIRE(bits.FindNext(3) == 63);
+    REQUIRE(bits.FindNext(65) == 130);
+    REQUIRE(bits.FindNext(300) == 300);
+
+    for (sizet i = 0; i < set.size(); i++) {
+        REQUIRE(bits.Select(i) == set[i]);
+        REQUIRE(bits.Rank(set[i]) == i);
+        REQUIRE(bits.Rank(set[i] + 1) == i + 1);
+    }
+
+    REQUIRE(bits.Select(set.size()) == 300);
+    REQUIRE(bits.Rank(300) == set.size());
+
+    std::vector<sizet> visited;
+    bits.ForEachSet([&](sizet index) { visited.push_back(index); });
+    REQUIRE(visited == set);
+}
+
+TEST_CASE(BitSet_Bulk_Operations) {
+    BitSet<130> a;
+    BitSet<130> b;
+
+    for (sizet i = 0; i < 130; i += 2)
+        a.Set(i);
+    for (sizet i = 0; i < 130; i += 3)
+        b.Set(i);
+
+    REQUIRE((a & b).Count() == 22);
+    REQUIRE((a | b).Count() == 65 + 44 - 22);
+    REQUIRE((a ^ b).Count() == 65 + 44 - 2 * 22);
+
+    BitSet<130> c = a;
+    c.AndNot(b);
+    REQUIRE(c.Count() == 65 - 22);
+    REQUIRE((c & b).None());
+
+    c |= b;
+    REQUIRE(c == (a | b));
+    c ^= c;
+    REQUIRE(c.None());
+}
+
+TEST_CASE(BitVector_Growth) {
+    BitVector<> bits;
+
+    REQUIRE(bits.Empty());
+    REQUIRE(bits.FindFirst() == 0);
+
+    std::vector<bool> expected;
+    std::mt19937 random(17);
+
+    for (sizet i = 0; i < 1000; i++) {
+        const b8 value = random() % 3 == 0;
+
+        bits.PushBack(value);
+        expected.push_back(value);
+    }
+
+    REQUIRE(bits.Size() == 1000);
+    REQUIRE(bits.Capacity() >= 1000);
+
+    sizet count = 0;
+    for (sizet i = 0; i < 1000; i++) {
+        REQUIRE(bits[i] == expected[i]);
+        count += expected[i];
+    }
+
+    REQUIRE(bits.Count() == count);
+
+    bits.PopBack();
+    bits.PopBack();
+    REQUIRE(bits.Size() == 998);
+
+    // Growing with set bits sets only the new bits, shrinking drops the bits past the size.
+    bits.Resize(1100, true);
+    REQUIRE(bits.Count() == bits.Rank(998) + 102);
+    REQUIRE(bits.At(1099));
+    REQUIRE_THROW_AS(bits.At(1100), Ocean::Exception);
+
+    bits.Resize(10);
+    bits.Resize(200);
+    REQUIRE(bits.FindNext(10) == 200);
+
+    bits.Fill(true);
+    REQUIRE(bits.All());
+
+    bits.Flip();
+    REQUIRE(bits.None());
+
+    bits.Clear();
+    REQUIRE(bits.Empty());
+    REQUIRE_THROW_AS(bits.PopBack(), Ocean::Exception);
+
+    // Refilling after a clear does not see the old bits.
+    bits.Resize(128);
+    REQUIRE(bits.None());
+}
+
+/**
+ * @brief A policy that fails once its copies have allocated a shared number of bytes, freed bytes are not returned.
+ */
+struct BudgetPolicy {
+    sizet* remaining;
+
+    void* Allocate(sizet size, OC_UNUSED sizet alignment = alignof(max_align_t)) {
+        if (size > *this->remaining)
+            return nullptr;
+
+        *this->remaining -= size;
+
+        return malloc(size);
+    }
+    void Deallocate(void* ptr) { free(ptr); }
+    void* Reallocate(void* ptr, sizet oldSize, sizet newSize, OC_UNUSED sizet alignment = alignof(max_align_t)) {
+        if (newSize > oldSize + *this->remaining)
+            return nullptr;
+
+        *this->remaining -= newSize - oldSize;
+
+        return realloc(ptr, newSize);
+    }
+
+    b8 operator == (const BudgetPolicy& other) const { return this->remaining == other.remaining; }
+    b8 operator != (const BudgetPolicy& other) const { return this->remaining != other.remaining; }
+
+};  // BudgetPolicy
+
+TEST_CASE(BitVector_Allocation_Failure) {
+    sizet remaining = 2 * sizeof(u64);
+
+    BitVector<BudgetPolicy> bits(128, true, BudgetPolicy{ &remaining });
+
+    // A failed grow throws and keeps the bits.
+    REQUIRE_THROW_AS(bits.PushBack(true), Ocean::Exception);
+    REQUIRE(bits.Size() == 128);
+    REQUIRE(bits.All());
+
+    // A failed copy throws instead of writing through a null pointer.
+    REQUIRE_THROW_AS(BitVector<BudgetPolicy> copy(bits), Ocean::Exception);
+
+    BitVector<BudgetPolicy> empty(0, false, BudgetPolicy{ &remaining });
+    REQUIRE_THROW_AS(empty.PushBack(true), Ocean::Exception);
+    REQUIRE(empty.Empty());
+}
+
+TEST_CASE(BitVector_Bulk_Operations) {
+    BitVector<> a(200);
+    BitVector<> b(200, true);
+
+    for (sizet i = 0; i < 200; i += 5)
+        a.Set(i);
+
+    BitVector<> c = a;
+    c &= b;
+    REQUIRE(c == a);
+
+    c ^= b;
+    REQUIRE(c.Count() == 160);
+    REQUIRE(c.Select(0) == 1);
+    REQUIRE(c.Rank(5) == 4);
+
+    c |= a;
+    REQUIRE(c.All());
+
+    c.AndNot(a);
+    REQUIRE(c.Count() == 160);
+
+    std::vector<sizet> found;
+    a.ForEachSet([&](sizet index) { found.push_back(index); });
+    REQUIRE(found.size() == 40);
+    REQUIRE(found.back() == 195);
+
+    BitVector<> other(100);
+    REQUIRE_THROW_AS(a |= other, Ocean::Exception);
+
+    other = a;
+    REQUIRE(other == a);
+
+    BitVector<> moved(std::move(other));
+    REQUIRE(moved == a);
+    REQUIRE(other.Empty());
+    REQUIRE(moved != b);
+}
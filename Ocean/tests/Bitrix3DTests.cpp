@@ -0,0 +1,302 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <cmath>
+#include <random>
+#include <set>
+#include <tuple>
+#include <utility>
+
+using Voxel = std::tuple<i32, i32, i32>;
+
+/**
+ * @brief Walks a ray voxel by voxel, the plain digital differential analyzer the Bitrix3D raycast skips ahead of.
+ */
+static b8 ReferenceRaycast(const Bitrix3D& volume, const f64 origin[3], const f64 direction[3], f64 maxDistance,
+                           Bitrix3DHit& hit) {
+    i64 voxel[3];
+    i32 step[3];
+    f64 next[3];
+    f64 delta[3];
+
+    for (u32 a = 0; a < 3; a++) {
+        voxel[a] = static_cast<i64>(std::floor(origin[a]));
+        step[a] = direction[a] > 0 ? 1 : direction[a] < 0 ? -1 : 0;
+        delta[a] = step[a] == 0 ? INFINITY : 1.0 / std::abs(direction[a]);
+        next[a] = step[a] == 0 ? INFINITY : (voxel[a] + (step[a] > 0) - origin[a]) / direction[a];
+    }
+
+    f64 distance = 0.0;
+    i32 axis = -1;
+
+    while (distance <= maxDistance) {
+        if (volume.Get(static_cast<i32>(voxel[0]), static_cast<i32>(voxel[1]), static_cast<i32>(voxel[2]))) {
+            hit.x = static_cast<i32>(voxel[0]);
+            hit.y = static_cast<i32>(voxel[1]);
+            hit.z = static_cast<i32>(voxel[2]);
+            hit.distance = static_cast<f32>(distance);
+            hit.normalX = static_cast<i8>(axis == 0 ? -step[0] : 0);
+            hit.normalY = static_cast<i8>(axis == 1 ? -step[1] : 0);
+            hit.normalZ = static_cast<i8>(axis == 2 ? -step[2] : 0);
+
+            return true;
+        }
+
+        axis = next[0] < next[1] ? (next[0] < next[2] ? 0 : 2) : (next[1] < next[2] ? 1 : 2);
+        distance = next[axis];
+        voxel[axis] += step[axis];
+        next[axis] += delta[axis];
+    }
+
+    return false;
+}
+
+TEST_CASE(Bitrix3D_Set_and_Get) {
+    Bitrix3D volume;
+
+    REQUIRE(volume.Empty());
+    REQUIRE(!volume.Get(0, 0, 0));
+
+    volume.Set(0, 0, 0);
+    volume.Set(-1, -1, -1);
+    volume.Set(3, 3, 3);
+    volume.Set(1000000, -2000000, 7);
+    volume.Set(Bitrix3D::k_Max - 1, Bitrix3D::k_Min, 0);
+
+    REQUIRE(volume.Count() == 5);
+    REQUIRE(volume.Get(-1, -1, -1));
+    REQUIRE(volume.Get(1000000, -2000000, 7));
+    REQUIRE(volume.Get(Bitrix3D::k_Max - 1, Bitrix3D::k_Min, 0));
+    REQUIRE(!volume.Get(-1, -1, 0));
+    REQUIRE(!volume.Get(1000000, -2000000, 6));
+
+    // Positions one chunk range apart would share a key, so they are out of range rather than aliased.
+    REQUIRE(!volume.Get(Bitrix3D::k_Max, 0, 0));
+    REQUIRE_THROW_AS(volume.Set(Bitrix3D::k_Max, 0, 0), Ocean::Exception);
+    REQUIRE_THROW_AS(volume.Set(0, Bitrix3D::k_Min - 1, 0), Ocean::Exception);
+
+    // (0, 0, 0) and (3, 3, 3) share a brick, (-1, -1, -1) is in another chunk.
+    REQUIRE(volume.BrickCount() == 4);
+    REQUIRE(volume.ChunkCount() == 4);
+
+    volume.Set(3, 3, 3);
+    REQUIRE(volume.Count() == 5);
+
+    // Clearing the last voxel of a brick frees it, and the last brick of a chunk frees the chunk.
+    volume.Set(0, 0, 0, false);
+    REQUIRE(volume.BrickCount() == 4);
+
+    volume.Set(3, 3, 3, false);
+    volume.Set(-1, -1, -1, false);
+    volume.Set(-1, -1, -1, false);
+    REQUIRE(volume.Count() == 2);
+    REQUIRE(volume.BrickCount() == 2);
+    REQUIRE(volume.ChunkCount() == 2);
+
+    volume.Clear();
+    REQUIRE(volume.Empty());
+    REQUIRE(volume.ChunkCount() == 0);
+}
+
+TEST_CASE(Bitrix3D_Bricks_Stay_Ordered) {
+    // Every brick of a chunk, added and removed out of order, against a set of the positions.
+    Bitrix3D volume;
+    std::set<Voxel> expected;
+    std::mt19937 random(4);
+
+    for (u32 i = 0; i < 5000; i++) {
+        const i32 x = static_cast<i32>(random() % 32) - 16;
+        const i32 y = static_cast<i32>(random() % 16);
+        const i32 z = static_cast<i32>(random() % 16);
+        const b8 value = random() % 3 != 0;
+
+        volume.Set(x, y, z, value);
+
+        if (value)
+            expected.insert({ x, y, z });
+        else
+            expected.erase({ x, y, z });
+    }
+
+    REQUIRE(volume.Count() == expected.size());
+
+    for (i32 z = 0; z < 16; z++)
+        for (i32 y = 0; y < 16; y++)
+            for (i32 x = -16; x < 16; x++)
+                REQUIRE(volume.Get(x, y, z) == (expected.count({ x, y, z }) == 1));
+
+    std::set<Voxel> visited;
+    volume.ForEachSet([&](i32 x, i32 y, i32 z) { REQUIRE(visited.insert({ x, y, z }).second); });
+    REQUIRE(visited == expected);
+}
+
+TEST_CASE(Bitrix3D_Regions) {
+    Bitrix3D volume;
+    std::set<Voxel> expected;
+    std::mt19937 random(9);
+
+    // Boxes that start and end inside bricks and chunks, on both sides of 0.
+    for (u32 i = 0; i < 40; i++) {
+        const i32 x = static_cast<i32>(random() % 60) - 30;
+        const i32 y = static_cast<i32>(random() % 60) - 30;
+        const i32 z = static_cast<i32>(random() % 60) - 30;
+        const u32 width = random() % 20;
+        const u32 height = random() % 20;
+        const u32 depth = random() % 20;
+        const b8 value = i % 4 != 3;
+
+        volume.SetRegion(x, y, z, width, height, depth, value);
+
+        for (i32 vz = z; vz < z + static_cast<i32>(depth); vz++) {
+            for (i32 vy = y; vy < y + static_cast<i32>(height); vy++) {
+                for (i32 vx = x; vx < x + static_cast<i32>(width); vx++) {
+                    if (value)
+                        expected.insert({ vx, vy, vz });
+                    else
+                        expected.erase({ vx, vy, vz });
+                }
+            }
+        }
+    }
+
+    REQUIRE(volume.Count() == expected.size());
+
+    for (u32 i = 0; i < 40; i++) {
+        const i32 x = static_cast<i32>(random() % 80) - 40;
+        const i32 y = static_cast<i32>(random() % 80) - 40;
+        const i32 z = static_cast<i32>(random() % 80) - 40;
+        const u32 size = random() % 40;
+
+        std::set<Voxel> inside;
+        for (const Voxel& voxel : expected) {
+            const auto [vx, vy, vz] = voxel;
+
+            if (vx >= x && vx < x + static_cast<i32>(size) && vy >= y && vy < y + static_cast<i32>(size) &&
+                vz >= z && vz < z + static_cast<i32>(size))
+                inside.insert(voxel);
+        }
+
+        std::set<Voxel> visited;
+        volume.ForEachSetInRegion(x, y, z, size, size, size, [&](i32 vx, i32 vy, i32 vz) {
+            REQUIRE(visited.insert({ vx, vy, vz }).second);
+        });
+
+        REQUIRE(visited == inside);
+        REQUIRE(volume.CountRegion(x, y, z, size, size, size) == inside.size());
+    }
+
+    // A box larger than the chunks there are walks the chunks instead of looking them up.
+    REQUIRE(volume.CountRegion(-1000, -1000, -1000, 2000, 2000, 2000) == expected.size());
+
+    volume.SetRegion(-100, -100, -100, 200, 200, 200, false);
+    REQUIRE(volume.Empty());
+    REQUIRE(volume.ChunkCount() == 0);
+
+    REQUIRE_THROW_AS(volume.SetRegion(Bitrix3D::k_Max - 4, 0, 0, 5, 1, 1), Ocean::Exception);
+}
+
+TEST_CASE(Bitrix3D_Copy_and_Move) {
+    Bitrix3D volume;
+    volume.SetRegion(-5, -5, -5, 30, 2, 9);
+    volume.Set(100, 100, 100);
+
+    Bitrix3D copy(volume);
+    REQUIRE(copy == volume);
+
+    copy.Set(100, 100, 100, false);
+    REQUIRE(copy != volume);
+    REQUIRE(volume.Get(100, 100, 100));
+
+    copy = volume;
+    REQUIRE(copy == volume);
+
+    Bitrix3D moved(std::move(copy));
+    REQUIRE(moved == volume);
+    REQUIRE(copy.Empty());
+
+    copy = std::move(moved);
+    REQUIRE(copy == volume);
+    REQUIRE(moved.Empty());
+    REQUIRE(moved.ChunkCount() == 0);
+}
+
+TEST_CASE(Bitrix3D_Raycast) {
+    Bitrix3D volume;
+    Bitrix3DHit hit;
+
+    REQUIRE(!volume.Raycast(0, 0, 0, 1, 0, 0, 1000, hit));
+    REQUIRE_THROW_AS(volume.Raycast(0, 0, 0, 0, 0, 0, 1000, hit), Ocean::Exception);
+
+    // A wall far down the x axis, behind empty chunks.
+    volume.SetRegion(200, -8, -8, 1, 16, 16);
+
+    REQUIRE(volume.Raycast(0.5f, 0.5f, 0.5f, 2, 0, 0, 1000, hit));
+    REQUIRE(hit.x == 200);
+    REQUIRE(hit.y == 0);
+    REQUIRE(std::abs(hit.distance - 199.5f) < 1e-3f);
+    REQUIRE(hit.normalX == -1);
+    REQUIRE(hit.normalY == 0);
+
+    REQUIRE(!volume.Raycast(0.5f, 0.5f, 0.5f, 1, 0, 0, 199, hit));
+    REQUIRE(!volume.Raycast(0.5f, 0.5f, 0.5f, -1, 0, 0, 1000, hit));
+    REQUIRE(!volume.Raycast(0.5f, 20.5f, 0.5f, 1, 0, 0, 1000, hit));
+
+    REQUIRE(volume.Raycast(200.5f, 0.5f, 0.5f, 0, 1, 0, 10, hit));
+    REQUIRE(hit.distance == 0);
+    REQUIRE(hit.normalX == 0);
+
+    // Sparse random voxels, against the voxel by voxel walk.
+    volume.Clear();
+    std::mt19937 random(21);
+    std::uniform_real_distribution<f64> position(-40.0, 40.0);
+    std::uniform_real_distribution<f64> component(-1.0, 1.0);
+
+    for (u32 i = 0; i < 600; i++)
+        volume.Set(static_cast<i32>(random() % 80) - 40, static_cast<i32>(random() % 80) - 40,
+                   static_cast<i32>(random() % 80) - 40);
+
+    u32 hits = 0;
+
+    for (u32 i = 0; i < 2000; i++) {
+        // Both walks start from the same floats.
+        f32 origin[3] = { static_cast<f32>(position(random)), static_cast<f32>(position(random)),
+                          static_cast<f32>(position(random)) };
+        f32 direction[3] = { static_cast<f32>(component(random)), static_cast<f32>(component(random)),
+                             static_cast<f32>(component(random)) };
+
+        // Some rays run along an axis.
+        if (i % 10 == 0)
+            direction[0] = direction[1] = 0;
+
+        const f64 length = std::sqrt(static_cast<f64>(direction[0]) * direction[0] +
+                                     static_cast<f64>(direction[1]) * direction[1] +
+                                     static_cast<f64>(direction[2]) * direction[2]);
+        if (length == 0)
+            continue;
+
+        const f64 start[3] = { origin[0], origin[1], origin[2] };
+        const f64 heading[3] = { direction[0] / length, direction[1] / length, direction[2] / length };
+
+        Bitrix3DHit expected;
+        const b8 found = ReferenceRaycast(volume, start, heading, 150.0, expected);
+
+        REQUIRE(volume.Raycast(origin[0], origin[1], origin[2], direction[0], direction[1], direction[2], 150.0f,
+                               hit) == found);
+
+        if (!found)
+            continue;
+
+        hits++;
+        REQUIRE(hit.x == expected.x);
+        REQUIRE(hit.y == expected.y);
+        REQUIRE(hit.z == expected.z);
+        REQUIRE(std::abs(hit.distance - expected.distance) < 1e-3f);
+        REQUIRE(hit.normalX == expected.normalX);
+        REQUIRE(hit.normalY == expected.normalY);
+        REQUIRE(hit.normalZ == expected.normalZ);
+    }
+
+    REQUIRE(hits > 100);
+}
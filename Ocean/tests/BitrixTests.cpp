@@ -3,7 +3,68 @@
 #include "./Base/Tests.hpp"
 
 // std
+#include <random>
 #include <sstream>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A random matrix with about one in every given number of cells set.
+ */
+static Bitrix2D RandomMatrix(u16 width, u16 height, u32 oneIn, u32 seed) {
+    std::mt19937 random(seed);
+    Bitrix2D matrix(width, height);
+
+    for (u16 y = 0; y < height; y++)
+        for (u16 x = 0; x < width; x++)
+            matrix.Set(x, y, random() % oneIn == 0);
+
+    return matrix;
+}
+
+/**
+ * @brief Labels the 4-connected regions cell by cell, numbered in the order their first cell appears.
+ */
+static u32 ReferenceLabels(const Bitrix2D& matrix, std::vector<u32>& labels) {
+    const i32 width = matrix.Width();
+    const i32 height = matrix.Height();
+
+    labels.assign(width * height, 0);
+    u32 count = 0;
+
+    for (i32 start = 0; start < width * height; start++) {
+        if (labels[start] != 0 || !matrix.Get(start % width, start / width))
+            continue;
+
+        std::vector<i32> stack = { start };
+        labels[start] = ++count;
+
+        while (!stack.empty()) {
+            const i32 cell = stack.back();
+            stack.pop_back();
+
+            const i32 x = cell % width;
+            const i32 y = cell / width;
+
+            const i32 neighbors[4][2] = { { x - 1, y }, { x + 1, y }, { x, y - 1 }, { x, y + 1 } };
+
+            for (const auto& neighbor : neighbors) {
+                const i32 nx = neighbor[0];
+                const i32 ny = neighbor[1];
+
+                if (nx < 0 || ny < 0 || nx >= width || ny >= height)
+                    continue;
+                if (labels[ny * width + nx] != 0 || !matrix.Get(nx, ny))
+                    continue;
+
+                labels[ny * width + nx] = count;
+                stack.push_back(ny * width + nx);
+            }
+        }
+    }
+
+    return count;
+}
 
 TEST_CASE(Bitrix2D_Default_Constructor) {
     Bitrix2D matrix;
@@ -69,3 +130,318 @@ TEST_CASE(Bitrix2D_Output_Stream_Operator) {
 
     REQUIRE(oss.str() == std::string("1 0 0 \n0 1 0 \n0 0 1 \n"));
 }
+
+TEST_CASE(Bitrix2D_Copy_and_Move) {
+    Bitrix2D matrix(70, 3);
+
+    matrix.Set(69, 2, true);
+    matrix.Set(0, 0, true);
+
+    Bitrix2D copy(matrix);
+    REQUIRE(copy == matrix);
+
+    copy.Set(1, 1, true);
+    REQUIRE(copy != matrix);
+
+    // Assigning reuses or replaces the words, and never keeps the old bits.
+    Bitrix2D other(5, 5);
+    other.Clear(true);
+    other = matrix;
+    REQUIRE(other == matrix);
+    REQUIRE(other.Count() == 2);
+
+    Bitrix2D moved(std::move(copy));
+    REQUIRE(moved.Count() == 3);
+    REQUIRE(copy.Empty());
+
+    other = std::move(moved);
+    REQUIRE(other.Count() == 3);
+    REQUIRE(moved.Empty());
+}
+
+TEST_CASE(Bitrix2D_Resize_Keeps_Bits) {
+    Bitrix2D matrix(100, 4);
+
+    matrix.Set(99, 3, true);
+    matrix.Set(64, 0, true);
+    matrix.Set(10, 1, true);
+
+    // New columns and rows take the value, the bits that remain are kept as they are.
+    matrix.Resize(130, 5, true);
+    REQUIRE(matrix.Width() == 130);
+    REQUIRE(matrix.Height() == 5);
+    REQUIRE(matrix.Get(99, 3));
+    REQUIRE(!matrix.Get(98, 3));
+    REQUIRE(matrix.Get(100, 0));
+    REQUIRE(matrix.Get(129, 4));
+    REQUIRE(matrix.Count() == 3 + 30 * 4 + 130);
+
+    matrix.Resize(65, 2);
+    REQUIRE(matrix.Count() == 2);
+    REQUIRE(matrix.Get(64, 0));
+    REQUIRE(matrix.Get(10, 1));
+
+    matrix.Clear(true);
+    REQUIRE(matrix.Count() == 65 * 2);
+    REQUIRE(matrix.CountRow(1) == 65);
+}
+
+TEST_CASE(Bitrix2D_Bulk_Operations) {
+    Bitrix2D a(200, 10);
+    Bitrix2D b(200, 10);
+
+    for (u16 y = 0; y < 10; y++) {
+        for (u16 x = 0; x < 200; x++) {
+            a[x][y] = (x + y) % 2 == 0;
+            b.Set(x, y, x % 4 == 0);
+        }
+    }
+
+    REQUIRE(a.Count() == 1000);
+    REQUIRE(b.Count() == 500);
+    REQUIRE((a & b).Count() == 250);
+    REQUIRE((a | b).Count() == 1250);
+    REQUIRE((a ^ b).Count() == 1000);
+    REQUIRE((~a).Count() == 1000);
+    REQUIRE((~a & a).Count() == 0);
+
+    Bitrix2D c = a;
+    c.AndNot(b);
+    REQUIRE(c.Count() == 750);
+
+    c |= b;
+    c ^= b;
+    c &= a;
+    REQUIRE(c.Count() == 750);
+
+    Bitrix2D small(10, 10);
+    REQUIRE_THROW_AS(a |= small, Ocean::Exception);
+
+    REQUIRE(b.CountRegion(0, 0, 200, 10) == 500);
+    REQUIRE(b.CountRegion(1, 0, 3, 10) == 0);
+    REQUIRE(b.CountRegion(60, 2, 70, 3) == 18 * 3);
+    REQUIRE_THROW_AS(b.CountRegion(150, 0, 51, 1), Ocean::Exception);
+}
+
+TEST_CASE(Bitrix2D_Shift) {
+    Bitrix2D matrix(130, 6);
+
+    matrix.Set(0, 0, true);
+    matrix.Set(63, 1, true);
+    matrix.Set(129, 5, true);
+
+    Bitrix2D shifted = matrix;
+    shifted.Shift(1, 1);
+    REQUIRE(shifted.Count() == 2);
+    REQUIRE(shifted.Get(1, 1));
+    REQUIRE(shifted.Get(64, 2));
+
+    shifted = matrix;
+    shifted.Shift(-63, -1);
+    REQUIRE(shifted.Count() == 2);
+    REQUIRE(shifted.Get(0, 0));
+    REQUIRE(shifted.Get(66, 4));
+
+    shifted = matrix;
+    shifted.Shift(60, 0);
+    shifted.Shift(-60, 0);
+    REQUIRE(shifted.Count() == 2);
+    REQUIRE(shifted.Get(0, 0));
+    REQUIRE(shifted.Get(63, 1));
+
+    shifted.Shift(0, 6);
+    REQUIRE(shifted.Count() == 0);
+}
+
+TEST_CASE(Bitrix2D_Flood_Fill) {
+    // A wall with a gap in the last row, the fill wraps around it.
+    Bitrix2D maze(150, 4);
+    maze.Clear(true);
+
+    for (u16 y = 0; y < 3; y++)
+        maze.Set(100, y, false);
+
+    Bitrix2D filled = maze.FloodFill(0, 0);
+    REQUIRE(filled == maze);
+
+    maze.Set(100, 3, false);
+
+    filled = maze.FloodFill(149, 0);
+    REQUIRE(filled.Count() == 49 * 4);
+    REQUIRE(filled.Get(101, 3));
+    REQUIRE(!filled.Get(99, 3));
+
+    REQUIRE(maze.FloodFill(100, 1).Count() == 0);
+    REQUIRE_THROW_AS(maze.FloodFill(150, 0), Ocean::Exception);
+
+    // Against the regions of the reference labeling.
+    const Bitrix2D random = RandomMatrix(200, 60, 2, 3);
+
+    std::vector<u32> expected;
+    ReferenceLabels(random, expected);
+
+    for (u16 y = 0; y < 60; y += 7) {
+        for (u16 x = 0; x < 200; x += 13) {
+            const Bitrix2D region = random.FloodFill(x, y);
+            const u32 label = expected[y * 200 + x];
+
+            for (u16 cy = 0; cy < 60; cy++)
+                for (u16 cx = 0; cx < 200; cx++)
+                    REQUIRE(region.Get(cx, cy) == (label != 0 && expected[cy * 200 + cx] == label));
+        }
+    }
+}
+
+TEST_CASE(Bitrix2D_Label_Components) {
+    DynamicArray<u32> labels;
+    std::vector<u32> expected;
+
+    Bitrix2D empty;
+    REQUIRE(empty.LabelComponents(labels) == 0);
+    REQUIRE(labels.Size() == 0);
+
+    // Dense enough for regions to wind between rows, and large enough for the threads to split it into bands.
+    for (u32 oneIn : { 2, 3 }) {
+        const Bitrix2D matrix = RandomMatrix(1000, 1100, oneIn, oneIn);
+        const u32 count = ReferenceLabels(matrix, expected);
+
+        for (u32 threads : { 1, 4 }) {
+            REQUIRE(matrix.LabelComponents(labels, threads) == count);
+            REQUIRE(labels.Size() == expected.size());
+
+            for (sizet i = 0; i < expected.size(); i++)
+                REQUIRE(labels[i] == expected[i]);
+        }
+    }
+}
+
+TEST_CASE(Bitrix2D_Dilate_and_Erode) {
+    for (u16 radius : { 1, 2, 5, 70 }) {
+        for (u32 threads : { 1, 4 }) {
+            const Bitrix2D matrix = RandomMatrix(150, 40, 60, radius);
+
+            Bitrix2D dilated = matrix;
+            dilated.Dilate(radius, threads);
+
+            Bitrix2D eroded = ~matrix;
+            eroded.Erode(radius, threads);
+
+            for (i32 y = 0; y < 40; y++) {
+                for (i32 x = 0; x < 150; x++) {
+                    b8 any = false;
+
+                    for (i32 ny = std::max(y - radius, 0); ny <= std::min(y + radius, 39); ny++)
+                        for (i32 nx = std::max(x - radius, 0); nx <= std::min(x + radius, 149); nx++)
+                            any = any || matrix.Get(nx, ny);
+
+                    REQUIRE(dilated.Get(x, y) == any);
+                    REQUIRE(eroded.Get(x, y) == !any);
+                }
+            }
+
+            REQUIRE(dilated.Count() <= 150 * 40);
+        }
+    }
+
+    // Large enough for the threads to split it into bands, every band works in its own part of the scratch.
+    const Bitrix2D large = RandomMatrix(4096, 1024, 500, 9);
+
+    for (u16 radius : { 1, 6 }) {
+        Bitrix2D single = large;
+        single.Dilate(radius, 1);
+
+        for (u32 threads : { 3, 4 }) {
+            Bitrix2D banded = large;
+            banded.Dilate(radius, threads);
+            REQUIRE(banded == single);
+
+            banded = ~large;
+            banded.Erode(radius, threads);
+            REQUIRE(banded == ~single);
+        }
+    }
+
+    // The cells outside count as set, so a full matrix keeps its edges.
+    Bitrix2D full(70, 3);
+    full.Clear(true);
+    full.Erode(2);
+    REQUIRE(full.Count() == 70 * 3);
+}
+
+TEST_CASE(Bitrix2D_Step) {
+    // A blinker turns over and back.
+    Bitrix2D blinker(5, 5);
+    blinker.Set(1, 2, true);
+    blinker.Set(2, 2, true);
+    blinker.Set(3, 2, true);
+
+    Bitrix2D next = blinker;
+    next.Step(Bitrix2D::k_LifeBirth, Bitrix2D::k_LifeSurvive);
+    REQUIRE(next.Count() == 3);
+    REQUIRE(next.Get(2, 1) && next.Get(2, 2) && next.Get(2, 3));
+
+    next.Step(Bitrix2D::k_LifeBirth, Bitrix2D::k_LifeSurvive);
+    REQUIRE(next == blinker);
+
+    // Random generations against counting every neighbor, with rows that cross words.
+    Bitrix2D matrix = RandomMatrix(300, 300, 3, 11);
+
+    for (u32 generation = 0; generation < 4; generation++) {
+        Bitrix2D expected(300, 300);
+
+        for (i32 y = 0; y < 300; y++) {
+            for (i32 x = 0; x < 300; x++) {
+                u32 neighbors = 0;
+
+                for (i32 ny = y - 1; ny <= y + 1; ny++)
+                    for (i32 nx = x - 1; nx <= x + 1; nx++)
+                        if ((nx != x || ny != y) && nx >= 0 && ny >= 0 && nx < 300 && ny < 300)
+                            neighbors += matrix.Get(nx, ny);
+
+                const u16 rule = matrix.Get(x, y) ? Bitrix2D::k_LifeSurvive : Bitrix2D::k_LifeBirth;
+                expected.Set(x, y, (rule >> neighbors) & 1);
+            }
+        }
+
+        matrix.Step(Bitrix2D::k_LifeBirth, Bitrix2D::k_LifeSurvive, generation % 2 == 0 ? 1 : 4);
+        REQUIRE(matrix == expected);
+    }
+
+    // A rule with births from no neighbors still leaves the bits past the width clear.
+    Bitrix2D seeds(70, 2);
+    seeds.Step(1, 0);
+    REQUIRE(seeds.Count() == 70 * 2);
+}
+
+TEST_CASE(Bitrix2D_Allocator_Policy) {
+    // The default policy is stateless, the matrix is its two sizes, its row words and its words.
+    static_assert(sizeof(Bitrix2D) == 2 * sizeof(sizet) + sizeof(u64*));
+
+    LinearAllocator linear;
+    linear.Init(omega(1));
+
+    {
+        using LinearBitrix2D = BasicBitrix2D<AllocatorRef<LinearAllocator>>;
+
+        LinearBitrix2D matrix(200, 100, &linear);
+        REQUIRE(matrix.GetAllocator().Get() == &linear);
+        REQUIRE(linear.AllocatedSize() >= matrix.WordsPerRow() * matrix.Height() * sizeof(u64));
+
+        matrix.Set(5, 5, true);
+        matrix.Set(6, 5, true);
+
+        // Results and copies allocate from the same allocator.
+        const sizet before = linear.AllocatedSize();
+
+        LinearBitrix2D filled = matrix.FloodFill(5, 5);
+        REQUIRE(filled.GetAllocator().Get() == &linear);
+        REQUIRE(filled.Count() == 2);
+        REQUIRE(linear.AllocatedSize() > before);
+
+        LinearBitrix2D copy(matrix);
+        REQUIRE(copy == matrix);
+        REQUIRE(copy.GetAllocator().Get() == &linear);
+    }
+
+    linear.Shutdown();
+}
@@ -3,7 +3,11 @@
 #include "./Base/Tests.hpp"
 
 // std
+#include <ratio>
 #include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 TEST_CASE(DynamicArray_Default_Constructor) {
     DynamicArray<int> arr;
@@ -92,6 +96,25 @@ TEST_CASE(DynamicArray_Resize_Function) {
     REQUIRE(arr.Capacity() == 10);  // Capacity should increase
 }
 
+TEST_CASE(DynamicArray_PushBack_Function) {
+    DynamicArray<int> ints;
+    for (int i = 0; i < 1000; i++)
+        ints.PushBack(i);
+
+    REQUIRE(ints.Size() == 1000);
+    REQUIRE(ints.Capacity() >= 1000);
+
+    for (int i = 0; i < 1000; i++)
+        REQUIRE(ints[i] == i);
+
+    DynamicArray<std::string> strings;
+    for (int i = 0; i < 100; i++)
+        strings.PushBack(std::to_string(i));
+
+    for (int i = 0; i < 100; i++)
+        REQUIRE(strings[i] == std::to_string(i));
+}
+
 TEST_CASE(DynamicArray_Clear_Function) {
     DynamicArray<int> arr(5);
 
@@ -166,3 +189,255 @@ TEST_CASE(DynamicArray_Print_Function) {
 
     REQUIRE(oss.str() == "{ 1, 2, 3 }");
 }
+
+/**
+ * @brief Counts the live instances, so tests can check that every constructed element is destroyed once.
+ */
+struct LifetimeCounter {
+    static inline i32 s_Live = 0;
+
+    int value;
+
+    LifetimeCounter(int v) : value(v) { s_Live++; }
+    LifetimeCounter(const LifetimeCounter& other) : value(other.value) { s_Live++; }
+    LifetimeCounter(LifetimeCounter&& other) : value(other.value) { other.value = -1; s_Live++; }
+    ~LifetimeCounter() { s_Live--; }
+
+    LifetimeCounter& operator = (const LifetimeCounter& other) = default;
+    LifetimeCounter& operator = (LifetimeCounter&& other) = default;
+
+    b8 operator == (const LifetimeCounter& other) const { return this->value == other.value; }
+
+};  // LifetimeCounter
+
+TEST_CASE(DynamicArray_Large_Sizes) {
+    DynamicArray<u32> arr;
+
+    for (u32 i = 0; i < 200000; i++)
+        arr.PushBack(i);
+
+    REQUIRE(arr.Size() == 200000);
+    REQUIRE(arr[70000] == 70000);
+    REQUIRE(arr.Back() == 199999);
+}
+
+TEST_CASE(DynamicArray_Reserve_And_ShrinkToFit) {
+    DynamicArray<int> arr;
+
+    arr.Reserve(100);
+    REQUIRE(arr.Capacity() == 100);
+
+    const int* data = arr.Data();
+    for (int i = 0; i < 100; i++)
+        arr.PushBack(i);
+
+    REQUIRE(arr.Data() == data);  // No growth within the reserved space.
+
+    arr.Erase(10, 100);
+    REQUIRE(arr.Size() == 10);
+    REQUIRE(arr.Capacity() == 100);
+
+    arr.ShrinkToFit();
+    REQUIRE(arr.Capacity() == 10);
+    REQUIRE(arr[9] == 9);
+
+    arr.Clear();
+    arr.ShrinkToFit();
+    REQUIRE(arr.Capacity() == 0);
+    REQUIRE(arr.Data() == nullptr);
+}
+
+TEST_CASE(DynamicArray_Growth_Factor) {
+    DynamicArray<int> arr;
+
+    arr.Reserve(100);
+
+    for (int i = 0; i < 101; i++)
+        arr.PushBack(i);
+
+    REQUIRE(arr.Capacity() == 200);
+
+    DynamicArray<int, MallocPolicy, std::ratio<3, 2>> slow;
+
+    slow.Reserve(100);
+
+    for (int i = 0; i < 101; i++)
+        slow.PushBack(i);
+
+    REQUIRE(slow.Capacity() == 150);
+
+    // The factor is part of the type, so it costs no space.
+    static_assert(sizeof(slow) == sizeof(arr));
+}
+
+TEST_CASE(DynamicArray_Layout) {
+    // No vtable and no storage for a stateless policy, only the pointer, the size and the capacity.
+    static_assert(!std::is_polymorphic_v<DynamicArray<u32>>);
+    static_assert(sizeof(DynamicArray<u32>) == sizeof(u32*) + 2 * sizeof(sizet));
+    static_assert(sizeof(DynamicArray<std::string>) == sizeof(DynamicArray<u32>));
+
+    // A stateful policy adds its own state and nothing else.
+    static_assert(sizeof(DynamicArray<u32, AllocatorRef<LinearAllocator>>) == sizeof(DynamicArray<u32>) + sizeof(LinearAllocator*));
+
+    // The same footprint as a std::vector.
+    REQUIRE(sizeof(DynamicArray<u32>) == sizeof(std::vector<u32>));
+}
+
+TEST_CASE(DynamicArray_Element_Lifetimes) {
+    LifetimeCounter::s_Live = 0;
+
+    {
+        DynamicArray<LifetimeCounter> arr;
+
+        for (int i = 0; i < 100; i++)
+            arr.EmplaceBack(i);
+
+        REQUIRE(LifetimeCounter::s_Live == 100);
+
+        arr.Erase(10, 20);
+        arr.Erase(0);
+        arr.PopBack();
+        REQUIRE(LifetimeCounter::s_Live == 88);
+        REQUIRE(arr[0].value == 1);
+        REQUIRE(arr[9].value == 20);
+
+        arr.Emplace(5, 500);
+        REQUIRE(arr[5].value == 500);
+        REQUIRE(arr[6].value == 6);
+
+        // Pushing a copy of an element while the array grows must not read the moved-from element.
+        //
+        arr.ShrinkToFit();
+        arr.PushBack(arr[0]);
+        REQUIRE(arr.Back().value == 1);
+
+        DynamicArray<LifetimeCounter> copy(arr);
+        REQUIRE(LifetimeCounter::s_Live == 2 * static_cast<i32>(arr.Size()));
+
+        copy = std::move(arr);
+        REQUIRE(LifetimeCounter::s_Live == static_cast<i32>(copy.Size()));
+
+        copy.Resize(10);
+        REQUIRE(LifetimeCounter::s_Live == 10);
+    }
+
+    REQUIRE(LifetimeCounter::s_Live == 0);
+}
+
+TEST_CASE(DynamicArray_Relocates_Smart_Pointers) {
+    REQUIRE(IsTriviallyRelocatable_v<Ref<int>>);
+    REQUIRE(!IsTriviallyRelocatable_v<LifetimeCounter>);
+
+    Ref<int> shared = MakeRef<int>(7);
+
+    {
+        DynamicArray<Ref<int>> arr;
+
+        for (int i = 0; i < 1000; i++)
+            arr.PushBack(shared);
+
+        REQUIRE(shared.use_count() == 1001);
+
+        arr.Erase(0, 500);
+        REQUIRE(shared.use_count() == 501);
+        REQUIRE(*arr[499] == 7);
+    }
+
+    REQUIRE(shared.use_count() == 1);
+}
+
+TEST_CASE(DynamicArray_Linear_Allocator_Policy) {
+    LinearAllocator linear;
+    linear.Init(omega(4));
+
+    {
+        DynamicArray<u32, AllocatorRef<LinearAllocator>> arr(&linear);
+
+        for (u32 i = 0; i < 100; i++)
+            arr.PushBack(i);
+
+        REQUIRE(arr.Size() == 100);
+        REQUIRE(arr.GetAllocator().Get() == &linear);
+        REQUIRE(arr[99] == 99);
+
+        // Every byte of the array came from the linear allocator.
+        REQUIRE(linear.AllocatedSize() >= arr.Capacity() * sizeof(u32));
+
+        DynamicArray<u32, AllocatorRef<LinearAllocator>> copy(arr);
+
+        REQUIRE(copy.GetAllocator() == arr.GetAllocator());
+        REQUIRE(copy[50] == 50);
+    }
+
+    linear.Shutdown();
+}
+
+TEST_CASE(DynamicArray_Pool_Allocator_Policy) {
+    PoolAllocator pool;
+    pool.Init(16 * sizeof(u32), 8, alignof(u32));
+
+    {
+        DynamicArray<u32, AllocatorRef<PoolAllocator>> first(16, &pool);
+        DynamicArray<u32, AllocatorRef<PoolAllocator>> second(16, &pool);
+
+        for (u32 i = 0; i < 16; i++) {
+            first.PushBack(i);
+            second.PushBack(i * 2);
+        }
+
+        REQUIRE(first.Data() != second.Data());
+        REQUIRE(first[15] == 15);
+        REQUIRE(second[15] == 30);
+
+        first = std::move(second);
+
+        REQUIRE(first[15] == 30);
+        REQUIRE(second.Data() == nullptr);
+    }
+
+    pool.Shutdown();
+}
+
+TEST_CASE(DynamicArray_Policy_Equality) {
+    REQUIRE(MallocPolicy() == MallocPolicy());
+    REQUIRE(SystemPolicy() == SystemPolicy());
+
+    LinearAllocator a, b;
+
+    REQUIRE(AllocatorRef<LinearAllocator>(&a) == AllocatorRef<LinearAllocator>(&a));
+    REQUIRE(AllocatorRef<LinearAllocator>(&a) != AllocatorRef<LinearAllocator>(&b));
+
+    // The default policy is stateless, so a DynamicArray gains no size from it.
+    REQUIRE(sizeof(MallocPolicy) == 1);
+}
+
+TEST_CASE(DynamicArray_Over_Aligned_Elements) {
+    struct alignas(64) CacheLine {
+        u32 value;
+
+    };  // CacheLine
+
+    DynamicArray<DynamicArray<CacheLine>> arrays(200);
+
+    for (u32 i = 0; i < 200; i++) {
+        arrays.EmplaceBack();
+
+        // Growing past the first capacity reallocates, which must keep the alignment as well.
+        for (u32 j = 0; j < 20; j++)
+            arrays[i].PushBack(CacheLine { i + j });
+
+        REQUIRE(reinterpret_cast<uintptr_t>(arrays[i].Data()) % 64 == 0);
+        REQUIRE(arrays[i][19].value == i + 19);
+    }
+
+    // The malloc fallback of the policy keeps over aligned memory aligned too.
+    MallocPolicy policy;
+
+    void* block = policy.Allocate(100, 256);
+    REQUIRE(reinterpret_cast<uintptr_t>(block) % 256 == 0);
+
+    block = policy.Reallocate(block, 100, 5000, 256);
+    REQUIRE(reinterpret_cast<uintptr_t>(block) % 256 == 0);
+
+    policy.Deallocate(block);
+}
@@ -0,0 +1,89 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <memory>
+#include <sstream>
+#include <type_traits>
+
+// The elements are stored inline, so the array is exactly the size of a plain array and copies like one.
+static_assert(sizeof(FixedArray<int, 4>) == sizeof(int[4]));
+static_assert(alignof(FixedArray<double, 3>) == alignof(double));
+static_assert(std::is_trivially_copyable_v<FixedArray<int, 4>>);
+static_assert(std::is_trivially_destructible_v<FixedArray<int, 4>>);
+
+// The Container base is empty and literal, it keeps all of the above.
+static_assert(std::is_base_of_v<Container<FixedArray<int, 4>>, FixedArray<int, 4>>);
+static_assert(!std::is_polymorphic_v<FixedArray<int, 4>>);
+
+static constexpr FixedArray<int, 4> MakeSquares() {
+    FixedArray<int, 4> arr;
+
+    for (sizet i = 0; i < arr.Size(); i++)
+        arr[i] = static_cast<int>(i * i);
+
+    return arr;
+}
+
+static constexpr int Sum(const FixedArray<int, 4>& arr) {
+    int sum = 0;
+
+    for (int value : arr)
+        sum += value;
+
+    return sum;
+}
+
+TEST_CASE(FixedArray_Constexpr) {
+    constexpr FixedArray<int, 4> squares = MakeSquares();
+    constexpr FixedArray<int, 4> partial { 1, 2 };
+
+    static_assert(squares[3] == 9);
+    static_assert(squares.At(2) == 4);
+    static_assert(Sum(squares) == 14);
+    static_assert(partial.Back() == 0);
+    static_assert(partial != squares);
+    static_assert(partial == FixedArray<int, 4>{ 1, 2, 0, 0 });
+
+    REQUIRE(Sum(squares) == 14);
+}
+
+TEST_CASE(FixedArray_Initializer_List) {
+    FixedArray<int, 3> full { 1, 2, 3 };
+    FixedArray<int, 3> partial { 7 };
+
+    REQUIRE(full.Front() == 1);
+    REQUIRE(full.Back() == 3);
+    REQUIRE(partial[0] == 7);
+    REQUIRE(partial[2] == 0);
+
+    REQUIRE_THROW_AS((FixedArray<int, 2>{ 1, 2, 3 }), Ocean::Exception);
+    REQUIRE_THROW_AS(full.At(3), Ocean::Exception);
+}
+
+TEST_CASE(FixedArray_Copy_And_Move) {
+    FixedArray<std::shared_ptr<int>, 2> arr { std::make_shared<int>(1), std::make_shared<int>(2) };
+
+    FixedArray<std::shared_ptr<int>, 2> copy(arr);
+    REQUIRE(copy == arr);
+    REQUIRE(copy.Data() != arr.Data());
+    REQUIRE(arr[0].use_count() == 2);
+
+    FixedArray<std::shared_ptr<int>, 2> moved(std::move(copy));
+    REQUIRE(*moved[1] == 2);
+    REQUIRE(copy[1] == nullptr);
+    REQUIRE(arr[1].use_count() == 2);
+
+    moved.Fill(nullptr);
+    REQUIRE(arr[0].use_count() == 1);
+}
+
+TEST_CASE(FixedArray_Print_Function) {
+    FixedArray<int, 3> arr { 1, 2, 3 };
+
+    std::ostringstream oss;
+    oss << arr;
+
+    REQUIRE(oss.str() == "{ 1, 2, 3 }");
+}
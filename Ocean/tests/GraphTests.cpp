@@ -0,0 +1,300 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <algorithm>
+#include <queue>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Random edges between the given number of vertices, with repeats and self loops.
+ */
+static std::vector<GraphEdge> RandomEdges(u32 vertices, sizet count, u64 seed) {
+    std::mt19937_64 random(seed);
+    std::vector<GraphEdge> edges(count);
+
+    for (GraphEdge& edge : edges)
+        edge = { static_cast<u32>(random() % vertices), static_cast<u32>(random() % vertices) };
+
+    return edges;
+}
+
+/**
+ * @brief The distances of a plain queue based breadth first search over an edge list.
+ */
+static std::vector<u32> ReferenceDistances(u32 vertices, const std::vector<GraphEdge>& edges, u32 source) {
+    std::vector<std::vector<u32>> adjacency(vertices);
+    for (const GraphEdge& edge : edges)
+        adjacency[edge.from].push_back(edge.to);
+
+    std::vector<u32> distances(vertices, CsrGraph<>::k_Unreached);
+    std::queue<u32> queue;
+
+    distances[source] = 0;
+    queue.push(source);
+
+    while (!queue.empty()) {
+        const u32 vertex = queue.front();
+        queue.pop();
+
+        for (u32 target : adjacency[vertex]) {
+            if (distances[target] == CsrGraph<>::k_Unreached) {
+                distances[target] = distances[vertex] + 1;
+                queue.push(target);
+            }
+        }
+    }
+
+    return distances;
+}
+
+/**
+ * @brief Checks that an order places every edge's start before its end.
+ */
+template <class A>
+static b8 RespectsEdges(const DynamicArray<u32, A>& order, u32 vertices, const std::vector<GraphEdge>& edges) {
+    std::vector<u32> position(vertices);
+    for (sizet i = 0; i < order.Size(); i++)
+        position[order[i]] = static_cast<u32>(i);
+
+    for (const GraphEdge& edge : edges)
+        if (position[edge.from] >= position[edge.to])
+            return false;
+
+    return true;
+}
+
+TEST_CASE(CsrGraph_Build_And_Edit) {
+    // The Graph base has no vtable, a graph is only its own members.
+    static_assert(!std::is_polymorphic_v<CsrGraph<>>);
+    static_assert(!std::is_polymorphic_v<BitrixGraph<>>);
+    static_assert(sizeof(CsrGraph<>) == sizeof(void*) + 2 * sizeof(DynamicArray<u32>));
+
+    const std::vector<GraphEdge> edges = { { 0, 2 }, { 0, 1 }, { 2, 3 }, { 0, 2 }, { 3, 0 } };
+
+    CsrGraph<> graph(4, edges.data(), edges.size());
+
+    // The repeated edge is kept once and neighbors come out sorted.
+    REQUIRE(graph.VertexCount() == 4);
+    REQUIRE(graph.EdgeCount() == 4);
+    REQUIRE(graph.Degree(0) == 2);
+    REQUIRE(*graph.NeighborsOf(0).Begin() == 1);
+    REQUIRE(graph.IsAdjacent(0, 2));
+    REQUIRE(!graph.IsAdjacent(2, 0));
+    REQUIRE(graph.NeighborsOf(1).Empty());
+
+    graph.AddEdge(1, 3);
+    graph.AddEdge(1, 3);
+    graph.AddEdge(0, 0);
+    REQUIRE(graph.EdgeCount() == 6);
+    REQUIRE(graph.IsAdjacent(1, 3));
+    REQUIRE(graph.IsAdjacent(0, 0));
+    REQUIRE(graph.IsAdjacent(3, 0));
+
+    graph.RemoveEdge(0, 2);
+    graph.RemoveEdge(0, 2);
+    REQUIRE(graph.EdgeCount() == 5);
+    REQUIRE(!graph.IsAdjacent(0, 2));
+    REQUIRE(graph.IsAdjacent(2, 3));
+
+    REQUIRE(graph.AddVertices(2) == 4);
+    graph.AddEdge(5, 4);
+    REQUIRE(graph.IsAdjacent(5, 4));
+    REQUIRE(graph.Degree(4) == 0);
+
+    REQUIRE_THROW_AS(graph.AddEdge(0, 6), Ocean::Exception);
+    REQUIRE_THROW_AS(graph.IsAdjacent(6, 0), Ocean::Exception);
+
+    const GraphEdge bad = { 0, 9 };
+    REQUIRE_THROW_AS(CsrGraph<>(4, &bad, 1), Ocean::Exception);
+
+    CsrGraph<> copy(graph);
+    REQUIRE(copy == graph);
+    copy.RemoveEdge(0, 1);
+    REQUIRE(copy != graph);
+    copy.AddEdge(0, 1);
+    REQUIRE(copy == graph);
+
+    CsrGraph<> moved(std::move(graph));
+    REQUIRE(moved.EdgeCount() == 6);
+    REQUIRE(graph.VertexCount() == 0);
+    REQUIRE(graph.EdgeCount() == 0);
+    REQUIRE(moved != graph);
+}
+
+TEST_CASE(BitrixGraph_Edit_And_Resize) {
+    BitrixGraph<> graph(70);
+
+    graph.AddEdge(0, 69);
+    graph.AddEdge(69, 0);
+    graph.AddEdge(69, 0);
+    graph.AddEdge(3, 64);
+    graph.AddEdge(3, 5);
+
+    REQUIRE(graph.EdgeCount() == 4);
+    REQUIRE(graph.WordsPerRow() == 2);
+    REQUIRE(graph.IsAdjacent(0, 69));
+    REQUIRE(!graph.IsAdjacent(69, 69));
+    REQUIRE(graph.Degree(3) == 2);
+
+    std::vector<u32> neighbors;
+    graph.ForEachNeighbor(3, [&](u32 target) { neighbors.push_back(target); });
+    REQUIRE(neighbors == std::vector<u32>({ 5, 64 }));
+
+    graph.RemoveEdge(3, 5);
+    graph.RemoveEdge(3, 5);
+    REQUIRE(graph.EdgeCount() == 3);
+
+    // Shrinking drops the edges to and from the removed vertices.
+    graph.Resize(65);
+    REQUIRE(graph.VertexCount() == 65);
+    REQUIRE(graph.EdgeCount() == 1);
+    REQUIRE(graph.IsAdjacent(3, 64));
+    REQUIRE_THROW_AS(graph.IsAdjacent(0, 69), Ocean::Exception);
+
+    graph.Resize(200);
+    REQUIRE(graph.EdgeCount() == 1);
+    REQUIRE(graph.IsAdjacent(3, 64));
+    REQUIRE(!graph.IsAdjacent(0, 69));
+    REQUIRE_THROW_AS(graph.Resize(u16_max + 1), Ocean::Exception);
+
+    BitrixGraph<> copy(graph);
+    REQUIRE(copy == graph);
+    copy.AddEdge(199, 199);
+    REQUIRE(copy != graph);
+    REQUIRE(copy.EdgeCount() == 2);
+    REQUIRE(graph.EdgeCount() == 1);
+
+    graph = std::move(copy);
+    REQUIRE(graph.IsAdjacent(199, 199));
+    REQUIRE(copy.VertexCount() == 0);
+}
+
+TEST_CASE(Graph_Breadth_First_Matches_Reference) {
+    // Small graphs stay on one thread, the large ones split their levels.
+    struct Case {
+        u32 vertices;
+        sizet edges;
+    };
+
+    for (const Case& test : { Case{ 1, 0 }, Case{ 100, 150 }, Case{ 3000, 20000 } }) {
+        const std::vector<GraphEdge> edges = RandomEdges(test.vertices, test.edges, test.vertices);
+        const std::vector<u32> expected = ReferenceDistances(test.vertices, edges, 0);
+
+        CsrGraph<> csr(test.vertices, edges.data(), edges.size());
+        BitrixGraph<> bitrix(test.vertices);
+
+        for (const GraphEdge& edge : edges)
+            bitrix.AddEdge(edge.from, edge.to);
+
+        REQUIRE(csr.EdgeCount() == bitrix.EdgeCount());
+
+        for (u32 threads : { 1u, 4u }) {
+            const DynamicArray<u32> fromCsr = csr.BreadthFirst(0, threads);
+            const DynamicArray<u32> fromBitrix = bitrix.BreadthFirst(0, threads);
+
+            REQUIRE(fromCsr.Size() == test.vertices);
+            REQUIRE(fromBitrix.Size() == test.vertices);
+
+            for (u32 v = 0; v < test.vertices; v++) {
+                REQUIRE(fromCsr[v] == expected[v]);
+                REQUIRE(fromBitrix[v] == expected[v]);
+            }
+        }
+    }
+
+    // A large sparse graph whose levels are spread over the threads.
+    const u32 vertices = 200000;
+    const std::vector<GraphEdge> edges = RandomEdges(vertices, 1000000, 3);
+    const std::vector<u32> expected = ReferenceDistances(vertices, edges, 7);
+
+    CsrGraph<> csr(vertices, edges.data(), edges.size());
+    const DynamicArray<u32> distances = csr.BreadthFirst(7, 4);
+
+    for (u32 v = 0; v < vertices; v++)
+        REQUIRE(distances[v] == expected[v]);
+}
+
+TEST_CASE(Graph_Topological_Sort) {
+    // A random DAG, every edge goes from a lower to a higher vertex before the vertices are shuffled.
+    const u32 vertices = 500;
+    std::mt19937 random(9);
+
+    std::vector<u32> names(vertices);
+    for (u32 v = 0; v < vertices; v++)
+        names[v] = v;
+
+    std::shuffle(names.begin(), names.end(), random);
+
+    std::vector<GraphEdge> edges;
+    for (u32 i = 0; i < 3000; i++) {
+        const u32 a = random() % vertices;
+        const u32 b = random() % vertices;
+
+        if (a != b)
+            edges.push_back({ names[std::min(a, b)], names[std::max(a, b)] });
+    }
+
+    CsrGraph<> csr(vertices, edges.data(), edges.size());
+    BitrixGraph<> bitrix(vertices);
+
+    for (const GraphEdge& edge : edges)
+        bitrix.AddEdge(edge.from, edge.to);
+
+    DynamicArray<u32> order;
+
+    REQUIRE(csr.TopologicalSort(order));
+    REQUIRE(order.Size() == vertices);
+    REQUIRE(RespectsEdges(order, vertices, edges));
+
+    REQUIRE(bitrix.TopologicalSort(order));
+    REQUIRE(order.Size() == vertices);
+    REQUIRE(RespectsEdges(order, vertices, edges));
+
+    // Closing a cycle leaves the vertices on it unordered.
+    csr.AddEdge(order.Back(), order.Front());
+    bitrix.AddEdge(order.Back(), order.Front());
+
+    REQUIRE(!csr.TopologicalSort(order));
+    REQUIRE(order.Size() < vertices);
+    REQUIRE(!bitrix.TopologicalSort(order));
+    REQUIRE(order.Size() < vertices);
+}
+
+TEST_CASE(BitrixGraph_Transitive_Closure) {
+    const u32 vertices = 150;
+    const std::vector<GraphEdge> edges = RandomEdges(vertices, 160, 21);
+
+    BitrixGraph<> graph(vertices);
+    for (const GraphEdge& edge : edges)
+        graph.AddEdge(edge.from, edge.to);
+
+    const BitrixGraph<> closure = graph.TransitiveClosure();
+
+    sizet reachable = 0;
+
+    // A vertex reaches another by one or more edges, so it reaches itself only through a cycle.
+    for (u32 from = 0; from < vertices; from++) {
+        const DynamicArray<u32> distances = graph.BreadthFirst(from);
+
+        b8 onCycle = false;
+        graph.ForEachNeighbor(from, [&](u32 target) {
+            const DynamicArray<u32> back = graph.BreadthFirst(target);
+
+            onCycle = onCycle || back[from] != BitrixGraph<>::k_Unreached;
+        });
+
+        for (u32 to = 0; to < vertices; to++) {
+            const b8 expected = to == from ? onCycle : distances[to] != BitrixGraph<>::k_Unreached;
+
+            REQUIRE(closure.IsAdjacent(from, to) == expected);
+
+            reachable += expected;
+        }
+    }
+
+    REQUIRE(closure.EdgeCount() == reachable);
+}
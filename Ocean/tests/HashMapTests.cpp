@@ -0,0 +1,189 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+TEST_CASE(HashMap_Insert_And_Find) {
+    HashMap<u32, u32> map;
+
+    REQUIRE(map.Empty());
+    REQUIRE(map.Find(1) == map.End());
+
+    for (u32 i = 0; i < 1000; i++)
+        REQUIRE(map.Insert(i, i * 3).second);
+
+    REQUIRE(map.Size() == 1000);
+    REQUIRE(map.Capacity() >= 1000);
+
+    // A duplicate key keeps its value.
+    REQUIRE(!map.Insert(10, 0).second);
+    REQUIRE(map.At(10) == 30);
+
+    for (u32 i = 0; i < 1000; i++) {
+        REQUIRE(map.Contains(i));
+        REQUIRE(map.Find(i)->value == i * 3);
+    }
+
+    REQUIRE(!map.Contains(1000));
+    REQUIRE_THROW_AS(map.At(1000), Ocean::Exception);
+
+    map[1000] += 5;
+    REQUIRE(map.At(1000) == 5);
+
+    map.InsertOrAssign(1000u, 7u);
+    REQUIRE(map.At(1000) == 7);
+}
+
+TEST_CASE(HashMap_Iterates_Dense_Entries) {
+    HashMap<u32, u32> map;
+
+    for (u32 i = 0; i < 64; i++)
+        map[i] = i;
+
+    // Entries are stored in insertion order.
+    u32 expected = 0;
+    for (const auto& entry : map) {
+        REQUIRE(entry.key == expected);
+        REQUIRE(entry.value == expected);
+
+        expected++;
+    }
+
+    REQUIRE(map.End() - map.Begin() == 64);
+
+    // Erasing while iterating visits every remaining entry once.
+    u32 visited = 0;
+    for (auto it = map.Begin(); it != map.End(); ) {
+        if ((*it).key % 2 == 0)
+            it = map.Erase(it);
+        else
+            ++it;
+
+        visited++;
+    }
+
+    REQUIRE(visited == 64);
+    REQUIRE(map.Size() == 32);
+
+    for (u32 i = 0; i < 64; i++)
+        REQUIRE(map.Contains(i) == (i % 2 == 1));
+}
+
+TEST_CASE(HashMap_Matches_Std_Unordered_Map) {
+    HashMap<u64, u64> map;
+    std::unordered_map<u64, u64> reference;
+
+    std::mt19937_64 random(7);
+
+    // A small key range keeps the table busy with inserts and erases of the same keys, leaving deleted slots behind.
+    for (u32 i = 0; i < 200000; i++) {
+        const u64 key = random() % 4096;
+
+        switch (random() % 3) {
+            case 0:
+                REQUIRE(map.Insert(key, i).second == reference.insert({ key, i }).second);
+                break;
+
+            case 1:
+                REQUIRE(map.Erase(key) == (reference.erase(key) == 1));
+                break;
+
+            case 2:
+                REQUIRE(map.Contains(key) == (reference.count(key) == 1));
+                break;
+        }
+    }
+
+    REQUIRE(map.Size() == reference.size());
+
+    for (const auto& entry : map)
+        REQUIRE(reference.at(entry.key) == entry.value);
+}
+
+TEST_CASE(HashMap_Heterogeneous_Lookup) {
+    HashMap<std::string, u32> map;
+
+    map["texture"] = 1;
+    map[std::string("shader")] = 2;
+    map.Emplace(std::string_view("font"), 3u);
+
+    const char* name = "shader";
+    const std::string_view view("font");
+
+    REQUIRE(map.At(name) == 2);
+    REQUIRE(map.Find(view)->value == 3);
+    REQUIRE(map.Contains("texture"));
+
+    // The lookup compares contents, not pointers.
+    const std::string copy("texture");
+    REQUIRE(map.At(copy.c_str()) == 1);
+
+    REQUIRE(map.Erase("texture"));
+    REQUIRE(!map.Contains(copy));
+
+    // Indexing with an lvalue string does not move from it.
+    std::string key("mesh");
+    map[key] = 4;
+    REQUIRE(key == "mesh");
+    REQUIRE(map.At("mesh") == 4);
+}
+
+TEST_CASE(HashMap_Copy_And_Move) {
+    HashMap<std::string, std::shared_ptr<u32>> map;
+
+    for (u32 i = 0; i < 100; i++)
+        map.Emplace(std::to_string(i), std::make_shared<u32>(i));
+
+    HashMap<std::string, std::shared_ptr<u32>> copy(map);
+    REQUIRE(copy.Size() == 100);
+    REQUIRE(*copy.At("42") == 42);
+    REQUIRE(copy.At("42").use_count() == 2);
+
+    HashMap<std::string, std::shared_ptr<u32>> moved(std::move(copy));
+    REQUIRE(copy.Empty());
+    REQUIRE(moved.At("42").use_count() == 2);
+
+    moved.Erase("42");
+    REQUIRE(map.At("42").use_count() == 1);
+
+    copy = moved;
+    REQUIRE(copy.Size() == 99);
+
+    map = std::move(moved);
+    REQUIRE(map.Size() == 99);
+    REQUIRE(!map.Contains("42"));
+
+    map.Clear();
+    REQUIRE(map.Empty());
+    REQUIRE(!map.Contains("1"));
+    REQUIRE(copy.At("1").use_count() == 1);
+}
+
+TEST_CASE(HashMap_Allocator_Policy) {
+    LinearAllocator linear;
+    linear.Init(omega(4));
+
+    {
+        HashMap<u32, u32, Hash<u32>, EqualTo<u32>, AllocatorRef<LinearAllocator>> map(&linear);
+
+        map.Reserve(100);
+        const sizet reserved = linear.AllocatedSize();
+
+        REQUIRE(reserved > 0);
+
+        for (u32 i = 0; i < 100; i++)
+            map[i] = i;
+
+        // Reserve made room for every entry.
+        REQUIRE(linear.AllocatedSize() == reserved);
+        REQUIRE(map.GetAllocator().Get() == &linear);
+    }
+
+    linear.Shutdown();
+}
@@ -0,0 +1,141 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <vector>
+
+struct ReadyTag { };
+struct AllTag { };
+
+/** @brief An object that is in a list of every job and, while it waits, in a ready list. */
+struct Job : public IntrusiveListHook<AllTag>, public IntrusiveListHook<ReadyTag> {
+    u32 id;
+
+    explicit Job(u32 id) :
+        id(id)
+    { }
+
+};  // Job
+
+using AllList = IntrusiveList<Job, AllTag>;
+using ReadyList = IntrusiveList<Job, ReadyTag>;
+
+/**
+ * @brief Collects the ids of a list in order.
+ */
+template <class L>
+static std::vector<u32> Ids(const L& list) {
+    std::vector<u32> ids;
+
+    for (const Job& job : list)
+        ids.push_back(job.id);
+
+    return ids;
+}
+
+TEST_CASE(IntrusiveList_Push_Pop_Erase) {
+    std::vector<Job> jobs;
+    for (u32 i = 0; i < 6; i++)
+        jobs.emplace_back(i);
+
+    AllList list;
+    REQUIRE(list.Empty());
+    REQUIRE(list.Begin() == list.End());
+
+    list.PushBack(jobs[1]);
+    list.PushBack(jobs[2]);
+    list.PushFront(jobs[0]);
+    list.Insert(list.End(), jobs[4]);
+    list.Insert(list.IteratorTo(jobs[4]), jobs[3]);
+
+    REQUIRE(list.Size() == 5);
+    REQUIRE(Ids(list) == std::vector<u32>({ 0, 1, 2, 3, 4 }));
+    REQUIRE(list.Front().id == 0);
+    REQUIRE(list.Back().id == 4);
+
+    // Erasing by object needs no search.
+    list.Erase(jobs[2]);
+    REQUIRE(!static_cast<IntrusiveListHook<AllTag>&>(jobs[2]).IsLinked());
+    REQUIRE(Ids(list) == std::vector<u32>({ 0, 1, 3, 4 }));
+
+    REQUIRE(list.PopFront().id == 0);
+    REQUIRE(list.PopBack().id == 4);
+    REQUIRE(list.Erase(list.Begin())->id == 3);
+    REQUIRE(list.Size() == 1);
+
+    // Walking backwards from the end.
+    AllList::Iterator last = list.End();
+    REQUIRE((--last)->id == 3);
+
+    list.Clear();
+    REQUIRE(list.Empty());
+    REQUIRE_THROW_AS(list.PopFront(), Ocean::Exception);
+    REQUIRE_THROW_AS(list.PopBack(), Ocean::Exception);
+}
+
+TEST_CASE(IntrusiveList_Object_In_Two_Lists) {
+    std::vector<Job> jobs;
+    for (u32 i = 0; i < 4; i++)
+        jobs.emplace_back(i);
+
+    AllList all;
+    ReadyList ready;
+
+    for (Job& job : jobs)
+        all.PushBack(job);
+
+    ready.PushBack(jobs[3]);
+    ready.PushBack(jobs[1]);
+
+    REQUIRE(Ids(all) == std::vector<u32>({ 0, 1, 2, 3 }));
+    REQUIRE(Ids(ready) == std::vector<u32>({ 3, 1 }));
+
+    // Leaving one list does not touch the other.
+    ready.Erase(jobs[3]);
+    REQUIRE(Ids(ready) == std::vector<u32>({ 1 }));
+    REQUIRE(all.Size() == 4);
+
+    ready.Clear();
+    all.Clear();
+}
+
+TEST_CASE(IntrusiveList_Splice_And_Move) {
+    std::vector<Job> jobs;
+    for (u32 i = 0; i < 6; i++)
+        jobs.emplace_back(i);
+
+    AllList a;
+    AllList b;
+
+    for (u32 i = 0; i < 3; i++)
+        a.PushBack(jobs[i]);
+    for (u32 i = 3; i < 6; i++)
+        b.PushBack(jobs[i]);
+
+    a.Splice(a.IteratorTo(jobs[1]), b);
+    REQUIRE(Ids(a) == std::vector<u32>({ 0, 3, 4, 5, 1, 2 }));
+    REQUIRE(a.Size() == 6);
+    REQUIRE(b.Empty());
+
+    // One object moved to the front of another list, and within the same list.
+    b.Splice(b.End(), a, jobs[4]);
+    REQUIRE(Ids(b) == std::vector<u32>({ 4 }));
+    REQUIRE(a.Size() == 5);
+
+    a.Splice(a.Begin(), a, jobs[2]);
+    REQUIRE(Ids(a) == std::vector<u32>({ 2, 0, 3, 5, 1 }));
+
+    // Moving the list relinks the objects to the new sentinel.
+    AllList moved(std::move(a));
+    REQUIRE(a.Empty());
+    REQUIRE(Ids(moved) == std::vector<u32>({ 2, 0, 3, 5, 1 }));
+    REQUIRE((--moved.End())->id == 1);
+
+    a = std::move(b);
+    REQUIRE(Ids(a) == std::vector<u32>({ 4 }));
+
+    // Copies of a linked object start unlinked.
+    const Job copy = jobs[0];
+    REQUIRE(!static_cast<const IntrusiveListHook<AllTag>&>(copy).IsLinked());
+}
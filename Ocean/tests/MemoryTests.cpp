@@ -0,0 +1,746 @@
+#include <Ocean/Ocean.hpp>
+#include <Ocean/Primitives/StdAllocator.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <thread>
+#include <vector>
+
+TEST_CASE(HeapAllocator_Small_Allocations_Are_Aligned) {
+    HeapAllocator heap;
+    heap.Init(omega(1));
+
+    for (sizet size = 1; size <= HeapAllocator::k_MaxCachedSize; size += 7) {
+        void* ptr = heap.Allocate(size, 1);
+
+        REQUIRE(ptr != nullptr);
+        REQUIRE(oAlignmentOffset(HeapAllocator::k_CacheAlignment, ptr) == 0);
+
+        heap.Deallocate(ptr);
+    }
+
+    heap.Shutdown();
+}
+
+TEST_CASE(HeapAllocator_Large_Alignment) {
+    HeapAllocator heap;
+    heap.Init(omega(1));
+
+    void* ptr = heap.Allocate(32, 256);
+
+    REQUIRE(ptr != nullptr);
+    REQUIRE(oAlignmentOffset(256, ptr) == 0);
+
+    heap.Deallocate(ptr);
+    heap.Shutdown();
+}
+
+TEST_CASE(HeapAllocator_Thread_Cache_Reuses_Blocks) {
+    HeapAllocator heap;
+    heap.Init(omega(1));
+
+    void* first = heap.Allocate(64, 16);
+    heap.Deallocate(first);
+
+    // The freed block sits on top of the calling thread's magazine.
+    void* second = heap.Allocate(64, 16);
+    REQUIRE(first == second);
+
+    heap.Deallocate(second);
+    heap.Shutdown();
+}
+
+TEST_CASE(HeapAllocator_Shutdown_Drains_Other_Threads) {
+    HeapAllocator heap;
+    heap.Init(omega(1));
+
+    std::atomic<b8> cached(false);
+    std::atomic<b8> shutdown(false);
+
+    // The worker's freed blocks stay in its magazine while it is alive, Shutdown has to take them back itself.
+    std::thread worker([&]() {
+        for (u32 i = 0; i < 16; i++)
+            heap.Deallocate(heap.Allocate(64, 16));
+
+        cached = true;
+
+        while (!shutdown)
+            std::this_thread::yield();
+    });
+
+    while (!cached)
+        std::this_thread::yield();
+
+    REQUIRE(heap.AllocatedSize() > 0);
+
+    heap.Shutdown();
+    REQUIRE(heap.AllocatedSize() == 0);
+
+    // The worker's cache is stale now, exiting must not touch the unmapped pools.
+    shutdown = true;
+    worker.join();
+}
+
+TEST_CASE(HeapAllocator_Without_Thread_Cache) {
+    HeapAllocator heap;
+    heap.Init(omega(1), false);
+
+    void* ptr = heap.Allocate(64, 16);
+    REQUIRE(ptr != nullptr);
+
+    memset(ptr, 0xAB, 64);
+
+    heap.Deallocate(ptr);
+    heap.Shutdown();
+}
+
+TEST_CASE(HeapAllocator_Multithreaded_Allocations) {
+    HeapAllocator heap;
+    heap.Init(omega(16));
+
+    std::vector<std::thread> threads;
+
+    for (u32 t = 0; t < 4; t++) {
+        threads.emplace_back([&heap, t]() {
+            std::vector<u8*> blocks;
+
+            for (u32 i = 0; i < 4096; i++) {
+                const sizet size = 8 + (i * 13 + t) % 1500;
+                u8* block = static_cast<u8*>(heap.Allocate(size, 16));
+
+                REQUIRE(block != nullptr);
+
+                block[0] = static_cast<u8>(t);
+                block[size - 1] = static_cast<u8>(t);
+                blocks.push_back(block);
+
+                if (i % 3 == 0) {
+                    REQUIRE(blocks.front()[0] == t);
+
+                    heap.Deallocate(blocks.front());
+                    blocks.erase(blocks.begin());
+                }
+            }
+
+            for (u8* block : blocks) {
+                REQUIRE(block[0] == t);
+
+                heap.Deallocate(block);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    heap.Shutdown();
+}
+
+TEST_CASE(HeapAllocator_Grows_And_Releases_Pools) {
+    HeapAllocator heap;
+    heap.Init(okilo(64), false, okilo(64));
+
+    REQUIRE(heap.PoolCount() == 1);
+
+    std::vector<void*> blocks;
+    for (u32 i = 0; i < 16; i++) {
+        void* block = heap.Allocate(okilo(16), 16);
+        REQUIRE(block != nullptr);
+
+        memset(block, 0xCD, okilo(16));
+        blocks.push_back(block);
+    }
+
+    REQUIRE(heap.PoolCount() > 1);
+
+    for (void* block : blocks)
+        heap.Deallocate(block);
+
+    // The initial pool and one spare are kept once everything is freed.
+    REQUIRE(heap.PoolCount() == 2);
+    REQUIRE(heap.AllocatedSize() == 0);
+
+    // Churn past the initial pool reuses the spare instead of mapping a pool every cycle.
+    const sizet totalSize = heap.TotalSize();
+
+    for (u32 cycle = 0; cycle < 8; cycle++) {
+        for (void*& block : blocks)
+            block = heap.Allocate(okilo(16), 16);
+
+        REQUIRE(heap.PoolCount() > 2);
+
+        for (void* block : blocks)
+            heap.Deallocate(block);
+
+        REQUIRE(heap.PoolCount() == 2);
+        REQUIRE(heap.TotalSize() == totalSize);
+    }
+
+    heap.Shutdown();
+}
+
+TEST_CASE(HeapAllocator_Direct_Mapping) {
+    HeapAllocator heap;
+    heap.Init(okilo(64), true, 0, omega(1));
+
+    const sizet totalSize = heap.TotalSize();
+
+    u8* block = static_cast<u8*>(heap.Allocate(omega(4), 64));
+    REQUIRE(block != nullptr);
+    REQUIRE(oAlignmentOffset(64, block) == 0);
+    REQUIRE(heap.PoolCount() == 1);
+    REQUIRE(heap.TotalSize() > totalSize + omega(4) - 1);
+
+    block[0] = 1;
+    block[omega(4) - 1] = 2;
+
+    // Goes through the thread cache path before being unmapped.
+    heap.Deallocate(block);
+    REQUIRE(heap.TotalSize() == totalSize);
+    REQUIRE(heap.AllocatedSize() == 0);
+
+    heap.Shutdown();
+}
+
+TEST_CASE(HeapAllocator_Reallocate) {
+    HeapAllocator heap;
+    heap.Init(omega(1), false);
+
+    // The rest of the pool is free after the first block, so it grows in place.
+    u8* a = static_cast<u8*>(heap.Allocate(2048, 8));
+    memset(a, 0xAB, 2048);
+
+    u8* grown = static_cast<u8*>(heap.Reallocate(a, 2048, 8192, 8));
+    REQUIRE(grown == a);
+    REQUIRE(heap.BlockSize(grown) >= 8192);
+
+    // A block right behind it forces a move that keeps the contents.
+    void* b = heap.Allocate(64, 8);
+    u8* moved = static_cast<u8*>(heap.Reallocate(grown, 8192, 16384, 8));
+    REQUIRE(moved != nullptr);
+    REQUIRE(moved[0] == 0xAB && moved[2047] == 0xAB);
+
+    // Larger alignments than TLSF's own are kept, even when the block moves.
+    void* c = heap.Allocate(100, 64);
+    void* d = heap.Allocate(64, 8);
+    void* aligned = heap.Reallocate(c, 100, 4096, 64);
+    REQUIRE(oAlignmentOffset(64, aligned) == 0);
+
+    // Shrinking keeps the block.
+    REQUIRE(heap.Reallocate(moved, 16384, 100, 8) == moved);
+
+    heap.Deallocate(moved);
+    heap.Deallocate(aligned);
+    heap.Deallocate(b);
+    heap.Deallocate(d);
+
+    REQUIRE(heap.AllocatedSize() == 0);
+
+    heap.Shutdown();
+}
+
+TEST_CASE(HeapAllocator_Reallocate_Cached_And_Direct) {
+    HeapAllocator heap;
+    heap.Init(omega(1), true, 0, okilo(64));
+
+    // A cached block grows out of its size class and back into the pools.
+    u32* values = static_cast<u32*>(heap.Allocate(16 * sizeof(u32), alignof(u32)));
+    for (u32 i = 0; i < 16; i++)
+        values[i] = i;
+
+    values = static_cast<u32*>(heap.Reallocate(values, 16 * sizeof(u32), 1024 * sizeof(u32), alignof(u32)));
+    for (u32 i = 0; i < 16; i++)
+        REQUIRE(values[i] == i);
+
+    // Growing past the direct map threshold moves the block into its own mapping.
+    values = static_cast<u32*>(heap.Reallocate(values, 1024 * sizeof(u32), okilo(32) * sizeof(u32), alignof(u32)));
+    for (u32 i = 0; i < 16; i++)
+        REQUIRE(values[i] == i);
+
+    REQUIRE(heap.TotalSize() > omega(1) + okilo(64));
+
+    heap.Deallocate(values);
+    heap.FlushThreadCache();
+
+    REQUIRE(heap.AllocatedSize() == 0);
+
+    heap.Shutdown();
+}
+
+TEST_CASE(LinearAllocator_Reallocate_In_Place) {
+    LinearAllocator linear;
+    linear.Init(256);
+
+    u8* a = static_cast<u8*>(linear.Allocate(16, 8));
+    REQUIRE(linear.Reallocate(a, 16, 64, 8) == a);
+    REQUIRE(linear.AllocatedSize() == 64);
+
+    // Only the last allocation can grow in place.
+    u8* b = static_cast<u8*>(linear.Allocate(8, 8));
+    u8* c = static_cast<u8*>(linear.Reallocate(a, 64, 96, 8));
+    REQUIRE(c != a);
+    REQUIRE(c >= b + 8);
+
+    linear.Shutdown();
+}
+
+TEST_CASE(MallocAllocator_Reallocate) {
+    MallocAllocator allocator;
+
+    u32* values = static_cast<u32*>(allocator.Reallocate(nullptr, 0, 4 * sizeof(u32), alignof(u32)));
+    for (u32 i = 0; i < 4; i++)
+        values[i] = i;
+
+    values = static_cast<u32*>(allocator.Reallocate(values, 4 * sizeof(u32), 4096 * sizeof(u32), alignof(u32)));
+    for (u32 i = 0; i < 4; i++)
+        REQUIRE(values[i] == i);
+
+    REQUIRE(allocator.Reallocate(values, 4096 * sizeof(u32), 0, alignof(u32)) == nullptr);
+}
+
+static u32 s_BudgetCalls[2] = { };
+
+static void CountBudgetCalls(MemoryTag tag, MemoryBudgetLevel level, sizet liveBytes, sizet budget) {
+    REQUIRE(tag == MEMORY_TAG_AUDIO);
+    REQUIRE(liveBytes >= budget);
+
+    s_BudgetCalls[level]++;
+}
+
+TEST_CASE(TaggedAllocator_Live_And_Peak_Bytes) {
+    HeapAllocator heap;
+    heap.Init(omega(1));
+
+    TaggedAllocator tagged;
+    tagged.Init(&heap, MEMORY_TAG_RENDERER);
+
+    void* a = tagged.Allocate(100, 16);
+    void* b = tagged.Allocate(300, 16);
+
+    REQUIRE(tagged.LiveBytes() == heap.BlockSize(a) + heap.BlockSize(b));
+    REQUIRE(tagged.LiveBytes() >= 400);
+
+    const sizet peak = tagged.LiveBytes();
+    tagged.Deallocate(b);
+
+    REQUIRE(tagged.LiveBytes() == heap.BlockSize(a));
+    REQUIRE(tagged.PeakBytes() == peak);
+
+    tagged.ResetPeak();
+    REQUIRE(tagged.PeakBytes() == tagged.LiveBytes());
+
+    tagged.Deallocate(a);
+    REQUIRE(tagged.LiveBytes() == 0);
+
+    heap.Shutdown();
+}
+
+TEST_CASE(TaggedAllocator_Budgets) {
+    HeapAllocator heap;
+    heap.Init(omega(1));
+
+    MemoryBudget budget;
+    budget.Soft = 1000;
+    budget.Hard = 2000;
+
+    TaggedAllocator tagged;
+    tagged.Init(&heap, MEMORY_TAG_AUDIO, budget, CountBudgetCalls);
+
+    s_BudgetCalls[MEMORY_BUDGET_SOFT] = s_BudgetCalls[MEMORY_BUDGET_HARD] = 0;
+
+    void* a = tagged.Allocate(512, 16);
+    REQUIRE(s_BudgetCalls[MEMORY_BUDGET_SOFT] == 0);
+
+    // Crossing the soft budget only notifies once.
+    void* b = tagged.Allocate(512, 16);
+    void* c = tagged.Allocate(128, 16);
+    REQUIRE(b != nullptr);
+    REQUIRE(c != nullptr);
+    REQUIRE(s_BudgetCalls[MEMORY_BUDGET_SOFT] == 1);
+
+    // Crossing the hard budget fails the allocation and leaves the counters untouched.
+    const sizet live = tagged.LiveBytes();
+    REQUIRE(tagged.Allocate(1024, 16) == nullptr);
+    REQUIRE(s_BudgetCalls[MEMORY_BUDGET_HARD] == 1);
+    REQUIRE(tagged.LiveBytes() == live);
+
+    tagged.Deallocate(a);
+    tagged.Deallocate(b);
+    tagged.Deallocate(c);
+
+    REQUIRE(tagged.LiveBytes() == 0);
+
+    heap.Shutdown();
+}
+
+TEST_CASE(TaggedAllocator_Reallocate) {
+    HeapAllocator heap;
+    heap.Init(omega(1));
+
+    MemoryBudget budget;
+    budget.Hard = 4096;
+
+    TaggedAllocator tagged;
+    tagged.Init(&heap, MEMORY_TAG_AUDIO, budget, CountBudgetCalls);
+
+    s_BudgetCalls[MEMORY_BUDGET_SOFT] = s_BudgetCalls[MEMORY_BUDGET_HARD] = 0;
+
+    void* a = tagged.Allocate(64, 8);
+    a = tagged.Reallocate(a, 64, 2048, 8);
+
+    REQUIRE(a != nullptr);
+    REQUIRE(tagged.LiveBytes() == heap.BlockSize(a));
+    REQUIRE(tagged.PeakBytes() == tagged.LiveBytes());
+
+    // Growing past the hard budget fails and keeps the old block.
+    REQUIRE(tagged.Reallocate(a, 2048, 8192, 8) == nullptr);
+    REQUIRE(s_BudgetCalls[MEMORY_BUDGET_HARD] == 1);
+    REQUIRE(tagged.LiveBytes() == heap.BlockSize(a));
+
+    tagged.Deallocate(a);
+    REQUIRE(tagged.LiveBytes() == 0);
+
+    heap.Shutdown();
+}
+
+TEST_CASE(MemoryService_Tag_Allocators) {
+    MemoryServiceConfig config;
+    config.MaxDynamicSize = omega(1);
+    config.Budgets[MEMORY_TAG_AUDIO].Hard = okilo(4);
+    config.BudgetCallback = CountBudgetCalls;
+
+    MemoryService::Instance().Init(&config);
+
+    TaggedAllocator* audio = oTagAllocator(MEMORY_TAG_AUDIO);
+    TaggedAllocator* resources = oTagAllocator(MEMORY_TAG_RESOURCES);
+
+    REQUIRE(audio->Tag() == MEMORY_TAG_AUDIO);
+    REQUIRE(audio->Budget().Hard == okilo(4));
+
+    u8* small = oallocat(u8, 256, audio);
+    REQUIRE(small != nullptr);
+    REQUIRE(oallocat(u8, okilo(8), audio) == nullptr);
+
+    // Budgets are per tag.
+    u8* large = oallocat(u8, okilo(8), resources);
+    REQUIRE(large != nullptr);
+    REQUIRE(resources->LiveBytes() >= okilo(8));
+    REQUIRE(audio->LiveBytes() < okilo(4));
+
+    ofree(small, audio);
+    ofree(large, resources);
+
+    MemoryService::Shutdown();
+}
+
+TEST_CASE(PoolAllocator_Allocate_Deallocate) {
+    PoolAllocator pool;
+    pool.Init(24, 4);
+
+    void* a = pool.Allocate(24, 8);
+    void* b = pool.Allocate(16, 8);
+
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(a != b);
+    REQUIRE(oAlignmentOffset(OC_CACHE_LINE_SIZE, a) == 0);
+    REQUIRE(oAlignmentOffset(OC_CACHE_LINE_SIZE, b) == 0);
+    REQUIRE(pool.AllocatedBlocks() == 2);
+
+    // The most recently freed block is handed out first.
+    pool.Deallocate(a);
+    REQUIRE(pool.Allocate(24, 8) == a);
+
+    pool.Shutdown();
+}
+
+TEST_CASE(PoolAllocator_Growth) {
+    PoolAllocator pool;
+    pool.Init(sizeof(u64), 8, alignof(u64), true);
+
+    std::vector<u64*> blocks;
+    for (u32 i = 0; i < 100; i++) {
+        u64* block = oallocat(u64, 1, &pool);
+
+        REQUIRE(block != nullptr);
+
+        *block = i;
+        blocks.push_back(block);
+    }
+
+    REQUIRE(pool.Capacity() >= 100);
+
+    for (u32 i = 0; i < 100; i++)
+        REQUIRE(*blocks[i] == i);
+
+    for (u64* block : blocks)
+        ofree(block, &pool);
+
+    REQUIRE(pool.AllocatedBlocks() == 0);
+
+    pool.Shutdown();
+}
+
+TEST_CASE(PoolAllocator_Reset) {
+    PoolAllocator pool;
+    pool.Init(32, 4, 16, true);
+
+    void* first = pool.Allocate(32, 16);
+    for (u32 i = 0; i < 10; i++)
+        pool.Allocate(32, 16);
+
+    const sizet capacity = pool.Capacity();
+    pool.Reset();
+
+    REQUIRE(pool.AllocatedBlocks() == 0);
+    REQUIRE(pool.Allocate(32, 16) == first);
+
+    // Reset keeps the chunks, so refilling the pool does not grow it.
+    for (u32 i = 0; i < 10; i++)
+        pool.Allocate(32, 16);
+
+    REQUIRE(pool.Capacity() == capacity);
+
+    pool.Shutdown();
+}
+
+TEST_CASE(OceanStdAllocator_Routes_Containers) {
+    PoolAllocator pool;
+    pool.Init(64, 32, 16, true);
+
+    {
+        std::vector<u32, OceanStdAllocator<u32>> values{ OceanStdAllocator<u32>(&pool) };
+        values.reserve(8);
+
+        REQUIRE(pool.AllocatedBlocks() == 1);
+
+        using Map = std::map<u32, u32, std::less<u32>, OceanStdAllocator<std::pair<const u32, u32>>>;
+
+        Map map{ std::less<u32>(), OceanStdAllocator<std::pair<const u32, u32>>(&pool) };
+        for (u32 i = 0; i < 16; i++)
+            map[i] = i * 2;
+
+        REQUIRE(pool.AllocatedBlocks() == 17);
+        REQUIRE(map[7] == 14);
+
+        // Copies keep the source container's allocator.
+        Map copy(map);
+        REQUIRE(copy.get_allocator() == map.get_allocator());
+        REQUIRE(pool.AllocatedBlocks() == 33);
+    }
+
+    REQUIRE(pool.AllocatedBlocks() == 0);
+
+    pool.Shutdown();
+}
+
+TEST_CASE(OceanStdAllocator_Equality) {
+    PoolAllocator a;
+    a.Init(32, 4);
+    PoolAllocator b;
+    b.Init(32, 4);
+
+    REQUIRE(OceanStdAllocator<u32>(&a) == OceanStdAllocator<u64>(&a));
+    REQUIRE(OceanStdAllocator<u32>(&a) != OceanStdAllocator<u32>(&b));
+
+    a.Shutdown();
+    b.Shutdown();
+}
+
+TEST_CASE(LinearAllocator_Allocations_Do_Not_Overlap) {
+    LinearAllocator linear;
+    linear.Init(256);
+
+    u8* a = static_cast<u8*>(linear.Allocate(3, 1));
+    u64* b = static_cast<u64*>(linear.Allocate(sizeof(u64), alignof(u64)));
+
+    REQUIRE(b != nullptr);
+    REQUIRE(reinterpret_cast<u8*>(b) >= a + 3);
+    REQUIRE(oAlignmentOffset(alignof(u64), b) == 0);
+    REQUIRE(linear.AllocatedSize() == 16);
+
+    linear.Clear();
+    REQUIRE(linear.Allocate(3, 1) == a);
+
+    linear.Shutdown();
+}
+
+TEST_CASE(StackAllocator_Allocate_And_Markers) {
+    StackAllocator stack;
+    stack.Init(256);
+
+    u8* a = static_cast<u8*>(stack.Allocate(3, 1));
+    u64* b = static_cast<u64*>(stack.Allocate(sizeof(u64), alignof(u64)));
+
+    REQUIRE(reinterpret_cast<u8*>(b) >= a + 3);
+    REQUIRE(oAlignmentOffset(alignof(u64), b) == 0);
+
+    const sizet marker = stack.GetMarker();
+    stack.Allocate(64, 16);
+    stack.FreeMarker(marker);
+    REQUIRE(stack.GetMarker() == marker);
+
+    // A marker above the top frees nothing.
+    stack.FreeMarker(marker + 32);
+    REQUIRE(stack.GetMarker() == marker);
+
+    // Deallocate pops everything from the pointer on.
+    stack.Deallocate(b);
+    REQUIRE(stack.GetMarker() == static_cast<sizet>(reinterpret_cast<u8*>(b) - a));
+
+    // The top allocation is resized in place, anything below it is copied to the top.
+    u8* c = static_cast<u8*>(stack.Allocate(16, 1));
+    REQUIRE(stack.Reallocate(c, 16, 100, 1) == c);
+    REQUIRE(stack.GetMarker() == static_cast<sizet>(c + 100 - a));
+
+    REQUIRE(stack.Reallocate(a, 3, 8, 1) == c + 100);
+
+    stack.Shutdown();
+}
+
+TEST_CASE(DoubleStackAllocator_Both_Ends) {
+    DoubleStackAllocator stack;
+    stack.Init(256);
+
+    u8* bottom = static_cast<u8*>(stack.AllocateBottom(10, 1));
+    u64* top = static_cast<u64*>(stack.AllocateTop(20, alignof(u64)));
+
+    REQUIRE(oAlignmentOffset(alignof(u64), top) == 0);
+    REQUIRE(reinterpret_cast<u8*>(top) + 20 <= bottom + 256);
+    REQUIRE(reinterpret_cast<u8*>(top) >= bottom + 10);
+
+    // As a plain Allocator it allocates from the bottom.
+    u8* generic = static_cast<u8*>(stack.Allocate(16, 16));
+    REQUIRE(generic >= bottom + 10);
+    REQUIRE(stack.GetBottomMarker() == static_cast<sizet>(generic + 16 - bottom));
+
+    const sizet topMarker = stack.GetTopMarker();
+    stack.AllocateTop(8, 8);
+    stack.FreeTopMarker(topMarker);
+    REQUIRE(stack.GetTopMarker() == topMarker);
+
+    stack.ClearTop();
+    stack.ClearBottom();
+    REQUIRE(stack.GetTopMarker() == 256);
+    REQUIRE(stack.GetBottomMarker() == 0);
+
+    stack.Shutdown();
+}
+
+TEST_CASE(ScopedArena_Rewinds_Stack) {
+    StackAllocator stack;
+    stack.Init(okilo(4));
+
+    stack.Allocate(16, 16);
+    const sizet marker = stack.GetMarker();
+
+    {
+        ScopedArena outer(&stack);
+        outer.Allocate(100, 16);
+
+        {
+            ScopedArena inner(&stack);
+            void* ptr = inner.Allocate(200, 16);
+
+            // Deallocate leaves the memory to the scope.
+            inner.Deallocate(ptr);
+            REQUIRE(stack.GetMarker() >= marker + 300);
+        }
+
+        REQUIRE(stack.GetMarker() < marker + 300);
+        REQUIRE(stack.GetMarker() >= marker + 100);
+    }
+
+    REQUIRE(stack.GetMarker() == marker);
+
+    stack.Shutdown();
+}
+
+TEST_CASE(ScopedArena_As_Allocator) {
+    DoubleStackAllocator stack;
+    stack.Init(okilo(64));
+
+    {
+        ScopedArena bottom(&stack, false);
+        ScopedArena top(&stack, true);
+
+        std::vector<u32, OceanStdAllocator<u32>> values{ OceanStdAllocator<u32>(&bottom) };
+        for (u32 i = 0; i < 1000; i++)
+            values.push_back(i);
+
+        u32* path = static_cast<u32*>(top.Allocate(64 * sizeof(u32), alignof(u32)));
+        path = static_cast<u32*>(top.Reallocate(path, 64 * sizeof(u32), 128 * sizeof(u32), alignof(u32)));
+
+        REQUIRE(path != nullptr);
+        REQUIRE(values[999] == 999);
+        REQUIRE(stack.GetBottomMarker() >= 1000 * sizeof(u32));
+        REQUIRE(stack.GetTopMarker() <= okilo(64) - 128 * sizeof(u32));
+    }
+
+    REQUIRE(stack.GetBottomMarker() == 0);
+    REQUIRE(stack.GetTopMarker() == okilo(64));
+
+    stack.Shutdown();
+}
+
+TEST_CASE(MemoryService_Scratch_Stack_Per_Thread) {
+    StackAllocator* mainStack = oScratchStack;
+    REQUIRE(mainStack == oScratchStack);
+    REQUIRE(mainStack->TotalSize() > 0);
+
+    StackAllocator* workerStack = nullptr;
+    std::thread worker([&workerStack]() {
+        ScopedArena scratch(oScratchStack);
+        scratch.Allocate(128, 16);
+
+        workerStack = oScratchStack;
+    });
+    worker.join();
+
+    REQUIRE(workerStack != mainStack);
+
+    {
+        ScopedArena scratch(mainStack);
+        REQUIRE(scratch.Allocate(64, 16) != nullptr);
+    }
+
+    REQUIRE(mainStack->AllocatedSize() == 0);
+}
+
+TEST_CASE(MemoryService_Frame_Allocator) {
+    MemoryServiceConfig config;
+    config.MaxDynamicSize = omega(1);
+    config.FrameAllocatorSize = okilo(64);
+    config.FrameBufferCount = 2;
+
+    // Ending a frame before Init has no arenas to cycle and does nothing.
+    MemoryService::Instance().EndFrame();
+    REQUIRE(MemoryService::Instance().FrameHighWaterMark() == 0);
+
+    MemoryService::Instance().Init(&config);
+
+    u32* first = oallocat(u32, 100, oFrameAllocator);
+    REQUIRE(first != nullptr);
+    first[99] = 7;
+
+    MemoryService::Instance().EndFrame();
+    REQUIRE(MemoryService::Instance().FrameHighWaterMark() == sizeof(u32) * 100);
+
+    // With two buffers the previous frame's memory is still intact.
+    u32* second = oallocat(u32, 10, oFrameAllocator);
+    REQUIRE(second != first);
+    REQUIRE(first[99] == 7);
+
+    MemoryService::Instance().EndFrame();
+    REQUIRE(MemoryService::Instance().FrameHighWaterMark() == sizeof(u32) * 10);
+    REQUIRE(MemoryService::Instance().PeakFrameHighWaterMark() == sizeof(u32) * 100);
+
+    // The first arena has been reset and is reused.
+    REQUIRE(oallocat(u32, 1, oFrameAllocator) == first);
+
+    MemoryService::Shutdown();
+}
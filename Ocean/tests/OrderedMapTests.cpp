@@ -0,0 +1,270 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <algorithm>
+#include <forward_list>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** @brief A small fanout so that a few hundred keys already build a tree several levels deep. */
+template <class K, class T>
+using SmallOrderedMap = OrderedMap<K, T, std::less<K>, MallocPolicy, 4>;
+
+TEST_CASE(OrderedMap_Insert_And_Find) {
+    OrderedMap<u32, u32> map;
+
+    REQUIRE(map.Empty());
+    REQUIRE(map.Find(1) == map.End());
+    REQUIRE(map.Begin() == map.End());
+
+    // Inserting in reverse order splits at the front of the leaves.
+    for (u32 i = 1000; i-- > 0; )
+        REQUIRE(map.Insert(i, i * 3).second);
+
+    REQUIRE(map.Size() == 1000);
+    REQUIRE(map.Height() > 0);
+
+    // A duplicate key keeps its value.
+    REQUIRE(!map.Insert(10, 0).second);
+    REQUIRE(map.At(10) == 30);
+
+    for (u32 i = 0; i < 1000; i++) {
+        REQUIRE(map.Contains(i));
+        REQUIRE(map.Find(i)->value == i * 3);
+    }
+
+    REQUIRE(!map.Contains(1000));
+    REQUIRE_THROW_AS(map.At(1000), Ocean::Exception);
+
+    map[1000] += 5;
+    REQUIRE(map.At(1000) == 5);
+
+    map.InsertOrAssign(1000u, 7u);
+    REQUIRE(map.At(1000) == 7);
+}
+
+TEST_CASE(OrderedMap_Iterates_In_Key_Order) {
+    SmallOrderedMap<u32, u32> map;
+
+    std::mt19937 random(3);
+    std::vector<u32> keys(500);
+
+    for (u32 i = 0; i < 500; i++)
+        keys[i] = i * 2;
+
+    std::shuffle(keys.begin(), keys.end(), random);
+
+    for (u32 key : keys)
+        map[key] = key + 1;
+
+    u32 expected = 0;
+    for (const auto& entry : map) {
+        REQUIRE(entry.key == expected);
+        REQUIRE(entry.value == expected + 1);
+
+        expected += 2;
+    }
+
+    REQUIRE(expected == 1000);
+
+    // Walking back from the end visits the same keys in reverse.
+    auto it = map.End();
+    for (u32 i = 500; i-- > 0; ) {
+        --it;
+        REQUIRE((*it).key == i * 2);
+    }
+
+    REQUIRE(it == map.Begin());
+}
+
+TEST_CASE(OrderedMap_Bounds_And_Ranges) {
+    SmallOrderedMap<u32, u32> map;
+
+    for (u32 i = 0; i < 100; i++)
+        map[i * 10] = i;
+
+    REQUIRE(map.LowerBound(0)->key == 0);
+    REQUIRE(map.LowerBound(15)->key == 20);
+    REQUIRE(map.LowerBound(20)->key == 20);
+    REQUIRE(map.UpperBound(20)->key == 30);
+    REQUIRE(map.LowerBound(991) == map.End());
+    REQUIRE(map.UpperBound(990) == map.End());
+
+    // The range is half open, [from, to).
+    u32 count = 0;
+    u32 expected = 250;
+    for (const auto& entry : map.Range(245, 500)) {
+        REQUIRE(entry.key == expected);
+
+        expected += 10;
+        count++;
+    }
+
+    REQUIRE(count == 25);
+    REQUIRE(map.Range(500, 245).Empty());
+    REQUIRE(map.Range(241, 249).Empty());
+
+    const SmallOrderedMap<u32, u32>& view = map;
+    REQUIRE(view.LowerBound(15)->value == 2);
+    REQUIRE(!view.Range(0, 1000).Empty());
+}
+
+TEST_CASE(OrderedMap_Matches_Std_Map) {
+    SmallOrderedMap<u64, u64> map;
+    std::map<u64, u64> reference;
+
+    std::mt19937_64 random(7);
+
+    // A small key range keeps the tree splitting, borrowing and merging nodes.
+    for (u32 i = 0; i < 200000; i++) {
+        const u64 key = random() % 2048;
+
+        switch (random() % 4) {
+            case 0:
+            case 1:
+                REQUIRE(map.Insert(key, i).second == reference.insert({ key, i }).second);
+                break;
+
+            case 2:
+                REQUIRE(map.Erase(key) == (reference.erase(key) == 1));
+                break;
+
+            case 3: {
+                const auto it = map.LowerBound(key);
+                const auto expected = reference.lower_bound(key);
+
+                REQUIRE((it == map.End()) == (expected == reference.end()));
+
+                if (expected != reference.end())
+                    REQUIRE(it->key == expected->first);
+
+                break;
+            }
+        }
+    }
+
+    REQUIRE(map.Size() == reference.size());
+
+    auto expected = reference.begin();
+    for (const auto& entry : map) {
+        REQUIRE(entry.key == expected->first);
+        REQUIRE(entry.value == expected->second);
+
+        ++expected;
+    }
+
+    // Erasing everything collapses the tree.
+    for (auto it = map.Begin(); it != map.End(); )
+        it = map.Erase(it);
+
+    REQUIRE(map.Empty());
+    REQUIRE(map.Height() == 0);
+    REQUIRE(map.Begin() == map.End());
+}
+
+TEST_CASE(OrderedMap_Bulk_Load) {
+    std::vector<std::pair<u32, u32>> entries;
+
+    for (u32 i = 0; i < 1000; i++)
+        entries.push_back({ i * 3, i });
+
+    SmallOrderedMap<u32, u32> map;
+    map[1] = 1;
+
+    map.BulkLoad(entries.begin(), entries.end());
+
+    REQUIRE(map.Size() == 1000);
+    REQUIRE(!map.Contains(1));
+
+    u32 expected = 0;
+    for (const auto& entry : map) {
+        REQUIRE(entry.key == expected * 3);
+        REQUIRE(entry.value == expected);
+
+        expected++;
+    }
+
+    // A bulk loaded tree keeps working as a normal one.
+    for (u32 i = 0; i < 1000; i++) {
+        REQUIRE(map.Insert(i * 3 + 1, i).second);
+        REQUIRE(map.Erase(i * 3));
+    }
+
+    REQUIRE(map.Size() == 1000);
+    REQUIRE(map.Begin()->key == 1);
+
+    // Unsorted input is rejected and leaves the map as it was.
+    entries.push_back({ 5, 0 });
+    REQUIRE_THROW_AS(map.BulkLoad(entries.begin(), entries.end()), Ocean::Exception);
+    REQUIRE(map.Size() == 1000);
+
+    map.BulkLoad(entries.begin(), entries.begin());
+    REQUIRE(map.Empty());
+
+    // A forward iterator is enough, the input is only walked forwards.
+    std::forward_list<std::pair<u32, u32>> list = { { 1, 10 }, { 2, 20 }, { 4, 40 } };
+
+    map.BulkLoad(list.begin(), list.end());
+    REQUIRE(map.Size() == 3);
+    REQUIRE(map.At(4) == 40);
+
+    list.push_front({ 3, 30 });
+    REQUIRE_THROW_AS(map.BulkLoad(list.begin(), list.end()), Ocean::Exception);
+    REQUIRE(map.Size() == 3);
+}
+
+TEST_CASE(OrderedMap_Copy_And_Move) {
+    SmallOrderedMap<std::string, std::shared_ptr<u32>> map;
+
+    for (u32 i = 0; i < 100; i++)
+        map.Emplace(std::to_string(i), std::make_shared<u32>(i));
+
+    SmallOrderedMap<std::string, std::shared_ptr<u32>> copy(map);
+    REQUIRE(copy.Size() == 100);
+    REQUIRE(*copy.At("42") == 42);
+    REQUIRE(copy.At("42").use_count() == 2);
+
+    SmallOrderedMap<std::string, std::shared_ptr<u32>> moved(std::move(copy));
+    REQUIRE(copy.Empty());
+    REQUIRE(moved.At("42").use_count() == 2);
+
+    moved.Erase("42");
+    REQUIRE(map.At("42").use_count() == 1);
+
+    copy = moved;
+    REQUIRE(copy.Size() == 99);
+
+    map = std::move(moved);
+    REQUIRE(map.Size() == 99);
+    REQUIRE(!map.Contains("42"));
+    REQUIRE(map.Begin()->key == "0");
+
+    map.Clear();
+    REQUIRE(map.Empty());
+    REQUIRE(!map.Contains("1"));
+    REQUIRE(copy.At("1").use_count() == 1);
+}
+
+TEST_CASE(OrderedMap_Allocator_Policy) {
+    LinearAllocator linear;
+    linear.Init(omega(4));
+
+    {
+        OrderedMap<u32, u32, std::less<u32>, AllocatorRef<LinearAllocator>> map(&linear);
+
+        for (u32 i = 0; i < 100; i++)
+            map[i] = i;
+
+        REQUIRE(linear.AllocatedSize() > 0);
+        REQUIRE(map.GetAllocator().Get() == &linear);
+        REQUIRE(map.At(99) == 99);
+    }
+
+    linear.Shutdown();
+}
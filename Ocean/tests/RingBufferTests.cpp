@@ -0,0 +1,198 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST_CASE(Ring_Capacity_Is_A_Power_Of_Two) {
+    REQUIRE(SpscRing<u32>(1).Capacity() == 2);
+    REQUIRE(SpscRing<u32>(5).Capacity() == 8);
+    REQUIRE(MpmcRing<u32>(64).Capacity() == 64);
+    REQUIRE(MpmcRing<u32>(65).Capacity() == 128);
+
+    REQUIRE_THROW_AS(SpscRing<u32>(0), Ocean::Exception);
+    REQUIRE_THROW_AS(MpmcRing<u32>(0), Ocean::Exception);
+
+    static_assert(alignof(SpscRing<u32>) == OC_CACHE_LINE_SIZE, "The ring indexes sit on their own cache lines.");
+}
+
+TEST_CASE(SpscRing_Push_Pop_And_Wrap) {
+    SpscRing<u32> ring(4);
+    u32 value = 0;
+
+    REQUIRE(!ring.TryPop(value));
+
+    // Going around the ring several times keeps the order.
+    u32 next = 0;
+    u32 expected = 0;
+
+    for (u32 round = 0; round < 10; round++) {
+        while (ring.TryPush(next))
+            next++;
+
+        REQUIRE(ring.SizeApprox() == 4);
+
+        for (u32 i = 0; i < 3; i++) {
+            REQUIRE(ring.TryPop(value));
+            REQUIRE(value == expected++);
+        }
+    }
+
+    // Batches stop at the free space and at the elements available.
+    const u32 batch[8] = { 100, 101, 102, 103, 104, 105, 106, 107 };
+    REQUIRE(ring.TryPushBatch(batch, 8) == 3);
+
+    u32 out[8] = { };
+    REQUIRE(ring.TryPopBatch(out, 8) == 4);
+    REQUIRE(out[0] == expected);
+    REQUIRE(out[1] == 100);
+    REQUIRE(out[3] == 102);
+    REQUIRE(ring.EmptyApprox());
+}
+
+TEST_CASE(MpmcRing_Push_Pop_And_Wrap) {
+    MpmcRing<u32> ring(4);
+    u32 value = 0;
+
+    REQUIRE(!ring.TryPop(value));
+
+    u32 next = 0;
+    u32 expected = 0;
+
+    for (u32 round = 0; round < 10; round++) {
+        while (ring.TryPush(next))
+            next++;
+
+        REQUIRE(ring.SizeApprox() == 4);
+
+        for (u32 i = 0; i < 3; i++) {
+            REQUIRE(ring.TryPop(value));
+            REQUIRE(value == expected++);
+        }
+    }
+
+    const u32 batch[8] = { 100, 101, 102, 103, 104, 105, 106, 107 };
+    REQUIRE(ring.TryPushBatch(batch, 8) == 3);
+    REQUIRE(ring.TryPushBatch(batch, 8) == 0);
+
+    std::vector<u32> out;
+    REQUIRE(ring.TryPopBatch(std::back_inserter(out), 8) == 4);
+    REQUIRE(out[0] == expected);
+    REQUIRE(out[3] == 102);
+    REQUIRE(ring.TryPopBatch(std::back_inserter(out), 8) == 0);
+}
+
+TEST_CASE(Ring_Destroys_Remaining_Elements) {
+    const std::shared_ptr<u32> shared = std::make_shared<u32>(1);
+
+    {
+        SpscRing<std::shared_ptr<u32>> spsc(8);
+        MpmcRing<std::shared_ptr<u32>> mpmc(8);
+
+        for (u32 i = 0; i < 5; i++) {
+            spsc.TryPush(shared);
+            mpmc.TryPush(shared);
+        }
+
+        std::shared_ptr<u32> popped;
+        REQUIRE(spsc.TryPop(popped));
+        REQUIRE(mpmc.TryPop(popped));
+        REQUIRE(shared.use_count() == 10);
+    }
+
+    REQUIRE(shared.use_count() == 1);
+}
+
+TEST_CASE(SpscRing_Transfers_Between_Threads) {
+    constexpr u64 k_Count = 1000000;
+
+    SpscRing<u64> ring(1024);
+
+    std::thread producer([&]() {
+        u64 batch[16];
+        u64 next = 0;
+
+        while (next < k_Count) {
+            // Alternate single and batch pushes to exercise both paths.
+            if (next % 2 == 0) {
+                if (ring.TryPush(next))
+                    next++;
+            }
+            else {
+                const u64 count = k_Count - next < 16 ? k_Count - next : 16;
+                for (u64 i = 0; i < count; i++)
+                    batch[i] = next + i;
+
+                next += ring.TryPushBatch(batch, count);
+            }
+        }
+    });
+
+    u64 expected = 0;
+    u64 out[32];
+
+    while (expected < k_Count) {
+        const sizet popped = ring.TryPopBatch(out, 32);
+
+        for (sizet i = 0; i < popped; i++)
+            REQUIRE(out[i] == expected++);
+    }
+
+    producer.join();
+
+    REQUIRE(ring.EmptyApprox());
+}
+
+TEST_CASE(MpmcRing_Transfers_Between_Threads) {
+    constexpr u32 k_Threads = 4;
+    constexpr u64 k_PerProducer = 200000;
+
+    MpmcRing<u64> ring(256);
+
+    std::atomic<u64> consumed{ 0 };
+    std::vector<std::atomic<u8>> seen(k_Threads * k_PerProducer);
+    std::vector<std::thread> threads;
+
+    for (u32 t = 0; t < k_Threads; t++) {
+        threads.emplace_back([&, t]() {
+            for (u64 i = 0; i < k_PerProducer; ) {
+                const u64 value = t * k_PerProducer + i;
+
+                if (i % 3 == 0) {
+                    const u64 batch[2] = { value, value + 1 };
+                    i += ring.TryPushBatch(batch, i + 1 < k_PerProducer ? 2 : 1);
+                }
+                else if (ring.TryPush(value)) {
+                    i++;
+                }
+            }
+        });
+
+        threads.emplace_back([&]() {
+            u64 out[8];
+
+            while (consumed.load(std::memory_order_relaxed) < k_Threads * k_PerProducer) {
+                const sizet popped = ring.TryPopBatch(out, 8);
+
+                for (sizet i = 0; i < popped; i++)
+                    seen[out[i]].fetch_add(1, std::memory_order_relaxed);
+
+                consumed.fetch_add(popped, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    // Every value arrived exactly once.
+    for (const std::atomic<u8>& count : seen)
+        REQUIRE(count.load() == 1);
+
+    REQUIRE(ring.EmptyApprox());
+}
@@ -0,0 +1,226 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Collects the data of a list in order.
+ */
+template <class T, class A>
+static std::vector<T> Values(const SinglyLinkedList<T, A>& list) {
+    return std::vector<T>(list.Begin(), list.End());
+}
+
+/**
+ * @brief A policy that is always out of memory.
+ */
+struct FailingPolicy {
+    void* Allocate(OC_UNUSED sizet size, OC_UNUSED sizet alignment = alignof(max_align_t)) { return nullptr; }
+    void Deallocate(OC_UNUSED void* ptr) { }
+
+    b8 operator == (const FailingPolicy&) const { return true; }
+    b8 operator != (const FailingPolicy&) const { return false; }
+
+};  // FailingPolicy
+
+TEST_CASE(SinglyLinkedList_Push_Pop_And_Positions) {
+    // The List base has no vtable, the size and the empty policy share the first word.
+    static_assert(!std::is_polymorphic_v<SinglyLinkedList<int>>);
+    static_assert(!std::is_polymorphic_v<SinglyLinkedList<std::string>>);
+    static_assert(sizeof(SinglyLinkedList<int>) == 7 * sizeof(void*) + sizeof(sizet));
+
+    SinglyLinkedList<u32> list;
+
+    REQUIRE(list.Empty());
+    REQUIRE_THROW_AS(list.PopFront(), Ocean::Exception);
+    REQUIRE_THROW_AS(list.PopBack(), Ocean::Exception);
+
+    list.PushBack(1);
+    list.PushBack(2);
+    list.PushFront(0);
+    list.EmplaceBack(4u);
+    list.Insert(3, 3);
+
+    REQUIRE(list.Size() == 5);
+    REQUIRE(Values(list) == std::vector<u32>({ 0, 1, 2, 3, 4 }));
+    REQUIRE(list.Front() == 0);
+    REQUIRE(list.Back() == 4);
+    REQUIRE_THROW_AS(list.Insert(7, 0), Ocean::Exception);
+
+    list.Erase(2);
+    list.PopFront();
+    list.PopBack();
+    REQUIRE(Values(list) == std::vector<u32>({ 1, 3 }));
+    REQUIRE(list.Back() == 3);
+
+    // The tail follows erasing the last node, appending after it still works.
+    list.Erase(1);
+    list.PushBack(5);
+    REQUIRE(Values(list) == std::vector<u32>({ 1, 5 }));
+
+    SinglyLinkedList<u32>::Iterator it = list.InsertAfter(list.Begin(), 2);
+    list.EmplaceAfter(it, 3u);
+    REQUIRE(Values(list) == std::vector<u32>({ 1, 2, 3, 5 }));
+    REQUIRE(*list.EraseAfter(list.Begin()) == 3);
+    REQUIRE(Values(list) == std::vector<u32>({ 1, 3, 5 }));
+
+    // The List base emplace goes through Insert.
+    List<u32, SinglyLinkedList<u32>>& base = list;
+    base.Emplace(1, 2u);
+    REQUIRE(Values(list) == std::vector<u32>({ 1, 2, 3, 5 }));
+
+    // Inserting at the size links after the tail and moves it.
+    list.Insert(4, 6);
+    list.PushBack(7);
+    REQUIRE(Values(list) == std::vector<u32>({ 1, 2, 3, 5, 6, 7 }));
+    REQUIRE(list.Back() == 7);
+}
+
+TEST_CASE(SinglyLinkedList_Allocation_Failure) {
+    SinglyLinkedList<u32, FailingPolicy> list;
+
+    REQUIRE_THROW_AS(list.PushBack(1), Ocean::Exception);
+    REQUIRE_THROW_AS(list.Reserve(8), Ocean::Exception);
+    REQUIRE(list.Empty());
+}
+
+TEST_CASE(SinglyLinkedList_Remove_Unique_Reverse) {
+    SinglyLinkedList<std::string> list;
+
+    for (const char* word : { "a", "b", "a", "c", "b", "a" })
+        list.EmplaceBack(word);
+
+    list.Remove("b");
+    REQUIRE(Values(list) == std::vector<std::string>({ "a", "a", "c", "b", "a" }));
+
+    list.MakeUnique();
+    REQUIRE(Values(list) == std::vector<std::string>({ "a", "c", "b" }));
+
+    list.Reverse();
+    REQUIRE(Values(list) == std::vector<std::string>({ "b", "c", "a" }));
+    REQUIRE(list.Back() == "a");
+
+    list.PushBack("a");
+    list.RemoveAll(list.Back());
+    REQUIRE(Values(list) == std::vector<std::string>({ "b", "c" }));
+    REQUIRE(list.Back() == "c");
+}
+
+TEST_CASE(SinglyLinkedList_Reuses_Pooled_Nodes) {
+    LinearAllocator linear;
+    linear.Init(omega(1));
+
+    {
+        SinglyLinkedList<u64, AllocatorRef<LinearAllocator>> list(&linear);
+
+        list.Reserve(64);
+        const sizet reserved = linear.AllocatedSize();
+
+        REQUIRE(list.Capacity() == 64);
+
+        // A queue that keeps cycling nodes never goes back to the allocator.
+        for (u64 i = 0; i < 10000; i++) {
+            list.PushBack(i);
+
+            if (list.Size() == 64) {
+                while (!list.Empty())
+                    list.PopFront();
+            }
+        }
+
+        list.Clear();
+        for (u64 i = 0; i < 64; i++)
+            list.PushFront(i);
+
+        REQUIRE(linear.AllocatedSize() == reserved);
+        REQUIRE(list.Capacity() == 64);
+    }
+
+    linear.Shutdown();
+}
+
+TEST_CASE(SinglyLinkedList_Splice_Copy_Move) {
+    const std::shared_ptr<u32> shared = std::make_shared<u32>(7);
+
+    {
+        SinglyLinkedList<std::shared_ptr<u32>> a;
+        SinglyLinkedList<std::shared_ptr<u32>> b;
+
+        for (u32 i = 0; i < 3; i++)
+            a.PushBack(shared);
+        for (u32 i = 0; i < 40; i++)
+            b.PushBack(shared);
+
+        b.PopFront();
+
+        // The other list's nodes and pool are taken over, b can still grow its own pool again.
+        const sizet capacity = a.Capacity() + b.Capacity();
+
+        a.Splice(b);
+        REQUIRE(a.Size() == 42);
+        REQUIRE(b.Empty());
+        REQUIRE(b.Capacity() == 0);
+        REQUIRE(a.Capacity() == capacity);
+
+        b.PushBack(shared);
+        REQUIRE(b.Size() == 1);
+
+        a.Merge(b);
+        REQUIRE(a.Size() == 43);
+        REQUIRE(shared.use_count() == 44);
+
+        SinglyLinkedList<std::shared_ptr<u32>> copy(a);
+        REQUIRE(copy.Size() == 43);
+        REQUIRE(shared.use_count() == 87);
+        REQUIRE(copy == a);
+
+        copy.PopBack();
+        REQUIRE(copy != a);
+        copy.PushBack(shared);
+        REQUIRE(copy == a);
+
+        SinglyLinkedList<std::shared_ptr<u32>> moved(std::move(copy));
+        REQUIRE(copy.Empty());
+        REQUIRE(moved.Size() == 43);
+
+        copy = moved;
+        moved = std::move(a);
+        REQUIRE(moved.Size() == 43);
+        REQUIRE(shared.use_count() == 87);
+
+        moved.Clear();
+        REQUIRE(shared.use_count() == 44);
+    }
+
+    REQUIRE(shared.use_count() == 1);
+}
+
+TEST_CASE(SinglyLinkedList_Splice_Across_Allocators) {
+    LinearAllocator first;
+    LinearAllocator second;
+    first.Init(omega(1));
+    second.Init(omega(1));
+
+    {
+        SinglyLinkedList<u32, AllocatorRef<LinearAllocator>> a(&first);
+        SinglyLinkedList<u32, AllocatorRef<LinearAllocator>> b(&second);
+
+        a.PushBack(0);
+        b.PushBack(1);
+        b.PushBack(2);
+
+        // The pools cannot be shared, so the data is moved instead.
+        a.Splice(b);
+        REQUIRE(Values(a) == std::vector<u32>({ 0, 1, 2 }));
+        REQUIRE(b.Empty());
+        REQUIRE(b.Capacity() > 0);
+    }
+
+    second.Shutdown();
+    first.Shutdown();
+}
@@ -0,0 +1,209 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+TEST_CASE(SlotHandle_Packing) {
+    const SlotHandle32 handle(5, 3);
+
+    REQUIRE(handle.Index() == 5);
+    REQUIRE(handle.Generation() == 3);
+    REQUIRE(!handle.IsNull());
+    REQUIRE(SlotHandle32::FromValue(handle.Value()) == handle);
+    REQUIRE(SlotHandle32().IsNull());
+
+    const SlotHandle64 wide(SlotHandle64::k_MaxIndex, SlotHandle64::k_MaxGeneration);
+    REQUIRE(wide.Index() == SlotHandle64::k_MaxIndex);
+    REQUIRE(wide.Generation() == SlotHandle64::k_MaxGeneration);
+
+    static_assert(sizeof(SlotHandle32) == 4, "SlotHandle32 is a u32.");
+    static_assert(sizeof(SlotHandle64) == 8, "SlotHandle64 is a u64.");
+}
+
+TEST_CASE(SlotMap_Insert_Get_Erase) {
+    SlotMap<std::string> map;
+
+    REQUIRE(map.Empty());
+    REQUIRE(map.Get(SlotHandle32()) == nullptr);
+
+    const SlotHandle32 a = map.Insert("texture");
+    const SlotHandle32 b = map.Emplace(3, 'x');
+    const SlotHandle32 c = map.Insert(std::string("font"));
+
+    REQUIRE(map.Size() == 3);
+    REQUIRE(map.At(a) == "texture");
+    REQUIRE(map[b] == "xxx");
+    REQUIRE(*map.Get(c) == "font");
+
+    REQUIRE(map.Erase(a));
+    REQUIRE(!map.Erase(a));
+    REQUIRE(!map.Contains(a));
+    REQUIRE(map.Get(a) == nullptr);
+    REQUIRE_THROW_AS(map.At(a), Ocean::Exception);
+
+    // The other handles still resolve after the last object moved into the hole.
+    REQUIRE(map.At(b) == "xxx");
+    REQUIRE(map.At(c) == "font");
+
+    // The freed slot is reused with a new generation, the old handle stays stale.
+    const SlotHandle32 d = map.Insert("shader");
+    REQUIRE(d.Index() == a.Index());
+    REQUIRE(d.Generation() != a.Generation());
+    REQUIRE(map.Get(a) == nullptr);
+    REQUIRE(map.At(d) == "shader");
+}
+
+TEST_CASE(SlotMap_Dense_Iteration) {
+    SlotMap<u32> map;
+    std::vector<SlotHandle32> handles;
+
+    for (u32 i = 0; i < 100; i++)
+        handles.push_back(map.Insert(i));
+
+    for (u32 i = 0; i < 100; i += 2)
+        map.Erase(handles[i]);
+
+    REQUIRE(map.Size() == 50);
+    REQUIRE(map.End() - map.Begin() == 50);
+
+    u32 sum = 0;
+    for (u32 value : map) {
+        REQUIRE(value % 2 == 1);
+
+        sum += value;
+    }
+
+    REQUIRE(sum == 2500);
+
+    // HandleAt names the object at each dense index.
+    for (sizet i = 0; i < map.Size(); i++)
+        REQUIRE(&map[map.HandleAt(i)] == map.Data() + i);
+}
+
+TEST_CASE(SlotMap_Matches_Std_Unordered_Map) {
+    SlotMap<u64, SlotHandle64> map;
+    std::unordered_map<u64, u64> reference;
+    std::vector<SlotHandle64> live;
+    std::vector<SlotHandle64> dead;
+
+    std::mt19937_64 random(11);
+
+    for (u32 i = 0; i < 100000; i++) {
+        if (live.empty() || random() % 3 != 0) {
+            const SlotHandle64 handle = map.Insert(i);
+
+            reference[handle.Value()] = i;
+            live.push_back(handle);
+        }
+        else {
+            const sizet pick = random() % live.size();
+            const SlotHandle64 handle = live[pick];
+
+            REQUIRE(map.Erase(handle));
+
+            reference.erase(handle.Value());
+            live[pick] = live.back();
+            live.pop_back();
+            dead.push_back(handle);
+        }
+    }
+
+    REQUIRE(map.Size() == reference.size());
+
+    for (SlotHandle64 handle : live)
+        REQUIRE(map.At(handle) == reference.at(handle.Value()));
+
+    for (SlotHandle64 handle : dead)
+        REQUIRE(!map.Contains(handle));
+}
+
+TEST_CASE(SlotMap_Retires_Exhausted_Slots) {
+    // Two generation bits leave generations 1 to 3 for each slot.
+    using TinyHandle = SlotHandle<u8, 6>;
+
+    SlotMap<u32, TinyHandle> map;
+    std::vector<TinyHandle> handles;
+
+    for (u32 i = 0; i < 3; i++) {
+        handles.push_back(map.Insert(i));
+
+        REQUIRE(handles.back().Index() == 0);
+        REQUIRE(map.Erase(handles.back()));
+    }
+
+    // The slot ran out of generations, so a new slot is used and the old handles never resolve again.
+    const TinyHandle handle = map.Insert(7);
+    REQUIRE(handle.Index() == 1);
+
+    for (TinyHandle old : handles)
+        REQUIRE(!map.Contains(old));
+
+    map.Clear();
+    REQUIRE(map.Empty());
+    REQUIRE(!map.Contains(handle));
+    REQUIRE(map.Insert(8).Index() == 1);
+
+    // Every slot is taken or retired.
+    for (u32 i = 0; i < 62; i++)
+        map.Insert(i);
+
+    REQUIRE_THROW_AS(map.Insert(0), Ocean::Exception);
+}
+
+TEST_CASE(SlotMap_Copy_Move_And_Clear) {
+    SlotMap<std::shared_ptr<u32>> map;
+    std::vector<SlotHandle32> handles;
+
+    for (u32 i = 0; i < 10; i++)
+        handles.push_back(map.Insert(std::make_shared<u32>(i)));
+
+    SlotMap<std::shared_ptr<u32>> copy(map);
+    REQUIRE(*copy.At(handles[4]) == 4);
+    REQUIRE(copy.At(handles[4]).use_count() == 2);
+
+    SlotMap<std::shared_ptr<u32>> moved(std::move(copy));
+    REQUIRE(copy.Empty());
+    REQUIRE(!copy.Contains(handles[4]));
+    REQUIRE(moved.At(handles[4]).use_count() == 2);
+
+    // A moved from map is still usable.
+    REQUIRE(*copy.At(copy.Insert(std::make_shared<u32>(42))) == 42);
+
+    map.Clear();
+    REQUIRE(map.Empty());
+    REQUIRE(moved.At(handles[4]).use_count() == 1);
+
+    for (SlotHandle32 handle : handles)
+        REQUIRE(!map.Contains(handle));
+
+    // Cleared slots are reused from the lowest index.
+    REQUIRE(map.Insert(nullptr).Index() == 0);
+}
+
+TEST_CASE(SlotMap_Allocator_Policy) {
+    LinearAllocator linear;
+    linear.Init(omega(4));
+
+    {
+        SlotMap<u32, SlotHandle32, AllocatorRef<LinearAllocator>> map(&linear);
+
+        map.Reserve(100);
+        const sizet reserved = linear.AllocatedSize();
+
+        REQUIRE(reserved > 0);
+
+        for (u32 i = 0; i < 100; i++)
+            map.Insert(i);
+
+        REQUIRE(linear.AllocatedSize() == reserved);
+        REQUIRE(map.GetAllocator().Get() == &linear);
+    }
+
+    linear.Shutdown();
+}
@@ -0,0 +1,117 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+TEST_CASE(SmallArray_Starts_Inline) {
+    SmallArray<int, 4> arr;
+
+    REQUIRE(arr.Size() == 0);
+    REQUIRE(arr.Capacity() == 4);
+    REQUIRE(arr.IsInline());
+
+    for (int i = 0; i < 4; i++)
+        arr.PushBack(i);
+
+    REQUIRE(arr.IsInline());
+    REQUIRE(reinterpret_cast<const u8*>(arr.Data()) >= reinterpret_cast<const u8*>(&arr));
+    REQUIRE(reinterpret_cast<const u8*>(arr.Data()) < reinterpret_cast<const u8*>(&arr) + sizeof(arr));
+}
+
+TEST_CASE(SmallArray_Layout) {
+    // No vtable and no storage for a stateless policy, the inline elements follow the pointer, size and capacity.
+    static_assert(!std::is_polymorphic_v<SmallArray<u32, 4>>);
+    static_assert(sizeof(SmallArray<u32, 4>) == sizeof(u32*) + 2 * sizeof(sizet) + 4 * sizeof(u32));
+
+    SmallArray<u32, 4> arr;
+    REQUIRE(reinterpret_cast<const u8*>(arr.Data()) == reinterpret_cast<const u8*>(&arr) + 3 * sizeof(sizet));
+}
+
+TEST_CASE(SmallArray_Spills_And_Shrinks_Back) {
+    SmallArray<int, 4> arr;
+
+    for (int i = 0; i < 100; i++)
+        arr.PushBack(i);
+
+    REQUIRE(!arr.IsInline());
+    REQUIRE(arr.Size() == 100);
+    REQUIRE(arr.Capacity() >= 100);
+
+    for (int i = 0; i < 100; i++)
+        REQUIRE(arr[i] == i);
+
+    arr.Erase(3, 100);
+    arr.ShrinkToFit();
+
+    REQUIRE(arr.IsInline());
+    REQUIRE(arr.Capacity() == 4);
+    REQUIRE(arr[2] == 2);
+}
+
+TEST_CASE(SmallArray_Copy_And_Move) {
+    SmallArray<std::string, 2> small { "a", "b" };
+    SmallArray<std::string, 2> large { "a", "b", "c", "d" };
+
+    SmallArray<std::string, 2> copy(large);
+    REQUIRE(copy == large);
+    REQUIRE(copy.Data() != large.Data());
+
+    // An inline array moves element by element.
+    SmallArray<std::string, 2> movedSmall(std::move(small));
+    REQUIRE(movedSmall.IsInline());
+    REQUIRE(movedSmall[1] == "b");
+    REQUIRE(small.Empty());
+
+    // A spilled array hands over its allocation.
+    const std::string* data = large.Data();
+    SmallArray<std::string, 2> movedLarge(std::move(large));
+    REQUIRE(movedLarge.Data() == data);
+    REQUIRE(large.Empty());
+    REQUIRE(large.IsInline());
+
+    movedSmall = std::move(movedLarge);
+    REQUIRE(movedSmall.Size() == 4);
+    REQUIRE(movedSmall[3] == "d");
+
+    copy = movedSmall;
+    REQUIRE(copy == movedSmall);
+}
+
+TEST_CASE(SmallArray_Emplace_And_Erase) {
+    SmallArray<std::string, 4> arr;
+
+    arr.EmplaceBack("one");
+    arr.EmplaceBack("three");
+    arr.Emplace(1, "two");
+    arr.Emplace(0, "zero");
+
+    REQUIRE(arr.Size() == 4);
+    REQUIRE(arr[0] == "zero");
+    REQUIRE(arr[2] == "two");
+
+    // Growing while pushing one of the array's own elements.
+    arr.PushBack(arr[0]);
+    REQUIRE(!arr.IsInline());
+    REQUIRE(arr.Back() == "zero");
+
+    arr.Erase(arr.Begin());
+    REQUIRE(arr[0] == "one");
+
+    arr.PopBack();
+    REQUIRE(arr.Size() == 3);
+
+    REQUIRE_THROW_AS(arr.At(3), Ocean::Exception);
+}
+
+TEST_CASE(SmallArray_Print_Function) {
+    SmallArray<int, 2> arr { 1, 2, 3 };
+
+    std::ostringstream oss;
+    oss << arr;
+
+    REQUIRE(oss.str() == "{ 1, 2, 3 }");
+}
@@ -0,0 +1,245 @@
+#include <Ocean/Ocean.hpp>
+
+#include "./Base/Tests.hpp"
+
+// std
+#include <string>
+
+/**
+ * @brief A malloc policy that counts its allocations, to show that growth takes one allocation for every stream.
+ */
+struct CountingPolicy {
+    void* Allocate(sizet size, OC_UNUSED sizet alignment = alignof(max_align_t)) {
+        (*p_Allocations)++;
+
+        return malloc(size);
+    }
+    void Deallocate(void* ptr) {
+        (*p_Frees)++;
+
+        free(ptr);
+    }
+
+    sizet* p_Allocations;
+    sizet* p_Frees;
+
+};  // CountingPolicy
+
+TEST_CASE(SoAArray_Push_Pop_And_Fields) {
+    SoAArray<f32, u32, u8> arr;
+
+    REQUIRE(arr.Empty());
+    REQUIRE(arr.Capacity() == 0);
+
+    for (u32 i = 0; i < 100; i++)
+        arr.PushBack(static_cast<f32>(i) * 0.5f, i, static_cast<u8>(i));
+
+    REQUIRE(arr.Size() == 100);
+    REQUIRE(arr.Capacity() >= 100);
+
+    Span<f32> x = arr.Field<0>();
+    Span<const u32> ids = static_cast<const SoAArray<f32, u32, u8>&>(arr).Field<1>();
+
+    REQUIRE(x.Size() == 100);
+    REQUIRE(x.Data() == arr.Data<0>());
+
+    for (u32 i = 0; i < 100; i++) {
+        REQUIRE(x[i] == static_cast<f32>(i) * 0.5f);
+        REQUIRE(ids[i] == i);
+        REQUIRE(arr.Data<2>()[i] == static_cast<u8>(i));
+    }
+
+    arr.PopBack();
+    arr.PopBack();
+
+    REQUIRE(arr.Size() == 98);
+    REQUIRE(std::get<1>(arr.Back()) == 97);
+
+    arr.Clear();
+
+    REQUIRE(arr.Empty());
+    REQUIRE_THROW_AS(arr.PopBack(), Ocean::Exception);
+    REQUIRE_THROW_AS(arr.At(0), Ocean::Exception);
+}
+
+TEST_CASE(SoAArray_Streams_Are_Cache_Aligned) {
+    SoAArray<u8, f64, u16, u8> arr;
+
+    for (u32 capacity : { 1u, 3u, 17u, 1000u }) {
+        arr.Reserve(capacity);
+
+        REQUIRE(reinterpret_cast<uintptr_t>(arr.Data<0>()) % 64 == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(arr.Data<1>()) % 64 == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(arr.Data<2>()) % 64 == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(arr.Data<3>()) % 64 == 0);
+
+        // Streams of the same type are still separate streams.
+        REQUIRE(arr.Data<0>() != arr.Data<3>());
+    }
+}
+
+TEST_CASE(SoAArray_Element_Proxies) {
+    SoAArray<i32, std::string> arr;
+
+    arr.PushBack(1, "one");
+    arr.PushBack(2, "two");
+
+    auto [number, name] = arr[1];
+    REQUIRE(number == 2);
+    REQUIRE(name == "two");
+
+    // The proxy refers to the streams, writing through it changes the array.
+    number = 20;
+    name += "!";
+
+    REQUIRE(arr.Data<0>()[1] == 20);
+    REQUIRE(arr.Field<1>()[1] == "two!");
+
+    const SoAArray<i32, std::string>& view = arr;
+    auto [firstNumber, firstName] = view.At(0);
+    REQUIRE(firstNumber == 1);
+    REQUIRE(firstName == "one");
+
+    REQUIRE_THROW_AS(view.At(2), Ocean::Exception);
+}
+
+TEST_CASE(SoAArray_Non_Trivial_Fields) {
+    SoAArray<std::string, u32> arr;
+
+    for (u32 i = 0; i < 50; i++)
+        arr.PushBack(std::string(32, static_cast<char>('a' + i % 26)), i);
+
+    // A value referring to an element survives the growth that moves the element.
+    while (arr.Size() != arr.Capacity())
+        arr.PushBack("filler", 0u);
+
+    arr.PushBack(arr.Field<0>()[0], 1000u);
+    REQUIRE(arr.Field<0>()[arr.Size() - 1] == std::string(32, 'a'));
+
+    SoAArray<std::string, u32> copy(arr);
+    REQUIRE(copy.Size() == arr.Size());
+    REQUIRE(copy.Data<0>() != arr.Data<0>());
+    REQUIRE(copy.Field<0>()[3] == std::string(32, 'd'));
+
+    SoAArray<std::string, u32> moved(std::move(copy));
+    REQUIRE(copy.Empty());
+    REQUIRE(copy.Capacity() == 0);
+    REQUIRE(moved.Field<1>()[49] == 49);
+
+    copy = moved;
+    REQUIRE(copy.Size() == moved.Size());
+
+    moved = std::move(copy);
+    REQUIRE(moved.Field<0>()[25] == std::string(32, 'z'));
+
+    moved.ShrinkToFit();
+    REQUIRE(moved.Capacity() == moved.Size());
+    REQUIRE(moved.Field<0>()[26] == std::string(32, 'a'));
+}
+
+TEST_CASE(SoAArray_Erase) {
+    SoAArray<u32, std::string> arr;
+
+    for (u32 i = 0; i < 10; i++)
+        arr.PushBack(i, std::to_string(i));
+
+    // Erase keeps the order.
+    arr.Erase(2);
+
+    REQUIRE(arr.Size() == 9);
+    for (u32 i = 0; i < 9; i++) {
+        const u32 expected = i < 2 ? i : i + 1;
+
+        REQUIRE(arr.Field<0>()[i] == expected);
+        REQUIRE(arr.Field<1>()[i] == std::to_string(expected));
+    }
+
+    // EraseUnordered moves the last element into the gap.
+    arr.EraseUnordered(0);
+
+    REQUIRE(arr.Size() == 8);
+    REQUIRE(arr.Field<0>()[0] == 9);
+    REQUIRE(arr.Field<1>()[0] == "9");
+    REQUIRE(arr.Field<0>()[7] == 8);
+
+    arr.EraseUnordered(7);
+
+    REQUIRE(arr.Size() == 7);
+    REQUIRE(arr.Field<1>()[6] == "7");
+
+    REQUIRE_THROW_AS(arr.Erase(7), Ocean::Exception);
+    REQUIRE_THROW_AS(arr.EraseUnordered(7), Ocean::Exception);
+}
+
+TEST_CASE(SoAArray_One_Allocation_Per_Growth) {
+    sizet allocations = 0;
+    sizet frees = 0;
+
+    {
+        BasicSoAArray<CountingPolicy, f32, f32, f32, u32> arr(CountingPolicy { &allocations, &frees });
+
+        arr.Reserve(64);
+        REQUIRE(allocations == 1);
+
+        for (u32 i = 0; i < 64; i++)
+            arr.PushBack(1.0f, 2.0f, 3.0f, i);
+
+        REQUIRE(allocations == 1);
+
+        arr.PushBack(0.0f, 0.0f, 0.0f, 64u);
+
+        // Growing moves all four streams into a single new block.
+        REQUIRE(allocations == 2);
+        REQUIRE(frees == 1);
+        REQUIRE(arr.Field<3>()[63] == 63);
+    }
+
+    REQUIRE(frees == allocations);
+}
+
+TEST_CASE(SoAArray_Linear_Allocator_Policy) {
+    LinearAllocator linear;
+    linear.Init(omega(4));
+
+    {
+        BasicSoAArray<AllocatorRef<LinearAllocator>, f32, u32> arr(&linear);
+
+        for (u32 i = 0; i < 100; i++)
+            arr.PushBack(static_cast<f32>(i), i);
+
+        REQUIRE(arr.GetAllocator().Get() == &linear);
+        REQUIRE(arr.Field<1>()[99] == 99);
+
+        // Every byte of the streams came from the linear allocator.
+        REQUIRE(linear.AllocatedSize() >= arr.Capacity() * (sizeof(f32) + sizeof(u32)));
+    }
+
+    linear.Shutdown();
+}
+
+TEST_CASE(Span_Access_And_Subspan) {
+    u32 values[] = { 1, 2, 3, 4, 5 };
+    Span<u32> span(values, 5);
+
+    REQUIRE(span.Size() == 5);
+    REQUIRE(!span.Empty());
+    REQUIRE(Span<u32>().Empty());
+
+    u32 sum = 0;
+    for (u32 value : span)
+        sum += value;
+
+    REQUIRE(sum == 15);
+
+    span[0] = 10;
+    REQUIRE(values[0] == 10);
+
+    Span<const u32> view = span.Subspan(1, 3);
+    REQUIRE(view.Size() == 3);
+    REQUIRE(view[0] == 2);
+    REQUIRE(view.At(2) == 4);
+
+    REQUIRE(span.Subspan(5, 0).Empty());
+    REQUIRE_THROW_AS(span.Subspan(4, 2), Ocean::Exception);
+    REQUIRE_THROW_AS(view.At(3), Ocean::Exception);
+}